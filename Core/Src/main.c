@@ -32,7 +32,14 @@
 #include "math.h"
 #include "LCDAPI.h"
 #include "FFT.h"
+#include "bench.h"
 #include "DDS.h"
+#include "ACQ.h"
+#include "track.h"
+#include "zoom.h"
+#include "adapt.h"
+#include "decim.h"
+#include "mem_section.h"
 /* USER CODE END Includes */
 
 /* Private typedef -----------------------------------------------------------*/
@@ -42,6 +49,12 @@
 
 /* Private define ------------------------------------------------------------*/
 /* USER CODE BEGIN PD */
+#if (ACQ_CHANNELS <= 2)
+#define AN_MEM              MEM_CCM         // 分析器随工作缓冲区放入 CCM：工作缓冲区约 44.7KB（其中最小二乘工作区约 4.3KB），
+                                            // 每通道分析器约 8.1KB、抽取器约 1.1KB，2 通道合计约 63KB；4 通道时超出 64KB，分析器留在 SRAM
+#else
+#define AN_MEM
+#endif
 
 /* USER CODE END PD */
 
@@ -53,12 +66,14 @@
 /* Private variables ---------------------------------------------------------*/
 
 /* USER CODE BEGIN PV */
-extern uint16_t *ADCbuff;						// 采样数据
-extern bin_prev_t prev[2];
-extern tone_t tones[2];
 extern DDS_TypeDef DDS;
-uint16_t ADCbuff_2frame[FFT_SIZE * 2];
-uint8_t frame_ready = 0;
+static analyzer_work_t an_work MEM_CCM;		// 分析器工作缓冲区，仅 CPU 访问，放入 CCM
+static zoom_t an_zoom;							// 通道 0 的 Zoom-FFT 实例，CCM 容纳不下，留在 SRAM
+analyzer_t an[ACQ_CHANNELS] AN_MEM;				// 各输入通道的分析器，共用工作缓冲区，结果在 an[c].tones
+static decim_t an_decim[ACQ_CHANNELS] MEM_CCM;	// 各输入通道的抽取前端，DECIM_ENABLE 时使用
+uint32_t lost_shown = 0;
+uint32_t shown_seq = 0;							// 最近一次刷新显示时的帧序号
+acq_reader_t acq_rd = { 0 };					// 捕获模式的采集流读取器，每次读取一跳
 /* USER CODE END PV */
 
 /* Private function prototypes -----------------------------------------------*/
@@ -80,6 +95,7 @@ int main(void)
 {
 
   /* USER CODE BEGIN 1 */
+  mem_init();
 
   /* USER CODE END 1 */
 
@@ -131,36 +147,104 @@ int main(void)
   
   printf("start\r\n");
   
-  HAL_ADC_Start_DMA(&hadc1, (uint32_t *)ADCbuff_2frame, FFT_SIZE * 2);
-  HAL_TIM_Base_Start(&htim3);
+  fft_plan_init();
+  zoom_init();
+  decim_init();
+  for (uint32_t c = 0; c < ACQ_CHANNELS; ++c)
+    analyzer_init(&an[c], &an_work, (c == 0) ? &an_zoom : NULL);
+#if BENCH_ENABLE
+  bench_run();
+#endif
+  if (DECIM_ENABLE)
+  {
+    // 过采样后抽取：分析器每跳取一个抽取输出块，码值刻度与采样率按抽取后折算
+    ACQ_SetRate(DECIM_FS_IN);
+    for (uint32_t c = 0; c < ACQ_CHANNELS; ++c)
+    {
+      decim_reset(&an_decim[c]);
+      FFT_SetHop(&an[c], DECIM_OUT_BLOCK);
+      FFT_SetLsb(&an[c], DECIM_LSB);
+    }
+  }
+  else if (ADAPT_ENABLE)
+    ACQ_SetRate(ADAPT_FS_COARSE);				// 自适应采样率从粗测开始
+  ACQ_Start(ACQ_MODE_DBM);
+  for (uint32_t c = 0; c < ACQ_CHANNELS; ++c)
+    FFT_SetSampleRate(&an[c], ACQ_SampleRate() / (DECIM_ENABLE ? DECIM_RATIO : 1));	// 频率刻度取实际采样率，切换到 ACQ_SRC_TRIPLE 时同样适用
   /* USER CODE END 2 */
 
   /* Infinite loop */
   /* USER CODE BEGIN WHILE */
   while (1)
   {
-	 if (frame_ready) 
+	 const uint16_t *hop;
+	 uint8_t gap;
+	 uint8_t updated = 0;
+	 uint8_t rate = 0;
+	 float32_t fs;
+	 uint32_t done;
+	 if (track_locked())
 	 {
-        ADCbuff = &ADCbuff_2frame[0]; 
-		process_signal();
-		 
-		printf("\r\nf1=%8.3f Hz  A1=%6.3f  phi1=%7.3f  |  f2=%8.3f Hz  A2=%6.3f  phi2=%7.3f\r\n",
-               tones[0].f, tones[0].A, tones[0].phi,
-               tones[1].f, tones[1].A, tones[1].phi);
-		 
-		ADCbuff = &ADCbuff_2frame[4096];
-		process_signal();
-        frame_ready = 0;
+		// 跟踪模式：按块更新 an[0].tones，显示与DDS仍每帧刷新一次；经过的帧计入自适应采样率的定期复查，到期时退出跟踪回到粗测
+		if (track_poll() && ACQ.seq != shown_seq)
+		{
+			if (ADAPT_ENABLE && ACQ.src == ACQ_SRC_TIM && adapt_tracked(&an[0], ACQ.seq - shown_seq, &fs))
+			{
+				track_unlock();
+				rate = 1;
+			}
+			shown_seq = ACQ.seq;
+			updated = 1;
+		}
+	 }
+	 else if ((hop = ACQ_Read(&acq_rd, DECIM_ENABLE ? DECIM_IN_BLOCK : FFT_GetHop(&an[0]), &gap)) != NULL) 
+	 {
+		// 每到一跳分析一次；单通道且帧移等于帧长时直接在采集缓冲区中处理，无需拷贝，处理期间DMA在其余缓冲区间轮换；
+		// 多通道时逐通道解交错进各自的滑动历史再分析；抽取前端开启时每块过采样样本先抽取为一跳
+		done = DECIM_ENABLE ? decim_channels(an_decim, an, ACQ_CHANNELS, hop, gap)
+							: process_channels(an, ACQ_CHANNELS, hop, gap);
+		if (done & 1U)
+		{
+			if (ADAPT_ENABLE && !DECIM_ENABLE && ACQ.src == ACQ_SRC_TIM && adapt_update(an, ACQ_CHANNELS, &fs))
+				rate = 1;
+			else if (!DECIM_ENABLE && track_acquired(&an[0], (an[0].tones[1].f > 100) ? 2 : 1))
+				ACQ_ReaderStop(&acq_rd);
+			if (ACQ.seq != shown_seq)
+			{
+				shown_seq = ACQ.seq;
+				updated = 1;
+			}
+		}
+	 }
+	 if (rate)
+	 {
+		// 切换采样率：重启采集，帧序号从 0 重新计数，读取器随之从头开始
+		ACQ_ReaderStop(&acq_rd);
+		ACQ_Stop();
+		fs = ACQ_SetRate(fs);
+		ACQ_Start(ACQ_MODE_DBM);
+		ACQ_ReaderStart(&acq_rd, 0);
+		for (uint32_t c = 0; c < ACQ_CHANNELS; ++c)
+			FFT_SetSampleRate(&an[c], fs);
+	 }
+	 if (updated)
+	 {
+		if (ACQ.overrun + ACQ_Dropped() != lost_shown)
+		{
+			lost_shown = ACQ.overrun + ACQ_Dropped();
+			printf("\r\nACQ frame %u: overrun %u, dropped %u\r\n", shown_seq, ACQ.overrun, ACQ_Dropped());
+		}
            
-        printf("\r\nf1=%8.3f Hz  A1=%6.3f  phi1=%7.3f  |  f2=%8.3f Hz  A2=%6.3f  phi2=%7.3f\r\n",
-                tones[0].f, tones[0].A, tones[0].phi,
-                tones[1].f, tones[1].A, tones[1].phi);
+        for (uint32_t c = 0; c < ACQ_CHANNELS; ++c)
+            printf("\r\nch%u f1=%8.3f Hz  A1=%6.3f  phi1=%7.3f  |  f2=%8.3f Hz  A2=%6.3f  phi2=%7.3f  |  dphi=%7.3f\r\n", c,
+                    an[c].tones[0].f, an[c].tones[0].A, an[c].tones[0].phi,
+                    an[c].tones[1].f, an[c].tones[1].A, an[c].tones[1].phi, an[c].xphi);	// dphi：成对分析时相对前一通道的相位差
 		 
 		 
-		// 装填DDS波形参数
-		DDS.amp = tones[0].A * 2;
-		DDS.freq = tones[0].f;
-		DDS.phase = tones[0].phi;
+		// 装填DDS波形参数，显示与DDS取通道 0
+		DDS.amp = an[0].tones[0].A * 2;
+		DDS.freq = an[0].tones[0].f;
+		DDS.phase = an[0].tones[0].phi;
 		DDS.duty = 0.5;
 		DDS.waveType = SINE_WAVE;
 		DDS.offset = 0;
@@ -169,8 +253,8 @@ int main(void)
 		// 判断频率整数位数
 		int intnum_1 = 0;
 		int intnum_2 = 0;
-		int temp_1 = (int)tones[0].f;
-		int temp_2 = (int)tones[1].f;
+		int temp_1 = (int)an[0].tones[0].f;
+		int temp_2 = (int)an[0].tones[1].f;
 		
 		while(temp_1 > 0)
 		{
@@ -184,16 +268,16 @@ int main(void)
 			temp_2 /= 10;
 		}
 			
-		LCD_Disp_Decimal(100, 80, LCD_COLOR_BLACK, 2, ASCII5x7, (double)tones[0].f, intnum_1, 2);
+		LCD_Disp_Decimal(100, 80, LCD_COLOR_BLACK, 2, ASCII5x7, (double)an[0].tones[0].f, intnum_1, 2);
 		LCD_Disp_Text(145 + intnum_1 * 10, 80, LCD_COLOR_BLACK, 2, ASCII5x7, "Hz");
 
-		LCD_Disp_Decimal(100, 105, LCD_COLOR_BLACK, 2, ASCII5x7, (double)tones[0].A * 10, 1, 2);
+		LCD_Disp_Decimal(100, 105, LCD_COLOR_BLACK, 2, ASCII5x7, (double)an[0].tones[0].A * 10, 1, 2);
 		LCD_Disp_Text(155, 105, LCD_COLOR_BLACK, 2, ASCII5x7, "V");
 		
-		LCD_Disp_Decimal(100, 180, LCD_COLOR_BLACK, 2, ASCII5x7, (double)tones[1].f, intnum_2, 2);
+		LCD_Disp_Decimal(100, 180, LCD_COLOR_BLACK, 2, ASCII5x7, (double)an[0].tones[1].f, intnum_2, 2);
 		LCD_Disp_Text(145 + intnum_2 * 10, 180, LCD_COLOR_BLACK, 2, ASCII5x7, "Hz");
 
-		LCD_Disp_Decimal(100, 205, LCD_COLOR_BLACK, 2, ASCII5x7, (double)tones[1].A * 10, 1, 2);
+		LCD_Disp_Decimal(100, 205, LCD_COLOR_BLACK, 2, ASCII5x7, (double)an[0].tones[1].A * 10, 1, 2);
 		LCD_Disp_Text(155, 205, LCD_COLOR_BLACK, 2, ASCII5x7, "V");
 		 
 		HAL_GPIO_TogglePin(LED_R_GPIO_Port, LED_R_Pin);
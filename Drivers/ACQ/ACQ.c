@@ -0,0 +1,646 @@
+#include "ACQ.h"
+#include "adc.h"
+#include "tim.h"
+#include "mem_section.h"
+
+extern DMA_HandleTypeDef hdma_adc1;
+
+ACQ_TypeDef     	ACQ = { ACQ_MODE_ONESHOT, ACQ_SRC_TIM, 0, 0 };
+static uint16_t 	ACQ_buff[ACQ_BUF_NUM][ACQ_SCAN_LEN] __ALIGNED(4) MEM_SRAM1;	// 采集缓冲区，DMA 目标，放在 SRAM1；循环模式下连续排列构成乒乓区；三重模式按字搬运
+static uint32_t		ACQ_xfer = 1;							// 每次DMA传输的码值个数：单ADC为 1，三重模式方式 2 为 2
+static ADC_HandleTypeDef ACQ_hadc2, ACQ_hadc3;				// 三重交替模式的从 ADC
+static frame_queue_t ACQ_ready;								// 已采满的帧：中断 -> 主循环
+static frame_queue_t ACQ_free;								// 已处理完的帧：主循环 -> 中断
+static uint32_t		ACQ_owned;								// 归采集侧所有的缓冲区位图，仅在中断中修改
+static uint32_t		ACQ_target[2];							// 双缓冲模式下 M0/M1 当前指向的缓冲区下标
+
+// 扫描序列中各通道对应的ADC输入，第 r 个为 rank r+1；避开 DAC(PA4) 与 LCD(PC4/PC5) 占用的引脚
+static const struct
+{
+	uint32_t channel;
+	GPIO_TypeDef *port;
+	uint16_t pin;
+} ACQ_inputs[ACQ_MAX_CHANNELS] = {
+	{ ADC_CHANNEL_5, GPIOA, GPIO_PIN_5 },				// PA5，与单通道配置相同
+	{ ADC_CHANNEL_6, GPIOA, GPIO_PIN_6 },				// PA6
+	{ ADC_CHANNEL_7, GPIOA, GPIO_PIN_7 },				// PA7
+	{ ADC_CHANNEL_8, GPIOB, GPIO_PIN_0 },				// PB0
+};
+
+static void ACQ_DMA_M0Cplt(DMA_HandleTypeDef *hdma);
+static void ACQ_DMA_M1Cplt(DMA_HandleTypeDef *hdma);
+static void ACQ_DMA_Error(DMA_HandleTypeDef *hdma);
+
+/**
+ * @brief       由数据地址得到缓冲区下标
+ * @param       buf:	帧数据首地址
+ * @retval      缓冲区下标
+ */
+static uint32_t ACQ_BufIndex(const uint16_t *buf)
+{
+	return (uint32_t)(buf - &ACQ_buff[0][0]) / ACQ_SCAN_LEN;
+}
+
+/**
+ * @brief       配置扫描序列
+ * @note		按 ACQ_inputs 依次配置 ACQ_CHANNELS 个 rank；PA5 的引脚已由 HAL_ADC_MspInit 配置，其余输入在此设为模拟模式
+ * @param       无
+ * @retval      无
+ */
+static void ACQ_ConfigChannels(void)
+{
+	ADC_ChannelConfTypeDef sConfig = {0};
+	GPIO_InitTypeDef GPIO_InitStruct = {0};
+	uint32_t r;
+
+	__HAL_RCC_GPIOA_CLK_ENABLE();
+	__HAL_RCC_GPIOB_CLK_ENABLE();
+	GPIO_InitStruct.Mode = GPIO_MODE_ANALOG;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	for(r = 0; r < ACQ_CHANNELS; ++r)
+	{
+		GPIO_InitStruct.Pin = ACQ_inputs[r].pin;
+		HAL_GPIO_Init(ACQ_inputs[r].port, &GPIO_InitStruct);
+
+		sConfig.Channel = ACQ_inputs[r].channel;
+		sConfig.Rank = r + 1;
+		sConfig.SamplingTime = ADC_SAMPLETIME_3CYCLES;
+		if (HAL_ADC_ConfigChannel(&hadc1, &sConfig) != HAL_OK)
+		{
+			Error_Handler();
+		}
+	}
+}
+
+/**
+ * @brief       配置 TIM3 触发的单 ADC 采集
+ * @note		关闭多重模式，ADC1 由 TIM3 更新事件触发，按 ACQ_CHANNELS 扫描
+ * @param       无
+ * @retval      无
+ */
+static void ACQ_ConfigTim(void)
+{
+	ADC_MultiModeTypeDef multimode = {0};
+
+	hadc1.Init.ContinuousConvMode = DISABLE;
+	hadc1.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_RISING;
+	hadc1.Init.ExternalTrigConv = ADC_EXTERNALTRIGCONV_T3_TRGO;
+	hadc1.Init.ScanConvMode = (ACQ_CHANNELS > 1) ? ENABLE : DISABLE;
+	hadc1.Init.NbrOfConversion = ACQ_CHANNELS;
+	if (HAL_ADC_Init(&hadc1) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	multimode.Mode = ADC_MODE_INDEPENDENT;
+	if (HAL_ADCEx_MultiModeConfigChannel(&hadc1, &multimode) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	ACQ_ConfigChannels();
+	ACQ_xfer = 1;
+}
+
+/**
+ * @brief       配置 ADC1/2/3 三重交替采集
+ * @note		三个 ADC 以相同配置连续转换 PC0（ADC123_IN10），ADC1 为主，软件启动后不再需要触发；
+ *				3 周期采样加 12 位转换共 15 个 ADC 时钟，恰为 3 * ACQ_TRIPLE_DELAY，输入源阻抗须足够低
+ * @param       无
+ * @retval      无
+ */
+static void ACQ_ConfigTriple(void)
+{
+	ADC_ChannelConfTypeDef sConfig = {0};
+	ADC_MultiModeTypeDef multimode = {0};
+	GPIO_InitTypeDef GPIO_InitStruct = {0};
+	ADC_HandleTypeDef *h[3] = { &hadc1, &ACQ_hadc2, &ACQ_hadc3 };
+	uint32_t i;
+
+	__HAL_RCC_ADC2_CLK_ENABLE();
+	__HAL_RCC_ADC3_CLK_ENABLE();
+	__HAL_RCC_GPIOC_CLK_ENABLE();
+	GPIO_InitStruct.Pin = GPIO_PIN_0;
+	GPIO_InitStruct.Mode = GPIO_MODE_ANALOG;
+	GPIO_InitStruct.Pull = GPIO_NOPULL;
+	HAL_GPIO_Init(GPIOC, &GPIO_InitStruct);
+
+	hadc1.Init.ContinuousConvMode = ENABLE;
+	hadc1.Init.ExternalTrigConvEdge = ADC_EXTERNALTRIGCONVEDGE_NONE;
+	hadc1.Init.ExternalTrigConv = ADC_SOFTWARE_START;
+	hadc1.Init.ScanConvMode = DISABLE;
+	hadc1.Init.NbrOfConversion = 1;
+	ACQ_hadc2.Instance = ADC2;
+	ACQ_hadc2.Init = hadc1.Init;
+	ACQ_hadc3.Instance = ADC3;
+	ACQ_hadc3.Init = hadc1.Init;
+
+	sConfig.Channel = ADC_CHANNEL_10;
+	sConfig.Rank = 1;
+	sConfig.SamplingTime = ADC_SAMPLETIME_3CYCLES;
+	for(i = 0; i < 3; ++i)
+	{
+		if (HAL_ADC_Init(h[i]) != HAL_OK || HAL_ADC_ConfigChannel(h[i], &sConfig) != HAL_OK)
+		{
+			Error_Handler();
+		}
+	}
+
+	multimode.Mode = ADC_TRIPLEMODE_INTERL;
+	multimode.DMAAccessMode = ADC_DMAACCESSMODE_2;
+	multimode.TwoSamplingDelay = ACQ_TRIPLE_DELAY;
+	if (HAL_ADCEx_MultiModeConfigChannel(&hadc1, &multimode) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	ACQ_xfer = 2;
+}
+
+/**
+ * @brief       回收主循环已释放的缓冲区，在DMA中断中调用
+ * @param       无
+ * @retval      无
+ */
+static void ACQ_Reclaim(void)
+{
+	frame_desc_t d;
+
+	while(fq_pop(&ACQ_free, &d))
+		ACQ_owned |= 1U << ACQ_BufIndex(d.buf);
+}
+
+/**
+ * @brief       一帧采满，在DMA中断中调用
+ * @note		先回收主循环已释放的缓冲区，再检查DMA即将写入的缓冲区是否仍被持有，
+ *				最后将采满的帧入队；入队失败时帧被丢弃，缓冲区留在采集侧
+ * @param       idx:	刚采满的缓冲区下标
+ * @param		next:	DMA 接下来写入的缓冲区下标，-1 表示DMA已停止
+ * @retval      无
+ */
+static void ACQ_FrameDone(uint32_t idx, int32_t next)
+{
+	frame_desc_t d;
+
+	ACQ_Reclaim();
+
+	if(next >= 0 && !(ACQ_owned & (1U << next)))
+		ACQ.overrun++;
+
+	d.buf = ACQ_buff[idx];
+	d.seq = ACQ.seq++;
+	d.tick = HAL_GetTick();
+	if(fq_push(&ACQ_ready, &d))
+		ACQ_owned &= ~(1U << idx);
+}
+
+/**
+ * @brief       双缓冲模式下一帧采满，在DMA中断中调用
+ * @note		DMA 已由硬件切换至另一存储器，此处只需为刚采满的存储器换入一个空闲缓冲区；
+ *				无空闲缓冲区或队满时丢弃本帧，让DMA重写同一缓冲区，处理侧持有的帧永不被覆盖
+ * @param       mem:	刚采满的存储器，MEMORY0 或 MEMORY1
+ * @retval      无
+ */
+static void ACQ_DbmDone(HAL_DMA_MemoryTypeDef mem)
+{
+	frame_desc_t d;
+	uint32_t idx = ACQ_target[mem];
+	uint32_t spare, next;
+
+	ACQ_Reclaim();
+
+	spare = ACQ_owned & ~(1U << ACQ_target[MEMORY0]) & ~(1U << ACQ_target[MEMORY1]);
+	d.buf = ACQ_buff[idx];
+	d.seq = ACQ.seq++;
+	d.tick = HAL_GetTick();
+	if(spare == 0)
+	{
+		ACQ.overrun++;
+		return;
+	}
+	if(!fq_push(&ACQ_ready, &d))
+		return;
+
+	for(next = 0; !(spare & (1U << next)); ++next);
+
+	ACQ_owned &= ~(1U << idx);
+	ACQ_target[mem] = next;
+	HAL_DMAEx_ChangeMemory(&hdma_adc1, (uint32_t)ACQ_buff[next], mem);
+}
+
+/**
+ * @brief       以硬件双缓冲方式启动ADC DMA
+ * @note		HAL_ADC_Start_DMA 与 HAL_ADCEx_MultiModeStart_DMA 只支持单缓冲，此处按其流程手动使能ADC的DMA请求，
+ *				再由 HAL_DMAEx_MultiBufferStart_IT 启动 DMA2_Stream0；三重模式下源地址为公共数据寄存器 CDR
+ * @param       无
+ * @retval      无
+ */
+static void ACQ_StartDBM(void)
+{
+	uint32_t src;
+
+	ACQ_target[MEMORY0] = 0;
+	ACQ_target[MEMORY1] = 1;
+
+	hdma_adc1.XferCpltCallback = ACQ_DMA_M0Cplt;
+	hdma_adc1.XferM1CpltCallback = ACQ_DMA_M1Cplt;
+	hdma_adc1.XferErrorCallback = ACQ_DMA_Error;
+	hdma_adc1.XferHalfCpltCallback = NULL;
+	hdma_adc1.XferM1HalfCpltCallback = NULL;
+
+	__HAL_ADC_CLEAR_FLAG(&hadc1, ADC_FLAG_EOC | ADC_FLAG_OVR);
+	if(ACQ.src == ACQ_SRC_TRIPLE)
+	{
+		ADC123_COMMON->CCR |= ADC_CCR_DDS;		// 多重模式的DMA请求由公共寄存器控制，方式已由 ACQ_ConfigTriple 选定
+		src = (uint32_t)&ADC123_COMMON->CDR;
+	}
+	else
+	{
+		hadc1.Instance->CR2 |= ADC_CR2_DMA;
+		src = (uint32_t)&hadc1.Instance->DR;
+	}
+	if (HAL_DMAEx_MultiBufferStart_IT(&hdma_adc1, src,
+			(uint32_t)ACQ_buff[0], (uint32_t)ACQ_buff[1], ACQ_SCAN_LEN / ACQ_xfer) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	if(ACQ.src == ACQ_SRC_TRIPLE)
+		HAL_ADC_Start(&hadc1);					// 等待稳定后软件启动主 ADC
+	else
+		__HAL_ADC_ENABLE(&hadc1);
+}
+
+/**
+ * @brief       开始采集
+ * @note		采集源为 ACQ_SRC_TIM 时由 TIM3 更新事件触发 ADC1，ACQ_CHANNELS 大于 1 时每次触发扫描全部通道；
+ *				为 ACQ_SRC_TRIPLE 时 ADC1/2/3 三重交替连续转换。均由 DMA2_Stream0 搬运至采集缓冲区
+ * @param       mode:	采集模式，ACQ_MODE_ONESHOT、ACQ_MODE_STREAM 或 ACQ_MODE_DBM
+ * @retval      无
+ */
+void ACQ_Start(uint8_t mode)
+{
+	ACQ_Stop();
+
+	ACQ.mode = mode;
+	ACQ.seq = 0;
+	ACQ.overrun = 0;
+	fq_init(&ACQ_ready);
+	fq_init(&ACQ_free);
+	ACQ_owned = (1U << ACQ_BUF_NUM) - 1;
+
+	// 按模式切换DMA循环/普通模式，连续采集时ADC需持续发出DMA请求；三重模式方式 2 按字搬运
+	hdma_adc1.Init.Mode = (mode == ACQ_MODE_ONESHOT) ? DMA_NORMAL : DMA_CIRCULAR;
+	hdma_adc1.Init.PeriphDataAlignment = (ACQ.src == ACQ_SRC_TRIPLE) ? DMA_PDATAALIGN_WORD : DMA_PDATAALIGN_HALFWORD;
+	hdma_adc1.Init.MemDataAlignment = (ACQ.src == ACQ_SRC_TRIPLE) ? DMA_MDATAALIGN_WORD : DMA_MDATAALIGN_HALFWORD;
+	if (HAL_DMA_Init(&hdma_adc1) != HAL_OK)
+	{
+		Error_Handler();
+	}
+	hadc1.Init.DMAContinuousRequests = (mode == ACQ_MODE_ONESHOT) ? DISABLE : ENABLE;
+	if(ACQ.src == ACQ_SRC_TRIPLE)
+		ACQ_ConfigTriple();
+	else
+		ACQ_ConfigTim();
+
+	if(mode == ACQ_MODE_DBM)
+	{
+		if(ACQ.src == ACQ_SRC_TRIPLE)
+		{
+			HAL_ADC_Start(&ACQ_hadc3);			// 从 ADC 先上电，随主 ADC 开始转换
+			HAL_ADC_Start(&ACQ_hadc2);
+		}
+		ACQ_StartDBM();
+	}
+	else if(ACQ.src == ACQ_SRC_TRIPLE)
+	{
+		HAL_ADC_Start(&ACQ_hadc3);
+		HAL_ADC_Start(&ACQ_hadc2);
+		HAL_ADCEx_MultiModeStart_DMA(&hadc1, (uint32_t *)ACQ_buff, ACQ_SCAN_LEN * 2 / ACQ_xfer);
+	}
+	else
+		HAL_ADC_Start_DMA(&hadc1, (uint32_t *)ACQ_buff, ACQ_SCAN_LEN * 2);	// 前两个缓冲区连续，构成乒乓区
+	if(ACQ.src == ACQ_SRC_TIM)
+		HAL_TIM_Base_Start(&htim3);
+}
+
+/**
+ * @brief       停止采集
+ * @param       无
+ * @retval      无
+ */
+void ACQ_Stop(void)
+{
+	HAL_TIM_Base_Stop(&htim3);
+	if(ADC123_COMMON->CCR & ADC_CCR_MULTI)
+	{
+		HAL_ADCEx_MultiModeStop_DMA(&hadc1);
+		HAL_ADC_Stop(&ACQ_hadc2);
+		HAL_ADC_Stop(&ACQ_hadc3);
+	}
+	else
+		HAL_ADC_Stop_DMA(&hadc1);
+}
+
+/**
+ * @brief       选择采集源，下次 ACQ_Start 生效
+ * @note		先停止当前采集；三重交替模式只支持单通道
+ * @param       src:	ACQ_SRC_TIM 或 ACQ_SRC_TRIPLE
+ * @retval      1：成功；0：不支持
+ */
+uint8_t ACQ_SetSource(uint8_t src)
+{
+	if(src > ACQ_SRC_TRIPLE || (src == ACQ_SRC_TRIPLE && ACQ_CHANNELS > 1))
+		return 0;
+
+	ACQ_Stop();
+	ACQ.src = src;
+	return 1;
+}
+
+/**
+ * @brief       TIM3 的计数时钟
+ * @note		APB1 分频不为 1 时定时器时钟为 PCLK1 的两倍
+ * @param       无
+ * @retval      时钟频率，单位 Hz
+ */
+static uint32_t ACQ_TimClock(void)
+{
+	uint32_t clk = HAL_RCC_GetPCLK1Freq();
+
+	if((RCC->CFGR & RCC_CFGR_PPRE1) != RCC_CFGR_PPRE1_DIV1)
+		clk *= 2U;
+	return clk;
+}
+
+/**
+ * @brief       当前采集源的实际采样率
+ * @note		由时钟树与寄存器换算，ACQ_Start 之后调用
+ * @param       无
+ * @retval      采样率，单位 Hz
+ */
+float32_t ACQ_SampleRate(void)
+{
+	uint32_t clk, ccr;
+
+	if(ACQ.src == ACQ_SRC_TRIPLE)
+	{
+		ccr = ADC123_COMMON->CCR;
+		clk = HAL_RCC_GetPCLK2Freq() / (2U * (((ccr & ADC_CCR_ADCPRE) >> ADC_CCR_ADCPRE_Pos) + 1U));
+		return (float32_t)clk / (float32_t)(((ccr & ADC_CCR_DELAY) >> ADC_CCR_DELAY_Pos) + 5U);
+	}
+
+	clk = ACQ_TimClock();
+	return (float32_t)clk / ((float32_t)(htim3.Instance->PSC + 1U) * (float32_t)(htim3.Instance->ARR + 1U));
+}
+
+/**
+ * @brief       设置 TIM3 触发的采样率
+ * @note		须在 ACQ_Stop 之后、ACQ_Start 之前调用。总分频 N = PSC * ARR 取最接近 clk / fs 的整数，
+ *				PSC 取使 ARR 不超过 16 位的最小值，ARR 再按 N / PSC 取整，分频误差不超过 PSC / 2 个计数；
+ *				N 不小于 ACQ_TIM_MIN_TICKS，保证扫描在下一次触发前完成。立即产生更新事件装载新值
+ * @param       fs:	目标采样率，单位 Hz
+ * @retval      实际采样率，单位 Hz
+ */
+float32_t ACQ_SetRate(float32_t fs)
+{
+	uint32_t clk = ACQ_TimClock();
+	uint32_t total, psc, arr;
+
+	total = (fs > 0.0f) ? (uint32_t)((float32_t)clk / fs + 0.5f) : 0xFFFFFFFFU;
+	if(total < ACQ_TIM_MIN_TICKS)
+		total = ACQ_TIM_MIN_TICKS;
+	psc = (total - 1U) / 0x10000U + 1U;
+	if(psc > 0x10000U)
+		psc = 0x10000U;
+	arr = (total + psc / 2U) / psc;
+	if(arr > 0x10000U)
+		arr = 0x10000U;
+
+	htim3.Init.Prescaler = psc - 1U;
+	htim3.Init.Period = arr - 1U;
+	__HAL_TIM_SET_PRESCALER(&htim3, psc - 1U);
+	__HAL_TIM_SET_AUTORELOAD(&htim3, arr - 1U);
+	htim3.Instance->EGR = TIM_EGR_UG;
+	return ACQ_SampleRate();
+}
+
+/**
+ * @brief       取出一帧待处理数据
+ * @note		取出的帧在调用 ACQ_ReleaseFrame 之前归主循环所有，可同时持有多帧
+ * @param       frame:	帧描述符输出
+ * @retval      1：取到新帧；0：无新帧
+ */
+uint8_t ACQ_GetFrame(frame_desc_t *frame)
+{
+	return fq_pop(&ACQ_ready, frame);
+}
+
+/**
+ * @brief       释放处理完毕的帧，缓冲区交还采集侧
+ * @param       frame:	由 ACQ_GetFrame 取得的帧
+ * @retval      无
+ */
+void ACQ_ReleaseFrame(const frame_desc_t *frame)
+{
+	fq_push(&ACQ_free, frame);
+}
+
+/**
+ * @brief       取DMA正在写入的缓冲区及其已写入的样本数
+ * @note		仅双缓冲模式支持；DMA按顺序写入，已写入部分在本帧采满前不会再变，可提前读取。
+ *				CT 位与 NDTR 不能同时读取，前后两次读 CT 一致才认为二者属于同一缓冲区；多通道时只计完整扫描过的点
+ * @param       buf:	缓冲区首地址输出，不支持时为 NULL
+ * @retval      已写入的每通道样本数
+ */
+uint32_t ACQ_Fill(const uint16_t **buf)
+{
+	uint32_t ct, ndtr;
+
+	if(ACQ.mode != ACQ_MODE_DBM)
+	{
+		*buf = NULL;
+		return 0;
+	}
+	do
+	{
+		ct = (hdma_adc1.Instance->CR & DMA_SxCR_CT) ? MEMORY1 : MEMORY0;
+		ndtr = __HAL_DMA_GET_COUNTER(&hdma_adc1);
+	} while(ct != ((hdma_adc1.Instance->CR & DMA_SxCR_CT) ? MEMORY1 : MEMORY0));
+
+	*buf = ACQ_buff[ACQ_target[ct]];
+	return (ACQ_SCAN_LEN - ndtr * ACQ_xfer) / ACQ_CHANNELS;
+}
+
+/**
+ * @brief       从指定帧开始读取采集流
+ * @note		早于 seq 的帧在读取时直接释放；第一块总是报告不连续
+ * @param       r:		读取器
+ * @param		seq:	起始帧序号
+ * @retval      无
+ */
+void ACQ_ReaderStart(acq_reader_t *r, uint32_t seq)
+{
+	ACQ_ReaderStop(r);
+	r->next_seq = seq;
+	r->pos = 0;
+	r->fill = NULL;
+	r->gap = 1;
+}
+
+/**
+ * @brief       停止读取，释放持有的帧
+ * @note		停止后仍可继续调用 ACQ_Read，读取位置已落后，从最新的帧重新开始并报告不连续
+ * @param       r:	读取器
+ * @retval      无
+ */
+void ACQ_ReaderStop(acq_reader_t *r)
+{
+	if(r->holding)
+	{
+		ACQ_ReleaseFrame(&r->held);
+		r->holding = 0;
+	}
+}
+
+/**
+ * @brief       按序读取下一块样本
+ * @note		先读已采满的帧，一次只持有一帧，读完在下次调用时释放；无已采满帧时读DMA正在写入的帧中已写入的整块。
+ *				帧序号不连续（丢帧、溢出、读取位置落后）时从新帧开头读起并报告不连续。
+ *				返回的样本在下一次调用 ACQ_Read 或 ACQ_ReaderStop 之前有效；多通道时为 block * ACQ_CHANNELS 个交错码值
+ * @param       r:		读取器
+ * @param		block:	每通道块长，须整除 ACQ_FRAME_LEN
+ * @param		gap:	输出，1 表示本块与上一块不连续
+ * @retval      块首地址；尚无完整的块时为 NULL
+ */
+const uint16_t *ACQ_Read(acq_reader_t *r, uint32_t block, uint8_t *gap)
+{
+	frame_desc_t fr;
+	const uint16_t *buf, *x;
+	uint32_t seq, cnt;
+
+	// 持有的帧已读完，释放并转到下一帧
+	if(r->holding && r->pos + block > ACQ_FRAME_LEN)
+	{
+		ACQ_ReleaseFrame(&r->held);
+		r->holding = 0;
+		r->next_seq = r->held.seq + 1;
+		r->pos = 0;
+		r->fill = NULL;
+	}
+
+	// 取下一个已采满的帧，早于读取位置的直接释放；此前读过其写入中的部分则接着读
+	while(!r->holding && ACQ_GetFrame(&fr))
+	{
+		if((int32_t)(fr.seq - r->next_seq) < 0)
+		{
+			ACQ_ReleaseFrame(&fr);
+			continue;
+		}
+		if(fr.seq != r->next_seq || (r->fill != NULL && r->fill != fr.buf))
+		{
+			r->gap = 1;
+			r->pos = 0;
+		}
+		r->held = fr;
+		r->holding = 1;
+		r->next_seq = fr.seq;
+		r->fill = NULL;
+	}
+
+	if(r->holding)
+	{
+		x = r->held.buf + r->pos * ACQ_CHANNELS;
+	}
+	else
+	{
+		// CT 与 ACQ.seq 前后一致才说明读到的是同一帧
+		seq = ACQ.seq;
+		cnt = ACQ_Fill(&buf);
+		if(buf == NULL || seq != ACQ.seq)
+			return NULL;
+		if((int32_t)(seq - r->next_seq) > 0)
+		{
+			r->next_seq = seq;
+			r->pos = 0;
+			r->fill = NULL;
+			r->gap = 1;
+		}
+		if(seq != r->next_seq)
+			return NULL;
+		// DMA 已切换 CT 而传输完成中断尚未递增 ACQ.seq 时，buf 是下一帧的缓冲区且几乎未写入；
+		// 须确认本块已写入后才绑定，否则该帧采满后会被误判为不连续
+		if((r->fill != NULL && r->fill != buf) || r->pos + block > cnt)
+			return NULL;
+		r->fill = buf;
+		x = buf + r->pos * ACQ_CHANNELS;
+	}
+
+	r->pos += block;
+	*gap = r->gap;
+	r->gap = 0;
+	return x;
+}
+
+/**
+ * @brief       因主循环未及时取帧而丢弃的帧数
+ * @param       无
+ * @retval      丢帧计数
+ */
+uint32_t ACQ_Dropped(void)
+{
+	return ACQ_ready.drop;
+}
+
+/**
+ * @brief       ADC DMA 半传输完成回调，前半区采满
+ * @param       hadc:	ADC句柄
+ * @retval      无
+ */
+void HAL_ADC_ConvHalfCpltCallback(ADC_HandleTypeDef *hadc)
+{
+	ACQ_FrameDone(0, 1);
+}
+
+/**
+ * @brief       ADC DMA 传输完成回调，后半区采满
+ * @param       hadc:	ADC句柄
+ * @retval      无
+ */
+void HAL_ADC_ConvCpltCallback(ADC_HandleTypeDef *hadc)
+{
+	if(ACQ.mode == ACQ_MODE_ONESHOT && ACQ.src == ACQ_SRC_TRIPLE)
+		__HAL_ADC_DISABLE(&hadc1);		// 连续转换不会自行停止，关闭主 ADC 以免DMA停止后持续溢出
+	ACQ_FrameDone(1, (ACQ.mode == ACQ_MODE_STREAM) ? 0 : -1);
+	HAL_GPIO_TogglePin(LED_R_GPIO_Port, LED_R_Pin);
+}
+
+/**
+ * @brief       双缓冲模式 M0 采满回调
+ * @param       hdma:	DMA句柄
+ * @retval      无
+ */
+static void ACQ_DMA_M0Cplt(DMA_HandleTypeDef *hdma)
+{
+	ACQ_DbmDone(MEMORY0);
+	HAL_GPIO_TogglePin(LED_R_GPIO_Port, LED_R_Pin);
+}
+
+/**
+ * @brief       双缓冲模式 M1 采满回调
+ * @param       hdma:	DMA句柄
+ * @retval      无
+ */
+static void ACQ_DMA_M1Cplt(DMA_HandleTypeDef *hdma)
+{
+	ACQ_DbmDone(MEMORY1);
+	HAL_GPIO_TogglePin(LED_R_GPIO_Port, LED_R_Pin);
+}
+
+/**
+ * @brief       双缓冲模式 DMA 错误回调，按 HAL 的 ADC DMA 错误流程上报
+ * @param       hdma:	DMA句柄
+ * @retval      无
+ */
+static void ACQ_DMA_Error(DMA_HandleTypeDef *hdma)
+{
+	hadc1.State = HAL_ADC_STATE_ERROR_DMA;
+	hadc1.ErrorCode |= HAL_ADC_ERROR_DMA;
+	HAL_ADC_ErrorCallback(&hadc1);
+}
@@ -0,0 +1,91 @@
+#ifndef __ACQ_H
+#define __ACQ_H
+
+#include "main.h"
+#include "FFT.h"
+#include "frame_queue.h"
+
+
+#define ACQ_FRAME_LEN       FFT_SIZE            // 每帧每通道采样点数
+#define ACQ_BUF_NUM         3                   // 采集缓冲区数量：循环模式用前两个，双缓冲模式全部轮换
+#define ACQ_MAX_CHANNELS    4                   // 扫描模式最多通道数
+#define ACQ_CHANNELS        1                   // 每次 TIM3 触发扫描的通道数，1 ~ ACQ_MAX_CHANNELS
+#define ACQ_SCAN_LEN        (ACQ_FRAME_LEN * ACQ_CHANNELS)	// 每帧的码值个数，各通道逐点交错
+#define ACQ_TIM_MIN_TICKS   (64U * ACQ_CHANNELS)	// TIM3 触发间隔下限（定时器时钟数），单次转换 15 个 ADC 时钟约 60 个定时器时钟
+#define ACQ_TRIPLE_DELAY    ADC_TWOSAMPLINGDELAY_5CYCLES	// 三重交替模式相邻两次转换的间隔，不小于单次转换时间的 1/3
+
+/*
+ * 多通道时 ADC1 以扫描模式依次转换 ACQ_CHANNELS 个输入，DMA 按 [ch0, ch1, ..., ch0, ch1, ...] 交错写入同一帧；
+ * 相邻通道的采样时刻相差一次转换时间（PCLK2/4、3 周期采样时约 0.71 us），各通道相位含该固定偏移。
+ * 采集缓冲区占 ACQ_BUF_NUM * ACQ_SCAN_LEN * 2 字节，4 通道时须相应减小 FFT_SIZE
+ *
+ * 高速采集源 ACQ_SRC_TRIPLE 改用 ADC1/2/3 三重交替模式：三个 ADC 连续转换同一输入（PC0，ADC123_IN10），
+ * 相邻两次转换相隔 ACQ_TRIPLE_DELAY 个 ADC 时钟，ADCCLK = PCLK2/4 = 21 MHz 时采样率 4.2 MHz；
+ * DMA 方式 2 每次搬运两个码值，按 ADC1、ADC2、ADC3 的时间顺序写入，帧格式与单通道相同。
+ * 主循环跟不上时双缓冲模式丢帧而不覆盖，每帧仍是连续的 ACQ_FRAME_LEN 点；实际采样率由 ACQ_SampleRate 给出
+ */
+
+#if (ACQ_BUF_NUM < 2) || (ACQ_BUF_NUM > FQ_DEPTH)
+#error "ACQ_BUF_NUM 须在 2 ~ FQ_DEPTH 之间"
+#endif
+#if (ACQ_CHANNELS < 1) || (ACQ_CHANNELS > ACQ_MAX_CHANNELS)
+#error "ACQ_CHANNELS 须在 1 ~ ACQ_MAX_CHANNELS 之间"
+#endif
+#if (2 * ACQ_SCAN_LEN > 0xFFFF)
+#error "循环模式的DMA传输长度 2 * ACQ_SCAN_LEN 超出 NDTR 上限"
+#endif
+
+//	Acquisition modes listed below
+enum
+{
+    ACQ_MODE_ONESHOT = 0,   // 单次采集：DMA普通模式，采满两帧后停止
+    ACQ_MODE_STREAM = 1,    // 连续采集：DMA循环模式，半传输/传输完成乒乓切换
+    ACQ_MODE_DBM = 2,       // 连续采集：DMA硬件双缓冲，中断中从缓冲池换入空闲缓冲区，处理侧可任意持有帧
+};
+
+//	Acquisition sources listed below
+enum
+{
+    ACQ_SRC_TIM = 0,        // TIM3 触发 ADC1，采样率 SAMPLE_RATE，可扫描 ACQ_CHANNELS 个通道
+    ACQ_SRC_TRIPLE = 1,     // ADC1/2/3 三重交替连续转换，单通道，采样率 MHz 级
+};
+
+
+//	ACQ Type Define
+typedef struct
+{
+    uint8_t             mode;       // 采集模式
+    uint8_t             src;        // 采集源
+    volatile uint32_t   seq;        // 已采满的帧计数
+    volatile uint32_t   overrun;    // 溢出计数：循环模式下DMA覆盖了仍被持有的帧，双缓冲模式下无空闲缓冲区而丢帧
+}   ACQ_TypeDef;
+
+extern ACQ_TypeDef ACQ;
+
+
+//	按块顺序读取采集流，双缓冲模式下可提前读取DMA正在写入的帧中已写入的部分；位置与块长均按每通道样本数计
+typedef struct
+{
+    uint32_t            next_seq;   // 正在读取的帧序号
+    uint32_t            pos;        // 该帧已读取的每通道样本数
+    const uint16_t      *fill;      // 正在写入的帧的缓冲区，尚未确定时为 NULL
+    frame_desc_t        held;       // 持有的已采满帧
+    uint8_t             holding;    // 是否持有已采满帧
+    uint8_t             gap;        // 下一块之前流不连续
+}   acq_reader_t;
+
+
+void ACQ_Start(uint8_t mode);
+void ACQ_Stop(void);
+uint8_t ACQ_SetSource(uint8_t src);
+float32_t ACQ_SampleRate(void);
+float32_t ACQ_SetRate(float32_t fs);
+uint8_t ACQ_GetFrame(frame_desc_t *frame);
+void ACQ_ReleaseFrame(const frame_desc_t *frame);
+uint32_t ACQ_Fill(const uint16_t **buf);
+uint32_t ACQ_Dropped(void);
+void ACQ_ReaderStart(acq_reader_t *r, uint32_t seq);
+void ACQ_ReaderStop(acq_reader_t *r);
+const uint16_t *ACQ_Read(acq_reader_t *r, uint32_t block, uint8_t *gap);
+
+#endif
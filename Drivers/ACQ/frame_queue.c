@@ -0,0 +1,69 @@
+#include "frame_queue.h"
+
+/**
+ * @brief       初始化帧队列
+ * @note		须在生产者、消费者均未运行时调用
+ * @param       q:	帧队列
+ * @retval      无
+ */
+void fq_init(frame_queue_t *q)
+{
+	q->head = 0;
+	q->tail = 0;
+	q->drop = 0;
+}
+
+/**
+ * @brief       帧入队，仅由生产者调用
+ * @note		head/tail 为自由递增计数，差值即为队内帧数
+ * @param       q:	帧队列
+ * @param		d:	帧描述符
+ * @retval      1：成功；0：队满，帧被丢弃
+ */
+uint8_t fq_push(frame_queue_t *q, const frame_desc_t *d)
+{
+	uint32_t head = q->head;
+
+	if(head - q->tail >= FQ_DEPTH)
+	{
+		q->drop++;
+		return 0;
+	}
+
+	q->slot[head & (FQ_DEPTH - 1)] = *d;
+	FQ_BARRIER();						// 先写内容，再发布索引
+	q->head = head + 1;
+
+	return 1;
+}
+
+/**
+ * @brief       帧出队，仅由消费者调用
+ * @param       q:	帧队列
+ * @param		d:	帧描述符输出
+ * @retval      1：成功；0：队空
+ */
+uint8_t fq_pop(frame_queue_t *q, frame_desc_t *d)
+{
+	uint32_t tail = q->tail;
+
+	if(q->head == tail)
+		return 0;
+
+	FQ_BARRIER();						// 先确认索引，再读内容
+	*d = q->slot[tail & (FQ_DEPTH - 1)];
+	FQ_BARRIER();						// 读完内容后才释放槽位
+	q->tail = tail + 1;
+
+	return 1;
+}
+
+/**
+ * @brief       队内帧数
+ * @param       q:	帧队列
+ * @retval      帧数
+ */
+uint32_t fq_count(const frame_queue_t *q)
+{
+	return q->head - q->tail;
+}
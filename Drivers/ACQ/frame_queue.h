@@ -0,0 +1,46 @@
+#ifndef __FRAME_QUEUE_H
+#define __FRAME_QUEUE_H
+
+#include <stdint.h>
+
+/*
+ * 单生产者/单消费者无锁帧队列
+ * 生产者（如DMA中断）只写 head，消费者（主循环）只写 tail，双方无需关中断；
+ * 不依赖HAL，可直接在主机上以两个线程编译运行
+ */
+
+#define FQ_DEPTH            4                   // 队列深度，须为 2 的幂
+
+#if (FQ_DEPTH & (FQ_DEPTH - 1))
+#error "FQ_DEPTH 须为 2 的幂"
+#endif
+
+// 内存屏障：保证描述符内容先于索引对另一方可见
+#if defined(__arm__) || defined(__ARMCC_VERSION)
+#include "cmsis_compiler.h"
+#define FQ_BARRIER()        __DMB()
+#else
+#define FQ_BARRIER()        __atomic_thread_fence(__ATOMIC_SEQ_CST)
+#endif
+
+// 帧描述符
+typedef struct{
+	uint16_t *buf;		// 帧数据
+	uint32_t seq;		// 帧序号，自采集开始递增
+	uint32_t tick;		// 采集完成时刻，单位 ms
+} frame_desc_t;
+
+// 帧队列
+typedef struct{
+	frame_desc_t slot[FQ_DEPTH];
+	volatile uint32_t head;		// 写计数，仅生产者修改
+	volatile uint32_t tail;		// 读计数，仅消费者修改
+	volatile uint32_t drop;		// 队满丢弃计数，仅生产者修改
+} frame_queue_t;
+
+void fq_init(frame_queue_t *q);
+uint8_t fq_push(frame_queue_t *q, const frame_desc_t *d);
+uint8_t fq_pop(frame_queue_t *q, frame_desc_t *d);
+uint32_t fq_count(const frame_queue_t *q);
+
+#endif
@@ -32,6 +32,9 @@
 #include "arm_math_types.h"
 #include "dsp/fast_math_functions.h"
 
+/* Project selection of the FFT lengths whose tables are linked */
+#include "arm_fft_table_config.h"
+
 #ifdef   __cplusplus
 extern "C"
 {
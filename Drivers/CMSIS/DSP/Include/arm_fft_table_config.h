@@ -0,0 +1,203 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS DSP Library
+ * Title:        arm_fft_table_config.h
+ * Description:  Project selection of the FFT tables to link
+ *
+ * Target Processor: Cortex-M4
+ * -------------------------------------------------------------------- */
+
+#ifndef _ARM_FFT_TABLE_CONFIG_H
+#define _ARM_FFT_TABLE_CONFIG_H
+
+/*
+ * Range of real FFT lengths used by the application (powers of two).
+ * Each length N needs twiddleCoef_rfft_N plus the N/2 point CFFT tables
+ * (twiddleCoef_N/2, armBitRevIndexTableN/2).
+ */
+#ifndef ARM_FFT_RFFT_MIN_LEN
+#define ARM_FFT_RFFT_MIN_LEN        256
+#endif
+#ifndef ARM_FFT_RFFT_MAX_LEN
+#define ARM_FFT_RFFT_MAX_LEN        4096
+#endif
+
+/*
+ * Generate the twiddle factors of the enabled lengths into RAM at startup
+ * (see fft_plan_init) instead of linking them from flash. Only the
+ * bit reversal tables stay in flash. In this mode arm_cfft_init_f32 and
+ * arm_rfft_fast_init_f32 do not support any length; use fft_plan_get.
+ */
+/* #define ARM_FFT_TWIDDLE_IN_RAM */
+
+/*
+ * Paired-frame transforms pack two real frames of length N into one N point
+ * CFFT. N up to ARM_FFT_RFFT_MAX_LEN/2 reuses the tables of the real FFTs;
+ * ARM_FFT_CFFT_PAIR also links the ARM_FFT_RFFT_MAX_LEN point CFFT tables
+ * (twiddleCoef_N, armBitRevIndexTableN) so full-length frames can be paired.
+ */
+#define ARM_FFT_CFFT_PAIR
+
+/*
+ * Fixed-point analysis pipeline (FFT_PIPE_Q31 in FFT.h): a real frame of
+ * length N is packed into an N/2 point q31 CFFT, so every enabled length also
+ * links twiddleCoef_N/2_q31 and armBitRevIndexTable_fixed_N/2. The real-FFT
+ * split takes its twiddles from twiddleCoef_<ARM_FFT_RFFT_MAX_LEN>_q31 with a
+ * stride. These tables always stay in flash.
+ */
+#define ARM_FFT_Q31
+
+/*
+ * Define ARM_FFT_ALL_LENGTHS to get the stock CMSIS behaviour (every table
+ * declared and every length handled by the init functions).
+ */
+#if !defined(ARM_FFT_ALL_LENGTHS) && !defined(ARM_DSP_CONFIG_TABLES)
+
+#define ARM_DSP_CONFIG_TABLES
+#define ARM_FFT_ALLOW_TABLES
+#define ARM_FAST_ALLOW_TABLES
+#define ARM_ALL_FAST_TABLES
+
+#define ARM_FFT_RFFT_LEN_ENABLED(N) ((ARM_FFT_RFFT_MIN_LEN <= (N)) && (ARM_FFT_RFFT_MAX_LEN >= (N)))
+
+#if ARM_FFT_RFFT_LEN_ENABLED(32)
+  #define ARM_TABLE_BITREVIDX_FLT_16
+  #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+    #define ARM_TABLE_TWIDDLECOEF_F32_16
+    #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_32
+  #endif
+  #if defined(ARM_FFT_Q31)
+    #define ARM_TABLE_TWIDDLECOEF_Q31_16
+    #define ARM_TABLE_BITREVIDX_FXT_16
+  #endif
+#endif
+
+#if ARM_FFT_RFFT_LEN_ENABLED(64)
+  #define ARM_TABLE_BITREVIDX_FLT_32
+  #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+    #define ARM_TABLE_TWIDDLECOEF_F32_32
+    #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_64
+  #endif
+  #if defined(ARM_FFT_Q31)
+    #define ARM_TABLE_TWIDDLECOEF_Q31_32
+    #define ARM_TABLE_BITREVIDX_FXT_32
+  #endif
+#endif
+
+#if ARM_FFT_RFFT_LEN_ENABLED(128)
+  #define ARM_TABLE_BITREVIDX_FLT_64
+  #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+    #define ARM_TABLE_TWIDDLECOEF_F32_64
+    #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_128
+  #endif
+  #if defined(ARM_FFT_Q31)
+    #define ARM_TABLE_TWIDDLECOEF_Q31_64
+    #define ARM_TABLE_BITREVIDX_FXT_64
+  #endif
+#endif
+
+#if ARM_FFT_RFFT_LEN_ENABLED(256)
+  #define ARM_TABLE_BITREVIDX_FLT_128
+  #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+    #define ARM_TABLE_TWIDDLECOEF_F32_128
+    #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_256
+  #endif
+  #if defined(ARM_FFT_Q31)
+    #define ARM_TABLE_TWIDDLECOEF_Q31_128
+    #define ARM_TABLE_BITREVIDX_FXT_128
+  #endif
+#endif
+
+#if ARM_FFT_RFFT_LEN_ENABLED(512)
+  #define ARM_TABLE_BITREVIDX_FLT_256
+  #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+    #define ARM_TABLE_TWIDDLECOEF_F32_256
+    #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_512
+  #endif
+  #if defined(ARM_FFT_Q31)
+    #define ARM_TABLE_TWIDDLECOEF_Q31_256
+    #define ARM_TABLE_BITREVIDX_FXT_256
+  #endif
+#endif
+
+#if ARM_FFT_RFFT_LEN_ENABLED(1024)
+  #define ARM_TABLE_BITREVIDX_FLT_512
+  #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+    #define ARM_TABLE_TWIDDLECOEF_F32_512
+    #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_1024
+  #endif
+  #if defined(ARM_FFT_Q31)
+    #define ARM_TABLE_TWIDDLECOEF_Q31_512
+    #define ARM_TABLE_BITREVIDX_FXT_512
+  #endif
+#endif
+
+#if ARM_FFT_RFFT_LEN_ENABLED(2048)
+  #define ARM_TABLE_BITREVIDX_FLT_1024
+  #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+    #define ARM_TABLE_TWIDDLECOEF_F32_1024
+    #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_2048
+  #endif
+  #if defined(ARM_FFT_Q31)
+    #define ARM_TABLE_TWIDDLECOEF_Q31_1024
+    #define ARM_TABLE_BITREVIDX_FXT_1024
+  #endif
+#endif
+
+#if ARM_FFT_RFFT_LEN_ENABLED(4096)
+  #define ARM_TABLE_BITREVIDX_FLT_2048
+  #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+    #define ARM_TABLE_TWIDDLECOEF_F32_2048
+    #define ARM_TABLE_TWIDDLECOEF_RFFT_F32_4096
+  #endif
+  #if defined(ARM_FFT_Q31)
+    #define ARM_TABLE_TWIDDLECOEF_Q31_2048
+    #define ARM_TABLE_BITREVIDX_FXT_2048
+  #endif
+#endif
+
+#if defined(ARM_FFT_CFFT_PAIR)
+  #if ARM_FFT_RFFT_MAX_LEN == 4096
+    #define ARM_TABLE_BITREVIDX_FLT_4096
+    #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+      #define ARM_TABLE_TWIDDLECOEF_F32_4096
+    #endif
+  #elif ARM_FFT_RFFT_MAX_LEN == 2048
+    #define ARM_TABLE_BITREVIDX_FLT_2048
+    #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+      #define ARM_TABLE_TWIDDLECOEF_F32_2048
+    #endif
+  #elif ARM_FFT_RFFT_MAX_LEN == 1024
+    #define ARM_TABLE_BITREVIDX_FLT_1024
+    #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+      #define ARM_TABLE_TWIDDLECOEF_F32_1024
+    #endif
+  #elif ARM_FFT_RFFT_MAX_LEN == 512
+    #define ARM_TABLE_BITREVIDX_FLT_512
+    #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+      #define ARM_TABLE_TWIDDLECOEF_F32_512
+    #endif
+  #elif ARM_FFT_RFFT_MAX_LEN == 256
+    #define ARM_TABLE_BITREVIDX_FLT_256
+    #if !defined(ARM_FFT_TWIDDLE_IN_RAM)
+      #define ARM_TABLE_TWIDDLECOEF_F32_256
+    #endif
+  #endif
+#endif
+
+#if defined(ARM_FFT_Q31)
+  #if ARM_FFT_RFFT_MAX_LEN == 4096
+    #define ARM_TABLE_TWIDDLECOEF_Q31_4096
+  #elif ARM_FFT_RFFT_MAX_LEN == 2048
+    #define ARM_TABLE_TWIDDLECOEF_Q31_2048
+  #elif ARM_FFT_RFFT_MAX_LEN == 1024
+    #define ARM_TABLE_TWIDDLECOEF_Q31_1024
+  #elif ARM_FFT_RFFT_MAX_LEN == 512
+    #define ARM_TABLE_TWIDDLECOEF_Q31_512
+  #elif ARM_FFT_RFFT_MAX_LEN == 256
+    #define ARM_TABLE_TWIDDLECOEF_Q31_256
+  #endif
+#endif
+
+#endif /* !defined(ARM_FFT_ALL_LENGTHS) && !defined(ARM_DSP_CONFIG_TABLES) */
+
+#endif /* _ARM_FFT_TABLE_CONFIG_H */
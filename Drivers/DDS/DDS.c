@@ -3,9 +3,10 @@
 #include "tim.h"
 #include "math.h"
 #include "arm_math.h"
+#include "mem_section.h"
 
 DDS_TypeDef     		DDS;
-volatile uint16_t  		DDS_lut[LUT_LENGTH];
+volatile uint16_t  		DDS_lut[LUT_LENGTH] MEM_SRAM2;		// DAC 的DMA源，放在 SRAM2，与采集DMA写入的 SRAM1 错开
 
 /**
  * @brief       设置偏置电压
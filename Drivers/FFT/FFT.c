@@ -1,49 +1,323 @@
 #include "main.h"
 #include "FFT.h"
 #include "usart.h"
+#include "peak.h"
+#include "adc_conv.h"
 
-uint16_t *ADCbuff;								// 采样数据
-static float32_t ADC_ConvData[FFT_SIZE];		// ADC模拟值
-static float32_t fft_inputbuf[FFT_SIZE];  		// 用于FFT的输入数据
-static float32_t fft_outputbuf[FFT_SIZE];		// 保存FFT结果
-static float32_t mag[FFT_SIZE / 2];				// 保存FFT频域幅值
-static float32_t window[FFT_SIZE]; 				// 窗函数
-static float window_cg = 0.0f;					// 窗函数相干增益
+#if (FFT_SIZE > WINDOW_TABLE_LEN)
+#error "FFT_SIZE 超出窗表长度 WINDOW_TABLE_LEN"
+#endif
+#if (FFT_SIZE > FFT_PLAN_MAX_SIZE)
+#error "FFT_SIZE 超出FFT计划最大长度 FFT_PLAN_MAX_SIZE"
+#endif
+#if (FFT_HOP_MIN % ZOOM_CHUNK) != 0
+#error "FFT_HOP_MIN 须为 ZOOM_CHUNK 的整数倍，每次只把新到的一跳样本送入 Zoom-FFT"
+#endif
+#if (FFT_PIPELINES & FFT_PIPE_Q31) && !defined(ARM_FFT_Q31)
+#error "定点流水线需在 arm_fft_table_config.h 中定义 ARM_FFT_Q31"
+#endif
+#if (FFT_PIPELINES & FFT_PIPE_DEFAULT) == 0
+#error "FFT_PIPE_DEFAULT 须为 FFT_PIPELINES 中编译进的流水线"
+#endif
 
-bin_prev_t prev[2] = { 0 };
-tone_t tones[2] = { 0 };
+/**
+ * @brief       取第 k 个bin的复数频谱
+ * @note		浮点流水线直接读取 a->spec；定点流水线只在此处把该bin的整数值乘 qscale 转为浮点
+ * @param       a:	分析器
+ * @param		k:	bin下标
+ * @param		c:	输出，实部与虚部
+ * @retval      无
+ */
+static void spec_bin(const analyzer_t *a, uint32_t k, float32_t *c)
+{
+	if(a->pipe == FFT_PIPE_Q31)
+	{
+		const q31_t *X = a->work->buf.q;
 
+		c[0] = (float32_t)X[2U * k] * a->qscale;
+		c[1] = (float32_t)X[2U * k + 1U] * a->qscale;
+		return;
+	}
+	c[0] = a->spec[2U * k];
+	c[1] = a->spec[2U * k + 1U];
+}
 
 /**
- * @brief       信号处理
- * @note		暂时放在 FFT.c 中，后续可考虑更高层次的封装
- * @param       无
+ * @brief       取第 k 个bin的幅值
+ * @note		频谱只保存幅值平方，仅对实际用到的少数bin开方
+ * @param       a:	分析器
+ * @param		k:	bin下标
+ * @retval      幅值
+ */
+static float32_t bin_mag(const analyzer_t *a, uint32_t k)
+{
+	float32_t m, c[2];
+
+	if(a->pipe == FFT_PIPE_Q31)
+	{
+		spec_bin(a, k, c);
+		arm_sqrt_f32(c[0] * c[0] + c[1] * c[1], &m);
+		return m;
+	}
+	arm_sqrt_f32(a->work->mag_sq.f[k], &m);
+	return m;
+}
+
+
+/**
+ * @brief       第 k 个bin上峰值的分数bin偏移
+ * @note		相位差模式下沿用幅值抛物线插值，其余模式用带窗偏差校正的插值DFT；首末bin无相邻点，返回 0
+ * @param       a:	分析器
+ * @param		k:	峰值bin下标
+ * @retval      偏移，单位 bin
+ */
+static float32_t bin_offset(const analyzer_t *a, uint32_t k)
+{
+	float32_t X[6];
+
+	if(k == 0 || k + 1U >= a->fft_n / 2U)
+		return 0.0f;
+	if(a->freq_mode == FREQ_MODE_PHASE)
+		return interp_parabolic(bin_mag(a, k - 1), bin_mag(a, k), bin_mag(a, k + 1));
+	spec_bin(a, k - 1, &X[0]);
+	spec_bin(a, k, &X[2]);
+	spec_bin(a, k + 1, &X[4]);
+	return interp_dft(a->window, &X[2]);
+}
+
+/**
+ * @brief       用 Zoom-FFT 分辨粗谱中合并的两音
+ * @note		各粗峰各占一个细化槽，只送入新到的一跳样本（与 fft_n 无关，保证采集流首尾相接）；
+ *				局部谱每 ZOOM_FRAMES 帧更新一次，其间沿用上一次结果。
+ *				k1、k2 按新频率重算，两音主瓣重叠时自动模式据此退回时域最小二乘
+ * @param       a:		分析器
+ * @param		k1, k2:	粗估计bin下标，输入输出
+ * @param		f1, f2:	频率估计，输入输出
  * @retval      无
  */
-void process_signal(void)
+static void zoom_resolve(analyzer_t *a, uint32_t *k1, uint32_t *k2, float32_t *f1, float32_t *f2)
 {
-	// 开启FFT
-	FFT_start(BLACKMAN_HARRIS);
-	
+	float32_t zf[ZOOM_SLOTS * ZOOM_MAX_PEAKS], zA[ZOOM_SLOTS * ZOOM_MAX_PEAKS];
+	uint32_t s, i, n = 0, i1 = 0, i2;
+	uint8_t pair = 0;
+	float32_t sep = window_get(ZOOM_WINDOW)->mainlobe * ZOOM_RESOLUTION(a->fs);
+
+	zoom_center(a->zoom, 0, *k1 ? *f1 : 0.0f);
+	zoom_center(a->zoom, 1, *k2 ? *f2 : 0.0f);
+	if(a->hop_new != NULL)
+		zoom_feed(a->zoom, a->hop_new, a->hop, a->lsb, a->adc_dc - ADC_OFFSET);
+	a->hop_new = NULL;
+
+	for(s = 0; s < ZOOM_SLOTS; ++s)
+	{
+		uint32_t c = zoom_get(a->zoom, s, &zf[n], &zA[n]);
+		if(c > 1)
+			pair = 1;
+		n += c;
+	}
+	if(!pair)
+		return;
+
+	// 取最强的两个；两槽带宽重叠时同一音可能出现两次，间隔不足一个窗主瓣的视为同一音
+	for(i = 1; i < n; ++i)
+	{
+		if(zA[i] > zA[i1])
+			i1 = i;
+	}
+	i2 = n;
+	for(i = 0; i < n; ++i)
+	{
+		if(fabsf(zf[i] - zf[i1]) >= sep && (i2 == n || zA[i] > zA[i2]))
+			i2 = i;
+	}
+	if(i2 == n)
+		return;
+	*f1 = zf[i1];
+	*f2 = zf[i2];
+	*k1 = (uint32_t)(*f1 * (float32_t)a->fft_n / a->fs + 0.5f);
+	*k2 = (uint32_t)(*f2 * (float32_t)a->fft_n / a->fs + 0.5f);
+}
+
+/**
+ * @brief       初始化分析器
+ * @note		采样率取 SAMPLE_RATE，码值刻度取 ADC_GAIN，FFT长度与帧移取 FFT_SIZE，频率估计取 FREQ_MODE_AUTO，幅度估计取 AMP_MODE_TIME，
+ *				流水线取 FFT_PIPE_DEFAULT，不开启 Zoom-FFT
+ * @param       a:		分析器
+ * @param		work:	工作缓冲区，可与其他分析器共用，但不能同时处理
+ * @param		zoom:	Zoom-FFT 实例，NULL 表示该通道不支持细化
+ * @retval      无
+ */
+void analyzer_init(analyzer_t *a, analyzer_work_t *work, zoom_t *zoom)
+{
+	memset(a, 0, sizeof(*a));
+	a->work = work;
+	a->spec = work->buf.f;
+	a->zoom = zoom;
+	a->window = window_get(BLACKMAN_HARRIS);
+	a->plan = fft_plan_get(FFT_SIZE);
+	a->fs = (float32_t)SAMPLE_RATE;
+	a->lsb = ADC_GAIN;
+	a->fft_n = FFT_SIZE;
+	a->hop = FFT_SIZE;
+	a->amp_mode = AMP_MODE_TIME;
+	a->freq_mode = FREQ_MODE_AUTO;
+	a->pipe = FFT_PIPE_DEFAULT;
+	if(zoom != NULL)
+		zoom_set_rate(zoom, a->fs);
+}
+
+/**
+ * @brief       送入一跳新样本
+ * @note		帧移等于 FFT_SIZE 时不拷贝，直接在采集缓冲区中分析；否则移入滑动历史，
+ *				分析最新的 fft_n 个样本，历史不足 fft_n 时不分析。流不连续时清空历史与前帧相位
+ * @param       a:		分析器
+ * @param		x:		hop 个ADC原始码值，在 process_signal 返回前须保持有效
+ * @param		gap:	1 表示与上一跳不连续
+ * @retval      待分析的 fft_n 个样本，交给 process_signal；历史不足时为 NULL
+ */
+const uint16_t *FFT_Feed(analyzer_t *a, const uint16_t *x, uint8_t gap)
+{
+	return FFT_FeedStrided(a, x, 1, gap);
+}
+
+/**
+ * @brief       从交错排列的多通道样本中送入本通道的一跳
+ * @note		与 FFT_Feed 相同，但第 i 个样本取 x[i * stride]；stride 大于 1 时总是拷贝进滑动历史，
+ *				拷贝同时完成解交错，Zoom-FFT 也从历史中读取新样本
+ * @param       a:		分析器
+ * @param		x:		本通道第一个样本
+ * @param		stride:	相邻两个样本的间隔，即扫描的通道数
+ * @param		gap:	1 表示与上一跳不连续
+ * @retval      待分析的 fft_n 个样本；历史不足时为 NULL
+ */
+const uint16_t *FFT_FeedStrided(analyzer_t *a, const uint16_t *x, uint32_t stride, uint8_t gap)
+{
+	uint16_t *dst = a->hist + FFT_SIZE - a->hop;
+	uint32_t i;
+
+	if(gap)
+	{
+		a->hist_len = 0;
+		FFT_ResetPhase(a);
+	}
+	if(stride == 1 && a->hop == FFT_SIZE)
+	{
+		a->hop_new = x;
+		return x;
+	}
+
+	memmove(a->hist, a->hist + a->hop, (FFT_SIZE - a->hop) * sizeof(a->hist[0]));
+	if(stride == 1)
+		memcpy(dst, x, a->hop * sizeof(a->hist[0]));
+	else
+	{
+		for(i = 0; i < a->hop; ++i)
+			dst[i] = x[i * stride];
+	}
+	a->hop_new = dst;
+	a->hist_len += a->hop;
+	if(a->hist_len > FFT_SIZE)
+		a->hist_len = FFT_SIZE;
+	return (a->hist_len >= a->fft_n) ? a->hist + FFT_SIZE - a->fft_n : NULL;
+}
+
+/**
+ * @brief       两个分析器能否成对变换
+ * @note		须共用工作缓冲区，FFT长度与码值刻度相同，都使用浮点流水线，且有对应长度的复数FFT实例
+ * @param       a, b:	分析器
+ * @retval      1：可以；0：不可以
+ */
+static uint8_t pair_ok(const analyzer_t *a, const analyzer_t *b)
+{
+	return a->work == b->work && a->fft_n == b->fft_n && a->lsb == b->lsb
+		&& a->pipe == FFT_PIPE_F32 && b->pipe == FFT_PIPE_F32
+		&& fft_plan_cfft(a->fft_n) != NULL;
+}
+
+/**
+ * @brief       多通道批量处理
+ * @note		x 为 nch 个通道逐点交错的一跳样本，各通道依次解交错；
+ *				相邻两个通道都到齐且可以成对时由 process_pair 一次复数FFT得到两帧频谱，否则逐个 process_signal。
+ *				所有分析器须使用相同的帧移，可共用同一个工作缓冲区，FFT计划与窗表本就为全部通道共用
+ * @param       a:		分析器数组，第 c 个对应通道 c
+ * @param		nch:	通道数
+ * @param		x:		交错排列的 hop * nch 个ADC原始码值
+ * @param		gap:	1 表示与上一跳不连续
+ * @retval      本跳完成分析的通道位图，bit c 对应通道 c
+ */
+uint32_t process_channels(analyzer_t *a, uint32_t nch, const uint16_t *x, uint8_t gap)
+{
+	uint32_t c, pc = 0, done = 0;
+	const uint16_t *w, *pending = NULL;			// 尚未分析的通道 pc 的样本，等待与下一个到齐的通道配对
+
+	for(c = 0; c < nch; ++c)
+	{
+		w = FFT_FeedStrided(&a[c], x + c, nch, gap);
+		if(w == NULL)
+			continue;
+		done |= 1U << c;
+		if(pending != NULL && pair_ok(&a[pc], &a[c]))
+		{
+			process_pair(&a[pc], &a[c], pending, w);
+			pending = NULL;
+			continue;
+		}
+		if(pending != NULL)
+			process_signal(&a[pc], pending);
+		pending = w;
+		pc = c;
+	}
+	if(pending != NULL)
+		process_signal(&a[pc], pending);
+	return done;
+}
+
+/**
+ * @brief       由本帧频谱估计两音
+ * @note		频谱已由 FFT_start、FFT_StartPair 或 FFT_StartQ31 算出；依次找峰、插值与相位差估计频率、最小二乘估计幅度与相位。
+ *				定点流水线的峰值搜索在整数幅值平方上完成，只有插值与相位用到的bin转为浮点；频域最小二乘需要浮点频谱，改用时域法
+ * @param       a:	分析器
+ * @param		x:	本帧 fft_n 个ADC原始码值，时域最小二乘使用
+ * @retval      无
+ */
+static void analyze_spectrum(analyzer_t *a, const uint16_t *x)
+{
+	const float32_t *out = a->spec;
+	bin_prev_t *prev = a->prev;
+	tone_t *tones = a->tones;
+	uint16_t fft_n = a->fft_n;
+	uint8_t fix = (a->pipe == FFT_PIPE_Q31);
+
+	// 峰值搜索只需比较大小，省去逐点开方
+	if(fix)
+		arm_cmplx_mag_squared_q31(a->work->buf.q, a->work->mag_sq.q, fft_n / 2);
+	else
+		arm_cmplx_mag_squared_f32(out, a->work->mag_sq.f, fft_n / 2);
+
 	// 找到两信号粗估计bin下标
 	uint32_t k1 = 0, k2 = 0;
-	find_peaks(&k1, &k2);
+	find_peaks(a, &k1, &k2);
 
-	float32_t f1 = (float32_t)k1 * (float32_t)SAMPLE_RATE / (float32_t)FFT_SIZE;
-	float32_t f2 = (float32_t)k2 * (float32_t)SAMPLE_RATE / (float32_t)FFT_SIZE;
+	// 单帧插值得到分数bin估计：FFT长度小于帧移时，相位差法只能分辨 ±fs/(2*帧移)，需先把粗估计压到该范围内
+	float32_t d1 = bin_offset(a, k1), d2 = bin_offset(a, k2);
+	float32_t f1 = ((float32_t)k1 + d1) * a->fs / (float32_t)fft_n;
+	float32_t f2 = ((float32_t)k2 + d2) * a->fs / (float32_t)fft_n;
 
 	// 相位差法进一步精确
-	float32_t *c1 = &fft_outputbuf[k1 * 2U];	// 得到复数频率点
-	float32_t *c2 = &fft_outputbuf[k2 * 2U];
+	float32_t c1[2], c2[2];						// 得到复数频率点
+	spec_bin(a, k1, c1);
+	spec_bin(a, k2, c2);
 	float32_t phi1_now, phi2_now;				// 计算当前相位
 	arm_atan2_f32(c1[1], c1[0], &phi1_now);
 	arm_atan2_f32(c2[1], c2[0], &phi2_now);
 
-	float32_t frameT = (float32_t)FFT_SIZE / (float32_t)SAMPLE_RATE;	// 频移周期，即每帧间隔 4096 / 40k = 0.1024 s
-	if (prev[0].k == k1) {
+	float32_t frameT = (float32_t)a->hop / a->fs;	// 相邻两次分析的起点间隔 hop / fs，与FFT长度无关；可分辨 ±fs/(2*hop) 的频率余量
+	uint8_t pd = (a->freq_mode != FREQ_MODE_INTERP);	// 单帧模式不做相位差修正
+	if (pd && prev[0].k == k1) {
         float32_t phi_prev;
 		arm_atan2_f32(prev[0].im, prev[0].re, &phi_prev);
-        float32_t delta_phi = phi1_now - phi_prev;
+        float32_t delta_phi = phi1_now - phi_prev - 2.0f * M_PI * f1 * frameT;	// 扣除粗估计频率在一帧内的相位推进
+        delta_phi -= 2.0f * M_PI * floorf(delta_phi / (2.0f * M_PI) + 0.5f);
         if (delta_phi >  M_PI) 
 			delta_phi -= 2.0f * M_PI;
         if (delta_phi < -M_PI) 
@@ -51,10 +325,11 @@ void process_signal(void)
 
         f1 += delta_phi / (2.0f * M_PI * frameT);
     }
-    if (prev[1].k == k2) {
+    if (pd && prev[1].k == k2) {
         float32_t phi_prev;
 		arm_atan2_f32(prev[1].im, prev[1].re, &phi_prev);
-        float32_t delta_phi = phi2_now - phi_prev;
+        float32_t delta_phi = phi2_now - phi_prev - 2.0f * M_PI * f2 * frameT;	// 扣除粗估计频率在一帧内的相位推进
+        delta_phi -= 2.0f * M_PI * floorf(delta_phi / (2.0f * M_PI) + 0.5f);
         if (delta_phi >  M_PI) 
 			delta_phi -= 2.0f * M_PI;
         if (delta_phi < -M_PI) 
@@ -66,167 +341,108 @@ void process_signal(void)
 	// 更新前帧结构体
 	prev[0] = (bin_prev_t){c1[0], c1[1], k1};
 	prev[1] = (bin_prev_t){c2[0], c2[1], k2};
+
+	// Zoom-FFT：两音相距小于主瓣时粗谱只剩一个峰，在各粗峰附近以 ZOOM_RESOLUTION 的分辨率重新分辨；
+	// 某个粗峰分出两个峰时，取全部局部峰中最强的两个作为两音
+	if(a->zoom_on)
+		zoom_resolve(a, &k1, &k2, &f1, &f2);
 	
 	if(!k2)
 		f2 = 0.001f;
 		
 	tones[0].f = f1;  tones[1].f = f2;
 
-	// 最小二乘法计算幅度与相位
-	float32_t I1, Q1, I2, Q2;
-	least_square(tones[0].f, tones[1].f, ADC_ConvData, &I1, &Q1, &I2, &Q2);
+	// 最小二乘法计算幅度与相位：频域法只拟合各峰主瓣内的bin，失败或不适用时退回时域法
+	float32_t f[2] = { f1, f2 };
+	float32_t I[2], Q[2];
+	uint32_t lobe = (uint32_t)ceilf(a->window->mainlobe);
+	uint32_t K = (f2 > 100) ? 2 : 1;
+	uint8_t fd = !fix && ((a->amp_mode == AMP_MODE_FREQ)
+		|| (a->amp_mode == AMP_MODE_AUTO && (K == 1 || (k1 > k2 ? k1 - k2 : k2 - k1) >= 2 * lobe)));
+	if(lobe > LSQ_FD_MAX_HALF_BINS)
+		lobe = LSQ_FD_MAX_HALF_BINS;
+	if(!fd || !lsq_solve_fd(&a->work->lsq, f, K, a->fs, out, fft_n, a->window, lobe, I, Q))
+		lsq_solve(&a->work->lsq, f, K, a->fs, x, fft_n, a->lsb, a->adc_dc - ADC_OFFSET, I, Q);
 	tones[0].f = f1;
-	arm_sqrt_f32(I1 * I1 + Q1 * Q1, &tones[0].A);
-	arm_atan2_f32(Q1, I1, &tones[0].phi);
+	arm_sqrt_f32(I[0] * I[0] + Q[0] * Q[0], &tones[0].A);
+	arm_atan2_f32(Q[0], I[0], &tones[0].phi);
 	tones[1].f = f2;
-	if(f2 > 100)
+	if(K == 2)
+	{
+		arm_sqrt_f32(I[1] * I[1] + Q[1] * Q[1], &tones[1].A);
+		arm_atan2_f32(Q[1], I[1], &tones[1].phi);
+	}
+	else
 	{
-		arm_sqrt_f32(I2 * I2 + Q2 * Q2, &tones[1].A);
-		arm_atan2_f32(Q2, I2, &tones[1].phi);
-	}		
+		tones[1].A = 0;							// 只有一个音时 I[1]/Q[1] 未求解，清零以免沿用上一帧的结果
+		tones[1].phi = 0;
+	}
 }
 
 /**
- * @brief       最小二乘法计算幅度与相位
- * @note		得到的幅度为Vop，非Vopp
- * @param       f1, f2：			已确定频率
- * @param		x：					采样序列
- * @param		I1, Q1, I2, Q2：	求解参数组
+ * @brief       信号处理
+ * @note		只读写分析器 a 及其工作缓冲区，不同分析器可在不同线程中并行处理；结果写入 a->tones
+ * @param       a:	分析器
+ * @param		x:	fft_n 个ADC原始码值，通常由 FFT_Feed 给出
  * @retval      无
  */
-void least_square(float32_t f1, float32_t f2, const float32_t *x, 
-				float32_t *I1, float32_t *Q1, 
-				float32_t *I2, float32_t *Q2)
+void process_signal(analyzer_t *a, const uint16_t *x)
 {
-	// 计算一次角增量
-	float32_t w1 = 2.0f * M_PI * f1 / SAMPLE_RATE;
-    float32_t w2 = 2.0f * M_PI * f2 / SAMPLE_RATE;
-	
-	// 迭代生产sin, cos序列
-	float32_t c1 = arm_cos_f32(w1), s1 = arm_sin_f32(w1);
-    float32_t c2 = arm_cos_f32(w2), s2 = arm_sin_f32(w2);
-    float32_t cn1 = 1, sn1 = 0, cn2 = 1, sn2 = 0;
-	
-	float32_t Scc1 = 0,Sss1 = 0,Scc2 = 0,Sss2 = 0;
-    float32_t Scc12 = 0,Scs12 = 0,Ssc12 = 0,Sss12 = 0;
-    float32_t SxC1 = 0,SxS1 = 0,SxC2 = 0,SxS2 = 0;
-    for (uint32_t n = 0; n < FFT_SIZE; ++n) 
-	{
-        float32_t xn = x[n];
-        // 同频能量
-        Scc1 += cn1 * cn1;
-        Sss1 += sn1 * sn1;
-        Scc2 += cn2 * cn2;
-        Sss2 += sn2 * sn2;
-        // 跨频交叉项
-        Scc12 += cn1 * cn2;
-        Scs12 += cn1 * sn2;
-        Ssc12 += sn1 * cn2;
-        Sss12 += sn1 * sn2;
-        // 数据投影
-        SxC1 += xn * cn1;
-        SxS1 += xn * sn1;
-        SxC2 += xn * cn2;
-        SxS2 += xn * sn2;
-        // 迭代sin/cos
-        float ncn1 = cn1 * c1 - sn1 * s1;
-        float nsn1 = sn1 * c1 + cn1 * s1;
-        float ncn2 = cn2 * c2 - sn2 * s2;
-        float nsn2 = sn2 * c2 + cn2 * s2;
-        cn1 = ncn1; 
-		sn1 = nsn1; 
-		cn2 = ncn2; 
-		sn2 = nsn2;
-    }
-	
-	// 构建正交矩阵和投影向量，部分交叉项可近似为0
-	float32_t H[4][4] = {
-        {Scc1,    0,      Scc12,  Scs12},
-        {0,       Sss1,   Ssc12,  Sss12},
-        {Scc12,   Ssc12,  Scc2,   0    },
-        {Scs12,   Sss12,  0,      Sss2 }
-    };	
-	float32_t b[4] = {SxC1, SxS1, SxC2, SxS2};
-	
-	// 高斯消元
-    for (int k = 0; k < 4; k++) 
-	{
-        // 主元选择
-        int m = k;
-        float_t maxv = fabsf(H[k][k]);
-        for (int i = k + 1; i < 4; ++i) 
-		{
-			if(fabsf(H[i][k]) > maxv)
-			{
-				m = i;
-				maxv = fabsf(H[i][k]);
-			}
-		}
-        // 交换行		
-        for(int j = k; j < 4; ++j) 
-		{
-			float_t t = H[k][j]; 
-			H[k][j] = H[m][j]; 
-			H[m][j] = t;
-		} 
-        float32_t tb = b[k]; 
-		b[k] = b[m]; 
-		b[m] = tb;
-        
-        // 标准化主行
-        float32_t diag = H[k][k];
-        for (int j = k; j < 4; ++j) 
-			H[k][j] /= diag; 
-		
-		int test = 0;
-		if(k == 3)
-			test = 1;
-		
-		b[k] /= diag;
-		
-		// 消去下方得到上三角式
-        for (int i = k + 1; i < 4; ++i) 
-		{
-            float_t factor = H[i][k];
-            for(int j = k; j < 4; ++j) 
-				H[i][j] -= factor * H[k][j];
-			
-            b[i] -= factor * b[k];
-        }
-    }
-	
-	// 回代求解
-    float32_t theta[4];
-    for(int i = 3; i >= 0; --i)
+#if (FFT_PIPELINES & FFT_PIPE_Q31)
+	if(a->pipe == FFT_PIPE_Q31)
+		FFT_StartQ31(a, x, BLACKMAN_HARRIS);
+	else
+#endif
+		FFT_start(a, x, BLACKMAN_HARRIS);
+	analyze_spectrum(a, x);
+}
+
+/**
+ * @brief       成对信号处理
+ * @note		两帧实数序列经一次复数FFT得到各自的频谱（FFT_StartPair），再分别估计；结果与各自 process_signal 相同。
+ *				两帧频谱同时在工作缓冲区中，顺带由 a 最强音所在bin上的互谱求出 b 相对 a 的相位差写入 b->xphi：
+ *				同一bin上两帧的窗与bin偏移相同，相位差即两路该音的相位差。不能成对时退回逐个处理，b->xphi 清零
+ * @param       a, b:	分析器，须共用工作缓冲区
+ * @param		xa, xb:	各自 fft_n 个ADC原始码值
+ * @retval      无
+ */
+void process_pair(analyzer_t *a, analyzer_t *b, const uint16_t *xa, const uint16_t *xb)
+{
+	uint32_t k;
+	const float32_t *A, *B;
+
+	b->xphi = 0.0f;
+	if(!FFT_StartPair(a, b, xa, xb, BLACKMAN_HARRIS))
 	{
-        float32_t sum = b[i];
-        for(int j = i + 1; j < 4; ++j) 
-			sum -= H[i][j] * theta[j];
-		
-        theta[i] = sum;
-    }
-    
-	// 缩放比例
-//    float32_t scale = 2.0f/ (float32_t)FFT_SIZE ;
-    *I1 = theta[0];
-    *Q1 = theta[1];
-    *I2 = theta[2];
-    *Q2 = theta[3];
+		process_signal(a, xa);
+		process_signal(b, xb);
+		return;
+	}
+	analyze_spectrum(a, xa);
+	analyze_spectrum(b, xb);
+
+	k = a->prev[0].k;
+	if(k == 0)
+		return;
+	A = &a->spec[2U * k];
+	B = &b->spec[2U * k];
+	arm_atan2_f32(B[1] * A[0] - B[0] * A[1], B[0] * A[0] + B[1] * A[1], &b->xphi);
 }
 
 /**
  * @brief       相关法计算幅度与相位
  * @note		得到的幅度为Vop，非Vopp
- * @param       freq: 		已确定的频率
+ * @param       a:			分析器，取其FFT长度与采样率
+ * @param		freq: 		已确定的频率
  * @param		x:			采样序列
  * @param		A_out:		幅度输出
  * @pqarm		phi_out:	相位输出
  * @retval      无
  */
-void corr_amp_phase(float32_t freq, const float32_t *x, float32_t *A_out, float32_t *phi_out)
+void corr_amp_phase(const analyzer_t *a, float32_t freq, const float32_t *x, float32_t *A_out, float32_t *phi_out)
 {
 	// 计算一次角增量
-	float32_t w  = 2.0f * M_PI * freq / SAMPLE_RATE;
+	float32_t w  = 2.0f * M_PI * freq / a->fs;
 	float32_t c = arm_cos_f32(w);
 	float32_t s = arm_sin_f32(w);
 
@@ -235,7 +451,7 @@ void corr_amp_phase(float32_t freq, const float32_t *x, float32_t *A_out, float3
 	float32_t acc_cos = 0.0f, acc_sin = 0.0f;	
 
 	int n;
-	for(n = 0; n < FFT_SIZE; ++n)
+	for(n = 0; n < a->fft_n; ++n)
 	{
 		float32_t xn = x[n];
 		acc_cos += xn * cos_n;
@@ -249,12 +465,12 @@ void corr_amp_phase(float32_t freq, const float32_t *x, float32_t *A_out, float3
 	}
 
 //	float32_t scale = 2.0f / ((float32_t)FFT_SIZE * window_cg);		// 计算缩放比例
-	float32_t scale = 2.0f / (float32_t)FFT_SIZE;
-	float32_t a = acc_cos * scale;		// Asin(phi)
-	float32_t b = acc_sin * scale;		// Acos(phi)
+	float32_t scale = 2.0f / (float32_t)a->fft_n;
+	float32_t ac = acc_cos * scale;		// Asin(phi)
+	float32_t bs = acc_sin * scale;		// Acos(phi)
 
-	arm_sqrt_f32(a * a + b * b, A_out);
-	arm_atan2_f32(a, b, phi_out);
+	arm_sqrt_f32(ac * ac + bs * bs, A_out);
+	arm_atan2_f32(ac, bs, phi_out);
 }
 
 /**
@@ -273,38 +489,71 @@ float32_t interp_parabolic(float32_t left, float32_t center, float32_t right)
 }
 
 /**
- * @brief       开启FFT
- * @note		选择窗函数并做FFT处理
- * @param       window_type: 窗函数类型
- * @retval      无
+ * @brief       带窗插值DFT频率估计
+ * @note		Jacobsen 式比值 r = Re[(X[k-1] - X[k+1]) / (2X[k] - X[k-1] - X[k+1])]，DFT-even 窗相邻bin相位相差 pi，
+ *				比值只取决于真实偏移与窗形；由窗的偏差表（gen_window_table.py 离线生成）按 |r| 反查偏移，
+ *				汉宁窗下即 d = 2r。单帧即可得到远小于 0.01 bin 的偏差，不受前帧影响
+ * @param       win:	分析所用的窗
+ * @param		X:		峰值bin的复数频谱，X[-2]、X[-1] 与 X[2]、X[3] 为相邻bin
+ * @retval      偏移，单位 bin，-0.5 ~ 0.5
  */
-void FFT_start(uint8_t window_type)
+float32_t interp_dft(const window_table_t *win, const float32_t *X)
 {
-	int i;						// 计数器
-		
-	Init_window(window_type);
-	
-	float32_t sum_avr = 0.0f;
-	for(i = 0; i < FFT_SIZE; ++i)
+	const float32_t *t = win->bias;
+	float32_t nre = X[-2] - X[2], nim = X[-1] - X[3];
+	float32_t dre = 2.0f * X[0] - X[-2] - X[2], dim = 2.0f * X[1] - X[-1] - X[3];
+	float32_t den = dre * dre + dim * dim;
+	float32_t r, a;
+	uint32_t lo = 0, hi = WINDOW_BIAS_LEN - 1, mid;
+
+	if(den < 1e-30f)
+		return 0.0f;
+	r = (nre * dre + nim * dim) / den;
+	a = fabsf(r);
+	if(a >= t[hi])
+		return (r > 0.0f) ? 0.5f : -0.5f;
+
+	// 二分查找 t[lo] <= a < t[lo+1]，段内线性插值
+	while(hi - lo > 1)
 	{
-		ADC_ConvData[i] = (float32_t)ADCbuff[i] * 3.3f / 4096.0f;
-		sum_avr += ADC_ConvData[i];
+		mid = (lo + hi) / 2;
+		if(t[mid] <= a)
+			lo = mid;
+		else
+			hi = mid;
 	}
-	sum_avr = sum_avr / FFT_SIZE;
+	a = ((float32_t)lo + (a - t[lo]) / (t[hi] - t[lo])) * (0.5f / (WINDOW_BIAS_LEN - 1));
+	return (r > 0.0f) ? a : -a;
+}
+
+/**
+ * @brief       开启FFT
+ * @note		选择窗函数并做FFT处理，频谱在 a->spec；未编译浮点流水线时由 FFT_StartQ31 代替
+ * @param       a:				分析器
+ * @param		x:				fft_n 个ADC原始码值
+ * @param		window_type:	窗函数类型
+ * @retval      无
+ */
+void FFT_start(analyzer_t *a, const uint16_t *x, uint8_t window_type)
+{
+#if (FFT_PIPELINES & FFT_PIPE_F32)
+	analyzer_work_t *w = a->work;
+
+	Init_window(a, window_type);
 	
-	// 初始化FFT输入数组
-	for(i = 0; i < FFT_SIZE; ++i)
-	{
-		ADC_ConvData[i] = ADC_ConvData[i] - sum_avr;
-		fft_inputbuf[i] = ADC_ConvData[i] * window[i];
-	}
+	uint32_t n = a->fft_n;
 
-	// FFT
-	arm_rfft_fast_instance_f32 Rfft;
-	arm_rfft_fast_init_f32(&Rfft, FFT_SIZE);
+	// 码值转电压、去直流、加窗一次完成：均值在整数域由 SMLAD 累加，窗函数对称，前后两半共用半窗表，
+	// n 小于窗表长度时按步长抽取；时域帧放在工作缓冲区后半
+	adc_conv_win_f32(x, a->window->half, WINDOW_TABLE_LEN / n,
+						a->lsb, ADC_OFFSET, w->buf.f + FFT_SIZE, &a->adc_dc, n);
 
-	arm_rfft_fast_f32(&Rfft, fft_inputbuf, fft_outputbuf, 0);
-	arm_cmplx_mag_f32(fft_outputbuf, mag, FFT_SIZE);
+	// FFT，实例取自计划缓存，不再逐帧初始化；频谱放在工作缓冲区前半
+	arm_rfft_fast_f32(&a->plan->rfft, w->buf.f + FFT_SIZE, w->buf.f, 0);
+	a->spec = w->buf.f;
+#else
+	FFT_StartQ31(a, x, window_type);		// 未编译浮点流水线，工作缓冲区只够定点使用
+#endif
 	
 	
 	
@@ -322,43 +571,208 @@ void FFT_start(uint8_t window_type)
 }
 
 /**
- * @brief       找到模值最大的两个下标
- * @note		该函数仅针对本次分离两个信号的设计，更低耦合的方法应排序后根据需要选取前几项数据，但耗时更多一些
- * @param       k1: 能量较大信号的下标
- * @param		k2: 能量次之信号的下标
+ * @brief       拆分成对变换的频谱
+ * @note		z 为 a + j*b 的 n 点复数FFT，两路实数序列的频谱为
+ *				A[k] = (Z[k] + Z*[n-k]) / 2，B[k] = (Z[k] - Z*[n-k]) / 2j，k = 0 ~ n/2。
+ *				原地完成：k 与 n/2-k 两组一起处理，读写的恰是同样四个复数位置 k、n/2-k、n/2+k、n-k，
+ *				A 写入前 n/2 个复数位置，B 写入后 n/2 个；打包格式与 arm_rfft_fast_f32 相同，[0] 的虚部存放 n/2 处的实数值
+ * @param       z:	2n 个浮点数，复数FFT结果输入，两路频谱输出
+ * @param		n:	复数FFT长度
  * @retval      无
  */
-void find_peaks(uint32_t *k1, uint32_t *k2)
+static void fft_pair_split(float32_t *z, uint32_t n)
 {
-	float32_t m = 10;
-	int i = 0;
-	
-	for(int k = 0; k < FFT_SIZE / 2; ++k)
+	uint32_t h = n / 2, k, m, i;
+	float32_t zr[4], zi[4];
+
+	// 直流与 n/2：Z[0]、Z[n/2] 的实部属于 A，虚部属于 B
+	zr[0] = z[0];
+	zi[0] = z[1];
+	zr[1] = z[n];
+	zi[1] = z[n + 1];
+	z[0] = zr[0];
+	z[1] = zr[1];
+	z[n] = zi[0];
+	z[n + 1] = zi[1];
+
+	for(k = 1; k <= h / 2; ++k)
 	{
-		float32_t v = mag[k];
-		if(v > m)
+		uint32_t pos[4];
+
+		m = h - k;
+		pos[0] = k;						// Z[k]
+		pos[1] = n - k;					// Z[n-k]
+		pos[2] = m;						// Z[n/2-k]
+		pos[3] = n - m;					// Z[n/2+k]
+		for(i = 0; i < 4; ++i)
 		{
-			m = v;
-			i = k;
+			zr[i] = z[2U * pos[i]];
+			zi[i] = z[2U * pos[i] + 1U];
 		}
-	}
-	
-	*k1 = i;
-	i = 0;
-	m = 10;
-	for(int k = 0; k < FFT_SIZE / 2; ++k)
-	{
-		if(k > *k1 - 4 && k <*k1 + 4)
-			continue;
-		
-		float32_t v = mag[k];		
-		if(v > m)
+		// 第 i 组：A 写入 Z[k] 的位置，B 写入 Z[n/2+k] 的位置；k = n/4 时两组相同，只写一次
+		for(i = 0; i < ((k == m) ? 1U : 2U); ++i)
 		{
-			m = v;
-			i = k;
+			uint32_t p = 2U * i, q = 2U * i + 1U;
+			uint32_t kk = (i == 0) ? k : m;
+
+			z[2U * kk] = 0.5f * (zr[p] + zr[q]);
+			z[2U * kk + 1U] = 0.5f * (zi[p] - zi[q]);
+			z[2U * (h + kk)] = 0.5f * (zi[p] + zi[q]);
+			z[2U * (h + kk) + 1U] = 0.5f * (zr[q] - zr[p]);
 		}
 	}
-	*k2 = i;
+}
+
+/**
+ * @brief       成对开启FFT
+ * @note		两帧同长的实数序列分别作为实部与虚部，经一次 fft_n 点复数FFT后按共轭对称拆分，
+ *				得到与各自 FFT_start 相同的频谱：a->spec 为工作缓冲区前半，b->spec 为后半。
+ *				两个分析器须共用工作缓冲区、FFT长度与码值刻度相同
+ * @param       a, b:			分析器
+ * @param		xa, xb:			各自 fft_n 个ADC原始码值
+ * @param		window_type:	窗函数类型
+ * @retval      1：成功；0：不能成对，未做任何处理
+ */
+uint8_t FFT_StartPair(analyzer_t *a, analyzer_t *b, const uint16_t *xa, const uint16_t *xb, uint8_t window_type)
+{
+	analyzer_work_t *w = a->work;
+	uint32_t n = a->fft_n;
+
+	if(!pair_ok(a, b))
+		return 0;
+
+	Init_window(a, window_type);
+	Init_window(b, window_type);
+	adc_conv_pair_f32(xa, xb, a->window->half, WINDOW_TABLE_LEN / n,
+						a->lsb, ADC_OFFSET, w->buf.f, &a->adc_dc, &b->adc_dc, n);
+	arm_cfft_f32(fft_plan_cfft(n), w->buf.f, 0, 1);
+	fft_pair_split(w->buf.f, n);
+	a->spec = w->buf.f;
+	b->spec = w->buf.f + n;
+	return 1;
+}
+
+#if (FFT_PIPELINES & FFT_PIPE_Q31)
+/**
+ * @brief       定点实数FFT后处理
+ * @note		n 点实数序列按实虚交错视为 n/2 点复数序列，其复数FFT为 Z，则
+ *				X[k] = E[k] - j*W^k*O[k]，X[n/2-k] = (E[k] + j*W^k*O[k])*，
+ *				E[k] = (Z[k] + Z*[n/2-k]) / 2，O[k] = (Z[k] - Z*[n/2-k]) / 2，W = e^(-j*2*pi/n)。
+ *				k 与 n/2-k 一起原地处理，乘积在 64 位中累加后只舍入一次；结果再缩小一半以免溢出。
+ *				arm_cfft_q31 已缩小 n/2 倍，故输出为真实频谱的 1/n；打包格式与 arm_rfft_fast_f32 相同，[0] 的虚部存放 n/2 处的实数值
+ * @param       z:		n 个 q31，复数FFT结果输入，实数频谱输出
+ * @param		n:		实数FFT长度
+ * @param		tw:		旋转因子表，第 i*step 个复数为 cos/sin(2*pi*i/n)
+ * @param		step:	旋转因子步长
+ * @retval      各输出分量绝对值的按位或，供块浮点归一
+ */
+static uint32_t fft_q31_split(q31_t *z, uint32_t n, const q31_t *tw, uint32_t step)
+{
+	uint32_t h = n / 2, k, m, bits;
+	q31_t er, ei, orr, oi, c, s;
+	q63_t tr, ti;
+
+	// 直流与 n/2：X[0] = Re Z[0] + Im Z[0]，X[n/2] = Re Z[0] - Im Z[0]
+	er = z[0] >> 1;
+	ei = z[1] >> 1;
+	z[0] = er + ei;
+	z[1] = er - ei;
+	bits = (uint32_t)(z[0] ^ (z[0] >> 31)) | (uint32_t)(z[1] ^ (z[1] >> 31));
+
+	for(k = 1; k <= h / 2; ++k)
+	{
+		m = h - k;
+		er = (z[2U * k] >> 1) + (z[2U * m] >> 1);
+		ei = (z[2U * k + 1U] >> 1) - (z[2U * m + 1U] >> 1);
+		orr = (z[2U * k] >> 1) - (z[2U * m] >> 1);
+		oi = (z[2U * k + 1U] >> 1) + (z[2U * m + 1U] >> 1);
+		c = tw[2U * k * step];
+		s = tw[2U * k * step + 1U];
+
+		// T = -j*W^k*O = (c*oi - s*or) - j*(c*or + s*oi)，q62
+		tr = (q63_t)c * oi - (q63_t)s * orr;
+		ti = -((q63_t)c * orr + (q63_t)s * oi);
+
+		// (E ± T) / 2：E 移到 q61 与 T/2 相加，再回到 q31；k = n/4 时两组相同，只写一次
+		z[2U * k] = (q31_t)((((q63_t)er << 30) + (tr >> 1)) >> 31);
+		z[2U * k + 1U] = (q31_t)((((q63_t)ei << 30) + (ti >> 1)) >> 31);
+		bits |= (uint32_t)(z[2U * k] ^ (z[2U * k] >> 31)) | (uint32_t)(z[2U * k + 1U] ^ (z[2U * k + 1U] >> 31));
+		if(k == m)
+			break;
+		z[2U * m] = (q31_t)((((q63_t)er << 30) - (tr >> 1)) >> 31);
+		z[2U * m + 1U] = (q31_t)(((ti >> 1) - ((q63_t)ei << 30)) >> 31);
+		bits |= (uint32_t)(z[2U * m] ^ (z[2U * m] >> 31)) | (uint32_t)(z[2U * m + 1U] ^ (z[2U * m + 1U] >> 31));
+	}
+	return bits;
+}
+
+/**
+ * @brief       定点开启FFT
+ * @note		去直流、块浮点归一与加窗都在整数域完成（adc_conv_bfp_q31），时域帧放在工作缓冲区前 fft_n 个，
+ *				经 fft_n/2 点 q31 复数FFT与 fft_q31_split 原地得到打包的实数频谱；再整体左移到满幅作第二次块浮点归一，
+ *				使后续 arm_cmplx_mag_squared_q31 保留尽量多的有效位。两次的指数合入 a->qscale：
+ *				频谱整数值乘 qscale 即为浮点流水线 a->spec 中的对应值
+ * @param       a:				分析器
+ * @param		x:				fft_n 个ADC原始码值
+ * @param		window_type:	窗函数类型
+ * @retval      无
+ */
+void FFT_StartQ31(analyzer_t *a, const uint16_t *x, uint8_t window_type)
+{
+	q31_t *z = a->work->buf.q;
+	uint32_t n = a->fft_n, sum, s, t, bits;
+
+	Init_window(a, window_type);
+
+	s = adc_conv_bfp_q31(x, a->window->half_q15, WINDOW_TABLE_LEN / n, z, &sum, n);
+	a->adc_dc = a->lsb * ((float32_t)sum / (float32_t)n) + ADC_OFFSET;
+
+	arm_cfft_q31(&a->plan->cfft_q31, z, 0, 1);
+	bits = fft_q31_split(z, n, a->plan->split_q31, a->plan->split_step);
+
+	t = (bits != 0) ? __CLZ(bits) - 1U : 0U;
+	if(t > 0)
+		arm_shift_q31(z, (int8_t)t, z, n);
+
+	// 时域帧为 码值 * 2^(s+16) * 窗，频谱再乘 2^t / n
+	a->qscale = ldexpf(a->lsb * (float32_t)n, -(int32_t)(s + 16U + t));
+}
+#endif
+
+/**
+ * @brief       找到最强的两个峰值下标
+ * @note		由通用峰值检测 peak_find 单次遍历完成，最小间隔取当前窗的主瓣半宽，门限相对噪声基底设定；
+ *				定点流水线用 peak_find_q31，门限换算为整数后在整数域比较
+ * @param       a:	分析器
+ * @param		k1: 能量较大信号的下标，无峰值时为 0
+ * @param		k2: 能量次之信号的下标，无峰值时为 0
+ * @retval      无
+ */
+void find_peaks(const analyzer_t *a, uint32_t *k1, uint32_t *k2)
+{
+	peak_t pk[2];
+	uint32_t n = a->fft_n / 2;
+	uint32_t sep = (uint32_t)ceilf(a->window->mainlobe);
+	uint32_t cnt;
+
+	if(a->pipe == FFT_PIPE_Q31)
+	{
+		const q31_t *mag_sq = a->work->mag_sq.q;
+		float32_t t = peak_noise_floor_q31(mag_sq, n, a->work->floor) * PEAK_SNR_RATIO;
+		q31_t thresh = (t < 2147483648.0f) ? (q31_t)t : 0x7FFFFFFF;
+
+		cnt = peak_find_q31(mag_sq, n, thresh, sep, pk, 2);
+	}
+	else
+	{
+		const float32_t *mag_sq = a->work->mag_sq.f;
+		float32_t thresh = peak_noise_floor(mag_sq, n, a->work->floor) * PEAK_SNR_RATIO;
+
+		cnt = peak_find(mag_sq, n, thresh, sep, pk, 2);
+	}
+
+	*k1 = (cnt > 0) ? pk[0].k : 0;
+	*k2 = (cnt > 1) ? pk[1].k : 0;
 		
 //	float32_t m1 = 0, m2 = 0; 
 //	int i1 = 0, i2 = 0;
@@ -388,101 +802,228 @@ void find_peaks(uint32_t *k1, uint32_t *k2)
 
 /**
  * @brief       初始化窗函数
- * @note		对采样数据加窗函数后作FFT，并得到频域幅值
- * @param       window_type:	选择窗函数类型
+ * @note		窗表已离线生成并存放于 Flash，此处只切换当前窗，不再逐点计算
+ * @param       a:				分析器
+ * @param		window_type:	选择窗函数类型
  * @retval      无
  */
-void Init_window(uint8_t window_type)
+void Init_window(analyzer_t *a, uint8_t window_type)
 {
-	switch(window_type){
-		case HANNING:
-			window_hanning();
-			break;
-		case HAMMING:
-			window_hamming();
-			break;
-		case BLACKMAN:
-			window_blackman();
-			break;
-		case BLACKMAN_HARRIS:
-			window_blackmanHarris();
-			break;
-		default: break;
-	}
+	const window_table_t *win = window_get(window_type);
+	if(win == NULL)
+		return;
+
+	a->window = win;
 }
 
 /**
- * @brief       汉宁窗函数
- * @note		无
- * @param       无
+ * @brief       设置FFT长度
+ * @note		运行中切换，下一帧起生效；每次分析取 n 点参与运算，分析间隔由帧移决定
+ * @param       a:	分析器
+ * @param		n:	FFT长度，须为 FFT_PLAN_MIN_SIZE ~ FFT_SIZE 之间的 2 的幂
+ * @retval      1：成功；0：长度不支持，保持原长度
+ */
+uint8_t FFT_SetSize(analyzer_t *a, uint16_t n)
+{
+	const fft_plan_t *p;
+
+	if(n > FFT_SIZE)
+		return 0;
+
+	p = fft_plan_get(n);
+	if(p == NULL)
+		return 0;
+
+	if(n != a->fft_n)
+		FFT_ResetPhase(a);		// bin 间隔改变，前帧相位不再可比
+	a->plan = p;
+	a->fft_n = n;
+	return 1;
+}
+
+/**
+ * @brief       清除前帧相位
+ * @note		帧不连续（切换FFT长度、从跟踪模式退回捕获）时调用，下一帧不做相位差修正，Zoom-FFT 从头累积
+ * @param       a:	分析器
  * @retval      无
  */
-void window_hanning(void)
+void FFT_ResetPhase(analyzer_t *a)
 {
-	int i = 0;
-	float32_t sum = 0.0f;
-	for(i = 0; i < FFT_SIZE; ++i)
-	{
-		window[i] = 0.5f * (1.0f - arm_cos_f32(2.0f * M_PI * i / (FFT_SIZE - 1)));
-		sum += window[i];	
-	}
+	a->prev[0].k = 0;
+	a->prev[1].k = 0;
+	if(a->zoom != NULL)
+		zoom_reset(a->zoom);
+}
+
+/**
+ * @brief       设置采样率
+ * @note		采集源或定时器改变后调用，频率刻度、相位差基线与 Zoom-FFT 本振均由此换算；前帧相位随之作废
+ * @param       a:	分析器
+ * @param		fs:	实际采样率，单位 Hz
+ * @retval      无
+ */
+void FFT_SetSampleRate(analyzer_t *a, float32_t fs)
+{
+	if(fs <= 0.0f || fs == a->fs)
+		return;
 
-	window_cg = sum / (float32_t)FFT_SIZE;
+	a->fs = fs;
+	FFT_ResetPhase(a);
+	if(a->zoom != NULL)
+		zoom_set_rate(a->zoom, fs);
 }
 
 /**
- * @brief       汉明窗函数
- * @note		无
- * @param       无
+ * @brief       设置输入码值的刻度
+ * @note		直接分析 ADC 码值时为 ADC_GAIN；经抽取前端输出的扩展位宽码值须相应缩小，码值不超过 15 位
+ * @param       a:		分析器
+ * @param		lsb:	每个码值对应的电压，单位 V
  * @retval      无
  */
-void window_hamming(void)
+void FFT_SetLsb(analyzer_t *a, float32_t lsb)
 {
-	int i = 0;
-	float32_t sum = 0.0f;
-	for(i = 0; i < FFT_SIZE; ++i)
+	if(lsb > 0.0f)
+		a->lsb = lsb;
+}
+
+/**
+ * @brief       当前采样率
+ * @param       a:	分析器
+ * @retval      采样率，单位 Hz
+ */
+float32_t FFT_GetSampleRate(const analyzer_t *a)
+{
+	return a->fs;
+}
+
+/**
+ * @brief       设置帧移
+ * @note		运行中切换，清空滑动历史；帧移为 FFT_SIZE/4 时相邻分析窗重叠 75%，
+ *				每帧间隔得到 4 次估计，相位差法的基线随之缩短为 hop / fs
+ * @param       a:		分析器
+ * @param		hop:	帧移，须为 FFT_HOP_MIN ~ FFT_SIZE 之间的 2 的幂
+ * @retval      1：成功；0：不支持，保持原帧移
+ */
+uint8_t FFT_SetHop(analyzer_t *a, uint16_t hop)
+{
+	if(hop < FFT_HOP_MIN || hop > FFT_SIZE || (hop & (hop - 1)) != 0)
+		return 0;
+
+	if(hop != a->hop)
 	{
-		window[i] = 0.54f - 0.46f * arm_cos_f32(2.0f * M_PI * i / (FFT_SIZE - 1));
-		sum += window[i];
+		a->hist_len = 0;
+		FFT_ResetPhase(a);
 	}
+	a->hop = hop;
+	return 1;
+}
 
-	window_cg = sum / (float32_t)FFT_SIZE;
+/**
+ * @brief       当前帧移
+ * @param       a:	分析器
+ * @retval      帧移
+ */
+uint16_t FFT_GetHop(const analyzer_t *a)
+{
+	return a->hop;
 }
 
 /**
- * @brief       布莱克曼窗函数
- * @note		无
- * @param       无
+ * @brief       当前FFT长度
+ * @param       a:	分析器
+ * @retval      FFT长度
+ */
+uint16_t FFT_GetSize(const analyzer_t *a)
+{
+	return a->fft_n;
+}
+
+/**
+ * @brief       设置幅度/相位估计方式
+ * @note		运行中切换，下一帧起生效
+ * @param       a:		分析器
+ * @param		mode:	AMP_MODE_TIME、AMP_MODE_FREQ 或 AMP_MODE_AUTO
  * @retval      无
  */
-void window_blackman(void)
+void FFT_SetAmpMode(analyzer_t *a, uint8_t mode)
 {
-	int i = 0;
-	float32_t sum = 0.0f;
-	for(i = 0; i < FFT_SIZE; ++i)
-	{
-		window[i] = 0.42323f - 0.49755f * arm_cos_f32(2.0f * M_PI * i / (FFT_SIZE - 1)) + 0.07922f * arm_cos_f32(4.0f * M_PI * i / (FFT_SIZE - 1));
-		sum += window[i];
-	}
+	if(mode <= AMP_MODE_AUTO)
+		a->amp_mode = mode;
+}
+
+/**
+ * @brief       当前幅度/相位估计方式
+ * @param       a:	分析器
+ * @retval      AMP_MODE_TIME、AMP_MODE_FREQ 或 AMP_MODE_AUTO
+ */
+uint8_t FFT_GetAmpMode(const analyzer_t *a)
+{
+	return a->amp_mode;
+}
 
-	window_cg = sum / (float32_t)FFT_SIZE;
+/**
+ * @brief       开关 Zoom-FFT 细化
+ * @note		开启后每帧增加两个细化槽的混频与抽取运算，局部谱每 ZOOM_FRAMES 帧更新一次
+ * @param       a:	分析器
+ * @param		on:	1：开启；0：关闭
+ * @retval      1：成功；0：分析器没有 Zoom-FFT 实例
+ */
+uint8_t FFT_SetZoom(analyzer_t *a, uint8_t on)
+{
+	if(a->zoom == NULL)
+		return on ? 0 : 1;
+	if(!on)
+		zoom_reset(a->zoom);
+	a->zoom_on = on ? 1 : 0;
+	return 1;
 }
 
 /**
- * @brief       布莱克曼-哈里斯窗函数
- * @note		无
- * @param       无
+ * @brief       选择分析流水线
+ * @note		运行中切换，下一帧起生效；两条流水线的频谱刻度相同，前帧相位仍可比。
+ *				定点流水线不做成对变换，幅度/相位总用时域最小二乘
+ * @param       a:		分析器
+ * @param		pipe:	FFT_PIPE_F32 或 FFT_PIPE_Q31
+ * @retval      1：成功；0：该流水线未编译进 FFT_PIPELINES，保持原流水线
+ */
+uint8_t FFT_SetPipeline(analyzer_t *a, uint8_t pipe)
+{
+	if((pipe != FFT_PIPE_F32 && pipe != FFT_PIPE_Q31) || (FFT_PIPELINES & pipe) == 0)
+		return 0;
+
+	a->pipe = pipe;
+	return 1;
+}
+
+/**
+ * @brief       当前分析流水线
+ * @param       a:	分析器
+ * @retval      FFT_PIPE_F32 或 FFT_PIPE_Q31
+ */
+uint8_t FFT_GetPipeline(const analyzer_t *a)
+{
+	return a->pipe;
+}
+
+/**
+ * @brief       设置频率估计方式
+ * @note		运行中切换，下一帧起生效
+ * @param       a:		分析器
+ * @param		mode:	FREQ_MODE_PHASE、FREQ_MODE_INTERP 或 FREQ_MODE_AUTO
  * @retval      无
  */
-void window_blackmanHarris(void)
+void FFT_SetFreqMode(analyzer_t *a, uint8_t mode)
 {
-	int i = 0;
-	float32_t sum = 0.0f;
-	for(i = 0; i < FFT_SIZE; ++i)
-	{	
-		window[i] = 0.35875f - 0.48829f * arm_cos_f32(2.0f * M_PI * i / (FFT_SIZE - 1)) + 0.14128f * arm_cos_f32(4.0f * M_PI * i / (FFT_SIZE - 1)) - 0.01168f * arm_cos_f32(6.0f * M_PI * i / (FFT_SIZE - 1));
-		sum += window[i];
-	}
+	if(mode <= FREQ_MODE_AUTO)
+		a->freq_mode = mode;
+}
 
-	window_cg = sum / (float32_t)FFT_SIZE;
+/**
+ * @brief       当前频率估计方式
+ * @param       a:	分析器
+ * @retval      FREQ_MODE_PHASE、FREQ_MODE_INTERP 或 FREQ_MODE_AUTO
+ */
+uint8_t FFT_GetFreqMode(const analyzer_t *a)
+{
+	return a->freq_mode;
 }
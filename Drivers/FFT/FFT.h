@@ -4,15 +4,42 @@
 #include "main.h"
 #include "arm_math.h"
 #include "arm_const_structs.h"
+#include "window_table.h"
+#include "fft_plan.h"
+#include "lsq.h"
+#include "peak.h"
+#include "zoom.h"
 
-#define FFT_SIZE            4096			// 采样数量
-#define SAMPLE_RATE         40000           // 采样率
+#define FFT_SIZE            4096			// 采样数量，即最大FFT长度
+#define SAMPLE_RATE         40000           // 默认采样率，TIM3 触发；实际采样率由 FFT_SetSampleRate 设置
+#define ADC_GAIN            (3.3f / 4096.0f)    // ADC 增益校准，单位 V/LSB
+#define ADC_OFFSET          0.0f                // ADC 偏置校准，码值 0 对应的电压
+#define FFT_HOP_MIN         256                 // 最小帧移，帧移为该值 ~ FFT_SIZE 之间的 2 的幂
 
+// 分析流水线：浮点为码值转浮点后 arm_rfft_fast_f32；定点为块浮点 q31 复数FFT，只把用到的少数bin转为浮点
+#define FFT_PIPE_F32        0x01                // 浮点流水线
+#define FFT_PIPE_Q31        0x02                // 定点流水线，需定义 ARM_FFT_Q31
+#define FFT_PIPELINES       (FFT_PIPE_F32 | FFT_PIPE_Q31)	// 编译进的流水线，运行时由 FFT_SetPipeline 选择；只保留 FFT_PIPE_Q31 时工作缓冲区约减少 40%
+#define FFT_PIPE_DEFAULT    FFT_PIPE_F32        // 分析器初始化时选用的流水线
+
+#if (FFT_PIPELINES & FFT_PIPE_F32)
+#define FFT_WORK_LEN        (2 * FFT_SIZE)		// 浮点：实数FFT输出与时域帧各 FFT_SIZE 个
+#else
+#define FFT_WORK_LEN        FFT_SIZE			// 定点：时域帧、复数FFT与频谱原地共用 FFT_SIZE 个
+#endif
+
+// 幅度/相位估计方式
+enum{
+	AMP_MODE_TIME = 0,		// 时域最小二乘，遍历全部样本
+	AMP_MODE_FREQ = 1,		// 频域最小二乘，只用各峰值附近的bin，需余弦和窗
+	AMP_MODE_AUTO = 2		// 各峰主瓣不重叠且窗支持时用频域法，否则用时域法
+};
+
+// 频率估计方式
 enum{
-    HANNING = 1,            // 汉宁窗
-    HAMMING = 2,            // 汉明窗
-    BLACKMAN = 3,           // 布莱克曼窗
-    BLACKMAN_HARRIS = 4     // 布莱克曼-哈里斯窗
+	FREQ_MODE_PHASE = 0,	// 幅值抛物线插值粗估计，再由相邻两次分析的相位差精确
+	FREQ_MODE_INTERP = 1,	// 单帧插值DFT，不依赖前帧，适合跳频输入
+	FREQ_MODE_AUTO = 2		// 单帧插值DFT给出首帧结果，前帧相位可用时再由相位差精确
 };
 
 // 前帧状态结构体，在相位差算法精确中使用
@@ -29,16 +56,73 @@ typedef struct{
 	float32_t phi;
 } tone_t;
 
-void process_signal(void);
-void Init_window(uint8_t window_type);
-void FFT_start(uint8_t window_type);
-void find_peaks(uint32_t *k1, uint32_t *k2);
+// 分析器工作缓冲区，只在一次 process_signal / process_pair 内有效，不同时处理的分析器可共用一份
+typedef struct{
+	union{
+		float32_t f[FFT_WORK_LEN];			// 单帧：前半为实数FFT输出，后半为加窗后的时域帧；成对：整体为复数FFT缓冲区，拆分后前后两半各为一帧的频谱
+		q31_t q[FFT_WORK_LEN];				// 定点：前 FFT_SIZE 个依次为块浮点时域帧、复数FFT缓冲区与打包的实数频谱
+	} buf;
+	union{
+		float32_t f[FFT_SIZE / 2];			// 幅值平方
+		q31_t q[FFT_SIZE / 2];				// 定点幅值平方，arm_cmplx_mag_squared_q31 的输出
+	} mag_sq;
+	lsq_work_t lsq;							// 最小二乘求解缓冲区
+	float32_t floor[PEAK_FLOOR_NUM];		// 噪声基底中位数的抽样
+} analyzer_work_t;
+
+// 分析器，每个采集通道一个，保存该通道的配置、滑动历史与跨帧状态
+typedef struct{
+	analyzer_work_t *work;					// 工作缓冲区，由调用者分配
+	zoom_t *zoom;							// Zoom-FFT 实例，NULL 表示不支持细化
+	const fft_plan_t *plan;					// 当前FFT计划
+	const window_table_t *window;			// 当前窗
+	const float32_t *spec;					// 本帧频谱，实虚交错，位于工作缓冲区中；定点流水线下不用
+	float32_t qscale;						// 定点流水线：本帧频谱整数值到浮点频谱的比例，随块指数逐帧变化
+	float32_t fs;							// 采样率，单位 Hz
+	float32_t lsb;							// 每个输入码值对应的电压，单位 V
+	uint16_t fft_n;							// FFT长度
+	uint16_t hop;							// 帧移
+	uint8_t amp_mode;						// 幅度/相位估计方式
+	uint8_t freq_mode;						// 频率估计方式
+	uint8_t zoom_on;						// Zoom-FFT 是否开启
+	uint8_t pipe;							// 分析流水线，FFT_PIPE_F32 或 FFT_PIPE_Q31
+	float32_t adc_dc;						// 当前帧直流电平，单位 V
+	const uint16_t *hop_new;				// 本跳新到的样本，待送入 Zoom-FFT
+	uint32_t hist_len;						// 滑动历史中的有效样本数
+	uint16_t hist[FFT_SIZE];				// 滑动历史，帧移小于 FFT_SIZE 时使用
+	bin_prev_t prev[2];						// 前帧峰值bin
+	tone_t tones[2];						// 分析结果
+	float32_t xphi;							// 成对分析时配对通道最强音处本通道相对其的相位差，单位 rad
+} analyzer_t;
+
+void analyzer_init(analyzer_t *a, analyzer_work_t *work, zoom_t *zoom);
+void process_signal(analyzer_t *a, const uint16_t *x);
+void process_pair(analyzer_t *a, analyzer_t *b, const uint16_t *xa, const uint16_t *xb);
+uint32_t process_channels(analyzer_t *a, uint32_t nch, const uint16_t *x, uint8_t gap);
+const uint16_t *FFT_Feed(analyzer_t *a, const uint16_t *x, uint8_t gap);
+const uint16_t *FFT_FeedStrided(analyzer_t *a, const uint16_t *x, uint32_t stride, uint8_t gap);
+void FFT_SetSampleRate(analyzer_t *a, float32_t fs);
+float32_t FFT_GetSampleRate(const analyzer_t *a);
+void FFT_SetLsb(analyzer_t *a, float32_t lsb);
+uint8_t FFT_SetHop(analyzer_t *a, uint16_t hop);
+uint16_t FFT_GetHop(const analyzer_t *a);
+uint8_t FFT_SetSize(analyzer_t *a, uint16_t n);
+uint16_t FFT_GetSize(const analyzer_t *a);
+void FFT_ResetPhase(analyzer_t *a);
+void FFT_SetAmpMode(analyzer_t *a, uint8_t mode);
+uint8_t FFT_GetAmpMode(const analyzer_t *a);
+void FFT_SetFreqMode(analyzer_t *a, uint8_t mode);
+uint8_t FFT_GetFreqMode(const analyzer_t *a);
+uint8_t FFT_SetZoom(analyzer_t *a, uint8_t on);
+uint8_t FFT_SetPipeline(analyzer_t *a, uint8_t pipe);
+uint8_t FFT_GetPipeline(const analyzer_t *a);
+void Init_window(analyzer_t *a, uint8_t window_type);
+void FFT_start(analyzer_t *a, const uint16_t *x, uint8_t window_type);
+void FFT_StartQ31(analyzer_t *a, const uint16_t *x, uint8_t window_type);
+uint8_t FFT_StartPair(analyzer_t *a, analyzer_t *b, const uint16_t *xa, const uint16_t *xb, uint8_t window_type);
+void find_peaks(const analyzer_t *a, uint32_t *k1, uint32_t *k2);
 float32_t interp_parabolic(float32_t left, float32_t center, float32_t right);
-void corr_amp_phase(float32_t freq, const float32_t *x, float32_t *A_out, float32_t *phi_out);
-void least_square(float32_t f1, float32_t f2, const float32_t *x, float32_t *I1, float32_t *Q1, float32_t *I2, float32_t *Q2);
-void window_hanning(void);
-void window_hamming(void);
-void window_blackman(void);
-void window_blackmanHarris(void);
+float32_t interp_dft(const window_table_t *win, const float32_t *X);
+void corr_amp_phase(const analyzer_t *a, float32_t freq, const float32_t *x, float32_t *A_out, float32_t *phi_out);
 
 #endif
@@ -0,0 +1,111 @@
+#include "adapt.h"
+
+// 自适应状态
+typedef struct{
+	uint8_t fine;								// 1：精测；0：粗测
+	uint32_t frames;							// 本次精测已分析的帧数
+} adapt_t;
+
+static adapt_t adp = { 0 };
+
+
+/**
+ * @brief       各通道中最高的有效音
+ * @param       a:		分析器数组
+ * @param		nch:	通道数
+ * @retval      频率，单位 Hz；无有效音时为 0
+ */
+static float32_t adapt_highest(const analyzer_t *a, uint32_t nch)
+{
+	uint32_t c, k;
+	float32_t f = 0.0f;
+
+	for(c = 0; c < nch; ++c)
+	{
+		for(k = 0; k < 2; ++k)
+		{
+			const tone_t *t = &a[c].tones[k];
+			if(t->f > ADAPT_MIN_FREQ && t->A >= ADAPT_AMP_FLOOR && t->f > f)
+				f = t->f;
+		}
+	}
+	return f;
+}
+
+/**
+ * @brief       回到粗测
+ * @note		采集重新开始或手动改变采样率后调用，下一帧按粗测处理
+ * @param       无
+ * @retval      无
+ */
+void adapt_reset(void)
+{
+	adp.fine = 0;
+	adp.frames = 0;
+}
+
+/**
+ * @brief       提交一帧分析结果，决定下一帧的采样率
+ * @note		粗测帧：最高音 f 的目标采样率为 f / (0.5 * ADAPT_NYQ_TARGET)，限制在 ADAPT_FS_MIN ~ ADAPT_FS_COARSE，转入精测；
+ *				精测帧：最高音超过 ADAPT_NYQ_HIGH、信号消失或满 ADAPT_RECHECK 帧时回到 ADAPT_FS_COARSE。
+ *				目标与当前采样率相差不足 ADAPT_FS_TOL 时不切换，免得重启采集
+ * @param       a:		刚完成分析的分析器数组，各通道采样率相同
+ * @param		nch:	通道数
+ * @param		fs:		需要切换时输出目标采样率，单位 Hz
+ * @retval      1：需切换采样率；0：保持
+ */
+uint8_t adapt_update(const analyzer_t *a, uint32_t nch, float32_t *fs)
+{
+	float32_t f = adapt_highest(a, nch);
+	float32_t cur = a[0].fs, want;
+
+	if(adp.fine)
+	{
+		if(f > 0.0f && f < ADAPT_NYQ_HIGH * 0.5f * cur && ++adp.frames < ADAPT_RECHECK)
+			return 0;
+		adp.fine = 0;
+		want = ADAPT_FS_COARSE;
+	}
+	else if(f <= 0.0f)
+	{
+		want = ADAPT_FS_COARSE;
+	}
+	else
+	{
+		want = f / (0.5f * ADAPT_NYQ_TARGET);
+		if(want < ADAPT_FS_MIN)
+			want = ADAPT_FS_MIN;
+		if(want > ADAPT_FS_COARSE)
+			want = ADAPT_FS_COARSE;
+		adp.fine = 1;
+		adp.frames = 0;
+	}
+
+	if(fabsf(want - cur) <= ADAPT_FS_TOL * cur)
+		return 0;
+	*fs = want;
+	return 1;
+}
+
+/**
+ * @brief       跟踪模式下计入精测帧数
+ * @note		跟踪锁定期间不做全帧分析，adapt_update 不会被调用；由主循环按经过的帧数调用本函数，
+ *				满 ADAPT_RECHECK 帧时同样回到粗测，调用者须先退出跟踪再切换采样率
+ * @param       a:		跟踪所用的分析器，取其当前采样率
+ * @param		frames:	自上次调用以来经过的帧数
+ * @param		fs:		需要切换时输出粗测采样率，单位 Hz
+ * @retval      1：需退出跟踪并切换采样率；0：保持
+ */
+uint8_t adapt_tracked(const analyzer_t *a, uint32_t frames, float32_t *fs)
+{
+	if(!adp.fine)
+		return 0;
+	adp.frames += frames;
+	if(adp.frames < ADAPT_RECHECK)
+		return 0;
+	adp.fine = 0;
+	if(fabsf(ADAPT_FS_COARSE - a->fs) <= ADAPT_FS_TOL * a->fs)
+		return 0;
+	*fs = ADAPT_FS_COARSE;
+	return 1;
+}
@@ -0,0 +1,30 @@
+#ifndef _ADAPT_H
+#define _ADAPT_H
+
+#include "main.h"
+#include "arm_math.h"
+#include "FFT.h"
+
+/*
+ * 自适应采样率
+ * 先以 ADAPT_FS_COARSE 粗测，找到最高的音后把 TIM3 采样率调到使该音落在奈奎斯特频率 ADAPT_NYQ_TARGET 处，
+ * 再在新采样率下精测：同样的 FFT_SIZE 点覆盖更窄的带宽，bin 间隔随之变细。
+ * 精测时最高音逼近奈奎斯特频率或信号消失即回到粗测；高于奈奎斯特频率的新音会折叠而无法从精测帧中发现，
+ * 故每 ADAPT_RECHECK 帧定期回到粗测一次；跟踪模式锁定期间的帧同样计入，到期时退出跟踪再回到粗测。只适用于 TIM3 触发的采集源
+ */
+
+#define ADAPT_ENABLE        1                   // 置 1 时按输入自动切换采样率
+#define ADAPT_FS_COARSE     200000.0f           // 粗测采样率，单位 Hz，亦为上限；输入前端须在其一半以上充分衰减
+#define ADAPT_FS_MIN        2000.0f             // 精测采样率下限，单位 Hz
+#define ADAPT_NYQ_TARGET    0.8f                // 精测时最高音在奈奎斯特频率中的目标位置
+#define ADAPT_NYQ_HIGH      0.9f                // 精测时最高音超过该比例即回到粗测
+#define ADAPT_FS_TOL        0.1f                // 目标与当前采样率相差不足该比例时不切换
+#define ADAPT_RECHECK       64                  // 精测每隔该帧数回到粗测复查一次
+#define ADAPT_MIN_FREQ      100.0f              // 参与判断的最低频率，单位 Hz，与双音判定一致
+#define ADAPT_AMP_FLOOR     0.01f               // 参与判断的最小幅度，单位 V
+
+void adapt_reset(void);
+uint8_t adapt_update(const analyzer_t *a, uint32_t nch, float32_t *fs);
+uint8_t adapt_tracked(const analyzer_t *a, uint32_t frames, float32_t *fs);
+
+#endif
@@ -0,0 +1,195 @@
+#include "adc_conv.h"
+#include "mem_section.h"
+
+#if MEM_RAMFUNC_WIN
+#define ADC_CONV_HOT        MEM_RAMFUNC     // 浮点加窗放入 SRAM2 执行
+#else
+#define ADC_CONV_HOT
+#endif
+
+
+/**
+ * @brief       码值整数求和
+ * @note		ARM_MATH_DSP 时每次读两个码值，以 1:1 权重的 SMLAD 累加
+ * @param       x:	码值
+ * @param		n:	点数
+ * @retval      码值之和
+ */
+static uint32_t adc_conv_sum(const uint16_t *x, uint32_t n)
+{
+	const q15_t *p = (const q15_t *)x;
+	uint32_t cnt, sum = 0;
+
+#if defined(ARM_MATH_DSP)
+	q31_t in1, in2;
+
+	for(cnt = n >> 2; cnt > 0; --cnt)
+	{
+		in1 = read_q15x2_ia(&p);
+		in2 = read_q15x2_ia(&p);
+		sum = __SMLAD(in1, 0x00010001, sum);
+		sum = __SMLAD(in2, 0x00010001, sum);
+	}
+	cnt = n & 3U;
+#else
+	cnt = n;
+#endif
+	for(; cnt > 0; --cnt)
+		sum += (uint16_t)*p++;
+	return sum;
+}
+
+/**
+ * @brief       码值转电压、去直流并加窗
+ * @note		y[n] = (x[n] * gain - gain * mean) * w[n]，每点一次乘减与一次乘法；
+ *				offset 在去直流后抵消，只影响 *mean
+ * @param       x:		码值
+ * @param		win:	半窗表
+ * @param		stride:	半窗表步长
+ * @param		gain:	每个码值对应的电压
+ * @param		offset:	码值 0 对应的电压
+ * @param		y:		浮点输出帧
+ * @param		mean:	帧的直流电平输出，单位 V，可为 NULL
+ * @param		n:		点数
+ * @retval      无
+ */
+ADC_CONV_HOT void adc_conv_win_f32(const uint16_t *x, const float32_t *win, uint32_t stride, float32_t gain, float32_t offset,
+					float32_t *y, float32_t *mean, uint32_t n)
+{
+	const float32_t *w = win;
+	uint32_t half = n >> 1, k, cnt;
+	int32_t step = (int32_t)stride;						// 后半倒序，步长取负
+	float32_t gmean = gain * ((float32_t)adc_conv_sum(x, n) / (float32_t)n);
+
+	if(mean != NULL)
+		*mean = gmean + offset;
+
+	// 前半从 w[0] 顺序取窗，后半从 w[n/2] 倒序取窗
+	for(k = 0; k < 2; ++k)
+	{
+#if defined(ARM_MATH_DSP)
+		const q15_t *p = (const q15_t *)x;
+		q31_t in;
+
+		for(cnt = half >> 1; cnt > 0; --cnt)
+		{
+			in = read_q15x2_ia(&p);
+			*y++ = ((float32_t)(in & 0xFFFF) * gain - gmean) * *w;
+			w += step;
+			*y++ = ((float32_t)((uint32_t)in >> 16) * gain - gmean) * *w;
+			w += step;
+		}
+		x = (const uint16_t *)p;
+		cnt = half & 1U;
+#else
+		cnt = half;
+#endif
+		for(; cnt > 0; --cnt)
+		{
+			*y++ = ((float32_t)*x++ * gain - gmean) * *w;
+			w += step;
+		}
+		w = win + half * stride;
+		step = -step;
+	}
+}
+
+/**
+ * @brief       两帧码值合为一个加窗的复数帧
+ * @note		与 adc_conv_win_f32 相同的转换，A 帧写入实部、B 帧写入虚部：
+ *				z[2n] = gain * (xa[n] - mean_a) * w[n]，z[2n+1] = gain * (xb[n] - mean_b) * w[n]；
+ *				其复数FFT按共轭对称拆出两个实数频谱 A[k] = (Z[k] + Z*[N-k]) / 2，B[k] = (Z[k] - Z*[N-k]) / 2j
+ * @param       xa, xb:	两帧码值
+ * @param		win:	半窗表
+ * @param		stride:	半窗表步长
+ * @param		gain:	每个码值对应的电压
+ * @param		offset:	码值 0 对应的电压
+ * @param		z:		交错的复数输出帧，2n 个值
+ * @param		mean_a, mean_b:	两帧的直流电平输出，单位 V，可为 NULL
+ * @param		n:		每帧点数
+ * @retval      无
+ */
+void adc_conv_pair_f32(const uint16_t *xa, const uint16_t *xb, const float32_t *win, uint32_t stride,
+					float32_t gain, float32_t offset, float32_t *z, float32_t *mean_a, float32_t *mean_b, uint32_t n)
+{
+	const float32_t *w = win;
+	uint32_t half = n >> 1, k, cnt;
+	int32_t step = (int32_t)stride;
+	float32_t ga = gain * ((float32_t)adc_conv_sum(xa, n) / (float32_t)n);
+	float32_t gb = gain * ((float32_t)adc_conv_sum(xb, n) / (float32_t)n);
+	float32_t v;
+
+	if(mean_a != NULL)
+		*mean_a = ga + offset;
+	if(mean_b != NULL)
+		*mean_b = gb + offset;
+
+	for(k = 0; k < 2; ++k)
+	{
+		for(cnt = half; cnt > 0; --cnt)
+		{
+			v = *w;
+			*z++ = ((float32_t)*xa++ * gain - ga) * v;
+			*z++ = ((float32_t)*xb++ * gain - gb) * v;
+			w += step;
+		}
+		w = win + half * stride;
+		step = -step;
+	}
+}
+
+/**
+ * @brief       码值去直流、块浮点归一并加窗，输出 q31
+ * @note		全部在整数域完成：mean = round(sum / n)，peak = max|x[n] - mean|，
+ *				取使 (peak << s) < 2^15 的最大 s，z[n] = ((x[n] - mean) << s) * w[n] * 2，w 为 q15。
+ *				无论信号大小每帧都用满 q31 的范围，后续 arm_cfft_q31 的相对精度与电平无关；
+ *				对应电压为 z[n] * gain / 2^(s + 16)。均值取整后残留的不足半个码值的直流只落在窗的前几个bin
+ * @param       x:		码值
+ * @param		win:	q15 半窗表
+ * @param		stride:	半窗表步长
+ * @param		z:		q31 输出帧
+ * @param		sum:	码值之和输出，可为 NULL
+ * @param		n:		点数
+ * @retval      块指数 s，即去直流后码值的左移位数
+ */
+uint32_t adc_conv_bfp_q31(const uint16_t *x, const q15_t *win, uint32_t stride, q31_t *z, uint32_t *sum, uint32_t n)
+{
+	const uint16_t *p = x;
+	const q15_t *w = win;
+	uint32_t half = n >> 1, k, cnt, s, acc = 0;
+	int32_t step = (int32_t)stride;
+	int32_t lo, hi, mean, peak, v;
+
+	// 第一遍：整数和与取值范围
+	lo = hi = (int32_t)x[0];
+	for(cnt = n; cnt > 0; --cnt)
+	{
+		v = (int32_t)*p++;
+		acc += (uint32_t)v;
+		if(v < lo)
+			lo = v;
+		else if(v > hi)
+			hi = v;
+	}
+	if(sum != NULL)
+		*sum = acc;
+
+	mean = (int32_t)((acc + half) / n);
+	peak = (hi - mean > mean - lo) ? (hi - mean) : (mean - lo);
+	s = (peak > 0) ? (__CLZ((uint32_t)peak) - 17U) : 0U;
+
+	// 第二遍：移位后乘窗，每点一次乘法
+	p = x;
+	for(k = 0; k < 2; ++k)
+	{
+		for(cnt = half; cnt > 0; --cnt)
+		{
+			v = ((int32_t)*p++ - mean) << s;
+			*z++ = (v * (q31_t)*w) << 1;
+			w += step;
+		}
+		w = win + half * stride;
+		step = -step;
+	}
+	return s;
+}
@@ -0,0 +1,20 @@
+#ifndef _ADC_CONV_H
+#define _ADC_CONV_H
+
+#include "main.h"
+#include "arm_math.h"
+
+/*
+ * ADC 码值帧的预处理：去直流、加窗与格式转换一次完成
+ * 输入为右对齐的无符号码值，12 位 ADC 为 0 ~ 4095，抽取前端输出可达 15 位；帧长须为偶数。
+ * 窗函数按 DFT 偶对称 w[n] = w[N - n] 只存前半，w[n] 取半窗表第 n * stride 项，后半倒序复用。
+ * 均值在整数域累加，15 位码值时帧长不超过 2^17 不会溢出
+ */
+
+void adc_conv_win_f32(const uint16_t *x, const float32_t *win, uint32_t stride, float32_t gain, float32_t offset,
+					float32_t *y, float32_t *mean, uint32_t n);
+void adc_conv_pair_f32(const uint16_t *xa, const uint16_t *xb, const float32_t *win, uint32_t stride,
+					float32_t gain, float32_t offset, float32_t *z, float32_t *mean_a, float32_t *mean_b, uint32_t n);
+uint32_t adc_conv_bfp_q31(const uint16_t *x, const q15_t *win, uint32_t stride, q31_t *z, uint32_t *sum, uint32_t n);
+
+#endif
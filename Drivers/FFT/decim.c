@@ -0,0 +1,214 @@
+#include "decim.h"
+
+#if (DECIM_CHUNK % DECIM_RATIO) != 0
+#error "DECIM_CHUNK 须为 DECIM_RATIO 的整数倍"
+#endif
+#if (DECIM_IN_BLOCK % DECIM_CHUNK) != 0
+#error "DECIM_IN_BLOCK 须为 DECIM_CHUNK 的整数倍"
+#endif
+#if (DECIM_IN_BLOCK > FFT_SIZE) || ((FFT_SIZE % DECIM_IN_BLOCK) != 0)
+#error "DECIM_IN_BLOCK 须整除采集帧长 ACQ_FRAME_LEN"
+#endif
+#if (12 + DECIM_EXTRA_BITS) > 15
+#error "输出码值不得超过 15 位"
+#endif
+
+#define DECIM_DESIGN_STEPS  128                 // 补偿FIR设计时频域积分的点数
+#define DECIM_SETTLE_OUT    ((DECIM_CIC_ORDER + DECIM_TAPS + DECIM_FIR_D - 1) / DECIM_FIR_D)	// 滤波器填满前的输出点数
+#define DECIM_SETTLE        ((DECIM_SETTLE_OUT + DECIM_OUT_BLOCK - 1) / DECIM_OUT_BLOCK)		// 丢弃的输出块数
+
+static float32_t decim_h[DECIM_TAPS];			// 补偿FIR系数，decim_init 后只读，各实例共用
+static float32_t decim_cic_scale;				// CIC 直流增益 R^N 的倒数
+
+
+/**
+ * @brief       CIC 在 CIC 输出采样率归一化频率 v 处的幅频响应
+ * @note		|H(v)| = |sin(pi*v) / (R*sin(pi*v/R))|^N，直流增益已归一为 1
+ * @param       v:	频率，单位为 CIC 输出采样率
+ * @retval      幅度
+ */
+static float32_t decim_cic_response(float32_t v)
+{
+	float32_t s, r = 1.0f;
+	uint32_t k;
+
+	if(v < 1e-6f)
+		return 1.0f;
+	s = fabsf(sinf(PI * v) / ((float32_t)DECIM_CIC_R * sinf(PI * v / (float32_t)DECIM_CIC_R)));
+	for(k = 0; k < DECIM_CIC_ORDER; ++k)
+		r *= s;
+	return r;
+}
+
+/**
+ * @brief       设计补偿FIR，上电后调用一次
+ * @note		理想响应在 0 ~ 1/(2*D) 内为 1/|H_cic|，其外为 0，按频率采样的逆傅里叶变换
+ *				h[n] = 2 * sum(C(v) * cos(2*pi*v*(n-m)) * dv) 数值积分得到，再乘布莱克曼窗，直流增益归一为 1。
+ *				系数由全部抽取器共用，之后只读
+ * @param       无
+ * @retval      无
+ */
+void decim_init(void)
+{
+	uint32_t i, k;
+	float32_t m = 0.5f * (float32_t)(DECIM_TAPS - 1);
+	float32_t fc = 0.5f / (float32_t)DECIM_FIR_D;
+	float32_t dv = fc / (float32_t)DECIM_DESIGN_STEPS;
+	float32_t sum = 0.0f;
+
+	for(i = 0; i < DECIM_TAPS; ++i)
+	{
+		float32_t t = (float32_t)i - m;
+		float32_t a = 2.0f * PI * (float32_t)i / (float32_t)(DECIM_TAPS - 1);
+		float32_t w = 0.42f - 0.5f * cosf(a) + 0.08f * cosf(2.0f * a);
+		float32_t s = 0.0f;
+
+		for(k = 0; k < DECIM_DESIGN_STEPS; ++k)
+		{
+			float32_t v = ((float32_t)k + 0.5f) * dv;
+			s += cosf(2.0f * PI * v * t) / decim_cic_response(v);
+		}
+		decim_h[i] = 2.0f * s * dv * w;
+		sum += decim_h[i];
+	}
+	for(i = 0; i < DECIM_TAPS; ++i)
+		decim_h[i] /= sum;
+
+	decim_cic_scale = 1.0f;
+	for(k = 0; k < DECIM_CIC_ORDER; ++k)
+		decim_cic_scale /= (float32_t)DECIM_CIC_R;
+}
+
+/**
+ * @brief       清空抽取器
+ * @note		新实例使用前与输入流不连续时调用；此后前 DECIM_SETTLE 个输出块在滤波器填满前算出，丢弃
+ * @param       d:	抽取器
+ * @retval      无
+ */
+void decim_reset(decim_t *d)
+{
+	uint32_t k;
+
+	for(k = 0; k < DECIM_CIC_ORDER; ++k)
+	{
+		d->integ[k] = 0;
+		d->comb[k] = 0;
+	}
+	d->phase = 0;
+	arm_fir_decimate_init_f32(&d->fir, DECIM_TAPS, DECIM_FIR_D, decim_h, d->st, DECIM_CIC_OUT);
+	d->skip = DECIM_SETTLE;
+	d->gap = 1;
+}
+
+/**
+ * @brief       CIC 积分与梳状差分
+ * @note		每个输入样本 N 次加法，每 R 个样本 N 次减法；积分器按 2^32 取模，
+ *				12 位码值经 N*log2(R) 位增长后仍在 32 位以内，差分结果精确
+ * @param       d:		抽取器
+ * @param		x:		本通道第一个样本
+ * @param		stride:	相邻两个样本的间隔
+ * @retval      无
+ */
+static void decim_cic(decim_t *d, const uint16_t *x, uint32_t stride)
+{
+	uint32_t i, k, o = 0;
+	uint32_t *integ = d->integ;
+
+	for(i = 0; i < DECIM_CHUNK; ++i)
+	{
+		uint32_t v = x[i * stride];
+
+		for(k = 0; k < DECIM_CIC_ORDER; ++k)
+		{
+			integ[k] += v;
+			v = integ[k];
+		}
+		if(++d->phase < DECIM_CIC_R)
+			continue;
+		d->phase = 0;
+		for(k = 0; k < DECIM_CIC_ORDER; ++k)
+		{
+			uint32_t t = v - d->comb[k];
+			d->comb[k] = v;
+			v = t;
+		}
+		d->cic[o++] = (float32_t)v * decim_cic_scale;
+	}
+}
+
+/**
+ * @brief       抽取一块样本
+ * @note		按 DECIM_CHUNK 分块经 CIC 与补偿FIR，输出按 2^DECIM_EXTRA_BITS 放大后四舍五入为码值。
+ *				送入的样本须与上一块首尾相接，gap 为 1 时先清空抽取器
+ * @param       d:			抽取器
+ * @param		x:			本通道第一个样本，共 DECIM_IN_BLOCK 个
+ * @param		stride:		相邻两个样本的间隔，即扫描的通道数
+ * @param		gap:		1 表示与上一块不连续
+ * @param		out_gap:	输出，1 表示返回的块与上一个返回的块不连续
+ * @retval      DECIM_OUT_BLOCK 个输出码值，下一次调用前有效；滤波器尚未填满时为 NULL
+ */
+const uint16_t *decim_process(decim_t *d, const uint16_t *x, uint32_t stride, uint8_t gap, uint8_t *out_gap)
+{
+	uint32_t pos, i, o = 0;
+	float32_t scale = (float32_t)(1 << DECIM_EXTRA_BITS);
+	float32_t top = (float32_t)((4096 << DECIM_EXTRA_BITS) - 1);
+
+	if(gap)
+		decim_reset(d);
+
+	for(pos = 0; pos < DECIM_IN_BLOCK; pos += DECIM_CHUNK)
+	{
+		decim_cic(d, x + pos * stride, stride);
+		arm_fir_decimate_f32(&d->fir, d->cic, d->y, DECIM_CIC_OUT);
+		for(i = 0; i < DECIM_FIR_OUT; ++i)
+		{
+			float32_t v = d->y[i] * scale + 0.5f;
+
+			if(v < 0.0f)
+				v = 0.0f;
+			else if(v > top)
+				v = top;
+			d->out[o++] = (uint16_t)v;
+		}
+	}
+
+	if(d->skip > 0)
+	{
+		d->skip--;
+		return NULL;
+	}
+	*out_gap = d->gap;
+	d->gap = 0;
+	return d->out;
+}
+
+/**
+ * @brief       多通道经抽取前端批量处理
+ * @note		与 process_channels 相同，但 x 为每通道 DECIM_IN_BLOCK 个过采样样本，各通道抽取后再送入各自的分析器；
+ *				分析器帧移须为 DECIM_OUT_BLOCK，刻度须为 DECIM_LSB，采样率须为过采样率的 1/DECIM_RATIO
+ * @param       d:		抽取器数组，第 c 个对应通道 c
+ * @param		a:		分析器数组
+ * @param		nch:	通道数
+ * @param		x:		交错排列的 DECIM_IN_BLOCK * nch 个ADC原始码值
+ * @param		gap:	1 表示与上一块不连续
+ * @retval      本块完成分析的通道位图，bit c 对应通道 c
+ */
+uint32_t decim_channels(decim_t *d, analyzer_t *a, uint32_t nch, const uint16_t *x, uint8_t gap)
+{
+	uint32_t c, done = 0;
+	const uint16_t *y, *w;
+	uint8_t g;
+
+	for(c = 0; c < nch; ++c)
+	{
+		y = decim_process(&d[c], x + c, nch, gap, &g);
+		if(y == NULL)
+			continue;
+		w = FFT_Feed(&a[c], y, g);
+		if(w == NULL)
+			continue;
+		process_signal(&a[c], w);
+		done |= 1U << c;
+	}
+	return done;
+}
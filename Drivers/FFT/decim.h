@@ -0,0 +1,52 @@
+#ifndef _DECIM_H
+#define _DECIM_H
+
+#include "main.h"
+#include "arm_math.h"
+#include "FFT.h"
+
+/*
+ * 抽取前端（CIC + 补偿FIR）
+ * ADC 以 DECIM_RATIO 倍的输出采样率过采样，先经 DECIM_CIC_ORDER 级 CIC 积分梳状滤波器抽取 DECIM_CIC_R 倍，
+ * 只用整数加减；再经 arm_fir_decimate_f32 抽取 DECIM_FIR_D 倍，FIR 同时补偿 CIC 通带内的下垂并抑制 CIC 抽取后的混叠。
+ * 输出为扩展了 DECIM_EXTRA_BITS 位的码值，交给分析器时刻度取 DECIM_LSB：
+ * 带内噪声随抽取下降，白噪声时每抽取 4 倍约多 1 位有效位；同样 FFT_SIZE 点覆盖的带宽缩小 DECIM_RATIO 倍，bin 间隔同样变细。
+ * 使用时分析器帧移须为 DECIM_OUT_BLOCK，每次送入每通道 DECIM_IN_BLOCK 个连续样本
+ */
+
+#define DECIM_ENABLE        0                   // 置 1 时采集以 DECIM_FS_IN 过采样并经抽取前端分析
+#define DECIM_CIC_ORDER     4                   // CIC 级数
+#define DECIM_CIC_R         8                   // CIC 抽取倍数
+#define DECIM_FIR_D         2                   // 补偿FIR抽取倍数
+#define DECIM_TAPS          64                  // 补偿FIR阶数
+#define DECIM_EXTRA_BITS    3                   // 输出码值比 ADC 多出的位数，12 + 3 位不超过 adc_conv 的 15 位上限
+#define DECIM_CHUNK         256                 // 每次 CIC/FIR 处理的输入样本数，须为 DECIM_RATIO 的整数倍
+
+#define DECIM_RATIO         (DECIM_CIC_R * DECIM_FIR_D)				// 总抽取倍数
+#define DECIM_OUT_BLOCK     FFT_HOP_MIN								// 每块输出点数，即分析器帧移
+#define DECIM_IN_BLOCK      (DECIM_OUT_BLOCK * DECIM_RATIO)			// 每块输入点数
+#define DECIM_FS_IN         ((float32_t)SAMPLE_RATE * DECIM_RATIO)	// 过采样率，单位 Hz，输出采样率为 SAMPLE_RATE
+#define DECIM_LSB           (ADC_GAIN / (1 << DECIM_EXTRA_BITS))	// 输出码值的刻度，单位 V/LSB
+#define DECIM_CIC_OUT       (DECIM_CHUNK / DECIM_CIC_R)			// 每次 CIC 输出点数
+#define DECIM_FIR_OUT       (DECIM_CHUNK / DECIM_RATIO)				// 每次 FIR 输出点数
+
+// 每个通道一个抽取器（约 1.2KB），由调用者分配
+typedef struct{
+	uint32_t integ[DECIM_CIC_ORDER];			// 积分器，按 2^32 取模累加，梳状差分后结果不受回绕影响
+	uint32_t comb[DECIM_CIC_ORDER];				// 各级梳状滤波器的上一个输入
+	uint32_t phase;								// 本次 CIC 抽取周期内已积分的样本数
+	arm_fir_decimate_instance_f32 fir;
+	float32_t st[DECIM_TAPS + DECIM_CIC_OUT - 1];
+	float32_t cic[DECIM_CIC_OUT];				// CIC 输出，单位为 ADC 码值
+	float32_t y[DECIM_FIR_OUT];					// FIR 输出
+	uint16_t out[DECIM_OUT_BLOCK];				// 扩展位宽的输出码值
+	uint32_t skip;								// 尚需丢弃的输出块数
+	uint8_t gap;								// 下一个输出块是否与上一块不连续
+} decim_t;
+
+void decim_init(void);
+void decim_reset(decim_t *d);
+const uint16_t *decim_process(decim_t *d, const uint16_t *x, uint32_t stride, uint8_t gap, uint8_t *out_gap);
+uint32_t decim_channels(decim_t *d, analyzer_t *a, uint32_t nch, const uint16_t *x, uint8_t gap);
+
+#endif
@@ -0,0 +1,168 @@
+#include "fft_plan.h"
+
+#define FFT_PLAN_HAS(N)     ((FFT_PLAN_MIN_SIZE <= (N)) && (FFT_PLAN_MAX_SIZE >= (N)))
+
+#if defined(ARM_FFT_TWIDDLE_IN_RAM)
+// 旋转因子存放于 RAM，由 fft_plan_init 生成；命名与库中的 Flash 表区分，避免重复定义
+#define FFT_PLAN_TWIDDLE(N, HALF)											\
+	static float32_t fft_twiddle_##HALF[2 * HALF];							\
+	static float32_t fft_twiddle_rfft_##N[N];
+#define FFT_PLAN_PAIR_TWIDDLE(N)		static float32_t fft_twiddle_##N[2 * N];
+#define FFT_PLAN_CFFT_TWIDDLE(HALF)		fft_twiddle_##HALF
+#define FFT_PLAN_RFFT_TWIDDLE(N)		fft_twiddle_rfft_##N
+#define FFT_PLAN_2PI					6.283185307179586476925		// 双精度 2*pi，PI 为单精度常量
+#else
+#define FFT_PLAN_TWIDDLE(N, HALF)
+#define FFT_PLAN_PAIR_TWIDDLE(N)
+#define FFT_PLAN_CFFT_TWIDDLE(HALF)		twiddleCoef_##HALF
+#define FFT_PLAN_RFFT_TWIDDLE(N)		(float32_t *)twiddleCoef_rfft_##N
+#endif
+
+#if defined(ARM_FFT_Q31)
+// 定点实数后处理共用 FFT_PLAN_MAX_SIZE 点 q31 复数FFT的旋转因子表，长度经一层宏展开后再拼接表名
+#define FFT_PLAN_SPLIT_Q31(N)			twiddleCoef_##N##_q31
+#define FFT_PLAN_SPLIT_Q31_X(N)			FFT_PLAN_SPLIT_Q31(N)
+#define FFT_PLAN_Q31(N, HALF)											\
+	, { HALF, twiddleCoef_##HALF##_q31, armBitRevIndexTable_fixed_##HALF,	\
+		ARMBITREVINDEXTABLE_FIXED_##HALF##_TABLE_LENGTH },				\
+	FFT_PLAN_SPLIT_Q31_X(FFT_PLAN_MAX_SIZE), FFT_PLAN_MAX_SIZE / N
+#else
+#define FFT_PLAN_Q31(N, HALF)
+#endif
+
+// 按长度填写实例：n 点实数FFT 由 n/2 点复数FFT 与 n 点实数后处理旋转因子组成
+#define FFT_PLAN_ENTRY(N, HALF)											\
+	{ N, { { HALF, FFT_PLAN_CFFT_TWIDDLE(HALF), armBitRevIndexTable##HALF,	\
+			ARMBITREVINDEXTABLE_##HALF##_TABLE_LENGTH },				\
+			N, FFT_PLAN_RFFT_TWIDDLE(N) } FFT_PLAN_Q31(N, HALF) }
+
+#if FFT_PLAN_HAS(256)
+FFT_PLAN_TWIDDLE(256, 128)
+#endif
+#if FFT_PLAN_HAS(512)
+FFT_PLAN_TWIDDLE(512, 256)
+#endif
+#if FFT_PLAN_HAS(1024)
+FFT_PLAN_TWIDDLE(1024, 512)
+#endif
+#if FFT_PLAN_HAS(2048)
+FFT_PLAN_TWIDDLE(2048, 1024)
+#endif
+#if FFT_PLAN_HAS(4096)
+FFT_PLAN_TWIDDLE(4096, 2048)
+#endif
+
+static const fft_plan_t fft_plans[] = {
+#if FFT_PLAN_HAS(256)
+	FFT_PLAN_ENTRY(256, 128),
+#endif
+#if FFT_PLAN_HAS(512)
+	FFT_PLAN_ENTRY(512, 256),
+#endif
+#if FFT_PLAN_HAS(1024)
+	FFT_PLAN_ENTRY(1024, 512),
+#endif
+#if FFT_PLAN_HAS(2048)
+	FFT_PLAN_ENTRY(2048, 1024),
+#endif
+#if FFT_PLAN_HAS(4096)
+	FFT_PLAN_ENTRY(4096, 2048),
+#endif
+};
+
+#define FFT_PLAN_NUM        (sizeof(fft_plans) / sizeof(fft_plans[0]))
+
+#if defined(ARM_FFT_CFFT_PAIR)
+// FFT_PLAN_MAX_SIZE 点复数FFT，供整帧长度的成对变换使用；长度经一层宏展开后再拼接表名
+#define FFT_PLAN_PAIR_ENTRY(N)											\
+	{ N, FFT_PLAN_CFFT_TWIDDLE(N), armBitRevIndexTable##N, ARMBITREVINDEXTABLE_##N##_TABLE_LENGTH }
+#define FFT_PLAN_PAIR(N)				FFT_PLAN_PAIR_TWIDDLE(N)		\
+	static const arm_cfft_instance_f32 fft_pair_cfft = FFT_PLAN_PAIR_ENTRY(N);
+#define FFT_PLAN_PAIR_X(N)				FFT_PLAN_PAIR(N)
+FFT_PLAN_PAIR_X(FFT_PLAN_MAX_SIZE)
+#endif
+
+
+/**
+ * @brief       初始化FFT计划缓存，上电后调用一次
+ * @note		旋转因子在 Flash 中时无需任何操作；定义 ARM_FFT_TWIDDLE_IN_RAM 时按 CMSIS 表的定义生成：
+ *				复数FFT  tw[2i] = cos(2*pi*i/M), tw[2i+1] = sin(2*pi*i/M), i < M
+ *				实数FFT  tw[2i] = cos(2*pi*i/N), tw[2i+1] = sin(2*pi*i/N), i < N/2
+ *				用双精度计算后取整，与库中常量表一致
+ * @param       无
+ * @retval      无
+ */
+void fft_plan_init(void)
+{
+#if defined(ARM_FFT_TWIDDLE_IN_RAM)
+	uint32_t i, k;
+
+	for(k = 0; k < FFT_PLAN_NUM; ++k)
+	{
+		const fft_plan_t *p = &fft_plans[k];
+		float32_t *tw = (float32_t *)p->rfft.Sint.pTwiddle;
+		float32_t *tr = (float32_t *)p->rfft.pTwiddleRFFT;
+		uint32_t m = p->rfft.Sint.fftLen;
+
+		for(i = 0; i < m; ++i)
+		{
+			tw[2 * i] = (float32_t)cos(FFT_PLAN_2PI * i / m);
+			tw[2 * i + 1] = (float32_t)sin(FFT_PLAN_2PI * i / m);
+		}
+		for(i = 0; i < p->n / 2; ++i)
+		{
+			tr[2 * i] = (float32_t)cos(FFT_PLAN_2PI * i / p->n);
+			tr[2 * i + 1] = (float32_t)sin(FFT_PLAN_2PI * i / p->n);
+		}
+	}
+#if defined(ARM_FFT_CFFT_PAIR)
+	{
+		float32_t *tw = (float32_t *)fft_pair_cfft.pTwiddle;
+
+		for(i = 0; i < FFT_PLAN_MAX_SIZE; ++i)
+		{
+			tw[2 * i] = (float32_t)cos(FFT_PLAN_2PI * i / FFT_PLAN_MAX_SIZE);
+			tw[2 * i + 1] = (float32_t)sin(FFT_PLAN_2PI * i / FFT_PLAN_MAX_SIZE);
+		}
+	}
+#endif
+#endif
+}
+
+/**
+ * @brief       取长度为 n 的FFT计划
+ * @param       n:	实数FFT长度，须为 FFT_PLAN_MIN_SIZE ~ FFT_PLAN_MAX_SIZE 之间的 2 的幂
+ * @retval      FFT计划；长度不支持时返回 NULL
+ */
+const fft_plan_t *fft_plan_get(uint16_t n)
+{
+	uint32_t i;
+
+	for(i = 0; i < FFT_PLAN_NUM; ++i)
+	{
+		if(fft_plans[i].n == n)
+			return &fft_plans[i];
+	}
+	return NULL;
+}
+
+/**
+ * @brief       取长度为 n 的复数FFT实例
+ * @note		成对变换把两帧 n 点实数序列作为一帧 n 点复数序列变换；n 不超过 FFT_PLAN_MAX_SIZE/2 时
+ *				取 2n 点实数FFT计划的内部实例，n 等于 FFT_PLAN_MAX_SIZE 时须定义 ARM_FFT_CFFT_PAIR
+ * @param       n:	复数FFT长度
+ * @retval      复数FFT实例；长度不支持时返回 NULL
+ */
+const arm_cfft_instance_f32 *fft_plan_cfft(uint16_t n)
+{
+	const fft_plan_t *p;
+
+#if defined(ARM_FFT_CFFT_PAIR)
+	if(n == FFT_PLAN_MAX_SIZE)
+		return &fft_pair_cfft;
+#endif
+	if(n > FFT_PLAN_MAX_SIZE / 2)
+		return NULL;
+	p = fft_plan_get(2 * n);
+	return (p != NULL) ? &p->rfft.Sint : NULL;
+}
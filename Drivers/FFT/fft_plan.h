@@ -0,0 +1,40 @@
+#ifndef _FFT_PLAN_H
+#define _FFT_PLAN_H
+
+#include "main.h"
+#include "arm_math.h"
+#include "arm_common_tables.h"
+
+/*
+ * FFT 计划缓存
+ * 各长度的 rfft 实例在编译期即已初始化并存放于 Flash，运行中按长度查表复用；
+ * 实例直接引用对应长度的旋转因子与位反转表，不经过 arm_rfft_fast_init_f32 / arm_cfft_init_f32
+ * 中覆盖全部长度的 switch。支持的长度范围与链接哪些表统一由 arm_fft_table_config.h 配置，
+ * 定义 ARM_FFT_TWIDDLE_IN_RAM 时旋转因子改为上电时在 RAM 中生成。
+ * 成对变换所需的 n 点复数FFT 取自 2n 点实数FFT 的内部实例；定义 ARM_FFT_CFFT_PAIR 时另有 FFT_PLAN_MAX_SIZE 点的复数FFT实例。
+ * 定义 ARM_FFT_Q31 时每个长度另有定点流水线所用的 n/2 点 q31 复数FFT实例与实数后处理旋转因子
+ */
+
+#define FFT_PLAN_MIN_SIZE   ARM_FFT_RFFT_MIN_LEN	// 支持的最小实数FFT长度
+#define FFT_PLAN_MAX_SIZE   ARM_FFT_RFFT_MAX_LEN	// 支持的最大实数FFT长度
+
+#if (FFT_PLAN_MIN_SIZE < 256) || (FFT_PLAN_MAX_SIZE > 4096) || (FFT_PLAN_MIN_SIZE > FFT_PLAN_MAX_SIZE)
+#error "FFT 计划长度范围须在 256 ~ 4096 之间"
+#endif
+
+// FFT 计划
+typedef struct{
+	uint16_t n;								// 实数FFT长度
+	arm_rfft_fast_instance_f32 rfft;		// n 点实数FFT实例，内含 n/2 点复数FFT实例 rfft.Sint
+#if defined(ARM_FFT_Q31)
+	arm_cfft_instance_q31 cfft_q31;			// n/2 点 q31 复数FFT实例
+	const q31_t *split_q31;					// 实数后处理旋转因子，第 i 个为 cos/sin(2*pi*i/n)，隔 split_step 个复数取一个
+	uint16_t split_step;
+#endif
+} fft_plan_t;
+
+void fft_plan_init(void);
+const fft_plan_t *fft_plan_get(uint16_t n);
+const arm_cfft_instance_f32 *fft_plan_cfft(uint16_t n);
+
+#endif
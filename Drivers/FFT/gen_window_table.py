@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+# -*- coding: utf-8 -*-
+"""
+生成 window_table.c：各窗函数的半窗常量表（浮点与 q15 两种）、相干增益、等效噪声带宽、余弦和系数与插值DFT偏差表
+
+窗函数采用 DFT-even（周期）形式 w[n], n = 0 ~ N-1，满足 w[n] = w[N-n]，
+因此只需保存 w[0] ~ w[N/2] 共 N/2 + 1 个点；长度为 N/2^m 的窗可按步长 2^m 直接抽取
+
+用法：python gen_window_table.py [表长，默认 4096] > window_table.c
+"""
+
+import math
+import sys
+
+N = int(sys.argv[1]) if len(sys.argv) > 1 else 4096
+KAISER_BETA = 8.6
+
+# 余弦和窗系数 w[n] = a0 - a1*cos(2πn/N) + a2*cos(4πn/N) - ...
+COSINE_WINDOWS = {
+    'hanning':         [0.5, 0.5],
+    'hamming':         [0.54, 0.46],
+    'blackman':        [0.42323, 0.49755, 0.07922],
+    'blackmanHarris':  [0.35875, 0.48829, 0.14128, 0.01168],
+    'flatTop':         [0.21557895, 0.41663158, 0.277263158, 0.083578947, 0.006947368],
+}
+
+
+def cosine_window(a):
+    return [sum(((-1) ** m) * a[m] * math.cos(2.0 * math.pi * m * n / N) for m in range(len(a)))
+            for n in range(N)]
+
+
+def bessel_i0(x):
+    s, t, k = 1.0, 1.0, 1
+    while t > 1e-17 * s:
+        t *= (x / (2.0 * k)) ** 2
+        s += t
+        k += 1
+    return s
+
+
+def kaiser_window(beta):
+    den = bessel_i0(beta)
+    return [bessel_i0(beta * math.sqrt(max(0.0, 1.0 - (2.0 * n / N - 1.0) ** 2))) / den
+            for n in range(N)]
+
+
+# 余弦和窗系数个数上限，需与 window_table.h 中 WINDOW_COEF_MAX 一致
+COEF_MAX = 5
+
+# 插值DFT偏差表点数，需与 window_table.h 中 WINDOW_BIAS_LEN 一致
+BIAS_LEN = 65
+
+# (C 名称, 枚举名, 采样序列, 主瓣半宽/bin)
+WINDOWS = [
+    ('hanning',        'HANNING',         cosine_window(COSINE_WINDOWS['hanning']),        2.0),
+    ('hamming',        'HAMMING',         cosine_window(COSINE_WINDOWS['hamming']),        2.0),
+    ('blackman',       'BLACKMAN',        cosine_window(COSINE_WINDOWS['blackman']),       3.0),
+    ('blackmanHarris', 'BLACKMAN_HARRIS', cosine_window(COSINE_WINDOWS['blackmanHarris']), 4.0),
+    ('kaiser',         'KAISER',          kaiser_window(KAISER_BETA),
+     math.sqrt(1.0 + (KAISER_BETA / math.pi) ** 2)),
+    ('flatTop',        'FLAT_TOP',        cosine_window(COSINE_WINDOWS['flatTop']),        5.0),
+]
+
+
+def fmt(v):
+    return '{:.9e}f'.format(v)
+
+
+def q15(v):
+    """q15 定点值，四舍五入并饱和到 -1 ~ 1-2^-15"""
+    return max(-32768, min(32767, int(math.floor(v * 32768.0 + 0.5))))
+
+
+def fmt_coef(name):
+    a = COSINE_WINDOWS.get(name, [])
+    return '{ ' + ', '.join(fmt(v) for v in a + [0.0] * (COEF_MAX - len(a))) + ' }, %d' % len(a)
+
+
+def zero_phase_spectrum(w, nu):
+    """窗的零相位频谱 R(nu)：DFT-even 窗关于 N/2 对称，W(nu) = e^(-j*pi*nu) * R(nu)"""
+    h = N // 2
+    r = w[h] + w[0] * math.cos(math.pi * nu)
+    for m in range(1, h):
+        r += 2.0 * w[h + m] * math.cos(2.0 * math.pi * nu * m / N)
+    return r
+
+
+def bias_table(w):
+    """
+    插值DFT偏差表：真实偏移 d = 0.5*i/(BIAS_LEN-1) 时 Jacobsen 式比值的取值
+      r = Re[(X[k-1] - X[k+1]) / (2X[k] - X[k-1] - X[k+1])]
+    相邻bin的窗频谱相位相差 pi，代入 X[k+m] = (-1)^m * R(m - d) 后 r = (R(1-d) - R(-1-d)) / (2R(-d) + R(-1-d) + R(1-d))，
+    汉宁窗下 r = d/2；运行时按 |r| 在表中反查 d
+    """
+    t = []
+    for i in range(BIAS_LEN):
+        d = 0.5 * i / (BIAS_LEN - 1)
+        rm, r0, rp = (zero_phase_spectrum(w, -1.0 - d), zero_phase_spectrum(w, -d),
+                      zero_phase_spectrum(w, 1.0 - d))
+        t.append((rp - rm) / (2.0 * r0 + rm + rp))
+    if any(b <= a for a, b in zip(t, t[1:])):
+        raise ValueError('插值DFT比值不单调')
+    return t
+
+
+def main():
+    out = []
+    out.append('/* 本文件由 gen_window_table.py 生成（N = %d），请勿手动修改 */' % N)
+    out.append('#include "window_table.h"')
+    out.append('')
+    out.append('#if (WINDOW_TABLE_LEN != %d) || (WINDOW_COEF_MAX != %d) || (WINDOW_BIAS_LEN != %d)'
+               % (N, COEF_MAX, BIAS_LEN))
+    out.append('#error "window_table.c 与 WINDOW_TABLE_LEN 不一致，请重新运行 gen_window_table.py"')
+    out.append('#endif')
+    out.append('')
+
+    for name, _, w, _ in WINDOWS:
+        half = w[:N // 2 + 1]
+        out.append('static const float32_t win_%s_half[WINDOW_HALF_LEN] = {' % name)
+        for i in range(0, len(half), 4):
+            out.append('\t' + ', '.join(fmt(v) for v in half[i:i + 4]) + ',')
+        out.append('};')
+        out.append('')
+        out.append('static const q15_t win_%s_half_q15[WINDOW_HALF_LEN] = {' % name)
+        for i in range(0, len(half), 8):
+            out.append('\t' + ', '.join('%d' % q15(v) for v in half[i:i + 8]) + ',')
+        out.append('};')
+        out.append('')
+        bias = bias_table(w)
+        out.append('static const float32_t win_%s_bias[WINDOW_BIAS_LEN] = {' % name)
+        for i in range(0, len(bias), 4):
+            out.append('\t' + ', '.join(fmt(v) for v in bias[i:i + 4]) + ',')
+        out.append('};')
+        out.append('')
+
+    out.append('const window_table_t window_tables[WINDOW_TYPE_NUM] = {')
+    for name, enum, w, lobe in WINDOWS:
+        s1 = sum(w)
+        s2 = sum(v * v for v in w)
+        cg = s1 / N
+        enbw = N * s2 / (s1 * s1)
+        out.append('\t{ win_%s_half, win_%s_half_q15, %s, %s, %s, %s, win_%s_bias },\t\t// %s'
+                   % (name, name, fmt(cg), fmt(enbw), fmt(lobe), fmt_coef(name), name, enum))
+    out.append('};')
+    out.append('')
+    out.append('/**')
+    out.append(' * @brief       获取窗函数描述')
+    out.append(' * @param       window_type: 窗函数类型')
+    out.append(' * @retval      窗函数描述，类型无效时返回 NULL')
+    out.append(' */')
+    out.append('const window_table_t *window_get(uint8_t window_type)')
+    out.append('{')
+    out.append('\tif(window_type < 1 || window_type > WINDOW_TYPE_NUM)')
+    out.append('\t\treturn NULL;')
+    out.append('')
+    out.append('\treturn &window_tables[window_type - 1];')
+    out.append('}')
+
+    sys.stdout.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,418 @@
+#include "lsq.h"
+#include "mem_section.h"
+
+#if MEM_RAMFUNC_LSQ
+#define LSQ_HOT             MEM_RAMFUNC     // 逐点投影放入 SRAM2 执行
+#else
+#define LSQ_HOT
+#endif
+
+/**
+ * @brief       复指数序列求和（Dirichlet 核）
+ * @note		sum_{t<n} e^(j*a*t) = sin(n*a/2) / sin(a/2) * e^(j*(n-1)*a/2)
+ *				a 先归约到 (-pi, pi]，a = 0 时和为 n
+ * @param       a:	每点相位增量，0 ~ 2*pi
+ * @param		n:	点数
+ * @param		C:	实部 sum cos(a*t)
+ * @param		S:	虚部 sum sin(a*t)
+ * @retval      无
+ */
+static void lsq_dirichlet(float32_t a, uint32_t n, float32_t *C, float32_t *S)
+{
+	float32_t h, d, p;
+
+	if(a > PI)
+		a -= 2.0f * PI;
+	h = sinf(0.5f * a);
+	if(h == 0.0f)
+	{
+		*C = (float32_t)n;
+		*S = 0.0f;
+		return;
+	}
+	d = sinf(0.5f * (float32_t)n * a) / h;
+	p = 0.5f * (float32_t)(n - 1) * a;
+	*C = d * cosf(p);
+	*S = d * sinf(p);
+}
+
+/**
+ * @brief       闭式计算正规矩阵上三角
+ * @note		积化和差后每项都是 Dirichlet 核，记 a = w_i + w_j，d = w_i - w_j：
+ *				sum cos_i*cos_j = (C(d) + C(a)) / 2		sum sin_i*sin_j = (C(d) - C(a)) / 2
+ *				sum cos_i*sin_j = (S(a) - S(d)) / 2		sum sin_i*cos_j = (S(a) + S(d)) / 2
+ *				只与频率和点数有关，每对音两次求值，代价 O(K^2) 且与 n 无关
+ * @param       f:	K 个频率，单位 Hz
+ * @param		K:	音数
+ * @param		fs:	采样率
+ * @param		n:	样本数
+ * @param		G:	2K 阶正规矩阵输出，只写上三角
+ * @retval      无
+ */
+static void lsq_gram(const float32_t *f, uint32_t K, float32_t fs, uint32_t n, float32_t *G)
+{
+	uint32_t M = 2 * K;
+	uint32_t i, j;
+	float32_t w[LSQ_MAX_TONES];
+	float32_t Ca, Sa, Cd, Sd;
+
+	for(i = 0; i < K; ++i)
+		w[i] = 2.0f * PI * f[i] / fs;
+
+	for(i = 0; i < K; ++i)
+	{
+		for(j = i; j < K; ++j)
+		{
+			float32_t *g0 = &G[2 * i * M + 2 * j];
+			float32_t *g1 = g0 + M;
+
+			lsq_dirichlet(w[i] + w[j], n, &Ca, &Sa);
+			lsq_dirichlet(fabsf(w[i] - w[j]), n, &Cd, &Sd);
+			if(w[i] < w[j])
+				Sd = -Sd;
+
+			g0[0] = 0.5f * (Cd + Ca);
+			g0[1] = 0.5f * (Sa - Sd);
+			g1[1] = 0.5f * (Cd - Ca);
+			if(j != i)
+				g1[0] = 0.5f * (Sa + Sd);
+		}
+	}
+}
+
+/**
+ * @brief       求解正规方程 G * theta = b
+ * @note		G 只需给出上三角，此处补全下三角并按 LSQ_RIDGE 做对角加载后 Cholesky 分解：
+ *				G = L * L^T，先解 L * y = b，再解 L^T * theta = y
+ * @param       w:		工作区，G 为 2K 阶正规矩阵，求解后被改写
+ * @param		b:		投影向量
+ * @param		K:		音数
+ * @param		I, Q:	各音的 cos、sin 分量输出
+ * @retval      1：成功；0：分解失败，I、Q 置 0
+ */
+static uint8_t lsq_normal_solve(lsq_work_t *w, float32_t *b, uint32_t K, float32_t *I, float32_t *Q)
+{
+	float32_t *G = w->G;
+	float32_t y[LSQ_MAX_DIM], theta[LSQ_MAX_DIM];
+	arm_matrix_instance_f32 mG, mL, mLT, mb, my, mtheta;
+	uint32_t M = 2 * K;
+	uint32_t i, j, k;
+	float32_t diag;
+	uint8_t ok = 0;
+
+	// 补全下三角并做对角加载
+	diag = 0.0f;
+	for(i = 0; i < M; ++i)
+		diag += G[i * M + i];
+	diag = diag / (float32_t)M * LSQ_RIDGE;
+	for(i = 0; i < M; ++i)
+	{
+		G[i * M + i] += diag;
+		for(j = i + 1; j < M; ++j)
+			G[j * M + i] = G[i * M + j];
+	}
+
+	memset(w->L, 0, sizeof(w->L));				// 分解只写下三角
+	arm_mat_init_f32(&mG, M, M, G);
+	arm_mat_init_f32(&mL, M, M, w->L);
+	arm_mat_init_f32(&mLT, M, M, w->LT);
+	arm_mat_init_f32(&mb, M, 1, b);
+	arm_mat_init_f32(&my, M, 1, y);
+	arm_mat_init_f32(&mtheta, M, 1, theta);
+	if(arm_mat_cholesky_f32(&mG, &mL) == ARM_MATH_SUCCESS
+		&& arm_mat_trans_f32(&mL, &mLT) == ARM_MATH_SUCCESS
+		&& arm_mat_solve_lower_triangular_f32(&mL, &mb, &my) == ARM_MATH_SUCCESS
+		&& arm_mat_solve_upper_triangular_f32(&mLT, &my, &mtheta) == ARM_MATH_SUCCESS)
+		ok = 1;
+
+	for(k = 0; k < K; ++k)
+	{
+		I[k] = ok ? theta[2 * k] : 0.0f;
+		Q[k] = ok ? theta[2 * k + 1] : 0.0f;
+	}
+	return ok;
+}
+
+/**
+ * @brief       K 音最小二乘法计算幅度与相位
+ * @note		得到的幅度为Vop，非Vopp；A_k = sqrt(I_k^2 + Q_k^2)，phi_k = atan2(Q_k, I_k)
+ *				样本遍历中每点更新 K 个振荡器并累加 2K 个数据投影；正规矩阵（含同频 cos*sin 交叉项，不再假设为0）
+ *				在 LSQ_GRAM_CLOSED_FORM 为 1 时由 lsq_gram 闭式给出，否则在遍历中逐点累加；
+ *				求解只涉及 2K 阶小矩阵，与样本数无关
+ *				频率接近 0 或 fs/2 时 sin 基函数几乎为零，正规矩阵奇异，由对角加载保证正定，对应 Q 趋于0
+ * @param       w:		工作区
+ * @param		f:		已确定的 K 个频率，单位 Hz
+ * @param		K:		音数，1 ~ LSQ_MAX_TONES
+ * @param		fs:		采样率
+ * @param		x:		ADC原始采样序列
+ * @param		n:		样本数
+ * @param		lsb:	每个码值对应的电压
+ * @param		bias:	x * lsb 中的直流分量，x[n] * lsb - bias 即去直流后的电压
+ * @param		I, Q:	各音的 cos、sin 分量输出
+ * @retval      1：成功；0：参数错误或分解失败，I、Q 置 0
+ */
+LSQ_HOT uint8_t lsq_solve(lsq_work_t *w, const float32_t *f, uint32_t K, float32_t fs, const uint16_t *x, uint32_t n,
+				float32_t lsb, float32_t bias, float32_t *I, float32_t *Q)
+{
+	float32_t cr[LSQ_MAX_TONES], sr[LSQ_MAX_TONES];	// 每点的旋转量
+	float32_t u[LSQ_MAX_DIM];						// 当前点的基函数 cos0, sin0, cos1, sin1 ...
+	float32_t b[LSQ_MAX_DIM];						// 数据投影
+	float32_t *G = w->G;
+	uint32_t M = 2 * K;
+	uint32_t i, k, t;
+
+	if(K == 0 || K > LSQ_MAX_TONES)
+		return 0;
+
+	// 计算一次角增量，振荡器从 cos = 1, sin = 0 开始
+	// arm_cos_f32/arm_sin_f32 查表误差约 1e-5，|旋转量| != 1 会使振荡器在数千点内衰减数个百分点，故先归一化
+	for(k = 0; k < K; ++k)
+	{
+		float32_t a = 2.0f * PI * f[k] / fs;
+		float32_t r;
+		cr[k] = arm_cos_f32(a);
+		sr[k] = arm_sin_f32(a);
+		arm_sqrt_f32(cr[k] * cr[k] + sr[k] * sr[k], &r);
+		cr[k] /= r;
+		sr[k] /= r;
+		u[2 * k] = 1.0f;
+		u[2 * k + 1] = 0.0f;
+	}
+	memset(G, 0, sizeof(w->G));
+	memset(b, 0, sizeof(b));
+
+	for(t = 0; t < n; ++t)
+	{
+		float32_t xn = (float32_t)x[t] * lsb - bias;
+
+#if LSQ_GRAM_CLOSED_FORM
+		// 数据投影，正规矩阵与数据无关，遍历后按闭式计算
+		for(i = 0; i < M; ++i)
+			b[i] += xn * u[i];
+#else
+		// 数据投影与正规矩阵上三角
+		for(i = 0; i < M; ++i)
+		{
+			float32_t ui = u[i];
+			float32_t *g = &G[i * M];
+			uint32_t j;
+
+			b[i] += xn * ui;
+			for(j = i; j < M; ++j)
+				g[j] += ui * u[j];
+		}
+#endif
+		// 迭代sin/cos
+		for(k = 0; k < K; ++k)
+		{
+			float32_t c = u[2 * k], s = u[2 * k + 1];
+			u[2 * k] = c * cr[k] - s * sr[k];
+			u[2 * k + 1] = s * cr[k] + c * sr[k];
+		}
+	}
+
+#if LSQ_GRAM_CLOSED_FORM
+	lsq_gram(f, K, fs, n, G);
+#endif
+
+	return lsq_normal_solve(w, b, K, I, Q);
+}
+
+/**
+ * @brief       由已有的数据投影求解 K 音最小二乘
+ * @note		投影由调用者用其他方式（如 Goertzel）求得，正规矩阵按闭式计算
+ * @param       w:		工作区
+ * @param		f:		K 个频率，单位 Hz
+ * @param		K:		音数，1 ~ LSQ_MAX_TONES
+ * @param		fs:		采样率
+ * @param		n:		样本数
+ * @param		b:		2K 个投影 sum x*cos(w_k*t)、sum x*sin(w_k*t)，求解后被改写
+ * @param		I, Q:	各音的 cos、sin 分量输出
+ * @retval      1：成功；0：参数错误或分解失败
+ */
+uint8_t lsq_solve_proj(lsq_work_t *w, const float32_t *f, uint32_t K, float32_t fs, uint32_t n, float32_t *b,
+				float32_t *I, float32_t *Q)
+{
+	if(K == 0 || K > LSQ_MAX_TONES)
+		return 0;
+
+	memset(w->G, 0, sizeof(w->G));
+	lsq_gram(f, K, fs, n, w->G);
+	return lsq_normal_solve(w, b, K, I, Q);
+}
+
+/**
+ * @brief       余弦和窗的频谱核
+ * @note		w[n] = sum_m (-1)^m * a_m * cos(2*pi*m*n/N) 的 DTFT 在偏离 mu 个bin处为
+ *				W(mu) = sum_m (-1)^m * a_m/2 * [D(mu - m) + D(mu + m)]，D(mu) = e^(-j*pi*mu*(N-1)/N) * sin(pi*mu) / sin(pi*mu/N)
+ *				对连续的 mu0 + j，e^(-j*pi*mu) * sin(pi*mu) 不随整数 j 变化，sin(pi*(mu0 + j -/+ m)/N) 可共用，
+ *				因此每点只需一次三角函数；mu 恰为整数时 0/0，取 mu + LSQ_FD_EPS 的极限值
+ * @param       inv:	LSQ_FD_INV_LEN 个点的缓冲区，存放 1 / sin(pi*(mu0 + t)/N)，t = -(nc-1) ~ cnt-1+(nc-1)
+ * @param		win:	窗函数，须为余弦和窗
+ * @param		mu0:	首点偏离，单位 bin
+ * @param		cnt:	点数，不大于 LSQ_FD_MAX_BINS
+ * @param		n:		FFT长度
+ * @param		re, im:	W(mu0 + j) 输出，j = 0 ~ cnt-1
+ * @retval      无
+ */
+static void lsq_fd_kernel(float32_t *inv, const window_table_t *win, float32_t mu0, uint32_t cnt, uint32_t n,
+						float32_t *re, float32_t *im)
+{
+	float32_t cm[WINDOW_COEF_MAX], sm[WINDOW_COEF_MAX];			// (-1)^m * a_m/2 * e^(-/+ j*pi*m/N)
+	float32_t pin = PI / (float32_t)n;
+	float32_t r, sr, er, ei, pr, pi, dr, di;
+	uint32_t nc = win->ncoef;
+	uint32_t j, m, t;
+
+	r = mu0 - floorf(mu0 + 0.5f);
+	if(fabsf(r) < LSQ_FD_EPS)
+	{
+		mu0 += LSQ_FD_EPS - r;
+		r = LSQ_FD_EPS;
+	}
+	// e^(-j*pi*r) * sin(pi*r)
+	sr = sinf(PI * r);
+	er = cosf(PI * r) * sr;
+	ei = -sr * sr;
+
+	for(t = 0; t < cnt + 2 * (nc - 1); ++t)
+		inv[t] = 1.0f / sinf(pin * (mu0 + (float32_t)t - (float32_t)(nc - 1)));
+	for(m = 0; m < nc; ++m)
+	{
+		float32_t a = ((m & 1) ? -0.5f : 0.5f) * win->a[m];
+		cm[m] = a * cosf(pin * (float32_t)m);
+		sm[m] = a * sinf(pin * (float32_t)m);
+	}
+
+	// e^(j*pi*mu/N) 由 e^(j*pi*mu0/N) 逐点旋转 e^(j*pi/N) 得到，与 e^(-j*pi*r) * sin(pi*r) 合成 e^(-j*pi*mu*(N-1)/N) * sin(pi*mu)
+	pr = cosf(pin * mu0);
+	pi = sinf(pin * mu0);
+	dr = cosf(pin);
+	di = sinf(pin);
+
+	for(j = 0; j < cnt; ++j)
+	{
+		const float32_t *v = &inv[j + nc - 1];
+		float32_t kr = 0.0f, ki = 0.0f, phr, phi, t0;
+
+		// sum_m c_m * [e^(-j*pi*m/N) / sin(pi*(mu - m)/N) + e^(j*pi*m/N) / sin(pi*(mu + m)/N)]
+		for(m = 0; m < nc; ++m)
+		{
+			kr += cm[m] * (v[-(int32_t)m] + v[m]);
+			ki += sm[m] * (v[m] - v[-(int32_t)m]);
+		}
+		phr = er * pr - ei * pi;
+		phi = er * pi + ei * pr;
+		re[j] = phr * kr - phi * ki;
+		im[j] = phr * ki + phi * kr;
+
+		t0 = pr * dr - pi * di;
+		pi = pi * dr + pr * di;
+		pr = t0;
+	}
+}
+
+/**
+ * @brief       频域 K 音最小二乘法计算幅度与相位
+ * @note		加窗后单音 A*cos(w*n - phi) 的频谱为 c/2 * W(b - v) + c'/2 * W(b + v)，v = f*N/fs，c = I - jQ；
+ *				在各峰值 ±half 个bin内对已知窗的频谱核做复数最小二乘，参数与 lsq_solve 相同（Vop，phi = atan2(Q, I)）
+ *				代价 O(K * half) 个核求值，与 N 无关；相邻峰的区间重叠时合并，每个bin只计一次，
+ *				主瓣相互重叠的音也按联合模型求解，但可用bin少时受噪声影响较时域法大
+ *				只支持余弦和窗；bin 0 与 N/2 在实数FFT输出中打包存放，不参与拟合
+ * @param       w:		工作区
+ * @param		f:		已确定的 K 个频率，单位 Hz
+ * @param		K:		音数，1 ~ LSQ_MAX_TONES
+ * @param		fs:		采样率
+ * @param		X:		arm_rfft_fast_f32 输出的复数频谱，输入为伏特单位的加窗序列
+ * @param		n:		FFT长度
+ * @param		win:	做FFT时所用的窗
+ * @param		half:	每个峰两侧参与拟合的bin数，1 ~ LSQ_FD_MAX_HALF_BINS
+ * @param		I, Q:	各音的 cos、sin 分量输出
+ * @retval      1：成功；0：参数错误、窗不支持或分解失败
+ */
+uint8_t lsq_solve_fd(lsq_work_t *w, const float32_t *f, uint32_t K, float32_t fs, const float32_t *X, uint32_t n,
+				const window_table_t *win, uint32_t half, float32_t *I, float32_t *Q)
+{
+	float32_t b[LSQ_MAX_DIM];
+	float32_t ar[LSQ_MAX_DIM], ai[LSQ_MAX_DIM];					// 当前bin的 2K 个模型列
+	float32_t *G = w->G;
+	float32_t v[LSQ_MAX_TONES];
+	int32_t lo[LSQ_MAX_TONES], hi[LSQ_MAX_TONES];
+	uint32_t M = 2 * K;
+	uint32_t i, j, k;
+
+	if(K == 0 || K > LSQ_MAX_TONES || win->ncoef == 0 || half == 0 || half > LSQ_FD_MAX_HALF_BINS)
+		return 0;
+
+	// 各峰的拟合区间，按起点插入排序后合并
+	for(k = 0; k < K; ++k)
+	{
+		int32_t c, l, h;
+
+		v[k] = f[k] * (float32_t)n / fs;
+		c = (int32_t)(v[k] + 0.5f);
+		l = (c - (int32_t)half < 1) ? 1 : c - (int32_t)half;
+		h = (c + (int32_t)half > (int32_t)n / 2 - 1) ? (int32_t)n / 2 - 1 : c + (int32_t)half;
+		for(i = k; i > 0 && lo[i - 1] > l; --i)
+		{
+			lo[i] = lo[i - 1];
+			hi[i] = hi[i - 1];
+		}
+		lo[i] = l;
+		hi[i] = h;
+	}
+
+	memset(G, 0, sizeof(w->G));
+	memset(b, 0, sizeof(b));
+
+	for(i = 0; i < K; )
+	{
+		int32_t s = lo[i], e = hi[i];
+		uint32_t cnt;
+
+		for(++i; i < K && lo[i] <= e + 1; ++i)
+		{
+			if(hi[i] > e)
+				e = hi[i];
+		}
+		if(e < s)
+			continue;
+		cnt = (uint32_t)(e - s + 1);
+
+		// 每个音的正、负频率分量在本段各bin上的核
+		for(k = 0; k < K; ++k)
+		{
+			lsq_fd_kernel(w->inv, win, (float32_t)s - v[k], cnt, n, w->Wm[k][0], w->Wm[k][1]);
+			lsq_fd_kernel(w->inv, win, (float32_t)s + v[k], cnt, n, w->Wp[k][0], w->Wp[k][1]);
+		}
+
+		for(j = 0; j < cnt; ++j)
+		{
+			const float32_t *x = &X[2 * (s + j)];
+
+			// I 列 (W- + W+)/2，Q 列 -j*(W- - W+)/2
+			for(k = 0; k < K; ++k)
+			{
+				float32_t mr = w->Wm[k][0][j], mi = w->Wm[k][1][j];
+				float32_t pr = w->Wp[k][0][j], pi = w->Wp[k][1][j];
+
+				ar[2 * k] = 0.5f * (mr + pr);
+				ai[2 * k] = 0.5f * (mi + pi);
+				ar[2 * k + 1] = 0.5f * (mi - pi);
+				ai[2 * k + 1] = -0.5f * (mr - pr);
+			}
+			// 实数化的正规方程：G += Re(a^H * a)，b += Re(a^H * X)
+			for(k = 0; k < M; ++k)
+			{
+				float32_t *g = &G[k * M];
+				uint32_t l;
+
+				b[k] += ar[k] * x[0] + ai[k] * x[1];
+				for(l = k; l < M; ++l)
+					g[l] += ar[k] * ar[l] + ai[k] * ai[l];
+			}
+		}
+	}
+
+	return lsq_normal_solve(w, b, K, I, Q);
+}
@@ -0,0 +1,44 @@
+#ifndef _LSQ_H
+#define _LSQ_H
+
+#include "main.h"
+#include "arm_math.h"
+#include "window_table.h"
+
+/*
+ * K 音最小二乘幅度/相位求解
+ * 模型 x[n] = sum_k I_k*cos(w_k*n) + Q_k*sin(w_k*n)，频率已知时对 2K 个参数线性；
+ * 一次遍历样本由 K 个递推振荡器同时生成各基函数并累加投影向量，2K x 2K 正规矩阵只与频率和点数有关，
+ * 可闭式计算；再用 Cholesky 分解与两次三角回代求解
+ * 频域法 lsq_solve_fd 改为在FFT频谱各峰值附近的少数bin上拟合窗的频谱核，代价与样本数无关
+ */
+
+#define LSQ_MAX_TONES       4                   // 最多同时求解的音数
+#define LSQ_MAX_DIM         (2 * LSQ_MAX_TONES) // 正规矩阵最大阶数
+#define LSQ_RIDGE           1e-6f               // 对角加载量，相对正规矩阵对角线均值
+#ifndef LSQ_GRAM_CLOSED_FORM
+#define LSQ_GRAM_CLOSED_FORM    1               // 1：正规矩阵按 Dirichlet 核闭式计算，遍历中只累加投影；0：逐点累加
+#endif
+#define LSQ_FD_MAX_HALF_BINS    6               // 频域法每个峰两侧最多参与拟合的bin数
+#define LSQ_FD_MAX_BINS     (LSQ_MAX_TONES * (2 * LSQ_FD_MAX_HALF_BINS + 1))	// 合并后一段内最多的bin数
+#define LSQ_FD_INV_LEN      (LSQ_FD_MAX_BINS + 2 * (WINDOW_COEF_MAX - 1))	// 频域核中共用的 1/sin 个数
+#define LSQ_FD_EPS          1e-4f               // 频谱核在整数bin处取极限时的偏移，单位 bin
+
+// 正规矩阵与分解的工作区，由调用者提供（约 4.3KB，不宜放在栈上）；不同时使用的求解可共享同一工作区
+typedef struct{
+	float32_t G[LSQ_MAX_DIM * LSQ_MAX_DIM];			// 正规矩阵
+	float32_t L[LSQ_MAX_DIM * LSQ_MAX_DIM];			// Cholesky 因子及其转置
+	float32_t LT[LSQ_MAX_DIM * LSQ_MAX_DIM];
+	float32_t Wm[LSQ_MAX_TONES][2][LSQ_FD_MAX_BINS];	// 频域法：各音负偏离 W(b - v) 的实部、虚部
+	float32_t Wp[LSQ_MAX_TONES][2][LSQ_FD_MAX_BINS];	// 频域法：镜像分量 W(b + v)
+	float32_t inv[LSQ_FD_INV_LEN];					// 频域法：频谱核的 1/sin 缓存
+} lsq_work_t;
+
+uint8_t lsq_solve(lsq_work_t *w, const float32_t *f, uint32_t K, float32_t fs, const uint16_t *x, uint32_t n,
+				float32_t lsb, float32_t bias, float32_t *I, float32_t *Q);
+uint8_t lsq_solve_proj(lsq_work_t *w, const float32_t *f, uint32_t K, float32_t fs, uint32_t n, float32_t *b,
+				float32_t *I, float32_t *Q);
+uint8_t lsq_solve_fd(lsq_work_t *w, const float32_t *f, uint32_t K, float32_t fs, const float32_t *X, uint32_t n,
+				const window_table_t *win, uint32_t half, float32_t *I, float32_t *Q);
+
+#endif
@@ -0,0 +1,262 @@
+#include "peak.h"
+
+/**
+ * @brief       小根堆下沉
+ * @param       h:	堆
+ * @param		n:	堆内元素个数
+ * @param		i:	下沉起点
+ * @retval      无
+ */
+static void peak_heap_down(peak_t *h, uint32_t n, uint32_t i)
+{
+	peak_t t = h[i];
+	uint32_t c;
+
+	while((c = 2 * i + 1) < n)
+	{
+		if(c + 1 < n && h[c + 1].p < h[c].p)
+			c++;
+		if(h[c].p >= t.p)
+			break;
+		h[i] = h[c];
+		i = c;
+	}
+	h[i] = t;
+}
+
+/**
+ * @brief       小根堆上浮
+ * @param       h:	堆
+ * @param		i:	上浮起点
+ * @retval      无
+ */
+static void peak_heap_up(peak_t *h, uint32_t i)
+{
+	peak_t t = h[i];
+
+	while(i > 0 && h[(i - 1) / 2].p > t.p)
+	{
+		h[i] = h[(i - 1) / 2];
+		i = (i - 1) / 2;
+	}
+	h[i] = t;
+}
+
+/**
+ * @brief       快速选择中位数
+ * @param       s:	样本，原地重排
+ * @param		m:	样本数，大于 0
+ * @retval      第 m/2 小的样本
+ */
+static float32_t peak_select(float32_t *s, uint32_t m)
+{
+	uint32_t lo = 0, hi = m - 1, mid = m / 2, i, store;
+	float32_t pivot, t;
+
+	while(lo < hi)
+	{
+		i = (lo + hi) / 2;
+		pivot = s[i];
+		s[i] = s[hi];
+		s[hi] = pivot;
+		store = lo;
+		for(i = lo; i < hi; ++i)
+		{
+			if(s[i] < pivot)
+			{
+				t = s[i];
+				s[i] = s[store];
+				s[store++] = t;
+			}
+		}
+		s[hi] = s[store];
+		s[store] = pivot;
+
+		if(store == mid)
+			break;
+		else if(mid < store)
+			hi = store - 1;
+		else
+			lo = store + 1;
+	}
+	return s[mid];
+}
+
+/**
+ * @brief       估计频谱噪声基底
+ * @note		均匀抽取 PEAK_FLOOR_NUM 个bin后取中位数，少数强峰不影响结果；
+ *				噪声的幅值平方服从指数分布，中位数约为均值的 ln2 倍。
+ *				抽样缓冲区由调用者提供，放在工作缓冲区中而不占栈
+ * @param       p:	幅值平方谱
+ * @param		n:	bin数
+ * @param		s:	PEAK_FLOOR_NUM 个点的抽样缓冲区
+ * @retval      噪声基底（幅值平方的中位数）
+ */
+float32_t peak_noise_floor(const float32_t *p, uint32_t n, float32_t *s)
+{
+	uint32_t step = (n + PEAK_FLOOR_NUM - 1) / PEAK_FLOOR_NUM;
+	uint32_t m = 0, i;
+
+	if(step == 0)
+		step = 1;
+	for(i = step / 2; i < n && m < PEAK_FLOOR_NUM; i += step)
+		s[m++] = p[i];
+	if(m == 0)
+		return 0.0f;
+	return peak_select(s, m);
+}
+
+/**
+ * @brief       估计定点频谱噪声基底
+ * @note		同 peak_noise_floor，只把抽样的 PEAK_FLOOR_NUM 个bin转为浮点
+ * @param       p:	幅值平方谱，arm_cmplx_mag_squared_q31 的输出
+ * @param		n:	bin数
+ * @param		s:	PEAK_FLOOR_NUM 个点的抽样缓冲区
+ * @retval      噪声基底，与 p 同一刻度
+ */
+float32_t peak_noise_floor_q31(const q31_t *p, uint32_t n, float32_t *s)
+{
+	uint32_t step = (n + PEAK_FLOOR_NUM - 1) / PEAK_FLOOR_NUM;
+	uint32_t m = 0, i;
+
+	if(step == 0)
+		step = 1;
+	for(i = step / 2; i < n && m < PEAK_FLOOR_NUM; i += step)
+		s[m++] = (float32_t)p[i];
+	if(m == 0)
+		return 0.0f;
+	return peak_select(s, m);
+}
+
+/**
+ * @brief       候选峰值入堆
+ * @note		与堆中已有峰值间隔小于 min_sep 时只保留较强者，由于按下标递增遍历且堆中峰值两两间隔不小于 min_sep，
+ *				冲突者至多一个；堆满时候选只需与堆顶（最弱者）比较
+ * @param       h:			堆
+ * @param		cnt:		堆内元素个数，输入输出
+ * @param		K:			堆容量
+ * @param		k:			候选bin下标
+ * @param		v:			候选幅值平方
+ * @param		min_sep:	峰值最小间隔，单位 bin
+ * @retval      无
+ */
+static void peak_insert(peak_t *h, uint32_t *cnt, uint32_t K, uint32_t k, float32_t v, uint32_t min_sep)
+{
+	uint32_t i;
+
+	// 与已有峰值的间隔检查
+	for(i = 0; i < *cnt; ++i)
+	{
+		if(k - h[i].k < min_sep)
+			break;
+	}
+	if(i < *cnt)
+	{
+		if(v > h[i].p)
+		{
+			h[i].k = k;
+			h[i].p = v;
+			peak_heap_down(h, *cnt, i);
+		}
+		return;
+	}
+
+	if(*cnt < K)
+	{
+		h[*cnt].k = k;
+		h[*cnt].p = v;
+		peak_heap_up(h, *cnt);
+		(*cnt)++;
+	}
+	else if(v > h[0].p)
+	{
+		h[0].k = k;
+		h[0].p = v;
+		peak_heap_down(h, *cnt, 0);
+	}
+}
+
+/**
+ * @brief       按强度降序输出堆中的峰值
+ * @param       h:		堆，输出后清空
+ * @param		cnt:	堆内元素个数
+ * @param		peaks:	峰值输出
+ * @retval      无
+ */
+static void peak_sort(peak_t *h, uint32_t cnt, peak_t *peaks)
+{
+	uint32_t i;
+
+	// 依次弹出堆顶，从尾部填入
+	for(i = cnt; i > 0; --i)
+	{
+		peaks[i - 1] = h[0];
+		h[0] = h[i - 1];
+		peak_heap_down(h, i - 1, 0);
+	}
+}
+
+/**
+ * @brief       单次遍历检测最强的 K 个峰值
+ * @note		局部极大值且超过门限者为候选，由 peak_insert 保留最强的 K 个且两两间隔不小于 min_sep；
+ *				总耗时约为 n + 候选数 * (K + log K)
+ * @param       p:			幅值平方谱
+ * @param		n:			bin数
+ * @param		thresh:		门限（幅值平方）
+ * @param		min_sep:	峰值最小间隔，单位 bin
+ * @param		peaks:		峰值输出，按强度降序排列
+ * @param		K:			最多检测的峰值个数，不大于 PEAK_MAX_K
+ * @retval      检测到的峰值个数
+ */
+uint32_t peak_find(const float32_t *p, uint32_t n, float32_t thresh, uint32_t min_sep, peak_t *peaks, uint32_t K)
+{
+	peak_t h[PEAK_MAX_K];
+	uint32_t cnt = 0, k;
+
+	if(K > PEAK_MAX_K)
+		K = PEAK_MAX_K;
+	if(K == 0 || n < 3)
+		return 0;
+
+	for(k = 1; k < n - 1; ++k)
+	{
+		float32_t v = p[k];
+		if(v <= thresh || v <= p[k - 1] || v < p[k + 1])
+			continue;
+		peak_insert(h, &cnt, K, k, v, min_sep);
+	}
+	peak_sort(h, cnt, peaks);
+	return cnt;
+}
+
+/**
+ * @brief       在定点频谱上检测最强的 K 个峰值
+ * @note		同 peak_find，遍历与门限比较都在整数域完成，只有候选转为浮点入堆；输出的幅值平方与 p 同一刻度
+ * @param       p:			幅值平方谱，arm_cmplx_mag_squared_q31 的输出
+ * @param		n:			bin数
+ * @param		thresh:		门限，与 p 同一刻度
+ * @param		min_sep:	峰值最小间隔，单位 bin
+ * @param		peaks:		峰值输出，按强度降序排列
+ * @param		K:			最多检测的峰值个数，不大于 PEAK_MAX_K
+ * @retval      检测到的峰值个数
+ */
+uint32_t peak_find_q31(const q31_t *p, uint32_t n, q31_t thresh, uint32_t min_sep, peak_t *peaks, uint32_t K)
+{
+	peak_t h[PEAK_MAX_K];
+	uint32_t cnt = 0, k;
+
+	if(K > PEAK_MAX_K)
+		K = PEAK_MAX_K;
+	if(K == 0 || n < 3)
+		return 0;
+
+	for(k = 1; k < n - 1; ++k)
+	{
+		q31_t v = p[k];
+		if(v <= thresh || v <= p[k - 1] || v < p[k + 1])
+			continue;
+		peak_insert(h, &cnt, K, k, (float32_t)v, min_sep);
+	}
+	peak_sort(h, cnt, peaks);
+	return cnt;
+}
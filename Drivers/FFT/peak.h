@@ -0,0 +1,28 @@
+#ifndef _PEAK_H
+#define _PEAK_H
+
+#include "main.h"
+#include "arm_math.h"
+
+/*
+ * 通用多峰值检测
+ * 单次遍历频谱，用容量为 K 的小根堆保留最强的 K 个局部极大值；
+ * 最小间隔取自窗函数主瓣宽度，门限相对噪声基底设定；_q31 版本用于定点流水线的幅值平方谱
+ */
+
+#define PEAK_MAX_K          8                   // 最多检测的峰值个数
+#define PEAK_FLOOR_NUM      128                 // 估计噪声基底时抽样的bin数
+#define PEAK_SNR_RATIO      100.0f              // 门限相对噪声基底的功率比（20 dB）
+
+// 峰值
+typedef struct{
+	uint32_t k;			// bin下标
+	float32_t p;		// 幅值平方
+} peak_t;
+
+float32_t peak_noise_floor(const float32_t *p, uint32_t n, float32_t *s);
+uint32_t peak_find(const float32_t *p, uint32_t n, float32_t thresh, uint32_t min_sep, peak_t *peaks, uint32_t K);
+float32_t peak_noise_floor_q31(const q31_t *p, uint32_t n, float32_t *s);
+uint32_t peak_find_q31(const q31_t *p, uint32_t n, q31_t thresh, uint32_t min_sep, peak_t *peaks, uint32_t K);
+
+#endif
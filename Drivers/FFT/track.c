@@ -0,0 +1,230 @@
+#include "track.h"
+#include "lsq.h"
+#include "ACQ.h"
+
+#if (ACQ_FRAME_LEN % TRACK_BLOCK) != 0
+#error "TRACK_BLOCK 须整除 ACQ_FRAME_LEN"
+#endif
+
+// 跟踪状态
+typedef struct{
+	uint8_t locked;
+	uint32_t K;									// 跟踪的音数
+	float32_t f[TRACK_MAX_TONES];				// 当前频率
+	float32_t A0[TRACK_MAX_TONES];				// 锁定时的幅度
+	float32_t phi_prev[TRACK_MAX_TONES];		// 上一块的相位
+	uint8_t has_prev;							// 上一块相位有效
+	uint8_t bad;								// 连续超限块数
+	tone_t last[TRACK_MAX_TONES];				// 上一次全帧捕获结果
+	acq_reader_t rd;							// 采集流读取器
+	analyzer_t *an;								// 捕获所用的分析器，跟踪结果写回其 tones
+} track_t;
+
+static track_t trk = { 0 };
+
+
+/**
+ * @brief       各音在一块内能否分辨
+ * @note		矩形窗下 TRACK_BLOCK 点的频率分辨率为 fs / TRACK_BLOCK，
+ *				两音间隔小于 TRACK_MIN_SEP_BINS 倍时基函数高度相关，幅度与相位对噪声极敏感
+ * @param       f:	各音频率，单位 Hz
+ * @param		K:	音数
+ * @param		fs:	采样率，单位 Hz
+ * @retval      1：可分辨；0：过近
+ */
+static uint8_t track_separable(const float32_t *f, uint32_t K, float32_t fs)
+{
+	uint32_t i, j;
+
+	for(i = 0; i < K; ++i)
+		for(j = i + 1; j < K; ++j)
+			if(fabsf(f[i] - f[j]) < TRACK_MIN_SEP_BINS * fs / TRACK_BLOCK)
+				return 0;
+	return 1;
+}
+
+/**
+ * @brief       提交一次全帧捕获结果
+ * @note		相邻两次捕获的各音频率相差都小于 TRACK_LOCK_TOL、幅度足够且各音在一块内可分辨时锁定，
+ *				锁定后从下一帧起按块跟踪；跟踪只读取单通道采集流，多通道扫描时不锁定
+ * @param       a:	完成捕获的分析器，取其 tones；锁定期间其工作缓冲区借给跟踪使用
+ * @param		K:	音数，1 ~ TRACK_MAX_TONES
+ * @retval      1：已锁定；0：未锁定
+ */
+uint8_t track_acquired(analyzer_t *a, uint32_t K)
+{
+	const tone_t *t = a->tones;
+	uint32_t k;
+	uint8_t stable = (K > 0 && K <= TRACK_MAX_TONES);
+
+	for(k = 0; k < K && stable; ++k)
+	{
+		if(fabsf(t[k].f - trk.last[k].f) >= TRACK_LOCK_TOL || t[k].A < TRACK_AMP_FLOOR)
+			stable = 0;
+	}
+	for(k = 0; k < K && k < TRACK_MAX_TONES; ++k)
+		trk.last[k] = t[k];
+
+	if(!TRACK_ENABLE || ACQ_CHANNELS > 1 || !stable)
+		return 0;
+
+	for(k = 0; k < K; ++k)
+	{
+		trk.f[k] = t[k].f;
+		trk.A0[k] = t[k].A;
+	}
+	if(!track_separable(trk.f, K, a->fs))
+		return 0;
+	trk.K = K;
+	trk.an = a;
+	trk.has_prev = 0;
+	trk.bad = 0;
+	ACQ_ReaderStart(&trk.rd, ACQ.seq + 1);		// 正在采集的帧已过半，从下一帧开头开始
+	trk.locked = 1;
+	return 1;
+}
+
+/**
+ * @brief       是否处于跟踪模式
+ * @param       无
+ * @retval      1：已锁定
+ */
+uint8_t track_locked(void)
+{
+	return trk.locked;
+}
+
+/**
+ * @brief       退出跟踪模式，回到全帧捕获
+ * @note		释放读取器持有的帧；全帧相位差法所需的前帧相位已过期，一并清除
+ * @param       无
+ * @retval      无
+ */
+void track_unlock(void)
+{
+	uint32_t k;
+
+	trk.locked = 0;
+	for(k = 0; k < TRACK_MAX_TONES; ++k)
+		trk.last[k].f = 0.0f;
+	ACQ_ReaderStop(&trk.rd);
+	FFT_ResetPhase(trk.an);
+}
+
+/**
+ * @brief       处理一块样本
+ * @note		1. 整数域累加码值和与平方和，得到块均值与去直流能量
+ *				2. 每个锁定频率一个 Goertzel 谐振器：s = x + 2cos(w)*s1 - s2，每点每音一次乘加一次减，
+ *				   块末 sum x*e^(-j*w*t) = e^(-j*w*(B-1)) * (s1 - e^(-j*w)*s2)，即最小二乘的投影；
+ *				   正规矩阵与数据无关按闭式计算，求得幅度与块起点相位
+ *				3. 相邻块相位应推进 -w*B，实测差值的余量即频率误差：df = -wrap(dphi + w*B) * fs / (2*pi*B)
+ *				4. 残差能量 E - sum(A^2)*B/2 占比或幅度超限则计数，连续 TRACK_LOST_BLOCKS 块超限判失锁；修正后两音间隔不足时立即失锁
+ *				结果写入锁定时分析器的 tones
+ * @param       x:	TRACK_BLOCK 个ADC原始码值
+ * @retval      1：仍锁定；0：失锁
+ */
+uint8_t track_block(const uint16_t *x)
+{
+	float32_t I[TRACK_MAX_TONES], Q[TRACK_MAX_TONES];
+	float32_t b[2 * TRACK_MAX_TONES];
+	float32_t c2[TRACK_MAX_TONES], s1[TRACK_MAX_TONES], s2[TRACK_MAX_TONES];
+	float32_t mean, energy, fit = 0.0f;
+	uint32_t sum = 0, k, t;
+	uint64_t sum2 = 0;
+	uint8_t bad = 0;
+
+	for(t = 0; t < TRACK_BLOCK; ++t)
+	{
+		sum += x[t];
+		sum2 += (uint32_t)x[t] * x[t];
+	}
+	mean = (float32_t)sum / (float32_t)TRACK_BLOCK;
+	energy = ((float32_t)sum2 - mean * (float32_t)sum) * trk.an->lsb * trk.an->lsb;
+
+	for(k = 0; k < trk.K; ++k)
+	{
+		c2[k] = 2.0f * cosf(2.0f * PI * trk.f[k] / trk.an->fs);
+		s1[k] = 0.0f;
+		s2[k] = 0.0f;
+	}
+	for(t = 0; t < TRACK_BLOCK; ++t)
+	{
+		float32_t xt = (float32_t)x[t] - mean;
+
+		for(k = 0; k < trk.K; ++k)
+		{
+			float32_t s0 = xt + c2[k] * s1[k] - s2[k];
+			s2[k] = s1[k];
+			s1[k] = s0;
+		}
+	}
+	for(k = 0; k < trk.K; ++k)
+	{
+		float32_t w = 2.0f * PI * trk.f[k] / trk.an->fs;
+		float32_t yr = s1[k] - 0.5f * c2[k] * s2[k];
+		float32_t yi = sinf(w) * s2[k];
+		float32_t pr = cosf(w * (TRACK_BLOCK - 1)), pi = -sinf(w * (TRACK_BLOCK - 1));
+
+		b[2 * k] = (pr * yr - pi * yi) * trk.an->lsb;
+		b[2 * k + 1] = -(pr * yi + pi * yr) * trk.an->lsb;
+	}
+	lsq_solve_proj(&trk.an->work->lsq, trk.f, trk.K, trk.an->fs, TRACK_BLOCK, b, I, Q);
+
+	for(k = 0; k < trk.K; ++k)
+	{
+		float32_t A, phi;
+
+		arm_sqrt_f32(I[k] * I[k] + Q[k] * Q[k], &A);
+		arm_atan2_f32(Q[k], I[k], &phi);
+		trk.an->tones[k].f = trk.f[k];
+		trk.an->tones[k].A = A;
+		trk.an->tones[k].phi = phi;
+		fit += A * A * (0.5f * TRACK_BLOCK);
+		if(A < trk.A0[k] * TRACK_AMP_MIN)
+			bad = 1;
+
+		// 相位差法修正频率，供下一块使用
+		if(trk.has_prev)
+		{
+			float32_t w = 2.0f * PI * trk.f[k] / trk.an->fs;
+			float32_t d = phi - trk.phi_prev[k] + w * TRACK_BLOCK;
+			d -= 2.0f * PI * floorf(d / (2.0f * PI) + 0.5f);
+			trk.f[k] -= TRACK_FREQ_GAIN * d * trk.an->fs / (2.0f * PI * TRACK_BLOCK);
+		}
+		trk.phi_prev[k] = phi;
+	}
+	trk.has_prev = 1;
+
+	if(energy - fit > TRACK_RESIDUAL_MAX * energy)
+		bad = 1;
+	trk.bad = bad ? trk.bad + 1 : 0;
+	if(trk.bad >= TRACK_LOST_BLOCKS || !track_separable(trk.f, trk.K, trk.an->fs))	// 频率修正后两音靠得过近同样退出
+	{
+		track_unlock();
+		return 0;
+	}
+	return 1;
+}
+
+/**
+ * @brief       跟踪模式主循环处理
+ * @note		由采集流读取器按序取出全部可用的整块（先已采满的帧，再DMA正在写入的帧）；
+ *				流不连续（丢帧或溢出）时相位参考失效，下一块不做频率修正
+ * @param       无
+ * @retval      本次更新的块数
+ */
+uint32_t track_poll(void)
+{
+	const uint16_t *x;
+	uint8_t gap;
+	uint32_t n = 0;
+
+	while(trk.locked && (x = ACQ_Read(&trk.rd, TRACK_BLOCK, &gap)) != NULL)
+	{
+		if(gap)
+			trk.has_prev = 0;
+		track_block(x);
+		n++;
+	}
+	return n;
+}
@@ -0,0 +1,35 @@
+#ifndef _TRACK_H
+#define _TRACK_H
+
+#include "main.h"
+#include "arm_math.h"
+#include "FFT.h"
+
+/*
+ * 锁定后的跟踪模式
+ * 全帧FFT捕获得到稳定的频率后，不再逐帧做FFT，而是把采集流切成 TRACK_BLOCK 点的小块，
+ * 在已锁定的频率上做块最小二乘（即 K 个 Goertzel 式递推振荡器的相关累加），
+ * 由相邻块的相位差修正频率；残差能量或幅度异常持续超限时判为失锁，退回全帧捕获
+ * 块长只有 TRACK_BLOCK 点，两音相距不足 TRACK_MIN_SEP_BINS 个块 bin 时正规矩阵接近奇异，此时不锁定，
+ * 仍由全帧FFT（及 Zoom-FFT）分辨
+ * 双缓冲采集模式下直接读取DMA正在写入的缓冲区，每块采满即可更新，不必等待整帧
+ */
+
+#define TRACK_ENABLE        1                   // 置 1 时捕获稳定后自动进入跟踪模式
+#define TRACK_BLOCK         256                 // 每次更新的样本数，须整除 ACQ_FRAME_LEN
+#define TRACK_MAX_TONES     2                   // 跟踪的音数上限
+#define TRACK_LOCK_TOL      0.5f                // 相邻两帧捕获结果相差小于该值（Hz）时锁定
+#define TRACK_AMP_FLOOR     0.01f               // 参与锁定的最小幅度，单位 V
+#define TRACK_FREQ_GAIN     0.5f                // 频率修正环路增益
+#define TRACK_RESIDUAL_MAX  0.1f                // 残差能量占比上限
+#define TRACK_AMP_MIN       0.5f                // 幅度相对锁定时的下限
+#define TRACK_LOST_BLOCKS   4                   // 连续超限块数达到该值判为失锁
+#define TRACK_MIN_SEP_BINS  2.0f                // 两音间隔下限，单位为块的 bin（fs / TRACK_BLOCK），更近时块内无法分辨，不锁定
+
+uint8_t track_acquired(analyzer_t *a, uint32_t K);
+uint8_t track_locked(void);
+void track_unlock(void);
+uint8_t track_block(const uint16_t *x);
+uint32_t track_poll(void);
+
+#endif
@@ -0,0 +1,4804 @@
+/* 本文件由 gen_window_table.py 生成（N = 4096），请勿手动修改 */
+#include "window_table.h"
+
+#if (WINDOW_TABLE_LEN != 4096) || (WINDOW_COEF_MAX != 5) || (WINDOW_BIAS_LEN != 65)
+#error "window_table.c 与 WINDOW_TABLE_LEN 不一致，请重新运行 gen_window_table.py"
+#endif
+
+static const float32_t win_hanning_half[WINDOW_HALF_LEN] = {
+	0.000000000e+00f, 5.882741491e-07f, 2.353095212e-06f, 5.294459036e-06f,
+	9.412358699e-06f, 1.470678451e-05f, 2.117772402e-05f, 2.882516199e-05f,
+	3.764908043e-05f, 4.764945857e-05f, 5.882627289e-05f, 7.117949709e-05f,
+	8.470910209e-05f, 9.941505606e-05f, 1.152973244e-04f, 1.323558697e-04f,
+	1.505906519e-04f, 1.700016280e-04f, 1.905887524e-04f, 2.123519766e-04f,
+	2.352912495e-04f, 2.594065169e-04f, 2.846977223e-04f, 3.111648060e-04f,
+	3.388077058e-04f, 3.676263567e-04f, 3.976206908e-04f, 4.287906376e-04f,
+	4.611361237e-04f, 4.946570730e-04f, 5.293534066e-04f, 5.652250429e-04f,
+	6.022718974e-04f, 6.404938831e-04f, 6.798909099e-04f, 7.204628851e-04f,
+	7.622097134e-04f, 8.051312963e-04f, 8.492275331e-04f, 8.944983198e-04f,
+	9.409435499e-04f, 9.885631143e-04f, 1.037356901e-03f, 1.087324794e-03f,
+	1.138466678e-03f, 1.190782431e-03f, 1.244271930e-03f, 1.298935049e-03f,
+	1.354771661e-03f, 1.411781632e-03f, 1.469964830e-03f, 1.529321118e-03f,
+	1.589850354e-03f, 1.651552399e-03f, 1.714427105e-03f, 1.778474325e-03f,
+	1.843693909e-03f, 1.910085702e-03f, 1.977649549e-03f, 2.046385291e-03f,
+	2.116292766e-03f, 2.187371810e-03f, 2.259622254e-03f, 2.333043930e-03f,
+	2.407636664e-03f, 2.483400281e-03f, 2.560334603e-03f, 2.638439448e-03f,
+	2.717714633e-03f, 2.798159971e-03f, 2.879775273e-03f, 2.962560348e-03f,
+	3.046514999e-03f, 3.131639030e-03f, 3.217932240e-03f, 3.305394426e-03f,
+	3.394025383e-03f, 3.483824901e-03f, 3.574792770e-03f, 3.666928776e-03f,
+	3.760232701e-03f, 3.854704326e-03f, 3.950343429e-03f, 4.047149785e-03f,
+	4.145123165e-03f, 4.244263341e-03f, 4.344570077e-03f, 4.446043138e-03f,
+	4.548682286e-03f, 4.652487279e-03f, 4.757457872e-03f, 4.863593818e-03f,
+	4.970894869e-03f, 5.079360771e-03f, 5.188991268e-03f, 5.299786104e-03f,
+	5.411745018e-03f, 5.524867745e-03f, 5.639154020e-03f, 5.754603574e-03f,
+	5.871216135e-03f, 5.988991428e-03f, 6.107929178e-03f, 6.228029103e-03f,
+	6.349290921e-03f, 6.471714347e-03f, 6.595299093e-03f, 6.720044868e-03f,
+	6.845951378e-03f, 6.973018327e-03f, 7.101245416e-03f, 7.230632344e-03f,
+	7.361178806e-03f, 7.492884494e-03f, 7.625749099e-03f, 7.759772308e-03f,
+	7.894953807e-03f, 8.031293275e-03f, 8.168790394e-03f, 8.307444839e-03f,
+	8.447256284e-03f, 8.588224401e-03f, 8.730348856e-03f, 8.873629317e-03f,
+	9.018065445e-03f, 9.163656902e-03f, 9.310403343e-03f, 9.458304425e-03f,
+	9.607359798e-03f, 9.757569113e-03f, 9.908932016e-03f, 1.006144815e-02f,
+	1.021511716e-02f, 1.036993868e-02f, 1.052591234e-02f, 1.068303779e-02f,
+	1.084131464e-02f, 1.100074253e-02f, 1.116132109e-02f, 1.132304993e-02f,
+	1.148592867e-02f, 1.164995694e-02f, 1.181513433e-02f, 1.198146048e-02f,
+	1.214893498e-02f, 1.231755744e-02f, 1.248732747e-02f, 1.265824466e-02f,
+	1.283030861e-02f, 1.300351892e-02f, 1.317787517e-02f, 1.335337697e-02f,
+	1.353002390e-02f, 1.370781553e-02f, 1.388675146e-02f, 1.406683126e-02f,
+	1.424805451e-02f, 1.443042078e-02f, 1.461392964e-02f, 1.479858066e-02f,
+	1.498437340e-02f, 1.517130744e-02f, 1.535938232e-02f, 1.554859761e-02f,
+	1.573895286e-02f, 1.593044763e-02f, 1.612308145e-02f, 1.631685389e-02f,
+	1.651176448e-02f, 1.670781276e-02f, 1.690499828e-02f, 1.710332056e-02f,
+	1.730277915e-02f, 1.750337357e-02f, 1.770510336e-02f, 1.790796802e-02f,
+	1.811196710e-02f, 1.831710011e-02f, 1.852336656e-02f, 1.873076598e-02f,
+	1.893929787e-02f, 1.914896174e-02f, 1.935975709e-02f, 1.957168345e-02f,
+	1.978474029e-02f, 1.999892713e-02f, 2.021424346e-02f, 2.043068877e-02f,
+	2.064826255e-02f, 2.086696430e-02f, 2.108679349e-02f, 2.130774961e-02f,
+	2.152983213e-02f, 2.175304055e-02f, 2.197737433e-02f, 2.220283293e-02f,
+	2.242941585e-02f, 2.265712253e-02f, 2.288595245e-02f, 2.311590506e-02f,
+	2.334697982e-02f, 2.357917620e-02f, 2.381249364e-02f, 2.404693160e-02f,
+	2.428248952e-02f, 2.451916684e-02f, 2.475696303e-02f, 2.499587750e-02f,
+	2.523590970e-02f, 2.547705907e-02f, 2.571932504e-02f, 2.596270704e-02f,
+	2.620720449e-02f, 2.645281682e-02f, 2.669954346e-02f, 2.694738381e-02f,
+	2.719633731e-02f, 2.744640336e-02f, 2.769758137e-02f, 2.794987075e-02f,
+	2.820327092e-02f, 2.845778127e-02f, 2.871340120e-02f, 2.897013011e-02f,
+	2.922796741e-02f, 2.948691247e-02f, 2.974696470e-02f, 3.000812348e-02f,
+	3.027038820e-02f, 3.053375823e-02f, 3.079823297e-02f, 3.106381178e-02f,
+	3.133049404e-02f, 3.159827913e-02f, 3.186716641e-02f, 3.213715526e-02f,
+	3.240824503e-02f, 3.268043509e-02f, 3.295372480e-02f, 3.322811351e-02f,
+	3.350360058e-02f, 3.378018537e-02f, 3.405786721e-02f, 3.433664546e-02f,
+	3.461651946e-02f, 3.489748855e-02f, 3.517955208e-02f, 3.546270937e-02f,
+	3.574695976e-02f, 3.603230259e-02f, 3.631873717e-02f, 3.660626285e-02f,
+	3.689487893e-02f, 3.718458475e-02f, 3.747537961e-02f, 3.776726284e-02f,
+	3.806023374e-02f, 3.835429164e-02f, 3.864943583e-02f, 3.894566563e-02f,
+	3.924298033e-02f, 3.954137924e-02f, 3.984086165e-02f, 4.014142685e-02f,
+	4.044307415e-02f, 4.074580284e-02f, 4.104961219e-02f, 4.135450150e-02f,
+	4.166047004e-02f, 4.196751710e-02f, 4.227564196e-02f, 4.258484388e-02f,
+	4.289512215e-02f, 4.320647603e-02f, 4.351890479e-02f, 4.383240769e-02f,
+	4.414698400e-02f, 4.446263297e-02f, 4.477935387e-02f, 4.509714595e-02f,
+	4.541600845e-02f, 4.573594064e-02f, 4.605694176e-02f, 4.637901104e-02f,
+	4.670214774e-02f, 4.702635110e-02f, 4.735162034e-02f, 4.767795471e-02f,
+	4.800535344e-02f, 4.833381575e-02f, 4.866334088e-02f, 4.899392805e-02f,
+	4.932557648e-02f, 4.965828539e-02f, 4.999205399e-02f, 5.032688151e-02f,
+	5.066276715e-02f, 5.099971013e-02f, 5.133770965e-02f, 5.167676491e-02f,
+	5.201687512e-02f, 5.235803948e-02f, 5.270025718e-02f, 5.304352743e-02f,
+	5.338784940e-02f, 5.373322230e-02f, 5.407964530e-02f, 5.442711760e-02f,
+	5.477563838e-02f, 5.512520681e-02f, 5.547582207e-02f, 5.582748335e-02f,
+	5.618018980e-02f, 5.653394060e-02f, 5.688873493e-02f, 5.724457193e-02f,
+	5.760145078e-02f, 5.795937064e-02f, 5.831833067e-02f, 5.867833001e-02f,
+	5.903936783e-02f, 5.940144326e-02f, 5.976455547e-02f, 6.012870360e-02f,
+	6.049388679e-02f, 6.086010417e-02f, 6.122735490e-02f, 6.159563810e-02f,
+	6.196495290e-02f, 6.233529845e-02f, 6.270667386e-02f, 6.307907827e-02f,
+	6.345251079e-02f, 6.382697055e-02f, 6.420245667e-02f, 6.457896826e-02f,
+	6.495650445e-02f, 6.533506433e-02f, 6.571464701e-02f, 6.609525162e-02f,
+	6.647687724e-02f, 6.685952299e-02f, 6.724318795e-02f, 6.762787124e-02f,
+	6.801357194e-02f, 6.840028914e-02f, 6.878802194e-02f, 6.917676943e-02f,
+	6.956653068e-02f, 6.995730479e-02f, 7.034909082e-02f, 7.074188787e-02f,
+	7.113569500e-02f, 7.153051129e-02f, 7.192633581e-02f, 7.232316763e-02f,
+	7.272100582e-02f, 7.311984943e-02f, 7.351969753e-02f, 7.392054919e-02f,
+	7.432240345e-02f, 7.472525937e-02f, 7.512911600e-02f, 7.553397239e-02f,
+	7.593982760e-02f, 7.634668066e-02f, 7.675453061e-02f, 7.716337651e-02f,
+	7.757321738e-02f, 7.798405225e-02f, 7.839588018e-02f, 7.880870018e-02f,
+	7.922251128e-02f, 7.963731251e-02f, 8.005310290e-02f, 8.046988146e-02f,
+	8.088764722e-02f, 8.130639919e-02f, 8.172613639e-02f, 8.214685782e-02f,
+	8.256856251e-02f, 8.299124945e-02f, 8.341491765e-02f, 8.383956612e-02f,
+	8.426519385e-02f, 8.469179985e-02f, 8.511938310e-02f, 8.554794261e-02f,
+	8.597747737e-02f, 8.640798636e-02f, 8.683946858e-02f, 8.727192300e-02f,
+	8.770534861e-02f, 8.813974439e-02f, 8.857510931e-02f, 8.901144236e-02f,
+	8.944874250e-02f, 8.988700872e-02f, 9.032623996e-02f, 9.076643521e-02f,
+	9.120759342e-02f, 9.164971357e-02f, 9.209279460e-02f, 9.253683547e-02f,
+	9.298183515e-02f, 9.342779258e-02f, 9.387470671e-02f, 9.432257649e-02f,
+	9.477140087e-02f, 9.522117880e-02f, 9.567190921e-02f, 9.612359104e-02f,
+	9.657622323e-02f, 9.702980471e-02f, 9.748433443e-02f, 9.793981130e-02f,
+	9.839623426e-02f, 9.885360223e-02f, 9.931191414e-02f, 9.977116890e-02f,
+	1.002313654e-01f, 1.006925027e-01f, 1.011545795e-01f, 1.016175949e-01f,
+	1.020815477e-01f, 1.025464368e-01f, 1.030122612e-01f, 1.034790198e-01f,
+	1.039467113e-01f, 1.044153349e-01f, 1.048848893e-01f, 1.053553734e-01f,
+	1.058267862e-01f, 1.062991265e-01f, 1.067723932e-01f, 1.072465852e-01f,
+	1.077217014e-01f, 1.081977407e-01f, 1.086747019e-01f, 1.091525840e-01f,
+	1.096313857e-01f, 1.101111060e-01f, 1.105917438e-01f, 1.110732979e-01f,
+	1.115557672e-01f, 1.120391505e-01f, 1.125234467e-01f, 1.130086547e-01f,
+	1.134947733e-01f, 1.139818014e-01f, 1.144697379e-01f, 1.149585815e-01f,
+	1.154483312e-01f, 1.159389857e-01f, 1.164305440e-01f, 1.169230049e-01f,
+	1.174163672e-01f, 1.179106297e-01f, 1.184057914e-01f, 1.189018509e-01f,
+	1.193988073e-01f, 1.198966592e-01f, 1.203954055e-01f, 1.208950451e-01f,
+	1.213955767e-01f, 1.218969993e-01f, 1.223993116e-01f, 1.229025123e-01f,
+	1.234066005e-01f, 1.239115748e-01f, 1.244174340e-01f, 1.249241771e-01f,
+	1.254318027e-01f, 1.259403098e-01f, 1.264496970e-01f, 1.269599632e-01f,
+	1.274711073e-01f, 1.279831279e-01f, 1.284960239e-01f, 1.290097941e-01f,
+	1.295244373e-01f, 1.300399523e-01f, 1.305563378e-01f, 1.310735926e-01f,
+	1.315917156e-01f, 1.321107054e-01f, 1.326305610e-01f, 1.331512809e-01f,
+	1.336728642e-01f, 1.341953094e-01f, 1.347186154e-01f, 1.352427809e-01f,
+	1.357678048e-01f, 1.362936857e-01f, 1.368204225e-01f, 1.373480138e-01f,
+	1.378764585e-01f, 1.384057553e-01f, 1.389359030e-01f, 1.394669003e-01f,
+	1.399987460e-01f, 1.405314388e-01f, 1.410649775e-01f, 1.415993607e-01f,
+	1.421345874e-01f, 1.426706561e-01f, 1.432075656e-01f, 1.437453147e-01f,
+	1.442839021e-01f, 1.448233266e-01f, 1.453635868e-01f, 1.459046815e-01f,
+	1.464466094e-01f, 1.469893693e-01f, 1.475329598e-01f, 1.480773797e-01f,
+	1.486226278e-01f, 1.491687026e-01f, 1.497156030e-01f, 1.502633277e-01f,
+	1.508118753e-01f, 1.513612446e-01f, 1.519114343e-01f, 1.524624430e-01f,
+	1.530142696e-01f, 1.535669126e-01f, 1.541203708e-01f, 1.546746429e-01f,
+	1.552297276e-01f, 1.557856236e-01f, 1.563423296e-01f, 1.568998442e-01f,
+	1.574581661e-01f, 1.580172941e-01f, 1.585772268e-01f, 1.591379629e-01f,
+	1.596995011e-01f, 1.602618401e-01f, 1.608249784e-01f, 1.613889149e-01f,
+	1.619536482e-01f, 1.625191769e-01f, 1.630854998e-01f, 1.636526155e-01f,
+	1.642205226e-01f, 1.647892198e-01f, 1.653587058e-01f, 1.659289793e-01f,
+	1.665000388e-01f, 1.670718832e-01f, 1.676445109e-01f, 1.682179207e-01f,
+	1.687921112e-01f, 1.693670811e-01f, 1.699428290e-01f, 1.705193535e-01f,
+	1.710966534e-01f, 1.716747271e-01f, 1.722535735e-01f, 1.728331911e-01f,
+	1.734135785e-01f, 1.739947345e-01f, 1.745766575e-01f, 1.751593463e-01f,
+	1.757427995e-01f, 1.763270157e-01f, 1.769119935e-01f, 1.774977316e-01f,
+	1.780842286e-01f, 1.786714830e-01f, 1.792594936e-01f, 1.798482589e-01f,
+	1.804377776e-01f, 1.810280482e-01f, 1.816190694e-01f, 1.822108398e-01f,
+	1.828033579e-01f, 1.833966225e-01f, 1.839906320e-01f, 1.845853852e-01f,
+	1.851808805e-01f, 1.857771167e-01f, 1.863740923e-01f, 1.869718058e-01f,
+	1.875702559e-01f, 1.881694412e-01f, 1.887693603e-01f, 1.893700117e-01f,
+	1.899713941e-01f, 1.905735060e-01f, 1.911763460e-01f, 1.917799127e-01f,
+	1.923842047e-01f, 1.929892205e-01f, 1.935949588e-01f, 1.942014180e-01f,
+	1.948085969e-01f, 1.954164938e-01f, 1.960251075e-01f, 1.966344365e-01f,
+	1.972444793e-01f, 1.978552345e-01f, 1.984667007e-01f, 1.990788765e-01f,
+	1.996917603e-01f, 2.003053508e-01f, 2.009196465e-01f, 2.015346460e-01f,
+	2.021503478e-01f, 2.027667504e-01f, 2.033838525e-01f, 2.040016525e-01f,
+	2.046201491e-01f, 2.052393407e-01f, 2.058592259e-01f, 2.064798032e-01f,
+	2.071010713e-01f, 2.077230285e-01f, 2.083456735e-01f, 2.089690048e-01f,
+	2.095930210e-01f, 2.102177204e-01f, 2.108431018e-01f, 2.114691636e-01f,
+	2.120959043e-01f, 2.127233225e-01f, 2.133514167e-01f, 2.139801853e-01f,
+	2.146096271e-01f, 2.152397403e-01f, 2.158705237e-01f, 2.165019756e-01f,
+	2.171340946e-01f, 2.177668792e-01f, 2.184003280e-01f, 2.190344394e-01f,
+	2.196692119e-01f, 2.203046441e-01f, 2.209407344e-01f, 2.215774814e-01f,
+	2.222148835e-01f, 2.228529393e-01f, 2.234916472e-01f, 2.241310058e-01f,
+	2.247710135e-01f, 2.254116689e-01f, 2.260529704e-01f, 2.266949165e-01f,
+	2.273375058e-01f, 2.279807366e-01f, 2.286246076e-01f, 2.292691171e-01f,
+	2.299142636e-01f, 2.305600457e-01f, 2.312064619e-01f, 2.318535105e-01f,
+	2.325011901e-01f, 2.331494991e-01f, 2.337984361e-01f, 2.344479994e-01f,
+	2.350981877e-01f, 2.357489992e-01f, 2.364004326e-01f, 2.370524863e-01f,
+	2.377051587e-01f, 2.383584483e-01f, 2.390123535e-01f, 2.396668729e-01f,
+	2.403220049e-01f, 2.409777480e-01f, 2.416341005e-01f, 2.422910610e-01f,
+	2.429486279e-01f, 2.436067997e-01f, 2.442655748e-01f, 2.449249516e-01f,
+	2.455849287e-01f, 2.462455045e-01f, 2.469066773e-01f, 2.475684457e-01f,
+	2.482308081e-01f, 2.488937630e-01f, 2.495573087e-01f, 2.502214437e-01f,
+	2.508861665e-01f, 2.515514755e-01f, 2.522173691e-01f, 2.528838457e-01f,
+	2.535509039e-01f, 2.542185419e-01f, 2.548867584e-01f, 2.555555515e-01f,
+	2.562249199e-01f, 2.568948619e-01f, 2.575653760e-01f, 2.582364605e-01f,
+	2.589081140e-01f, 2.595803347e-01f, 2.602531212e-01f, 2.609264718e-01f,
+	2.616003850e-01f, 2.622748591e-01f, 2.629498927e-01f, 2.636254840e-01f,
+	2.643016316e-01f, 2.649783338e-01f, 2.656555890e-01f, 2.663333956e-01f,
+	2.670117521e-01f, 2.676906568e-01f, 2.683701082e-01f, 2.690501046e-01f,
+	2.697306445e-01f, 2.704117262e-01f, 2.710933482e-01f, 2.717755088e-01f,
+	2.724582064e-01f, 2.731414395e-01f, 2.738252064e-01f, 2.745095055e-01f,
+	2.751943352e-01f, 2.758796939e-01f, 2.765655799e-01f, 2.772519917e-01f,
+	2.779389277e-01f, 2.786263862e-01f, 2.793143656e-01f, 2.800028643e-01f,
+	2.806918807e-01f, 2.813814132e-01f, 2.820714600e-01f, 2.827620197e-01f,
+	2.834530906e-01f, 2.841446710e-01f, 2.848367593e-01f, 2.855293540e-01f,
+	2.862224533e-01f, 2.869160556e-01f, 2.876101594e-01f, 2.883047629e-01f,
+	2.889998646e-01f, 2.896954628e-01f, 2.903915558e-01f, 2.910881421e-01f,
+	2.917852200e-01f, 2.924827878e-01f, 2.931808439e-01f, 2.938793867e-01f,
+	2.945784145e-01f, 2.952779257e-01f, 2.959779186e-01f, 2.966783916e-01f,
+	2.973793430e-01f, 2.980807712e-01f, 2.987826746e-01f, 2.994850514e-01f,
+	3.001879001e-01f, 3.008912189e-01f, 3.015950063e-01f, 3.022992605e-01f,
+	3.030039800e-01f, 3.037091630e-01f, 3.044148078e-01f, 3.051209130e-01f,
+	3.058274767e-01f, 3.065344972e-01f, 3.072419731e-01f, 3.079499025e-01f,
+	3.086582838e-01f, 3.093671154e-01f, 3.100763955e-01f, 3.107861226e-01f,
+	3.114962949e-01f, 3.122069108e-01f, 3.129179685e-01f, 3.136294665e-01f,
+	3.143414030e-01f, 3.150537764e-01f, 3.157665850e-01f, 3.164798271e-01f,
+	3.171935011e-01f, 3.179076052e-01f, 3.186221378e-01f, 3.193370972e-01f,
+	3.200524817e-01f, 3.207682897e-01f, 3.214845194e-01f, 3.222011691e-01f,
+	3.229182373e-01f, 3.236357221e-01f, 3.243536220e-01f, 3.250719351e-01f,
+	3.257906599e-01f, 3.265097946e-01f, 3.272293375e-01f, 3.279492870e-01f,
+	3.286696413e-01f, 3.293903988e-01f, 3.301115578e-01f, 3.308331165e-01f,
+	3.315550733e-01f, 3.322774265e-01f, 3.330001743e-01f, 3.337233151e-01f,
+	3.344468471e-01f, 3.351707687e-01f, 3.358950782e-01f, 3.366197738e-01f,
+	3.373448539e-01f, 3.380703167e-01f, 3.387961606e-01f, 3.395223838e-01f,
+	3.402489846e-01f, 3.409759613e-01f, 3.417033122e-01f, 3.424310356e-01f,
+	3.431591298e-01f, 3.438875930e-01f, 3.446164236e-01f, 3.453456198e-01f,
+	3.460751800e-01f, 3.468051023e-01f, 3.475353851e-01f, 3.482660267e-01f,
+	3.489970253e-01f, 3.497283793e-01f, 3.504600868e-01f, 3.511921463e-01f,
+	3.519245559e-01f, 3.526573139e-01f, 3.533904187e-01f, 3.541238684e-01f,
+	3.548576614e-01f, 3.555917959e-01f, 3.563262702e-01f, 3.570610826e-01f,
+	3.577962314e-01f, 3.585317148e-01f, 3.592675310e-01f, 3.600036785e-01f,
+	3.607401553e-01f, 3.614769598e-01f, 3.622140903e-01f, 3.629515451e-01f,
+	3.636893223e-01f, 3.644274202e-01f, 3.651658372e-01f, 3.659045715e-01f,
+	3.666436213e-01f, 3.673829849e-01f, 3.681226605e-01f, 3.688626465e-01f,
+	3.696029410e-01f, 3.703435424e-01f, 3.710844489e-01f, 3.718256588e-01f,
+	3.725671702e-01f, 3.733089815e-01f, 3.740510909e-01f, 3.747934967e-01f,
+	3.755361971e-01f, 3.762791904e-01f, 3.770224748e-01f, 3.777660486e-01f,
+	3.785099100e-01f, 3.792540573e-01f, 3.799984888e-01f, 3.807432026e-01f,
+	3.814881970e-01f, 3.822334703e-01f, 3.829790207e-01f, 3.837248465e-01f,
+	3.844709459e-01f, 3.852173171e-01f, 3.859639584e-01f, 3.867108681e-01f,
+	3.874580443e-01f, 3.882054854e-01f, 3.889531895e-01f, 3.897011549e-01f,
+	3.904493799e-01f, 3.911978627e-01f, 3.919466015e-01f, 3.926955945e-01f,
+	3.934448400e-01f, 3.941943363e-01f, 3.949440816e-01f, 3.956940740e-01f,
+	3.964443119e-01f, 3.971947935e-01f, 3.979455170e-01f, 3.986964806e-01f,
+	3.994476826e-01f, 4.001991212e-01f, 4.009507946e-01f, 4.017027012e-01f,
+	4.024548390e-01f, 4.032072064e-01f, 4.039598015e-01f, 4.047126226e-01f,
+	4.054656679e-01f, 4.062189357e-01f, 4.069724242e-01f, 4.077261315e-01f,
+	4.084800560e-01f, 4.092341959e-01f, 4.099885493e-01f, 4.107431145e-01f,
+	4.114978898e-01f, 4.122528733e-01f, 4.130080633e-01f, 4.137634580e-01f,
+	4.145190556e-01f, 4.152748544e-01f, 4.160308525e-01f, 4.167870482e-01f,
+	4.175434398e-01f, 4.183000253e-01f, 4.190568031e-01f, 4.198137714e-01f,
+	4.205709283e-01f, 4.213282722e-01f, 4.220858012e-01f, 4.228435135e-01f,
+	4.236014074e-01f, 4.243594810e-01f, 4.251177327e-01f, 4.258761605e-01f,
+	4.266347628e-01f, 4.273935377e-01f, 4.281524834e-01f, 4.289115982e-01f,
+	4.296708803e-01f, 4.304303279e-01f, 4.311899392e-01f, 4.319497124e-01f,
+	4.327096457e-01f, 4.334697374e-01f, 4.342299856e-01f, 4.349903886e-01f,
+	4.357509446e-01f, 4.365116518e-01f, 4.372725083e-01f, 4.380335124e-01f,
+	4.387946624e-01f, 4.395559564e-01f, 4.403173926e-01f, 4.410789692e-01f,
+	4.418406845e-01f, 4.426025367e-01f, 4.433645239e-01f, 4.441266444e-01f,
+	4.448888964e-01f, 4.456512780e-01f, 4.464137875e-01f, 4.471764231e-01f,
+	4.479391831e-01f, 4.487020655e-01f, 4.494650686e-01f, 4.502281907e-01f,
+	4.509914298e-01f, 4.517547843e-01f, 4.525182523e-01f, 4.532818321e-01f,
+	4.540455218e-01f, 4.548093196e-01f, 4.555732237e-01f, 4.563372324e-01f,
+	4.571013438e-01f, 4.578655562e-01f, 4.586298677e-01f, 4.593942766e-01f,
+	4.601587810e-01f, 4.609233792e-01f, 4.616880693e-01f, 4.624528496e-01f,
+	4.632177182e-01f, 4.639826734e-01f, 4.647477133e-01f, 4.655128362e-01f,
+	4.662780402e-01f, 4.670433236e-01f, 4.678086845e-01f, 4.685741212e-01f,
+	4.693396318e-01f, 4.701052146e-01f, 4.708708677e-01f, 4.716365894e-01f,
+	4.724023778e-01f, 4.731682312e-01f, 4.739341477e-01f, 4.747001255e-01f,
+	4.754661628e-01f, 4.762322579e-01f, 4.769984089e-01f, 4.777646141e-01f,
+	4.785308715e-01f, 4.792971795e-01f, 4.800635362e-01f, 4.808299398e-01f,
+	4.815963885e-01f, 4.823628806e-01f, 4.831294141e-01f, 4.838959873e-01f,
+	4.846625984e-01f, 4.854292456e-01f, 4.861959271e-01f, 4.869626411e-01f,
+	4.877293857e-01f, 4.884961593e-01f, 4.892629599e-01f, 4.900297857e-01f,
+	4.907966350e-01f, 4.915635060e-01f, 4.923303969e-01f, 4.930973057e-01f,
+	4.938642309e-01f, 4.946311704e-01f, 4.953981226e-01f, 4.961650856e-01f,
+	4.969320577e-01f, 4.976990369e-01f, 4.984660216e-01f, 4.992330099e-01f,
+	5.000000000e-01f, 5.007669901e-01f, 5.015339784e-01f, 5.023009631e-01f,
+	5.030679423e-01f, 5.038349144e-01f, 5.046018774e-01f, 5.053688296e-01f,
+	5.061357691e-01f, 5.069026943e-01f, 5.076696031e-01f, 5.084364940e-01f,
+	5.092033650e-01f, 5.099702143e-01f, 5.107370401e-01f, 5.115038407e-01f,
+	5.122706143e-01f, 5.130373589e-01f, 5.138040729e-01f, 5.145707544e-01f,
+	5.153374016e-01f, 5.161040127e-01f, 5.168705859e-01f, 5.176371194e-01f,
+	5.184036115e-01f, 5.191700602e-01f, 5.199364638e-01f, 5.207028205e-01f,
+	5.214691285e-01f, 5.222353859e-01f, 5.230015911e-01f, 5.237677421e-01f,
+	5.245338372e-01f, 5.252998745e-01f, 5.260658523e-01f, 5.268317688e-01f,
+	5.275976222e-01f, 5.283634106e-01f, 5.291291323e-01f, 5.298947854e-01f,
+	5.306603682e-01f, 5.314258788e-01f, 5.321913155e-01f, 5.329566764e-01f,
+	5.337219598e-01f, 5.344871638e-01f, 5.352522867e-01f, 5.360173266e-01f,
+	5.367822818e-01f, 5.375471504e-01f, 5.383119307e-01f, 5.390766208e-01f,
+	5.398412190e-01f, 5.406057234e-01f, 5.413701323e-01f, 5.421344438e-01f,
+	5.428986562e-01f, 5.436627676e-01f, 5.444267763e-01f, 5.451906804e-01f,
+	5.459544782e-01f, 5.467181679e-01f, 5.474817477e-01f, 5.482452157e-01f,
+	5.490085702e-01f, 5.497718093e-01f, 5.505349314e-01f, 5.512979345e-01f,
+	5.520608169e-01f, 5.528235769e-01f, 5.535862125e-01f, 5.543487220e-01f,
+	5.551111036e-01f, 5.558733556e-01f, 5.566354761e-01f, 5.573974633e-01f,
+	5.581593155e-01f, 5.589210308e-01f, 5.596826074e-01f, 5.604440436e-01f,
+	5.612053376e-01f, 5.619664876e-01f, 5.627274917e-01f, 5.634883482e-01f,
+	5.642490554e-01f, 5.650096114e-01f, 5.657700144e-01f, 5.665302626e-01f,
+	5.672903543e-01f, 5.680502876e-01f, 5.688100608e-01f, 5.695696721e-01f,
+	5.703291197e-01f, 5.710884018e-01f, 5.718475166e-01f, 5.726064623e-01f,
+	5.733652372e-01f, 5.741238395e-01f, 5.748822673e-01f, 5.756405190e-01f,
+	5.763985926e-01f, 5.771564865e-01f, 5.779141988e-01f, 5.786717278e-01f,
+	5.794290717e-01f, 5.801862286e-01f, 5.809431969e-01f, 5.816999747e-01f,
+	5.824565602e-01f, 5.832129518e-01f, 5.839691475e-01f, 5.847251456e-01f,
+	5.854809444e-01f, 5.862365420e-01f, 5.869919367e-01f, 5.877471267e-01f,
+	5.885021102e-01f, 5.892568855e-01f, 5.900114507e-01f, 5.907658041e-01f,
+	5.915199440e-01f, 5.922738685e-01f, 5.930275758e-01f, 5.937810643e-01f,
+	5.945343321e-01f, 5.952873774e-01f, 5.960401985e-01f, 5.967927936e-01f,
+	5.975451610e-01f, 5.982972988e-01f, 5.990492054e-01f, 5.998008788e-01f,
+	6.005523174e-01f, 6.013035194e-01f, 6.020544830e-01f, 6.028052065e-01f,
+	6.035556881e-01f, 6.043059260e-01f, 6.050559184e-01f, 6.058056637e-01f,
+	6.065551600e-01f, 6.073044055e-01f, 6.080533985e-01f, 6.088021373e-01f,
+	6.095506201e-01f, 6.102988451e-01f, 6.110468105e-01f, 6.117945146e-01f,
+	6.125419557e-01f, 6.132891319e-01f, 6.140360416e-01f, 6.147826829e-01f,
+	6.155290541e-01f, 6.162751535e-01f, 6.170209793e-01f, 6.177665297e-01f,
+	6.185118030e-01f, 6.192567974e-01f, 6.200015112e-01f, 6.207459427e-01f,
+	6.214900900e-01f, 6.222339514e-01f, 6.229775252e-01f, 6.237208096e-01f,
+	6.244638029e-01f, 6.252065033e-01f, 6.259489091e-01f, 6.266910185e-01f,
+	6.274328298e-01f, 6.281743412e-01f, 6.289155511e-01f, 6.296564576e-01f,
+	6.303970590e-01f, 6.311373535e-01f, 6.318773395e-01f, 6.326170151e-01f,
+	6.333563787e-01f, 6.340954285e-01f, 6.348341628e-01f, 6.355725798e-01f,
+	6.363106777e-01f, 6.370484549e-01f, 6.377859097e-01f, 6.385230402e-01f,
+	6.392598447e-01f, 6.399963215e-01f, 6.407324690e-01f, 6.414682852e-01f,
+	6.422037686e-01f, 6.429389174e-01f, 6.436737298e-01f, 6.444082041e-01f,
+	6.451423386e-01f, 6.458761316e-01f, 6.466095813e-01f, 6.473426861e-01f,
+	6.480754441e-01f, 6.488078537e-01f, 6.495399132e-01f, 6.502716207e-01f,
+	6.510029747e-01f, 6.517339733e-01f, 6.524646149e-01f, 6.531948977e-01f,
+	6.539248200e-01f, 6.546543802e-01f, 6.553835764e-01f, 6.561124070e-01f,
+	6.568408702e-01f, 6.575689644e-01f, 6.582966878e-01f, 6.590240387e-01f,
+	6.597510154e-01f, 6.604776162e-01f, 6.612038394e-01f, 6.619296833e-01f,
+	6.626551461e-01f, 6.633802262e-01f, 6.641049218e-01f, 6.648292313e-01f,
+	6.655531529e-01f, 6.662766849e-01f, 6.669998257e-01f, 6.677225735e-01f,
+	6.684449267e-01f, 6.691668835e-01f, 6.698884422e-01f, 6.706096012e-01f,
+	6.713303587e-01f, 6.720507130e-01f, 6.727706625e-01f, 6.734902054e-01f,
+	6.742093401e-01f, 6.749280649e-01f, 6.756463780e-01f, 6.763642779e-01f,
+	6.770817627e-01f, 6.777988309e-01f, 6.785154806e-01f, 6.792317103e-01f,
+	6.799475183e-01f, 6.806629028e-01f, 6.813778622e-01f, 6.820923948e-01f,
+	6.828064989e-01f, 6.835201729e-01f, 6.842334150e-01f, 6.849462236e-01f,
+	6.856585970e-01f, 6.863705335e-01f, 6.870820315e-01f, 6.877930892e-01f,
+	6.885037051e-01f, 6.892138774e-01f, 6.899236045e-01f, 6.906328846e-01f,
+	6.913417162e-01f, 6.920500975e-01f, 6.927580269e-01f, 6.934655028e-01f,
+	6.941725233e-01f, 6.948790870e-01f, 6.955851922e-01f, 6.962908370e-01f,
+	6.969960200e-01f, 6.977007395e-01f, 6.984049937e-01f, 6.991087811e-01f,
+	6.998120999e-01f, 7.005149486e-01f, 7.012173254e-01f, 7.019192288e-01f,
+	7.026206570e-01f, 7.033216084e-01f, 7.040220814e-01f, 7.047220743e-01f,
+	7.054215855e-01f, 7.061206133e-01f, 7.068191561e-01f, 7.075172122e-01f,
+	7.082147800e-01f, 7.089118579e-01f, 7.096084442e-01f, 7.103045372e-01f,
+	7.110001354e-01f, 7.116952371e-01f, 7.123898406e-01f, 7.130839444e-01f,
+	7.137775467e-01f, 7.144706460e-01f, 7.151632407e-01f, 7.158553290e-01f,
+	7.165469094e-01f, 7.172379803e-01f, 7.179285400e-01f, 7.186185868e-01f,
+	7.193081193e-01f, 7.199971357e-01f, 7.206856344e-01f, 7.213736138e-01f,
+	7.220610723e-01f, 7.227480083e-01f, 7.234344201e-01f, 7.241203061e-01f,
+	7.248056648e-01f, 7.254904945e-01f, 7.261747936e-01f, 7.268585605e-01f,
+	7.275417936e-01f, 7.282244912e-01f, 7.289066518e-01f, 7.295882738e-01f,
+	7.302693555e-01f, 7.309498954e-01f, 7.316298918e-01f, 7.323093432e-01f,
+	7.329882479e-01f, 7.336666044e-01f, 7.343444110e-01f, 7.350216662e-01f,
+	7.356983684e-01f, 7.363745160e-01f, 7.370501073e-01f, 7.377251409e-01f,
+	7.383996150e-01f, 7.390735282e-01f, 7.397468788e-01f, 7.404196653e-01f,
+	7.410918860e-01f, 7.417635395e-01f, 7.424346240e-01f, 7.431051381e-01f,
+	7.437750801e-01f, 7.444444485e-01f, 7.451132416e-01f, 7.457814581e-01f,
+	7.464490961e-01f, 7.471161543e-01f, 7.477826309e-01f, 7.484485245e-01f,
+	7.491138335e-01f, 7.497785563e-01f, 7.504426913e-01f, 7.511062370e-01f,
+	7.517691919e-01f, 7.524315543e-01f, 7.530933227e-01f, 7.537544955e-01f,
+	7.544150713e-01f, 7.550750484e-01f, 7.557344252e-01f, 7.563932003e-01f,
+	7.570513721e-01f, 7.577089390e-01f, 7.583658995e-01f, 7.590222520e-01f,
+	7.596779951e-01f, 7.603331271e-01f, 7.609876465e-01f, 7.616415517e-01f,
+	7.622948413e-01f, 7.629475137e-01f, 7.635995674e-01f, 7.642510008e-01f,
+	7.649018123e-01f, 7.655520006e-01f, 7.662015639e-01f, 7.668505009e-01f,
+	7.674988099e-01f, 7.681464895e-01f, 7.687935381e-01f, 7.694399543e-01f,
+	7.700857364e-01f, 7.707308829e-01f, 7.713753924e-01f, 7.720192634e-01f,
+	7.726624942e-01f, 7.733050835e-01f, 7.739470296e-01f, 7.745883311e-01f,
+	7.752289865e-01f, 7.758689942e-01f, 7.765083528e-01f, 7.771470607e-01f,
+	7.777851165e-01f, 7.784225186e-01f, 7.790592656e-01f, 7.796953559e-01f,
+	7.803307881e-01f, 7.809655606e-01f, 7.815996720e-01f, 7.822331208e-01f,
+	7.828659054e-01f, 7.834980244e-01f, 7.841294763e-01f, 7.847602597e-01f,
+	7.853903729e-01f, 7.860198147e-01f, 7.866485833e-01f, 7.872766775e-01f,
+	7.879040957e-01f, 7.885308364e-01f, 7.891568982e-01f, 7.897822796e-01f,
+	7.904069790e-01f, 7.910309952e-01f, 7.916543265e-01f, 7.922769715e-01f,
+	7.928989287e-01f, 7.935201968e-01f, 7.941407741e-01f, 7.947606593e-01f,
+	7.953798509e-01f, 7.959983475e-01f, 7.966161475e-01f, 7.972332496e-01f,
+	7.978496522e-01f, 7.984653540e-01f, 7.990803535e-01f, 7.996946492e-01f,
+	8.003082397e-01f, 8.009211235e-01f, 8.015332993e-01f, 8.021447655e-01f,
+	8.027555207e-01f, 8.033655635e-01f, 8.039748925e-01f, 8.045835062e-01f,
+	8.051914031e-01f, 8.057985820e-01f, 8.064050412e-01f, 8.070107795e-01f,
+	8.076157953e-01f, 8.082200873e-01f, 8.088236540e-01f, 8.094264940e-01f,
+	8.100286059e-01f, 8.106299883e-01f, 8.112306397e-01f, 8.118305588e-01f,
+	8.124297441e-01f, 8.130281942e-01f, 8.136259077e-01f, 8.142228833e-01f,
+	8.148191195e-01f, 8.154146148e-01f, 8.160093680e-01f, 8.166033775e-01f,
+	8.171966421e-01f, 8.177891602e-01f, 8.183809306e-01f, 8.189719518e-01f,
+	8.195622224e-01f, 8.201517411e-01f, 8.207405064e-01f, 8.213285170e-01f,
+	8.219157714e-01f, 8.225022684e-01f, 8.230880065e-01f, 8.236729843e-01f,
+	8.242572005e-01f, 8.248406537e-01f, 8.254233425e-01f, 8.260052655e-01f,
+	8.265864215e-01f, 8.271668089e-01f, 8.277464265e-01f, 8.283252729e-01f,
+	8.289033466e-01f, 8.294806465e-01f, 8.300571710e-01f, 8.306329189e-01f,
+	8.312078888e-01f, 8.317820793e-01f, 8.323554891e-01f, 8.329281168e-01f,
+	8.334999612e-01f, 8.340710207e-01f, 8.346412942e-01f, 8.352107802e-01f,
+	8.357794774e-01f, 8.363473845e-01f, 8.369145002e-01f, 8.374808231e-01f,
+	8.380463518e-01f, 8.386110851e-01f, 8.391750216e-01f, 8.397381599e-01f,
+	8.403004989e-01f, 8.408620371e-01f, 8.414227732e-01f, 8.419827059e-01f,
+	8.425418339e-01f, 8.431001558e-01f, 8.436576704e-01f, 8.442143764e-01f,
+	8.447702724e-01f, 8.453253571e-01f, 8.458796292e-01f, 8.464330874e-01f,
+	8.469857304e-01f, 8.475375570e-01f, 8.480885657e-01f, 8.486387554e-01f,
+	8.491881247e-01f, 8.497366723e-01f, 8.502843970e-01f, 8.508312974e-01f,
+	8.513773722e-01f, 8.519226203e-01f, 8.524670402e-01f, 8.530106307e-01f,
+	8.535533906e-01f, 8.540953185e-01f, 8.546364132e-01f, 8.551766734e-01f,
+	8.557160979e-01f, 8.562546853e-01f, 8.567924344e-01f, 8.573293439e-01f,
+	8.578654126e-01f, 8.584006393e-01f, 8.589350225e-01f, 8.594685612e-01f,
+	8.600012540e-01f, 8.605330997e-01f, 8.610640970e-01f, 8.615942447e-01f,
+	8.621235415e-01f, 8.626519862e-01f, 8.631795775e-01f, 8.637063143e-01f,
+	8.642321952e-01f, 8.647572191e-01f, 8.652813846e-01f, 8.658046906e-01f,
+	8.663271358e-01f, 8.668487191e-01f, 8.673694390e-01f, 8.678892946e-01f,
+	8.684082844e-01f, 8.689264074e-01f, 8.694436622e-01f, 8.699600477e-01f,
+	8.704755627e-01f, 8.709902059e-01f, 8.715039761e-01f, 8.720168721e-01f,
+	8.725288927e-01f, 8.730400368e-01f, 8.735503030e-01f, 8.740596902e-01f,
+	8.745681973e-01f, 8.750758229e-01f, 8.755825660e-01f, 8.760884252e-01f,
+	8.765933995e-01f, 8.770974877e-01f, 8.776006884e-01f, 8.781030007e-01f,
+	8.786044233e-01f, 8.791049549e-01f, 8.796045945e-01f, 8.801033408e-01f,
+	8.806011927e-01f, 8.810981491e-01f, 8.815942086e-01f, 8.820893703e-01f,
+	8.825836328e-01f, 8.830769951e-01f, 8.835694560e-01f, 8.840610143e-01f,
+	8.845516688e-01f, 8.850414185e-01f, 8.855302621e-01f, 8.860181986e-01f,
+	8.865052267e-01f, 8.869913453e-01f, 8.874765533e-01f, 8.879608495e-01f,
+	8.884442328e-01f, 8.889267021e-01f, 8.894082562e-01f, 8.898888940e-01f,
+	8.903686143e-01f, 8.908474160e-01f, 8.913252981e-01f, 8.918022593e-01f,
+	8.922782986e-01f, 8.927534148e-01f, 8.932276068e-01f, 8.937008735e-01f,
+	8.941732138e-01f, 8.946446266e-01f, 8.951151107e-01f, 8.955846651e-01f,
+	8.960532887e-01f, 8.965209802e-01f, 8.969877388e-01f, 8.974535632e-01f,
+	8.979184523e-01f, 8.983824051e-01f, 8.988454205e-01f, 8.993074973e-01f,
+	8.997686346e-01f, 9.002288311e-01f, 9.006880859e-01f, 9.011463978e-01f,
+	9.016037657e-01f, 9.020601887e-01f, 9.025156656e-01f, 9.029701953e-01f,
+	9.034237768e-01f, 9.038764090e-01f, 9.043280908e-01f, 9.047788212e-01f,
+	9.052285991e-01f, 9.056774235e-01f, 9.061252933e-01f, 9.065722074e-01f,
+	9.070181649e-01f, 9.074631645e-01f, 9.079072054e-01f, 9.083502864e-01f,
+	9.087924066e-01f, 9.092335648e-01f, 9.096737600e-01f, 9.101129913e-01f,
+	9.105512575e-01f, 9.109885576e-01f, 9.114248907e-01f, 9.118602556e-01f,
+	9.122946514e-01f, 9.127280770e-01f, 9.131605314e-01f, 9.135920136e-01f,
+	9.140225226e-01f, 9.144520574e-01f, 9.148806169e-01f, 9.153082002e-01f,
+	9.157348062e-01f, 9.161604339e-01f, 9.165850824e-01f, 9.170087506e-01f,
+	9.174314375e-01f, 9.178531422e-01f, 9.182738636e-01f, 9.186936008e-01f,
+	9.191123528e-01f, 9.195301185e-01f, 9.199468971e-01f, 9.203626875e-01f,
+	9.207774887e-01f, 9.211912998e-01f, 9.216041198e-01f, 9.220159477e-01f,
+	9.224267826e-01f, 9.228366235e-01f, 9.232454694e-01f, 9.236533193e-01f,
+	9.240601724e-01f, 9.244660276e-01f, 9.248708840e-01f, 9.252747406e-01f,
+	9.256775966e-01f, 9.260794508e-01f, 9.264803025e-01f, 9.268801506e-01f,
+	9.272789942e-01f, 9.276768324e-01f, 9.280736642e-01f, 9.284694887e-01f,
+	9.288643050e-01f, 9.292581121e-01f, 9.296509092e-01f, 9.300426952e-01f,
+	9.304334693e-01f, 9.308232306e-01f, 9.312119781e-01f, 9.315997109e-01f,
+	9.319864281e-01f, 9.323721288e-01f, 9.327568120e-01f, 9.331404770e-01f,
+	9.335231228e-01f, 9.339047484e-01f, 9.342853530e-01f, 9.346649357e-01f,
+	9.350434956e-01f, 9.354210317e-01f, 9.357975433e-01f, 9.361730294e-01f,
+	9.365474892e-01f, 9.369209217e-01f, 9.372933261e-01f, 9.376647016e-01f,
+	9.380350471e-01f, 9.384043619e-01f, 9.387726451e-01f, 9.391398958e-01f,
+	9.395061132e-01f, 9.398712964e-01f, 9.402354445e-01f, 9.405985567e-01f,
+	9.409606322e-01f, 9.413216700e-01f, 9.416816693e-01f, 9.420406294e-01f,
+	9.423985492e-01f, 9.427554281e-01f, 9.431112651e-01f, 9.434660594e-01f,
+	9.438198102e-01f, 9.441725167e-01f, 9.445241779e-01f, 9.448747932e-01f,
+	9.452243616e-01f, 9.455728824e-01f, 9.459203547e-01f, 9.462667777e-01f,
+	9.466121506e-01f, 9.469564726e-01f, 9.472997428e-01f, 9.476419605e-01f,
+	9.479831249e-01f, 9.483232351e-01f, 9.486622904e-01f, 9.490002899e-01f,
+	9.493372328e-01f, 9.496731185e-01f, 9.500079460e-01f, 9.503417146e-01f,
+	9.506744235e-01f, 9.510060720e-01f, 9.513366591e-01f, 9.516661842e-01f,
+	9.519946466e-01f, 9.523220453e-01f, 9.526483797e-01f, 9.529736489e-01f,
+	9.532978523e-01f, 9.536209890e-01f, 9.539430582e-01f, 9.542640594e-01f,
+	9.545839915e-01f, 9.549028541e-01f, 9.552206461e-01f, 9.555373670e-01f,
+	9.558530160e-01f, 9.561675923e-01f, 9.564810952e-01f, 9.567935240e-01f,
+	9.571048779e-01f, 9.574151561e-01f, 9.577243580e-01f, 9.580324829e-01f,
+	9.583395300e-01f, 9.586454985e-01f, 9.589503878e-01f, 9.592541972e-01f,
+	9.595569258e-01f, 9.598585731e-01f, 9.601591384e-01f, 9.604586208e-01f,
+	9.607570197e-01f, 9.610543344e-01f, 9.613505642e-01f, 9.616457084e-01f,
+	9.619397663e-01f, 9.622327372e-01f, 9.625246204e-01f, 9.628154153e-01f,
+	9.631051211e-01f, 9.633937372e-01f, 9.636812628e-01f, 9.639676974e-01f,
+	9.642530402e-01f, 9.645372906e-01f, 9.648204479e-01f, 9.651025114e-01f,
+	9.653834805e-01f, 9.656633545e-01f, 9.659421328e-01f, 9.662198146e-01f,
+	9.664963994e-01f, 9.667718865e-01f, 9.670462752e-01f, 9.673195649e-01f,
+	9.675917550e-01f, 9.678628447e-01f, 9.681328336e-01f, 9.684017209e-01f,
+	9.686695060e-01f, 9.689361882e-01f, 9.692017670e-01f, 9.694662418e-01f,
+	9.697296118e-01f, 9.699918765e-01f, 9.702530353e-01f, 9.705130875e-01f,
+	9.707720326e-01f, 9.710298699e-01f, 9.712865988e-01f, 9.715422187e-01f,
+	9.717967291e-01f, 9.720501292e-01f, 9.723024186e-01f, 9.725535966e-01f,
+	9.728036627e-01f, 9.730526162e-01f, 9.733004565e-01f, 9.735471832e-01f,
+	9.737927955e-01f, 9.740372930e-01f, 9.742806750e-01f, 9.745229409e-01f,
+	9.747640903e-01f, 9.750041225e-01f, 9.752430370e-01f, 9.754808332e-01f,
+	9.757175105e-01f, 9.759530684e-01f, 9.761875064e-01f, 9.764208238e-01f,
+	9.766530202e-01f, 9.768840949e-01f, 9.771140476e-01f, 9.773428775e-01f,
+	9.775705842e-01f, 9.777971671e-01f, 9.780226257e-01f, 9.782469595e-01f,
+	9.784701679e-01f, 9.786922504e-01f, 9.789132065e-01f, 9.791330357e-01f,
+	9.793517374e-01f, 9.795693112e-01f, 9.797857565e-01f, 9.800010729e-01f,
+	9.802152597e-01f, 9.804283166e-01f, 9.806402429e-01f, 9.808510383e-01f,
+	9.810607021e-01f, 9.812692340e-01f, 9.814766334e-01f, 9.816828999e-01f,
+	9.818880329e-01f, 9.820920320e-01f, 9.822948966e-01f, 9.824966264e-01f,
+	9.826972208e-01f, 9.828966794e-01f, 9.830950017e-01f, 9.832921872e-01f,
+	9.834882355e-01f, 9.836831461e-01f, 9.838769185e-01f, 9.840695524e-01f,
+	9.842610471e-01f, 9.844514024e-01f, 9.846406177e-01f, 9.848286926e-01f,
+	9.850156266e-01f, 9.852014193e-01f, 9.853860704e-01f, 9.855695792e-01f,
+	9.857519455e-01f, 9.859331687e-01f, 9.861132485e-01f, 9.862921845e-01f,
+	9.864699761e-01f, 9.866466230e-01f, 9.868221248e-01f, 9.869964811e-01f,
+	9.871696914e-01f, 9.873417553e-01f, 9.875126725e-01f, 9.876824426e-01f,
+	9.878510650e-01f, 9.880185395e-01f, 9.881848657e-01f, 9.883500431e-01f,
+	9.885140713e-01f, 9.886769501e-01f, 9.888386789e-01f, 9.889992575e-01f,
+	9.891586854e-01f, 9.893169622e-01f, 9.894740877e-01f, 9.896300613e-01f,
+	9.897848828e-01f, 9.899385518e-01f, 9.900910680e-01f, 9.902424309e-01f,
+	9.903926402e-01f, 9.905416956e-01f, 9.906895967e-01f, 9.908363431e-01f,
+	9.909819346e-01f, 9.911263707e-01f, 9.912696511e-01f, 9.914117756e-01f,
+	9.915527437e-01f, 9.916925552e-01f, 9.918312096e-01f, 9.919687067e-01f,
+	9.921050462e-01f, 9.922402277e-01f, 9.923742509e-01f, 9.925071155e-01f,
+	9.926388212e-01f, 9.927693677e-01f, 9.928987546e-01f, 9.930269817e-01f,
+	9.931540486e-01f, 9.932799551e-01f, 9.934047009e-01f, 9.935282857e-01f,
+	9.936507091e-01f, 9.937719709e-01f, 9.938920708e-01f, 9.940110086e-01f,
+	9.941287839e-01f, 9.942453964e-01f, 9.943608460e-01f, 9.944751323e-01f,
+	9.945882550e-01f, 9.947002139e-01f, 9.948110087e-01f, 9.949206392e-01f,
+	9.950291051e-01f, 9.951364062e-01f, 9.952425421e-01f, 9.953475127e-01f,
+	9.954513177e-01f, 9.955539569e-01f, 9.956554299e-01f, 9.957557367e-01f,
+	9.958548768e-01f, 9.959528502e-01f, 9.960496566e-01f, 9.961452957e-01f,
+	9.962397673e-01f, 9.963330712e-01f, 9.964252072e-01f, 9.965161751e-01f,
+	9.966059746e-01f, 9.966946056e-01f, 9.967820678e-01f, 9.968683610e-01f,
+	9.969534850e-01f, 9.970374397e-01f, 9.971202247e-01f, 9.972018400e-01f,
+	9.972822854e-01f, 9.973615606e-01f, 9.974396654e-01f, 9.975165997e-01f,
+	9.975923633e-01f, 9.976669561e-01f, 9.977403777e-01f, 9.978126282e-01f,
+	9.978837072e-01f, 9.979536147e-01f, 9.980223505e-01f, 9.980899143e-01f,
+	9.981563061e-01f, 9.982215257e-01f, 9.982855729e-01f, 9.983484476e-01f,
+	9.984101496e-01f, 9.984706789e-01f, 9.985300352e-01f, 9.985882184e-01f,
+	9.986452283e-01f, 9.987010650e-01f, 9.987557281e-01f, 9.988092176e-01f,
+	9.988615333e-01f, 9.989126752e-01f, 9.989626431e-01f, 9.990114369e-01f,
+	9.990590565e-01f, 9.991055017e-01f, 9.991507725e-01f, 9.991948687e-01f,
+	9.992377903e-01f, 9.992795371e-01f, 9.993201091e-01f, 9.993595061e-01f,
+	9.993977281e-01f, 9.994347750e-01f, 9.994706466e-01f, 9.995053429e-01f,
+	9.995388639e-01f, 9.995712094e-01f, 9.996023793e-01f, 9.996323736e-01f,
+	9.996611923e-01f, 9.996888352e-01f, 9.997153023e-01f, 9.997405935e-01f,
+	9.997647088e-01f, 9.997876480e-01f, 9.998094112e-01f, 9.998299984e-01f,
+	9.998494093e-01f, 9.998676441e-01f, 9.998847027e-01f, 9.999005849e-01f,
+	9.999152909e-01f, 9.999288205e-01f, 9.999411737e-01f, 9.999523505e-01f,
+	9.999623509e-01f, 9.999711748e-01f, 9.999788223e-01f, 9.999852932e-01f,
+	9.999905876e-01f, 9.999947055e-01f, 9.999976469e-01f, 9.999994117e-01f,
+	1.000000000e+00f,
+};
+
+static const q15_t win_hanning_half_q15[WINDOW_HALF_LEN] = {
+	0, 0, 0, 0, 0, 0, 1, 1,
+	1, 2, 2, 2, 3, 3, 4, 4,
+	5, 6, 6, 7, 8, 9, 9, 10,
+	11, 12, 13, 14, 15, 16, 17, 19,
+	20, 21, 22, 24, 25, 26, 28, 29,
+	31, 32, 34, 36, 37, 39, 41, 43,
+	44, 46, 48, 50, 52, 54, 56, 58,
+	60, 63, 65, 67, 69, 72, 74, 76,
+	79, 81, 84, 86, 89, 92, 94, 97,
+	100, 103, 105, 108, 111, 114, 117, 120,
+	123, 126, 129, 133, 136, 139, 142, 146,
+	149, 152, 156, 159, 163, 166, 170, 174,
+	177, 181, 185, 189, 192, 196, 200, 204,
+	208, 212, 216, 220, 224, 228, 233, 237,
+	241, 246, 250, 254, 259, 263, 268, 272,
+	277, 281, 286, 291, 296, 300, 305, 310,
+	315, 320, 325, 330, 335, 340, 345, 350,
+	355, 360, 366, 371, 376, 382, 387, 393,
+	398, 404, 409, 415, 420, 426, 432, 438,
+	443, 449, 455, 461, 467, 473, 479, 485,
+	491, 497, 503, 509, 516, 522, 528, 535,
+	541, 547, 554, 560, 567, 574, 580, 587,
+	593, 600, 607, 614, 621, 627, 634, 641,
+	648, 655, 662, 669, 677, 684, 691, 698,
+	705, 713, 720, 728, 735, 742, 750, 757,
+	765, 773, 780, 788, 796, 803, 811, 819,
+	827, 835, 843, 851, 859, 867, 875, 883,
+	891, 899, 908, 916, 924, 933, 941, 949,
+	958, 966, 975, 983, 992, 1001, 1009, 1018,
+	1027, 1035, 1044, 1053, 1062, 1071, 1080, 1089,
+	1098, 1107, 1116, 1125, 1134, 1144, 1153, 1162,
+	1171, 1181, 1190, 1200, 1209, 1218, 1228, 1238,
+	1247, 1257, 1266, 1276, 1286, 1296, 1306, 1315,
+	1325, 1335, 1345, 1355, 1365, 1375, 1385, 1395,
+	1406, 1416, 1426, 1436, 1447, 1457, 1467, 1478,
+	1488, 1499, 1509, 1520, 1530, 1541, 1552, 1562,
+	1573, 1584, 1595, 1605, 1616, 1627, 1638, 1649,
+	1660, 1671, 1682, 1693, 1704, 1716, 1727, 1738,
+	1749, 1761, 1772, 1783, 1795, 1806, 1818, 1829,
+	1841, 1853, 1864, 1876, 1887, 1899, 1911, 1923,
+	1935, 1946, 1958, 1970, 1982, 1994, 2006, 2018,
+	2030, 2043, 2055, 2067, 2079, 2091, 2104, 2116,
+	2128, 2141, 2153, 2166, 2178, 2191, 2203, 2216,
+	2229, 2241, 2254, 2267, 2280, 2292, 2305, 2318,
+	2331, 2344, 2357, 2370, 2383, 2396, 2409, 2422,
+	2435, 2449, 2462, 2475, 2488, 2502, 2515, 2528,
+	2542, 2555, 2569, 2582, 2596, 2610, 2623, 2637,
+	2651, 2664, 2678, 2692, 2706, 2719, 2733, 2747,
+	2761, 2775, 2789, 2803, 2817, 2831, 2846, 2860,
+	2874, 2888, 2902, 2917, 2931, 2945, 2960, 2974,
+	2989, 3003, 3018, 3032, 3047, 3061, 3076, 3091,
+	3105, 3120, 3135, 3150, 3165, 3179, 3194, 3209,
+	3224, 3239, 3254, 3269, 3284, 3299, 3315, 3330,
+	3345, 3360, 3376, 3391, 3406, 3421, 3437, 3452,
+	3468, 3483, 3499, 3514, 3530, 3545, 3561, 3577,
+	3592, 3608, 3624, 3640, 3655, 3671, 3687, 3703,
+	3719, 3735, 3751, 3767, 3783, 3799, 3815, 3831,
+	3847, 3864, 3880, 3896, 3912, 3929, 3945, 3961,
+	3978, 3994, 4011, 4027, 4044, 4060, 4077, 4094,
+	4110, 4127, 4144, 4160, 4177, 4194, 4211, 4227,
+	4244, 4261, 4278, 4295, 4312, 4329, 4346, 4363,
+	4380, 4397, 4414, 4432, 4449, 4466, 4483, 4501,
+	4518, 4535, 4553, 4570, 4587, 4605, 4622, 4640,
+	4657, 4675, 4693, 4710, 4728, 4746, 4763, 4781,
+	4799, 4817, 4834, 4852, 4870, 4888, 4906, 4924,
+	4942, 4960, 4978, 4996, 5014, 5032, 5050, 5068,
+	5087, 5105, 5123, 5141, 5160, 5178, 5196, 5215,
+	5233, 5251, 5270, 5288, 5307, 5325, 5344, 5363,
+	5381, 5400, 5418, 5437, 5456, 5475, 5493, 5512,
+	5531, 5550, 5569, 5588, 5606, 5625, 5644, 5663,
+	5682, 5701, 5721, 5740, 5759, 5778, 5797, 5816,
+	5835, 5855, 5874, 5893, 5913, 5932, 5951, 5971,
+	5990, 6010, 6029, 6048, 6068, 6088, 6107, 6127,
+	6146, 6166, 6186, 6205, 6225, 6245, 6264, 6284,
+	6304, 6324, 6344, 6364, 6383, 6403, 6423, 6443,
+	6463, 6483, 6503, 6523, 6543, 6564, 6584, 6604,
+	6624, 6644, 6664, 6685, 6705, 6725, 6746, 6766,
+	6786, 6807, 6827, 6847, 6868, 6888, 6909, 6929,
+	6950, 6971, 6991, 7012, 7032, 7053, 7074, 7094,
+	7115, 7136, 7157, 7177, 7198, 7219, 7240, 7261,
+	7282, 7302, 7323, 7344, 7365, 7386, 7407, 7428,
+	7449, 7470, 7492, 7513, 7534, 7555, 7576, 7597,
+	7619, 7640, 7661, 7682, 7704, 7725, 7746, 7768,
+	7789, 7811, 7832, 7853, 7875, 7896, 7918, 7939,
+	7961, 7983, 8004, 8026, 8047, 8069, 8091, 8112,
+	8134, 8156, 8177, 8199, 8221, 8243, 8265, 8286,
+	8308, 8330, 8352, 8374, 8396, 8418, 8440, 8462,
+	8484, 8506, 8528, 8550, 8572, 8594, 8616, 8638,
+	8661, 8683, 8705, 8727, 8749, 8772, 8794, 8816,
+	8839, 8861, 8883, 8906, 8928, 8950, 8973, 8995,
+	9018, 9040, 9063, 9085, 9108, 9130, 9153, 9175,
+	9198, 9220, 9243, 9266, 9288, 9311, 9334, 9356,
+	9379, 9402, 9424, 9447, 9470, 9493, 9516, 9538,
+	9561, 9584, 9607, 9630, 9653, 9676, 9699, 9722,
+	9745, 9768, 9791, 9814, 9837, 9860, 9883, 9906,
+	9929, 9952, 9975, 9998, 10021, 10045, 10068, 10091,
+	10114, 10137, 10161, 10184, 10207, 10230, 10254, 10277,
+	10300, 10324, 10347, 10370, 10394, 10417, 10441, 10464,
+	10487, 10511, 10534, 10558, 10581, 10605, 10628, 10652,
+	10676, 10699, 10723, 10746, 10770, 10793, 10817, 10841,
+	10864, 10888, 10912, 10935, 10959, 10983, 11007, 11030,
+	11054, 11078, 11102, 11125, 11149, 11173, 11197, 11221,
+	11245, 11269, 11292, 11316, 11340, 11364, 11388, 11412,
+	11436, 11460, 11484, 11508, 11532, 11556, 11580, 11604,
+	11628, 11652, 11676, 11700, 11724, 11748, 11772, 11797,
+	11821, 11845, 11869, 11893, 11917, 11942, 11966, 11990,
+	12014, 12038, 12063, 12087, 12111, 12135, 12160, 12184,
+	12208, 12233, 12257, 12281, 12306, 12330, 12354, 12379,
+	12403, 12427, 12452, 12476, 12501, 12525, 12549, 12574,
+	12598, 12623, 12647, 12672, 12696, 12721, 12745, 12770,
+	12794, 12819, 12843, 12868, 12892, 12917, 12942, 12966,
+	12991, 13015, 13040, 13064, 13089, 13114, 13138, 13163,
+	13188, 13212, 13237, 13262, 13286, 13311, 13336, 13360,
+	13385, 13410, 13435, 13459, 13484, 13509, 13533, 13558,
+	13583, 13608, 13632, 13657, 13682, 13707, 13732, 13756,
+	13781, 13806, 13831, 13856, 13881, 13905, 13930, 13955,
+	13980, 14005, 14030, 14055, 14079, 14104, 14129, 14154,
+	14179, 14204, 14229, 14254, 14279, 14304, 14329, 14353,
+	14378, 14403, 14428, 14453, 14478, 14503, 14528, 14553,
+	14578, 14603, 14628, 14653, 14678, 14703, 14728, 14753,
+	14778, 14803, 14828, 14853, 14878, 14903, 14928, 14953,
+	14978, 15003, 15028, 15053, 15078, 15104, 15129, 15154,
+	15179, 15204, 15229, 15254, 15279, 15304, 15329, 15354,
+	15379, 15404, 15429, 15455, 15480, 15505, 15530, 15555,
+	15580, 15605, 15630, 15655, 15680, 15706, 15731, 15756,
+	15781, 15806, 15831, 15856, 15881, 15907, 15932, 15957,
+	15982, 16007, 16032, 16057, 16082, 16108, 16133, 16158,
+	16183, 16208, 16233, 16258, 16283, 16309, 16334, 16359,
+	16384, 16409, 16434, 16459, 16485, 16510, 16535, 16560,
+	16585, 16610, 16635, 16660, 16686, 16711, 16736, 16761,
+	16786, 16811, 16836, 16861, 16887, 16912, 16937, 16962,
+	16987, 17012, 17037, 17062, 17088, 17113, 17138, 17163,
+	17188, 17213, 17238, 17263, 17288, 17313, 17339, 17364,
+	17389, 17414, 17439, 17464, 17489, 17514, 17539, 17564,
+	17589, 17614, 17639, 17664, 17690, 17715, 17740, 17765,
+	17790, 17815, 17840, 17865, 17890, 17915, 17940, 17965,
+	17990, 18015, 18040, 18065, 18090, 18115, 18140, 18165,
+	18190, 18215, 18240, 18265, 18290, 18315, 18340, 18365,
+	18390, 18415, 18439, 18464, 18489, 18514, 18539, 18564,
+	18589, 18614, 18639, 18664, 18689, 18713, 18738, 18763,
+	18788, 18813, 18838, 18863, 18887, 18912, 18937, 18962,
+	18987, 19012, 19036, 19061, 19086, 19111, 19136, 19160,
+	19185, 19210, 19235, 19259, 19284, 19309, 19333, 19358,
+	19383, 19408, 19432, 19457, 19482, 19506, 19531, 19556,
+	19580, 19605, 19630, 19654, 19679, 19704, 19728, 19753,
+	19777, 19802, 19826, 19851, 19876, 19900, 19925, 19949,
+	19974, 19998, 20023, 20047, 20072, 20096, 20121, 20145,
+	20170, 20194, 20219, 20243, 20267, 20292, 20316, 20341,
+	20365, 20389, 20414, 20438, 20462, 20487, 20511, 20535,
+	20560, 20584, 20608, 20633, 20657, 20681, 20705, 20730,
+	20754, 20778, 20802, 20826, 20851, 20875, 20899, 20923,
+	20947, 20971, 20996, 21020, 21044, 21068, 21092, 21116,
+	21140, 21164, 21188, 21212, 21236, 21260, 21284, 21308,
+	21332, 21356, 21380, 21404, 21428, 21452, 21476, 21499,
+	21523, 21547, 21571, 21595, 21619, 21643, 21666, 21690,
+	21714, 21738, 21761, 21785, 21809, 21833, 21856, 21880,
+	21904, 21927, 21951, 21975, 21998, 22022, 22045, 22069,
+	22092, 22116, 22140, 22163, 22187, 22210, 22234, 22257,
+	22281, 22304, 22327, 22351, 22374, 22398, 22421, 22444,
+	22468, 22491, 22514, 22538, 22561, 22584, 22607, 22631,
+	22654, 22677, 22700, 22723, 22747, 22770, 22793, 22816,
+	22839, 22862, 22885, 22908, 22931, 22954, 22977, 23000,
+	23023, 23046, 23069, 23092, 23115, 23138, 23161, 23184,
+	23207, 23230, 23252, 23275, 23298, 23321, 23344, 23366,
+	23389, 23412, 23434, 23457, 23480, 23502, 23525, 23548,
+	23570, 23593, 23615, 23638, 23660, 23683, 23705, 23728,
+	23750, 23773, 23795, 23818, 23840, 23862, 23885, 23907,
+	23929, 23952, 23974, 23996, 24019, 24041, 24063, 24085,
+	24107, 24130, 24152, 24174, 24196, 24218, 24240, 24262,
+	24284, 24306, 24328, 24350, 24372, 24394, 24416, 24438,
+	24460, 24482, 24503, 24525, 24547, 24569, 24591, 24612,
+	24634, 24656, 24677, 24699, 24721, 24742, 24764, 24785,
+	24807, 24829, 24850, 24872, 24893, 24915, 24936, 24957,
+	24979, 25000, 25022, 25043, 25064, 25086, 25107, 25128,
+	25149, 25171, 25192, 25213, 25234, 25255, 25276, 25298,
+	25319, 25340, 25361, 25382, 25403, 25424, 25445, 25466,
+	25486, 25507, 25528, 25549, 25570, 25591, 25611, 25632,
+	25653, 25674, 25694, 25715, 25736, 25756, 25777, 25797,
+	25818, 25839, 25859, 25880, 25900, 25921, 25941, 25961,
+	25982, 26002, 26022, 26043, 26063, 26083, 26104, 26124,
+	26144, 26164, 26184, 26204, 26225, 26245, 26265, 26285,
+	26305, 26325, 26345, 26365, 26385, 26404, 26424, 26444,
+	26464, 26484, 26504, 26523, 26543, 26563, 26582, 26602,
+	26622, 26641, 26661, 26680, 26700, 26720, 26739, 26758,
+	26778, 26797, 26817, 26836, 26855, 26875, 26894, 26913,
+	26933, 26952, 26971, 26990, 27009, 27028, 27047, 27067,
+	27086, 27105, 27124, 27143, 27162, 27180, 27199, 27218,
+	27237, 27256, 27275, 27293, 27312, 27331, 27350, 27368,
+	27387, 27405, 27424, 27443, 27461, 27480, 27498, 27517,
+	27535, 27553, 27572, 27590, 27608, 27627, 27645, 27663,
+	27681, 27700, 27718, 27736, 27754, 27772, 27790, 27808,
+	27826, 27844, 27862, 27880, 27898, 27916, 27934, 27951,
+	27969, 27987, 28005, 28022, 28040, 28058, 28075, 28093,
+	28111, 28128, 28146, 28163, 28181, 28198, 28215, 28233,
+	28250, 28267, 28285, 28302, 28319, 28336, 28354, 28371,
+	28388, 28405, 28422, 28439, 28456, 28473, 28490, 28507,
+	28524, 28541, 28557, 28574, 28591, 28608, 28624, 28641,
+	28658, 28674, 28691, 28708, 28724, 28741, 28757, 28774,
+	28790, 28807, 28823, 28839, 28856, 28872, 28888, 28904,
+	28921, 28937, 28953, 28969, 28985, 29001, 29017, 29033,
+	29049, 29065, 29081, 29097, 29113, 29128, 29144, 29160,
+	29176, 29191, 29207, 29223, 29238, 29254, 29269, 29285,
+	29300, 29316, 29331, 29347, 29362, 29377, 29392, 29408,
+	29423, 29438, 29453, 29469, 29484, 29499, 29514, 29529,
+	29544, 29559, 29574, 29589, 29603, 29618, 29633, 29648,
+	29663, 29677, 29692, 29707, 29721, 29736, 29750, 29765,
+	29779, 29794, 29808, 29823, 29837, 29851, 29866, 29880,
+	29894, 29908, 29922, 29937, 29951, 29965, 29979, 29993,
+	30007, 30021, 30035, 30049, 30062, 30076, 30090, 30104,
+	30117, 30131, 30145, 30158, 30172, 30186, 30199, 30213,
+	30226, 30240, 30253, 30266, 30280, 30293, 30306, 30319,
+	30333, 30346, 30359, 30372, 30385, 30398, 30411, 30424,
+	30437, 30450, 30463, 30476, 30488, 30501, 30514, 30527,
+	30539, 30552, 30565, 30577, 30590, 30602, 30615, 30627,
+	30640, 30652, 30664, 30677, 30689, 30701, 30713, 30725,
+	30738, 30750, 30762, 30774, 30786, 30798, 30810, 30822,
+	30833, 30845, 30857, 30869, 30881, 30892, 30904, 30915,
+	30927, 30939, 30950, 30962, 30973, 30985, 30996, 31007,
+	31019, 31030, 31041, 31052, 31064, 31075, 31086, 31097,
+	31108, 31119, 31130, 31141, 31152, 31163, 31173, 31184,
+	31195, 31206, 31216, 31227, 31238, 31248, 31259, 31269,
+	31280, 31290, 31301, 31311, 31321, 31332, 31342, 31352,
+	31362, 31373, 31383, 31393, 31403, 31413, 31423, 31433,
+	31443, 31453, 31462, 31472, 31482, 31492, 31502, 31511,
+	31521, 31530, 31540, 31550, 31559, 31568, 31578, 31587,
+	31597, 31606, 31615, 31624, 31634, 31643, 31652, 31661,
+	31670, 31679, 31688, 31697, 31706, 31715, 31724, 31733,
+	31741, 31750, 31759, 31767, 31776, 31785, 31793, 31802,
+	31810, 31819, 31827, 31835, 31844, 31852, 31860, 31869,
+	31877, 31885, 31893, 31901, 31909, 31917, 31925, 31933,
+	31941, 31949, 31957, 31965, 31972, 31980, 31988, 31995,
+	32003, 32011, 32018, 32026, 32033, 32040, 32048, 32055,
+	32063, 32070, 32077, 32084, 32091, 32099, 32106, 32113,
+	32120, 32127, 32134, 32141, 32147, 32154, 32161, 32168,
+	32175, 32181, 32188, 32194, 32201, 32208, 32214, 32221,
+	32227, 32233, 32240, 32246, 32252, 32259, 32265, 32271,
+	32277, 32283, 32289, 32295, 32301, 32307, 32313, 32319,
+	32325, 32330, 32336, 32342, 32348, 32353, 32359, 32364,
+	32370, 32375, 32381, 32386, 32392, 32397, 32402, 32408,
+	32413, 32418, 32423, 32428, 32433, 32438, 32443, 32448,
+	32453, 32458, 32463, 32468, 32472, 32477, 32482, 32487,
+	32491, 32496, 32500, 32505, 32509, 32514, 32518, 32522,
+	32527, 32531, 32535, 32540, 32544, 32548, 32552, 32556,
+	32560, 32564, 32568, 32572, 32576, 32579, 32583, 32587,
+	32591, 32594, 32598, 32602, 32605, 32609, 32612, 32616,
+	32619, 32622, 32626, 32629, 32632, 32635, 32639, 32642,
+	32645, 32648, 32651, 32654, 32657, 32660, 32663, 32665,
+	32668, 32671, 32674, 32676, 32679, 32682, 32684, 32687,
+	32689, 32692, 32694, 32696, 32699, 32701, 32703, 32705,
+	32708, 32710, 32712, 32714, 32716, 32718, 32720, 32722,
+	32724, 32725, 32727, 32729, 32731, 32732, 32734, 32736,
+	32737, 32739, 32740, 32742, 32743, 32744, 32746, 32747,
+	32748, 32749, 32751, 32752, 32753, 32754, 32755, 32756,
+	32757, 32758, 32759, 32759, 32760, 32761, 32762, 32762,
+	32763, 32764, 32764, 32765, 32765, 32766, 32766, 32766,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767,
+};
+
+static const float32_t win_hanning_bias[WINDOW_BIAS_LEN] = {
+	0.000000000e+00f, 3.906250000e-03f, 7.812500000e-03f, 1.171875000e-02f,
+	1.562500000e-02f, 1.953125000e-02f, 2.343750000e-02f, 2.734375000e-02f,
+	3.125000000e-02f, 3.515625000e-02f, 3.906250000e-02f, 4.296875000e-02f,
+	4.687500000e-02f, 5.078125000e-02f, 5.468750000e-02f, 5.859375000e-02f,
+	6.250000000e-02f, 6.640625000e-02f, 7.031250000e-02f, 7.421875000e-02f,
+	7.812500000e-02f, 8.203125000e-02f, 8.593750000e-02f, 8.984375000e-02f,
+	9.375000000e-02f, 9.765625000e-02f, 1.015625000e-01f, 1.054687500e-01f,
+	1.093750000e-01f, 1.132812500e-01f, 1.171875000e-01f, 1.210937500e-01f,
+	1.250000000e-01f, 1.289062500e-01f, 1.328125000e-01f, 1.367187500e-01f,
+	1.406250000e-01f, 1.445312500e-01f, 1.484375000e-01f, 1.523437500e-01f,
+	1.562500000e-01f, 1.601562500e-01f, 1.640625000e-01f, 1.679687500e-01f,
+	1.718750000e-01f, 1.757812500e-01f, 1.796875000e-01f, 1.835937500e-01f,
+	1.875000000e-01f, 1.914062500e-01f, 1.953125000e-01f, 1.992187500e-01f,
+	2.031250000e-01f, 2.070312500e-01f, 2.109375000e-01f, 2.148437500e-01f,
+	2.187500000e-01f, 2.226562500e-01f, 2.265625000e-01f, 2.304687500e-01f,
+	2.343750000e-01f, 2.382812500e-01f, 2.421875000e-01f, 2.460937500e-01f,
+	2.500000000e-01f,
+};
+
+static const float32_t win_hamming_half[WINDOW_HALF_LEN] = {
+	8.000000000e-02f, 8.000054121e-02f, 8.000216485e-02f, 8.000487090e-02f,
+	8.000865937e-02f, 8.001353024e-02f, 8.001948351e-02f, 8.002651915e-02f,
+	8.003463715e-02f, 8.004383750e-02f, 8.005412017e-02f, 8.006548514e-02f,
+	8.007793237e-02f, 8.009146185e-02f, 8.010607354e-02f, 8.012176740e-02f,
+	8.013854340e-02f, 8.015640150e-02f, 8.017534165e-02f, 8.019536382e-02f,
+	8.021646795e-02f, 8.023865400e-02f, 8.026192190e-02f, 8.028627162e-02f,
+	8.031170309e-02f, 8.033821625e-02f, 8.036581104e-02f, 8.039448739e-02f,
+	8.042424523e-02f, 8.045508451e-02f, 8.048700513e-02f, 8.052000704e-02f,
+	8.055409015e-02f, 8.058925437e-02f, 8.062549964e-02f, 8.066282585e-02f,
+	8.070123294e-02f, 8.074072079e-02f, 8.078128933e-02f, 8.082293845e-02f,
+	8.086566807e-02f, 8.090947807e-02f, 8.095436835e-02f, 8.100033881e-02f,
+	8.104738934e-02f, 8.109551984e-02f, 8.114473018e-02f, 8.119502025e-02f,
+	8.124638993e-02f, 8.129883910e-02f, 8.135236764e-02f, 8.140697543e-02f,
+	8.146266233e-02f, 8.151942821e-02f, 8.157727294e-02f, 8.163619638e-02f,
+	8.169619840e-02f, 8.175727885e-02f, 8.181943759e-02f, 8.188267447e-02f,
+	8.194698934e-02f, 8.201238206e-02f, 8.207885247e-02f, 8.214640042e-02f,
+	8.221502573e-02f, 8.228472826e-02f, 8.235550783e-02f, 8.242736429e-02f,
+	8.250029746e-02f, 8.257430717e-02f, 8.264939325e-02f, 8.272555552e-02f,
+	8.280279380e-02f, 8.288110791e-02f, 8.296049766e-02f, 8.304096287e-02f,
+	8.312250335e-02f, 8.320511891e-02f, 8.328880935e-02f, 8.337357447e-02f,
+	8.345941408e-02f, 8.354632798e-02f, 8.363431595e-02f, 8.372337780e-02f,
+	8.381351331e-02f, 8.390472227e-02f, 8.399700447e-02f, 8.409035969e-02f,
+	8.418478770e-02f, 8.428028830e-02f, 8.437686124e-02f, 8.447450631e-02f,
+	8.457322328e-02f, 8.467301191e-02f, 8.477387197e-02f, 8.487580322e-02f,
+	8.497880542e-02f, 8.508287833e-02f, 8.518802170e-02f, 8.529423529e-02f,
+	8.540151884e-02f, 8.550987211e-02f, 8.561929484e-02f, 8.572978677e-02f,
+	8.584134765e-02f, 8.595397720e-02f, 8.606767517e-02f, 8.618244128e-02f,
+	8.629827527e-02f, 8.641517686e-02f, 8.653314578e-02f, 8.665218176e-02f,
+	8.677228450e-02f, 8.689345373e-02f, 8.701568917e-02f, 8.713899052e-02f,
+	8.726335750e-02f, 8.738878981e-02f, 8.751528716e-02f, 8.764284925e-02f,
+	8.777147578e-02f, 8.790116645e-02f, 8.803192095e-02f, 8.816373897e-02f,
+	8.829662021e-02f, 8.843056435e-02f, 8.856557108e-02f, 8.870164007e-02f,
+	8.883877101e-02f, 8.897696358e-02f, 8.911621745e-02f, 8.925653230e-02f,
+	8.939790778e-02f, 8.954034358e-02f, 8.968383935e-02f, 8.982839476e-02f,
+	8.997400947e-02f, 9.012068313e-02f, 9.026841540e-02f, 9.041720593e-02f,
+	9.056705438e-02f, 9.071796038e-02f, 9.086992359e-02f, 9.102294364e-02f,
+	9.117702018e-02f, 9.133215285e-02f, 9.148834127e-02f, 9.164558508e-02f,
+	9.180388392e-02f, 9.196323740e-02f, 9.212364516e-02f, 9.228510681e-02f,
+	9.244762199e-02f, 9.261119029e-02f, 9.277581134e-02f, 9.294148476e-02f,
+	9.310821015e-02f, 9.327598711e-02f, 9.344481526e-02f, 9.361469420e-02f,
+	9.378562353e-02f, 9.395760284e-02f, 9.413063174e-02f, 9.430470980e-02f,
+	9.447983663e-02f, 9.465601182e-02f, 9.483323494e-02f, 9.501150558e-02f,
+	9.519082332e-02f, 9.537118774e-02f, 9.555259842e-02f, 9.573505492e-02f,
+	9.591855682e-02f, 9.610310369e-02f, 9.628869509e-02f, 9.647533058e-02f,
+	9.666300973e-02f, 9.685173210e-02f, 9.704149724e-02f, 9.723230470e-02f,
+	9.742415404e-02f, 9.761704480e-02f, 9.781097653e-02f, 9.800594877e-02f,
+	9.820196107e-02f, 9.839901296e-02f, 9.859710398e-02f, 9.879623367e-02f,
+	9.899640155e-02f, 9.919760715e-02f, 9.939985001e-02f, 9.960312964e-02f,
+	9.980744556e-02f, 1.000127973e-01f, 1.002191844e-01f, 1.004266063e-01f,
+	1.006350626e-01f, 1.008445527e-01f, 1.010550762e-01f, 1.012666327e-01f,
+	1.014792214e-01f, 1.016928421e-01f, 1.019074941e-01f, 1.021231771e-01f,
+	1.023398904e-01f, 1.025576335e-01f, 1.027764060e-01f, 1.029962073e-01f,
+	1.032170369e-01f, 1.034388943e-01f, 1.036617790e-01f, 1.038856905e-01f,
+	1.041106281e-01f, 1.043365915e-01f, 1.045635800e-01f, 1.047915931e-01f,
+	1.050206303e-01f, 1.052506911e-01f, 1.054817749e-01f, 1.057138811e-01f,
+	1.059470092e-01f, 1.061811588e-01f, 1.064163291e-01f, 1.066525197e-01f,
+	1.068897300e-01f, 1.071279595e-01f, 1.073672075e-01f, 1.076074736e-01f,
+	1.078487571e-01f, 1.080910576e-01f, 1.083343743e-01f, 1.085787068e-01f,
+	1.088240545e-01f, 1.090704168e-01f, 1.093177931e-01f, 1.095661828e-01f,
+	1.098155854e-01f, 1.100660003e-01f, 1.103174268e-01f, 1.105698644e-01f,
+	1.108233125e-01f, 1.110777705e-01f, 1.113332378e-01f, 1.115897138e-01f,
+	1.118471979e-01f, 1.121056895e-01f, 1.123651879e-01f, 1.126256926e-01f,
+	1.128872030e-01f, 1.131497184e-01f, 1.134132382e-01f, 1.136777618e-01f,
+	1.139432886e-01f, 1.142098180e-01f, 1.144773492e-01f, 1.147458818e-01f,
+	1.150154150e-01f, 1.152859483e-01f, 1.155574810e-01f, 1.158300124e-01f,
+	1.161035419e-01f, 1.163780689e-01f, 1.166535927e-01f, 1.169301127e-01f,
+	1.172076282e-01f, 1.174861386e-01f, 1.177656432e-01f, 1.180461414e-01f,
+	1.183276324e-01f, 1.186101157e-01f, 1.188935906e-01f, 1.191780564e-01f,
+	1.194635124e-01f, 1.197499579e-01f, 1.200373924e-01f, 1.203258151e-01f,
+	1.206152253e-01f, 1.209056223e-01f, 1.211970056e-01f, 1.214893743e-01f,
+	1.217827278e-01f, 1.220770654e-01f, 1.223723864e-01f, 1.226686902e-01f,
+	1.229659759e-01f, 1.232642430e-01f, 1.235634907e-01f, 1.238637183e-01f,
+	1.241649252e-01f, 1.244671105e-01f, 1.247702736e-01f, 1.250744138e-01f,
+	1.253795304e-01f, 1.256856226e-01f, 1.259926897e-01f, 1.263007310e-01f,
+	1.266097458e-01f, 1.269197333e-01f, 1.272306929e-01f, 1.275426237e-01f,
+	1.278555251e-01f, 1.281693963e-01f, 1.284842366e-01f, 1.288000452e-01f,
+	1.291168215e-01f, 1.294345645e-01f, 1.297532737e-01f, 1.300729482e-01f,
+	1.303935873e-01f, 1.307151903e-01f, 1.310377563e-01f, 1.313612847e-01f,
+	1.316857746e-01f, 1.320112254e-01f, 1.323376361e-01f, 1.326650062e-01f,
+	1.329933347e-01f, 1.333226210e-01f, 1.336528642e-01f, 1.339840636e-01f,
+	1.343162184e-01f, 1.346493278e-01f, 1.349833910e-01f, 1.353184073e-01f,
+	1.356543758e-01f, 1.359912958e-01f, 1.363291665e-01f, 1.366679870e-01f,
+	1.370077567e-01f, 1.373484746e-01f, 1.376901400e-01f, 1.380327520e-01f,
+	1.383763099e-01f, 1.387208129e-01f, 1.390662601e-01f, 1.394126508e-01f,
+	1.397599841e-01f, 1.401082592e-01f, 1.404574753e-01f, 1.408076315e-01f,
+	1.411587271e-01f, 1.415107611e-01f, 1.418637329e-01f, 1.422176415e-01f,
+	1.425724862e-01f, 1.429282660e-01f, 1.432849802e-01f, 1.436426279e-01f,
+	1.440012082e-01f, 1.443607204e-01f, 1.447211636e-01f, 1.450825368e-01f,
+	1.454448394e-01f, 1.458080704e-01f, 1.461722289e-01f, 1.465373142e-01f,
+	1.469033254e-01f, 1.472702615e-01f, 1.476381217e-01f, 1.480069053e-01f,
+	1.483766112e-01f, 1.487472386e-01f, 1.491187867e-01f, 1.494912546e-01f,
+	1.498646414e-01f, 1.502389462e-01f, 1.506141682e-01f, 1.509903064e-01f,
+	1.513673600e-01f, 1.517453281e-01f, 1.521242098e-01f, 1.525040042e-01f,
+	1.528847104e-01f, 1.532663275e-01f, 1.536488547e-01f, 1.540322909e-01f,
+	1.544166354e-01f, 1.548018873e-01f, 1.551880455e-01f, 1.555751092e-01f,
+	1.559630775e-01f, 1.563519495e-01f, 1.567417242e-01f, 1.571324008e-01f,
+	1.575239783e-01f, 1.579164559e-01f, 1.583098325e-01f, 1.587041072e-01f,
+	1.590992792e-01f, 1.594953475e-01f, 1.598923111e-01f, 1.602901692e-01f,
+	1.606889207e-01f, 1.610885648e-01f, 1.614891006e-01f, 1.618905270e-01f,
+	1.622928431e-01f, 1.626960480e-01f, 1.631001408e-01f, 1.635051204e-01f,
+	1.639109860e-01f, 1.643177365e-01f, 1.647253710e-01f, 1.651338886e-01f,
+	1.655432883e-01f, 1.659535692e-01f, 1.663647302e-01f, 1.667767704e-01f,
+	1.671896888e-01f, 1.676034845e-01f, 1.680181565e-01f, 1.684337038e-01f,
+	1.688501254e-01f, 1.692674203e-01f, 1.696855877e-01f, 1.701046264e-01f,
+	1.705245355e-01f, 1.709453141e-01f, 1.713669610e-01f, 1.717894754e-01f,
+	1.722128562e-01f, 1.726371025e-01f, 1.730622132e-01f, 1.734881873e-01f,
+	1.739150239e-01f, 1.743427219e-01f, 1.747712803e-01f, 1.752006982e-01f,
+	1.756309744e-01f, 1.760621081e-01f, 1.764940981e-01f, 1.769269435e-01f,
+	1.773606433e-01f, 1.777951964e-01f, 1.782306017e-01f, 1.786668584e-01f,
+	1.791039653e-01f, 1.795419214e-01f, 1.799807258e-01f, 1.804203772e-01f,
+	1.808608749e-01f, 1.813022176e-01f, 1.817444043e-01f, 1.821874341e-01f,
+	1.826313058e-01f, 1.830760184e-01f, 1.835215710e-01f, 1.839679623e-01f,
+	1.844151915e-01f, 1.848632573e-01f, 1.853121588e-01f, 1.857618950e-01f,
+	1.862124647e-01f, 1.866638669e-01f, 1.871161005e-01f, 1.875691645e-01f,
+	1.880230578e-01f, 1.884777794e-01f, 1.889333281e-01f, 1.893897029e-01f,
+	1.898469027e-01f, 1.903049264e-01f, 1.907637731e-01f, 1.912234415e-01f,
+	1.916839306e-01f, 1.921452393e-01f, 1.926073666e-01f, 1.930703114e-01f,
+	1.935340724e-01f, 1.939986488e-01f, 1.944640393e-01f, 1.949302429e-01f,
+	1.953972585e-01f, 1.958650850e-01f, 1.963337212e-01f, 1.968031662e-01f,
+	1.972734187e-01f, 1.977444777e-01f, 1.982163420e-01f, 1.986890106e-01f,
+	1.991624823e-01f, 1.996367561e-01f, 2.001118307e-01f, 2.005877052e-01f,
+	2.010643783e-01f, 2.015418490e-01f, 2.020201161e-01f, 2.024991785e-01f,
+	2.029790350e-01f, 2.034596846e-01f, 2.039411262e-01f, 2.044233585e-01f,
+	2.049063804e-01f, 2.053901908e-01f, 2.058747887e-01f, 2.063601727e-01f,
+	2.068463418e-01f, 2.073332949e-01f, 2.078210308e-01f, 2.083095483e-01f,
+	2.087988463e-01f, 2.092889237e-01f, 2.097797793e-01f, 2.102714119e-01f,
+	2.107638204e-01f, 2.112570036e-01f, 2.117509604e-01f, 2.122456895e-01f,
+	2.127411900e-01f, 2.132374604e-01f, 2.137344998e-01f, 2.142323070e-01f,
+	2.147308807e-01f, 2.152302197e-01f, 2.157303230e-01f, 2.162311894e-01f,
+	2.167328175e-01f, 2.172352064e-01f, 2.177383548e-01f, 2.182422615e-01f,
+	2.187469253e-01f, 2.192523450e-01f, 2.197585195e-01f, 2.202654476e-01f,
+	2.207731280e-01f, 2.212815596e-01f, 2.217907412e-01f, 2.223006715e-01f,
+	2.228113494e-01f, 2.233227737e-01f, 2.238349432e-01f, 2.243478566e-01f,
+	2.248615128e-01f, 2.253759106e-01f, 2.258910487e-01f, 2.264069259e-01f,
+	2.269235410e-01f, 2.274408928e-01f, 2.279589802e-01f, 2.284778017e-01f,
+	2.289973564e-01f, 2.295176428e-01f, 2.300386598e-01f, 2.305604062e-01f,
+	2.310828808e-01f, 2.316060822e-01f, 2.321300094e-01f, 2.326546609e-01f,
+	2.331800357e-01f, 2.337061325e-01f, 2.342329500e-01f, 2.347604870e-01f,
+	2.352887423e-01f, 2.358177146e-01f, 2.363474026e-01f, 2.368778052e-01f,
+	2.374089211e-01f, 2.379407490e-01f, 2.384732876e-01f, 2.390065358e-01f,
+	2.395404922e-01f, 2.400751557e-01f, 2.406105249e-01f, 2.411465986e-01f,
+	2.416833755e-01f, 2.422208544e-01f, 2.427590340e-01f, 2.432979131e-01f,
+	2.438374903e-01f, 2.443777644e-01f, 2.449187341e-01f, 2.454603982e-01f,
+	2.460027554e-01f, 2.465458043e-01f, 2.470895438e-01f, 2.476339726e-01f,
+	2.481790893e-01f, 2.487248927e-01f, 2.492713815e-01f, 2.498185544e-01f,
+	2.503664101e-01f, 2.509149474e-01f, 2.514641649e-01f, 2.520140613e-01f,
+	2.525646355e-01f, 2.531158859e-01f, 2.536678115e-01f, 2.542204108e-01f,
+	2.547736826e-01f, 2.553276255e-01f, 2.558822383e-01f, 2.564375197e-01f,
+	2.569934683e-01f, 2.575500829e-01f, 2.581073621e-01f, 2.586653046e-01f,
+	2.592239091e-01f, 2.597831743e-01f, 2.603430989e-01f, 2.609036816e-01f,
+	2.614649210e-01f, 2.620268158e-01f, 2.625893647e-01f, 2.631525664e-01f,
+	2.637164195e-01f, 2.642809227e-01f, 2.648460748e-01f, 2.654118743e-01f,
+	2.659783199e-01f, 2.665454104e-01f, 2.671131443e-01f, 2.676815203e-01f,
+	2.682505371e-01f, 2.688201934e-01f, 2.693904878e-01f, 2.699614190e-01f,
+	2.705329856e-01f, 2.711051862e-01f, 2.716780196e-01f, 2.722514844e-01f,
+	2.728255793e-01f, 2.734003028e-01f, 2.739756537e-01f, 2.745516305e-01f,
+	2.751282319e-01f, 2.757054567e-01f, 2.762833033e-01f, 2.768617705e-01f,
+	2.774408569e-01f, 2.780205611e-01f, 2.786008818e-01f, 2.791818175e-01f,
+	2.797633670e-01f, 2.803455289e-01f, 2.809283018e-01f, 2.815116842e-01f,
+	2.820956749e-01f, 2.826802725e-01f, 2.832654756e-01f, 2.838512829e-01f,
+	2.844376928e-01f, 2.850247041e-01f, 2.856123154e-01f, 2.862005253e-01f,
+	2.867893324e-01f, 2.873787354e-01f, 2.879687328e-01f, 2.885593232e-01f,
+	2.891505053e-01f, 2.897422777e-01f, 2.903346390e-01f, 2.909275877e-01f,
+	2.915211225e-01f, 2.921152421e-01f, 2.927099449e-01f, 2.933052296e-01f,
+	2.939010949e-01f, 2.944975392e-01f, 2.950945612e-01f, 2.956921595e-01f,
+	2.962903326e-01f, 2.968890793e-01f, 2.974883980e-01f, 2.980882874e-01f,
+	2.986887460e-01f, 2.992897724e-01f, 2.998913652e-01f, 3.004935231e-01f,
+	3.010962445e-01f, 3.016995281e-01f, 3.023033725e-01f, 3.029077761e-01f,
+	3.035127377e-01f, 3.041182557e-01f, 3.047243288e-01f, 3.053309555e-01f,
+	3.059381344e-01f, 3.065458641e-01f, 3.071541431e-01f, 3.077629701e-01f,
+	3.083723435e-01f, 3.089822619e-01f, 3.095927240e-01f, 3.102037282e-01f,
+	3.108152732e-01f, 3.114273574e-01f, 3.120399796e-01f, 3.126531381e-01f,
+	3.132668316e-01f, 3.138810586e-01f, 3.144958177e-01f, 3.151111074e-01f,
+	3.157269263e-01f, 3.163432730e-01f, 3.169601459e-01f, 3.175775437e-01f,
+	3.181954648e-01f, 3.188139079e-01f, 3.194328715e-01f, 3.200523540e-01f,
+	3.206723542e-01f, 3.212928704e-01f, 3.219139013e-01f, 3.225354453e-01f,
+	3.231575011e-01f, 3.237800671e-01f, 3.244031419e-01f, 3.250267240e-01f,
+	3.256508119e-01f, 3.262754043e-01f, 3.269004996e-01f, 3.275260963e-01f,
+	3.281521930e-01f, 3.287787881e-01f, 3.294058803e-01f, 3.300334681e-01f,
+	3.306615499e-01f, 3.312901243e-01f, 3.319191899e-01f, 3.325487450e-01f,
+	3.331787884e-01f, 3.338093183e-01f, 3.344403335e-01f, 3.350718324e-01f,
+	3.357038135e-01f, 3.363362753e-01f, 3.369692164e-01f, 3.376026352e-01f,
+	3.382365303e-01f, 3.388709001e-01f, 3.395057432e-01f, 3.401410581e-01f,
+	3.407768433e-01f, 3.414130973e-01f, 3.420498186e-01f, 3.426870057e-01f,
+	3.433246570e-01f, 3.439627712e-01f, 3.446013466e-01f, 3.452403819e-01f,
+	3.458798754e-01f, 3.465198258e-01f, 3.471602314e-01f, 3.478010907e-01f,
+	3.484424024e-01f, 3.490841647e-01f, 3.497263764e-01f, 3.503690357e-01f,
+	3.510121413e-01f, 3.516556916e-01f, 3.522996851e-01f, 3.529441202e-01f,
+	3.535889956e-01f, 3.542343095e-01f, 3.548800606e-01f, 3.555262473e-01f,
+	3.561728681e-01f, 3.568199214e-01f, 3.574674058e-01f, 3.581153197e-01f,
+	3.587636616e-01f, 3.594124299e-01f, 3.600616232e-01f, 3.607112399e-01f,
+	3.613612785e-01f, 3.620117375e-01f, 3.626626152e-01f, 3.633139103e-01f,
+	3.639656211e-01f, 3.646177462e-01f, 3.652702839e-01f, 3.659232328e-01f,
+	3.665765913e-01f, 3.672303579e-01f, 3.678845310e-01f, 3.685391092e-01f,
+	3.691940908e-01f, 3.698494743e-01f, 3.705052582e-01f, 3.711614410e-01f,
+	3.718180210e-01f, 3.724749968e-01f, 3.731323668e-01f, 3.737901294e-01f,
+	3.744482832e-01f, 3.751068265e-01f, 3.757657578e-01f, 3.764250756e-01f,
+	3.770847783e-01f, 3.777448644e-01f, 3.784053322e-01f, 3.790661803e-01f,
+	3.797274071e-01f, 3.803890110e-01f, 3.810509905e-01f, 3.817133440e-01f,
+	3.823760700e-01f, 3.830391669e-01f, 3.837026332e-01f, 3.843664672e-01f,
+	3.850306674e-01f, 3.856952323e-01f, 3.863601603e-01f, 3.870254499e-01f,
+	3.876910994e-01f, 3.883571072e-01f, 3.890234720e-01f, 3.896901919e-01f,
+	3.903572656e-01f, 3.910246914e-01f, 3.916924678e-01f, 3.923605931e-01f,
+	3.930290658e-01f, 3.936978844e-01f, 3.943670472e-01f, 3.950365528e-01f,
+	3.957063994e-01f, 3.963765856e-01f, 3.970471097e-01f, 3.977179703e-01f,
+	3.983891656e-01f, 3.990606941e-01f, 3.997325543e-01f, 4.004047446e-01f,
+	4.010772633e-01f, 4.017501089e-01f, 4.024232799e-01f, 4.030967746e-01f,
+	4.037705914e-01f, 4.044447288e-01f, 4.051191852e-01f, 4.057939589e-01f,
+	4.064690485e-01f, 4.071444522e-01f, 4.078201686e-01f, 4.084961960e-01f,
+	4.091725329e-01f, 4.098491776e-01f, 4.105261286e-01f, 4.112033842e-01f,
+	4.118809429e-01f, 4.125588031e-01f, 4.132369631e-01f, 4.139154215e-01f,
+	4.145941765e-01f, 4.152732266e-01f, 4.159525702e-01f, 4.166322058e-01f,
+	4.173121316e-01f, 4.179923461e-01f, 4.186728477e-01f, 4.193536348e-01f,
+	4.200347058e-01f, 4.207160590e-01f, 4.213976930e-01f, 4.220796061e-01f,
+	4.227617966e-01f, 4.234442630e-01f, 4.241270036e-01f, 4.248100170e-01f,
+	4.254933014e-01f, 4.261768552e-01f, 4.268606768e-01f, 4.275447647e-01f,
+	4.282291172e-01f, 4.289137328e-01f, 4.295986097e-01f, 4.302837464e-01f,
+	4.309691412e-01f, 4.316547927e-01f, 4.323406991e-01f, 4.330268588e-01f,
+	4.337132702e-01f, 4.343999317e-01f, 4.350868417e-01f, 4.357739986e-01f,
+	4.364614008e-01f, 4.371490466e-01f, 4.378369344e-01f, 4.385250625e-01f,
+	4.392134295e-01f, 4.399020337e-01f, 4.405908733e-01f, 4.412799469e-01f,
+	4.419692528e-01f, 4.426587894e-01f, 4.433485550e-01f, 4.440385481e-01f,
+	4.447287670e-01f, 4.454192100e-01f, 4.461098756e-01f, 4.468007621e-01f,
+	4.474918680e-01f, 4.481831915e-01f, 4.488747311e-01f, 4.495664851e-01f,
+	4.502584519e-01f, 4.509506298e-01f, 4.516430174e-01f, 4.523356128e-01f,
+	4.530284145e-01f, 4.537214209e-01f, 4.544146302e-01f, 4.551080410e-01f,
+	4.558016515e-01f, 4.564954602e-01f, 4.571894654e-01f, 4.578836654e-01f,
+	4.585780586e-01f, 4.592726434e-01f, 4.599674182e-01f, 4.606623814e-01f,
+	4.613575312e-01f, 4.620528660e-01f, 4.627483843e-01f, 4.634440844e-01f,
+	4.641399646e-01f, 4.648360233e-01f, 4.655322589e-01f, 4.662286697e-01f,
+	4.669252541e-01f, 4.676220104e-01f, 4.683189371e-01f, 4.690160324e-01f,
+	4.697132948e-01f, 4.704107225e-01f, 4.711083140e-01f, 4.718060677e-01f,
+	4.725039818e-01f, 4.732020547e-01f, 4.739002848e-01f, 4.745986704e-01f,
+	4.752972099e-01f, 4.759959017e-01f, 4.766947441e-01f, 4.773937354e-01f,
+	4.780928741e-01f, 4.787921584e-01f, 4.794915868e-01f, 4.801911575e-01f,
+	4.808908690e-01f, 4.815907196e-01f, 4.822907076e-01f, 4.829908314e-01f,
+	4.836910894e-01f, 4.843914799e-01f, 4.850920012e-01f, 4.857926517e-01f,
+	4.864934298e-01f, 4.871943338e-01f, 4.878953620e-01f, 4.885965128e-01f,
+	4.892977846e-01f, 4.899991758e-01f, 4.907006845e-01f, 4.914023093e-01f,
+	4.921040484e-01f, 4.928059002e-01f, 4.935078631e-01f, 4.942099354e-01f,
+	4.949121154e-01f, 4.956144016e-01f, 4.963167921e-01f, 4.970192855e-01f,
+	4.977218800e-01f, 4.984245740e-01f, 4.991273658e-01f, 4.998302538e-01f,
+	5.005332363e-01f, 5.012363117e-01f, 5.019394783e-01f, 5.026427345e-01f,
+	5.033460785e-01f, 5.040495088e-01f, 5.047530238e-01f, 5.054566216e-01f,
+	5.061603007e-01f, 5.068640595e-01f, 5.075678962e-01f, 5.082718093e-01f,
+	5.089757970e-01f, 5.096798577e-01f, 5.103839898e-01f, 5.110881915e-01f,
+	5.117924613e-01f, 5.124967975e-01f, 5.132011983e-01f, 5.139056623e-01f,
+	5.146101876e-01f, 5.153147727e-01f, 5.160194158e-01f, 5.167241154e-01f,
+	5.174288698e-01f, 5.181336773e-01f, 5.188385362e-01f, 5.195434449e-01f,
+	5.202484018e-01f, 5.209534052e-01f, 5.216584533e-01f, 5.223635446e-01f,
+	5.230686774e-01f, 5.237738501e-01f, 5.244790609e-01f, 5.251843083e-01f,
+	5.258895905e-01f, 5.265949060e-01f, 5.273002529e-01f, 5.280056298e-01f,
+	5.287110349e-01f, 5.294164665e-01f, 5.301219231e-01f, 5.308274029e-01f,
+	5.315329042e-01f, 5.322384255e-01f, 5.329439651e-01f, 5.336495213e-01f,
+	5.343550924e-01f, 5.350606768e-01f, 5.357662728e-01f, 5.364718788e-01f,
+	5.371774931e-01f, 5.378831140e-01f, 5.385887399e-01f, 5.392943691e-01f,
+	5.400000000e-01f, 5.407056309e-01f, 5.414112601e-01f, 5.421168860e-01f,
+	5.428225069e-01f, 5.435281212e-01f, 5.442337272e-01f, 5.449393232e-01f,
+	5.456449076e-01f, 5.463504787e-01f, 5.470560349e-01f, 5.477615745e-01f,
+	5.484670958e-01f, 5.491725971e-01f, 5.498780769e-01f, 5.505835335e-01f,
+	5.512889651e-01f, 5.519943702e-01f, 5.526997471e-01f, 5.534050940e-01f,
+	5.541104095e-01f, 5.548156917e-01f, 5.555209391e-01f, 5.562261499e-01f,
+	5.569313226e-01f, 5.576364554e-01f, 5.583415467e-01f, 5.590465948e-01f,
+	5.597515982e-01f, 5.604565551e-01f, 5.611614638e-01f, 5.618663227e-01f,
+	5.625711302e-01f, 5.632758846e-01f, 5.639805842e-01f, 5.646852273e-01f,
+	5.653898124e-01f, 5.660943377e-01f, 5.667988017e-01f, 5.675032025e-01f,
+	5.682075387e-01f, 5.689118085e-01f, 5.696160102e-01f, 5.703201423e-01f,
+	5.710242030e-01f, 5.717281907e-01f, 5.724321038e-01f, 5.731359405e-01f,
+	5.738396993e-01f, 5.745433784e-01f, 5.752469762e-01f, 5.759504912e-01f,
+	5.766539215e-01f, 5.773572655e-01f, 5.780605217e-01f, 5.787636883e-01f,
+	5.794667637e-01f, 5.801697462e-01f, 5.808726342e-01f, 5.815754260e-01f,
+	5.822781200e-01f, 5.829807145e-01f, 5.836832079e-01f, 5.843855984e-01f,
+	5.850878846e-01f, 5.857900646e-01f, 5.864921369e-01f, 5.871940998e-01f,
+	5.878959516e-01f, 5.885976907e-01f, 5.892993155e-01f, 5.900008242e-01f,
+	5.907022154e-01f, 5.914034872e-01f, 5.921046380e-01f, 5.928056662e-01f,
+	5.935065702e-01f, 5.942073483e-01f, 5.949079988e-01f, 5.956085201e-01f,
+	5.963089106e-01f, 5.970091686e-01f, 5.977092924e-01f, 5.984092804e-01f,
+	5.991091310e-01f, 5.998088425e-01f, 6.005084132e-01f, 6.012078416e-01f,
+	6.019071259e-01f, 6.026062646e-01f, 6.033052559e-01f, 6.040040983e-01f,
+	6.047027901e-01f, 6.054013296e-01f, 6.060997152e-01f, 6.067979453e-01f,
+	6.074960182e-01f, 6.081939323e-01f, 6.088916860e-01f, 6.095892775e-01f,
+	6.102867052e-01f, 6.109839676e-01f, 6.116810629e-01f, 6.123779896e-01f,
+	6.130747459e-01f, 6.137713303e-01f, 6.144677411e-01f, 6.151639767e-01f,
+	6.158600354e-01f, 6.165559156e-01f, 6.172516157e-01f, 6.179471340e-01f,
+	6.186424688e-01f, 6.193376186e-01f, 6.200325818e-01f, 6.207273566e-01f,
+	6.214219414e-01f, 6.221163346e-01f, 6.228105346e-01f, 6.235045398e-01f,
+	6.241983485e-01f, 6.248919590e-01f, 6.255853698e-01f, 6.262785791e-01f,
+	6.269715855e-01f, 6.276643872e-01f, 6.283569826e-01f, 6.290493702e-01f,
+	6.297415481e-01f, 6.304335149e-01f, 6.311252689e-01f, 6.318168085e-01f,
+	6.325081320e-01f, 6.331992379e-01f, 6.338901244e-01f, 6.345807900e-01f,
+	6.352712330e-01f, 6.359614519e-01f, 6.366514450e-01f, 6.373412106e-01f,
+	6.380307472e-01f, 6.387200531e-01f, 6.394091267e-01f, 6.400979663e-01f,
+	6.407865705e-01f, 6.414749375e-01f, 6.421630656e-01f, 6.428509534e-01f,
+	6.435385992e-01f, 6.442260014e-01f, 6.449131583e-01f, 6.456000683e-01f,
+	6.462867298e-01f, 6.469731412e-01f, 6.476593009e-01f, 6.483452073e-01f,
+	6.490308588e-01f, 6.497162536e-01f, 6.504013903e-01f, 6.510862672e-01f,
+	6.517708828e-01f, 6.524552353e-01f, 6.531393232e-01f, 6.538231448e-01f,
+	6.545066986e-01f, 6.551899830e-01f, 6.558729964e-01f, 6.565557370e-01f,
+	6.572382034e-01f, 6.579203939e-01f, 6.586023070e-01f, 6.592839410e-01f,
+	6.599652942e-01f, 6.606463652e-01f, 6.613271523e-01f, 6.620076539e-01f,
+	6.626878684e-01f, 6.633677942e-01f, 6.640474298e-01f, 6.647267734e-01f,
+	6.654058235e-01f, 6.660845785e-01f, 6.667630369e-01f, 6.674411969e-01f,
+	6.681190571e-01f, 6.687966158e-01f, 6.694738714e-01f, 6.701508224e-01f,
+	6.708274671e-01f, 6.715038040e-01f, 6.721798314e-01f, 6.728555478e-01f,
+	6.735309515e-01f, 6.742060411e-01f, 6.748808148e-01f, 6.755552712e-01f,
+	6.762294086e-01f, 6.769032254e-01f, 6.775767201e-01f, 6.782498911e-01f,
+	6.789227367e-01f, 6.795952554e-01f, 6.802674457e-01f, 6.809393059e-01f,
+	6.816108344e-01f, 6.822820297e-01f, 6.829528903e-01f, 6.836234144e-01f,
+	6.842936006e-01f, 6.849634472e-01f, 6.856329528e-01f, 6.863021156e-01f,
+	6.869709342e-01f, 6.876394069e-01f, 6.883075322e-01f, 6.889753086e-01f,
+	6.896427344e-01f, 6.903098081e-01f, 6.909765280e-01f, 6.916428928e-01f,
+	6.923089006e-01f, 6.929745501e-01f, 6.936398397e-01f, 6.943047677e-01f,
+	6.949693326e-01f, 6.956335328e-01f, 6.962973668e-01f, 6.969608331e-01f,
+	6.976239300e-01f, 6.982866560e-01f, 6.989490095e-01f, 6.996109890e-01f,
+	7.002725929e-01f, 7.009338197e-01f, 7.015946678e-01f, 7.022551356e-01f,
+	7.029152217e-01f, 7.035749244e-01f, 7.042342422e-01f, 7.048931735e-01f,
+	7.055517168e-01f, 7.062098706e-01f, 7.068676332e-01f, 7.075250032e-01f,
+	7.081819790e-01f, 7.088385590e-01f, 7.094947418e-01f, 7.101505257e-01f,
+	7.108059092e-01f, 7.114608908e-01f, 7.121154690e-01f, 7.127696421e-01f,
+	7.134234087e-01f, 7.140767672e-01f, 7.147297161e-01f, 7.153822538e-01f,
+	7.160343789e-01f, 7.166860897e-01f, 7.173373848e-01f, 7.179882625e-01f,
+	7.186387215e-01f, 7.192887601e-01f, 7.199383768e-01f, 7.205875701e-01f,
+	7.212363384e-01f, 7.218846803e-01f, 7.225325942e-01f, 7.231800786e-01f,
+	7.238271319e-01f, 7.244737527e-01f, 7.251199394e-01f, 7.257656905e-01f,
+	7.264110044e-01f, 7.270558798e-01f, 7.277003149e-01f, 7.283443084e-01f,
+	7.289878587e-01f, 7.296309643e-01f, 7.302736236e-01f, 7.309158353e-01f,
+	7.315575976e-01f, 7.321989093e-01f, 7.328397686e-01f, 7.334801742e-01f,
+	7.341201246e-01f, 7.347596181e-01f, 7.353986534e-01f, 7.360372288e-01f,
+	7.366753430e-01f, 7.373129943e-01f, 7.379501814e-01f, 7.385869027e-01f,
+	7.392231567e-01f, 7.398589419e-01f, 7.404942568e-01f, 7.411290999e-01f,
+	7.417634697e-01f, 7.423973648e-01f, 7.430307836e-01f, 7.436637247e-01f,
+	7.442961865e-01f, 7.449281676e-01f, 7.455596665e-01f, 7.461906817e-01f,
+	7.468212116e-01f, 7.474512550e-01f, 7.480808101e-01f, 7.487098757e-01f,
+	7.493384501e-01f, 7.499665319e-01f, 7.505941197e-01f, 7.512212119e-01f,
+	7.518478070e-01f, 7.524739037e-01f, 7.530995004e-01f, 7.537245957e-01f,
+	7.543491881e-01f, 7.549732760e-01f, 7.555968581e-01f, 7.562199329e-01f,
+	7.568424989e-01f, 7.574645547e-01f, 7.580860987e-01f, 7.587071296e-01f,
+	7.593276458e-01f, 7.599476460e-01f, 7.605671285e-01f, 7.611860921e-01f,
+	7.618045352e-01f, 7.624224563e-01f, 7.630398541e-01f, 7.636567270e-01f,
+	7.642730737e-01f, 7.648888926e-01f, 7.655041823e-01f, 7.661189414e-01f,
+	7.667331684e-01f, 7.673468619e-01f, 7.679600204e-01f, 7.685726426e-01f,
+	7.691847268e-01f, 7.697962718e-01f, 7.704072760e-01f, 7.710177381e-01f,
+	7.716276565e-01f, 7.722370299e-01f, 7.728458569e-01f, 7.734541359e-01f,
+	7.740618656e-01f, 7.746690445e-01f, 7.752756712e-01f, 7.758817443e-01f,
+	7.764872623e-01f, 7.770922239e-01f, 7.776966275e-01f, 7.783004719e-01f,
+	7.789037555e-01f, 7.795064769e-01f, 7.801086348e-01f, 7.807102276e-01f,
+	7.813112540e-01f, 7.819117126e-01f, 7.825116020e-01f, 7.831109207e-01f,
+	7.837096674e-01f, 7.843078405e-01f, 7.849054388e-01f, 7.855024608e-01f,
+	7.860989051e-01f, 7.866947704e-01f, 7.872900551e-01f, 7.878847579e-01f,
+	7.884788775e-01f, 7.890724123e-01f, 7.896653610e-01f, 7.902577223e-01f,
+	7.908494947e-01f, 7.914406768e-01f, 7.920312672e-01f, 7.926212646e-01f,
+	7.932106676e-01f, 7.937994747e-01f, 7.943876846e-01f, 7.949752959e-01f,
+	7.955623072e-01f, 7.961487171e-01f, 7.967345244e-01f, 7.973197275e-01f,
+	7.979043251e-01f, 7.984883158e-01f, 7.990716982e-01f, 7.996544711e-01f,
+	8.002366330e-01f, 8.008181825e-01f, 8.013991182e-01f, 8.019794389e-01f,
+	8.025591431e-01f, 8.031382295e-01f, 8.037166967e-01f, 8.042945433e-01f,
+	8.048717681e-01f, 8.054483695e-01f, 8.060243463e-01f, 8.065996972e-01f,
+	8.071744207e-01f, 8.077485156e-01f, 8.083219804e-01f, 8.088948138e-01f,
+	8.094670144e-01f, 8.100385810e-01f, 8.106095122e-01f, 8.111798066e-01f,
+	8.117494629e-01f, 8.123184797e-01f, 8.128868557e-01f, 8.134545896e-01f,
+	8.140216801e-01f, 8.145881257e-01f, 8.151539252e-01f, 8.157190773e-01f,
+	8.162835805e-01f, 8.168474336e-01f, 8.174106353e-01f, 8.179731842e-01f,
+	8.185350790e-01f, 8.190963184e-01f, 8.196569011e-01f, 8.202168257e-01f,
+	8.207760909e-01f, 8.213346954e-01f, 8.218926379e-01f, 8.224499171e-01f,
+	8.230065317e-01f, 8.235624803e-01f, 8.241177617e-01f, 8.246723745e-01f,
+	8.252263174e-01f, 8.257795892e-01f, 8.263321885e-01f, 8.268841141e-01f,
+	8.274353645e-01f, 8.279859387e-01f, 8.285358351e-01f, 8.290850526e-01f,
+	8.296335899e-01f, 8.301814456e-01f, 8.307286185e-01f, 8.312751073e-01f,
+	8.318209107e-01f, 8.323660274e-01f, 8.329104562e-01f, 8.334541957e-01f,
+	8.339972446e-01f, 8.345396018e-01f, 8.350812659e-01f, 8.356222356e-01f,
+	8.361625097e-01f, 8.367020869e-01f, 8.372409660e-01f, 8.377791456e-01f,
+	8.383166245e-01f, 8.388534014e-01f, 8.393894751e-01f, 8.399248443e-01f,
+	8.404595078e-01f, 8.409934642e-01f, 8.415267124e-01f, 8.420592510e-01f,
+	8.425910789e-01f, 8.431221948e-01f, 8.436525974e-01f, 8.441822854e-01f,
+	8.447112577e-01f, 8.452395130e-01f, 8.457670500e-01f, 8.462938675e-01f,
+	8.468199643e-01f, 8.473453391e-01f, 8.478699906e-01f, 8.483939178e-01f,
+	8.489171192e-01f, 8.494395938e-01f, 8.499613402e-01f, 8.504823572e-01f,
+	8.510026436e-01f, 8.515221983e-01f, 8.520410198e-01f, 8.525591072e-01f,
+	8.530764590e-01f, 8.535930741e-01f, 8.541089513e-01f, 8.546240894e-01f,
+	8.551384872e-01f, 8.556521434e-01f, 8.561650568e-01f, 8.566772263e-01f,
+	8.571886506e-01f, 8.576993285e-01f, 8.582092588e-01f, 8.587184404e-01f,
+	8.592268720e-01f, 8.597345524e-01f, 8.602414805e-01f, 8.607476550e-01f,
+	8.612530747e-01f, 8.617577385e-01f, 8.622616452e-01f, 8.627647936e-01f,
+	8.632671825e-01f, 8.637688106e-01f, 8.642696770e-01f, 8.647697803e-01f,
+	8.652691193e-01f, 8.657676930e-01f, 8.662655002e-01f, 8.667625396e-01f,
+	8.672588100e-01f, 8.677543105e-01f, 8.682490396e-01f, 8.687429964e-01f,
+	8.692361796e-01f, 8.697285881e-01f, 8.702202207e-01f, 8.707110763e-01f,
+	8.712011537e-01f, 8.716904517e-01f, 8.721789692e-01f, 8.726667051e-01f,
+	8.731536582e-01f, 8.736398273e-01f, 8.741252113e-01f, 8.746098092e-01f,
+	8.750936196e-01f, 8.755766415e-01f, 8.760588738e-01f, 8.765403154e-01f,
+	8.770209650e-01f, 8.775008215e-01f, 8.779798839e-01f, 8.784581510e-01f,
+	8.789356217e-01f, 8.794122948e-01f, 8.798881693e-01f, 8.803632439e-01f,
+	8.808375177e-01f, 8.813109894e-01f, 8.817836580e-01f, 8.822555223e-01f,
+	8.827265813e-01f, 8.831968338e-01f, 8.836662788e-01f, 8.841349150e-01f,
+	8.846027415e-01f, 8.850697571e-01f, 8.855359607e-01f, 8.860013512e-01f,
+	8.864659276e-01f, 8.869296886e-01f, 8.873926334e-01f, 8.878547607e-01f,
+	8.883160694e-01f, 8.887765585e-01f, 8.892362269e-01f, 8.896950736e-01f,
+	8.901530973e-01f, 8.906102971e-01f, 8.910666719e-01f, 8.915222206e-01f,
+	8.919769422e-01f, 8.924308355e-01f, 8.928838995e-01f, 8.933361331e-01f,
+	8.937875353e-01f, 8.942381050e-01f, 8.946878412e-01f, 8.951367427e-01f,
+	8.955848085e-01f, 8.960320377e-01f, 8.964784290e-01f, 8.969239816e-01f,
+	8.973686942e-01f, 8.978125659e-01f, 8.982555957e-01f, 8.986977824e-01f,
+	8.991391251e-01f, 8.995796228e-01f, 9.000192742e-01f, 9.004580786e-01f,
+	9.008960347e-01f, 9.013331416e-01f, 9.017693983e-01f, 9.022048036e-01f,
+	9.026393567e-01f, 9.030730565e-01f, 9.035059019e-01f, 9.039378919e-01f,
+	9.043690256e-01f, 9.047993018e-01f, 9.052287197e-01f, 9.056572781e-01f,
+	9.060849761e-01f, 9.065118127e-01f, 9.069377868e-01f, 9.073628975e-01f,
+	9.077871438e-01f, 9.082105246e-01f, 9.086330390e-01f, 9.090546859e-01f,
+	9.094754645e-01f, 9.098953736e-01f, 9.103144123e-01f, 9.107325797e-01f,
+	9.111498746e-01f, 9.115662962e-01f, 9.119818435e-01f, 9.123965155e-01f,
+	9.128103112e-01f, 9.132232296e-01f, 9.136352698e-01f, 9.140464308e-01f,
+	9.144567117e-01f, 9.148661114e-01f, 9.152746290e-01f, 9.156822635e-01f,
+	9.160890140e-01f, 9.164948796e-01f, 9.168998592e-01f, 9.173039520e-01f,
+	9.177071569e-01f, 9.181094730e-01f, 9.185108994e-01f, 9.189114352e-01f,
+	9.193110793e-01f, 9.197098308e-01f, 9.201076889e-01f, 9.205046525e-01f,
+	9.209007208e-01f, 9.212958928e-01f, 9.216901675e-01f, 9.220835441e-01f,
+	9.224760217e-01f, 9.228675992e-01f, 9.232582758e-01f, 9.236480505e-01f,
+	9.240369225e-01f, 9.244248908e-01f, 9.248119545e-01f, 9.251981127e-01f,
+	9.255833646e-01f, 9.259677091e-01f, 9.263511453e-01f, 9.267336725e-01f,
+	9.271152896e-01f, 9.274959958e-01f, 9.278757902e-01f, 9.282546719e-01f,
+	9.286326400e-01f, 9.290096936e-01f, 9.293858318e-01f, 9.297610538e-01f,
+	9.301353586e-01f, 9.305087454e-01f, 9.308812133e-01f, 9.312527614e-01f,
+	9.316233888e-01f, 9.319930947e-01f, 9.323618783e-01f, 9.327297385e-01f,
+	9.330966746e-01f, 9.334626858e-01f, 9.338277711e-01f, 9.341919296e-01f,
+	9.345551606e-01f, 9.349174632e-01f, 9.352788364e-01f, 9.356392796e-01f,
+	9.359987918e-01f, 9.363573721e-01f, 9.367150198e-01f, 9.370717340e-01f,
+	9.374275138e-01f, 9.377823585e-01f, 9.381362671e-01f, 9.384892389e-01f,
+	9.388412729e-01f, 9.391923685e-01f, 9.395425247e-01f, 9.398917408e-01f,
+	9.402400159e-01f, 9.405873492e-01f, 9.409337399e-01f, 9.412791871e-01f,
+	9.416236901e-01f, 9.419672480e-01f, 9.423098600e-01f, 9.426515254e-01f,
+	9.429922433e-01f, 9.433320130e-01f, 9.436708335e-01f, 9.440087042e-01f,
+	9.443456242e-01f, 9.446815927e-01f, 9.450166090e-01f, 9.453506722e-01f,
+	9.456837816e-01f, 9.460159364e-01f, 9.463471358e-01f, 9.466773790e-01f,
+	9.470066653e-01f, 9.473349938e-01f, 9.476623639e-01f, 9.479887746e-01f,
+	9.483142254e-01f, 9.486387153e-01f, 9.489622437e-01f, 9.492848097e-01f,
+	9.496064127e-01f, 9.499270518e-01f, 9.502467263e-01f, 9.505654355e-01f,
+	9.508831785e-01f, 9.511999548e-01f, 9.515157634e-01f, 9.518306037e-01f,
+	9.521444749e-01f, 9.524573763e-01f, 9.527693071e-01f, 9.530802667e-01f,
+	9.533902542e-01f, 9.536992690e-01f, 9.540073103e-01f, 9.543143774e-01f,
+	9.546204696e-01f, 9.549255862e-01f, 9.552297264e-01f, 9.555328895e-01f,
+	9.558350748e-01f, 9.561362817e-01f, 9.564365093e-01f, 9.567357570e-01f,
+	9.570340241e-01f, 9.573313098e-01f, 9.576276136e-01f, 9.579229346e-01f,
+	9.582172722e-01f, 9.585106257e-01f, 9.588029944e-01f, 9.590943777e-01f,
+	9.593847747e-01f, 9.596741849e-01f, 9.599626076e-01f, 9.602500421e-01f,
+	9.605364876e-01f, 9.608219436e-01f, 9.611064094e-01f, 9.613898843e-01f,
+	9.616723676e-01f, 9.619538586e-01f, 9.622343568e-01f, 9.625138614e-01f,
+	9.627923718e-01f, 9.630698873e-01f, 9.633464073e-01f, 9.636219311e-01f,
+	9.638964581e-01f, 9.641699876e-01f, 9.644425190e-01f, 9.647140517e-01f,
+	9.649845850e-01f, 9.652541182e-01f, 9.655226508e-01f, 9.657901820e-01f,
+	9.660567114e-01f, 9.663222382e-01f, 9.665867618e-01f, 9.668502816e-01f,
+	9.671127970e-01f, 9.673743074e-01f, 9.676348121e-01f, 9.678943105e-01f,
+	9.681528021e-01f, 9.684102862e-01f, 9.686667622e-01f, 9.689222295e-01f,
+	9.691766875e-01f, 9.694301356e-01f, 9.696825732e-01f, 9.699339997e-01f,
+	9.701844146e-01f, 9.704338172e-01f, 9.706822069e-01f, 9.709295832e-01f,
+	9.711759455e-01f, 9.714212932e-01f, 9.716656257e-01f, 9.719089424e-01f,
+	9.721512429e-01f, 9.723925264e-01f, 9.726327925e-01f, 9.728720405e-01f,
+	9.731102700e-01f, 9.733474803e-01f, 9.735836709e-01f, 9.738188412e-01f,
+	9.740529908e-01f, 9.742861189e-01f, 9.745182251e-01f, 9.747493089e-01f,
+	9.749793697e-01f, 9.752084069e-01f, 9.754364200e-01f, 9.756634085e-01f,
+	9.758893719e-01f, 9.761143095e-01f, 9.763382210e-01f, 9.765611057e-01f,
+	9.767829631e-01f, 9.770037927e-01f, 9.772235940e-01f, 9.774423665e-01f,
+	9.776601096e-01f, 9.778768229e-01f, 9.780925059e-01f, 9.783071579e-01f,
+	9.785207786e-01f, 9.787333673e-01f, 9.789449238e-01f, 9.791554473e-01f,
+	9.793649374e-01f, 9.795733937e-01f, 9.797808156e-01f, 9.799872027e-01f,
+	9.801925544e-01f, 9.803968704e-01f, 9.806001500e-01f, 9.808023928e-01f,
+	9.810035985e-01f, 9.812037663e-01f, 9.814028960e-01f, 9.816009870e-01f,
+	9.817980389e-01f, 9.819940512e-01f, 9.821890235e-01f, 9.823829552e-01f,
+	9.825758460e-01f, 9.827676953e-01f, 9.829585028e-01f, 9.831482679e-01f,
+	9.833369903e-01f, 9.835246694e-01f, 9.837113049e-01f, 9.838968963e-01f,
+	9.840814432e-01f, 9.842649451e-01f, 9.844474016e-01f, 9.846288123e-01f,
+	9.848091767e-01f, 9.849884944e-01f, 9.851667651e-01f, 9.853439882e-01f,
+	9.855201634e-01f, 9.856952902e-01f, 9.858693683e-01f, 9.860423972e-01f,
+	9.862143765e-01f, 9.863853058e-01f, 9.865551847e-01f, 9.867240129e-01f,
+	9.868917899e-01f, 9.870585152e-01f, 9.872241887e-01f, 9.873888097e-01f,
+	9.875523780e-01f, 9.877148932e-01f, 9.878763548e-01f, 9.880367626e-01f,
+	9.881961161e-01f, 9.883544149e-01f, 9.885116587e-01f, 9.886678472e-01f,
+	9.888229798e-01f, 9.889770564e-01f, 9.891300764e-01f, 9.892820396e-01f,
+	9.894329456e-01f, 9.895827941e-01f, 9.897315846e-01f, 9.898793169e-01f,
+	9.900259905e-01f, 9.901716052e-01f, 9.903161606e-01f, 9.904596564e-01f,
+	9.906020922e-01f, 9.907434677e-01f, 9.908837825e-01f, 9.910230364e-01f,
+	9.911612290e-01f, 9.912983599e-01f, 9.914344289e-01f, 9.915694357e-01f,
+	9.917033798e-01f, 9.918362610e-01f, 9.919680791e-01f, 9.920988336e-01f,
+	9.922285242e-01f, 9.923571507e-01f, 9.924847128e-01f, 9.926112102e-01f,
+	9.927366425e-01f, 9.928610095e-01f, 9.929843108e-01f, 9.931065463e-01f,
+	9.932277155e-01f, 9.933478182e-01f, 9.934668542e-01f, 9.935848231e-01f,
+	9.937017247e-01f, 9.938175587e-01f, 9.939323248e-01f, 9.940460228e-01f,
+	9.941586524e-01f, 9.942702132e-01f, 9.943807052e-01f, 9.944901279e-01f,
+	9.945984812e-01f, 9.947057647e-01f, 9.948119783e-01f, 9.949171217e-01f,
+	9.950211946e-01f, 9.951241968e-01f, 9.952261280e-01f, 9.953269881e-01f,
+	9.954267767e-01f, 9.955254937e-01f, 9.956231388e-01f, 9.957197117e-01f,
+	9.958152123e-01f, 9.959096403e-01f, 9.960029955e-01f, 9.960952777e-01f,
+	9.961864867e-01f, 9.962766222e-01f, 9.963656840e-01f, 9.964536720e-01f,
+	9.965405859e-01f, 9.966264255e-01f, 9.967111907e-01f, 9.967948811e-01f,
+	9.968774966e-01f, 9.969590371e-01f, 9.970395023e-01f, 9.971188921e-01f,
+	9.971972062e-01f, 9.972744445e-01f, 9.973506067e-01f, 9.974256928e-01f,
+	9.974997025e-01f, 9.975726357e-01f, 9.976444922e-01f, 9.977152717e-01f,
+	9.977849743e-01f, 9.978535996e-01f, 9.979211475e-01f, 9.979876179e-01f,
+	9.980530107e-01f, 9.981173255e-01f, 9.981805624e-01f, 9.982427212e-01f,
+	9.983038016e-01f, 9.983638036e-01f, 9.984227271e-01f, 9.984805718e-01f,
+	9.985373377e-01f, 9.985930246e-01f, 9.986476324e-01f, 9.987011609e-01f,
+	9.987536101e-01f, 9.988049798e-01f, 9.988552698e-01f, 9.989044802e-01f,
+	9.989526107e-01f, 9.989996612e-01f, 9.990456317e-01f, 9.990905219e-01f,
+	9.991343319e-01f, 9.991770615e-01f, 9.992187107e-01f, 9.992592792e-01f,
+	9.992987671e-01f, 9.993371741e-01f, 9.993745004e-01f, 9.994107456e-01f,
+	9.994459099e-01f, 9.994799930e-01f, 9.995129949e-01f, 9.995449155e-01f,
+	9.995757548e-01f, 9.996055126e-01f, 9.996341890e-01f, 9.996617838e-01f,
+	9.996882969e-01f, 9.997137284e-01f, 9.997380781e-01f, 9.997613460e-01f,
+	9.997835321e-01f, 9.998046362e-01f, 9.998246583e-01f, 9.998435985e-01f,
+	9.998614566e-01f, 9.998782326e-01f, 9.998939265e-01f, 9.999085381e-01f,
+	9.999220676e-01f, 9.999345149e-01f, 9.999458798e-01f, 9.999561625e-01f,
+	9.999653628e-01f, 9.999734809e-01f, 9.999805165e-01f, 9.999864698e-01f,
+	9.999913406e-01f, 9.999951291e-01f, 9.999978352e-01f, 9.999994588e-01f,
+	1.000000000e+00f,
+};
+
+static const q15_t win_hamming_half_q15[WINDOW_HALF_LEN] = {
+	2621, 2621, 2622, 2622, 2622, 2622, 2622, 2622,
+	2623, 2623, 2623, 2624, 2624, 2624, 2625, 2625,
+	2626, 2627, 2627, 2628, 2629, 2629, 2630, 2631,
+	2632, 2633, 2633, 2634, 2635, 2636, 2637, 2638,
+	2640, 2641, 2642, 2643, 2644, 2646, 2647, 2648,
+	2650, 2651, 2653, 2654, 2656, 2657, 2659, 2661,
+	2662, 2664, 2666, 2668, 2669, 2671, 2673, 2675,
+	2677, 2679, 2681, 2683, 2685, 2687, 2690, 2692,
+	2694, 2696, 2699, 2701, 2703, 2706, 2708, 2711,
+	2713, 2716, 2718, 2721, 2724, 2726, 2729, 2732,
+	2735, 2738, 2741, 2743, 2746, 2749, 2752, 2755,
+	2759, 2762, 2765, 2768, 2771, 2775, 2778, 2781,
+	2785, 2788, 2791, 2795, 2798, 2802, 2806, 2809,
+	2813, 2817, 2820, 2824, 2828, 2832, 2836, 2839,
+	2843, 2847, 2851, 2855, 2859, 2864, 2868, 2872,
+	2876, 2880, 2885, 2889, 2893, 2898, 2902, 2907,
+	2911, 2916, 2920, 2925, 2929, 2934, 2939, 2943,
+	2948, 2953, 2958, 2963, 2968, 2973, 2978, 2983,
+	2988, 2993, 2998, 3003, 3008, 3013, 3019, 3024,
+	3029, 3035, 3040, 3046, 3051, 3056, 3062, 3068,
+	3073, 3079, 3084, 3090, 3096, 3102, 3107, 3113,
+	3119, 3125, 3131, 3137, 3143, 3149, 3155, 3161,
+	3167, 3174, 3180, 3186, 3192, 3199, 3205, 3211,
+	3218, 3224, 3231, 3237, 3244, 3251, 3257, 3264,
+	3270, 3277, 3284, 3291, 3298, 3304, 3311, 3318,
+	3325, 3332, 3339, 3346, 3353, 3361, 3368, 3375,
+	3382, 3389, 3397, 3404, 3411, 3419, 3426, 3434,
+	3441, 3449, 3456, 3464, 3472, 3479, 3487, 3495,
+	3503, 3510, 3518, 3526, 3534, 3542, 3550, 3558,
+	3566, 3574, 3582, 3590, 3598, 3607, 3615, 3623,
+	3631, 3640, 3648, 3657, 3665, 3673, 3682, 3691,
+	3699, 3708, 3716, 3725, 3734, 3742, 3751, 3760,
+	3769, 3778, 3787, 3796, 3804, 3813, 3823, 3832,
+	3841, 3850, 3859, 3868, 3877, 3887, 3896, 3905,
+	3915, 3924, 3933, 3943, 3952, 3962, 3971, 3981,
+	3991, 4000, 4010, 4020, 4029, 4039, 4049, 4059,
+	4069, 4079, 4088, 4098, 4108, 4118, 4129, 4139,
+	4149, 4159, 4169, 4179, 4190, 4200, 4210, 4221,
+	4231, 4241, 4252, 4262, 4273, 4283, 4294, 4304,
+	4315, 4326, 4336, 4347, 4358, 4369, 4380, 4390,
+	4401, 4412, 4423, 4434, 4445, 4456, 4467, 4478,
+	4489, 4501, 4512, 4523, 4534, 4546, 4557, 4568,
+	4580, 4591, 4603, 4614, 4625, 4637, 4649, 4660,
+	4672, 4683, 4695, 4707, 4719, 4730, 4742, 4754,
+	4766, 4778, 4790, 4802, 4814, 4826, 4838, 4850,
+	4862, 4874, 4886, 4899, 4911, 4923, 4935, 4948,
+	4960, 4972, 4985, 4997, 5010, 5022, 5035, 5047,
+	5060, 5073, 5085, 5098, 5111, 5123, 5136, 5149,
+	5162, 5175, 5187, 5200, 5213, 5226, 5239, 5252,
+	5265, 5279, 5292, 5305, 5318, 5331, 5344, 5358,
+	5371, 5384, 5398, 5411, 5425, 5438, 5451, 5465,
+	5478, 5492, 5506, 5519, 5533, 5547, 5560, 5574,
+	5588, 5602, 5615, 5629, 5643, 5657, 5671, 5685,
+	5699, 5713, 5727, 5741, 5755, 5769, 5783, 5798,
+	5812, 5826, 5840, 5855, 5869, 5883, 5898, 5912,
+	5926, 5941, 5955, 5970, 5984, 5999, 6014, 6028,
+	6043, 6058, 6072, 6087, 6102, 6117, 6131, 6146,
+	6161, 6176, 6191, 6206, 6221, 6236, 6251, 6266,
+	6281, 6296, 6311, 6327, 6342, 6357, 6372, 6387,
+	6403, 6418, 6433, 6449, 6464, 6480, 6495, 6511,
+	6526, 6542, 6557, 6573, 6588, 6604, 6620, 6635,
+	6651, 6667, 6683, 6699, 6714, 6730, 6746, 6762,
+	6778, 6794, 6810, 6826, 6842, 6858, 6874, 6890,
+	6906, 6922, 6939, 6955, 6971, 6987, 7004, 7020,
+	7036, 7053, 7069, 7085, 7102, 7118, 7135, 7151,
+	7168, 7184, 7201, 7218, 7234, 7251, 7268, 7284,
+	7301, 7318, 7335, 7351, 7368, 7385, 7402, 7419,
+	7436, 7453, 7470, 7487, 7504, 7521, 7538, 7555,
+	7572, 7589, 7606, 7624, 7641, 7658, 7675, 7693,
+	7710, 7727, 7745, 7762, 7779, 7797, 7814, 7832,
+	7849, 7867, 7884, 7902, 7919, 7937, 7955, 7972,
+	7990, 8008, 8025, 8043, 8061, 8079, 8097, 8114,
+	8132, 8150, 8168, 8186, 8204, 8222, 8240, 8258,
+	8276, 8294, 8312, 8330, 8348, 8367, 8385, 8403,
+	8421, 8439, 8458, 8476, 8494, 8513, 8531, 8549,
+	8568, 8586, 8605, 8623, 8641, 8660, 8678, 8697,
+	8716, 8734, 8753, 8771, 8790, 8809, 8827, 8846,
+	8865, 8884, 8902, 8921, 8940, 8959, 8978, 8997,
+	9015, 9034, 9053, 9072, 9091, 9110, 9129, 9148,
+	9167, 9186, 9205, 9225, 9244, 9263, 9282, 9301,
+	9320, 9340, 9359, 9378, 9398, 9417, 9436, 9456,
+	9475, 9494, 9514, 9533, 9553, 9572, 9592, 9611,
+	9631, 9650, 9670, 9689, 9709, 9728, 9748, 9768,
+	9787, 9807, 9827, 9847, 9866, 9886, 9906, 9926,
+	9946, 9965, 9985, 10005, 10025, 10045, 10065, 10085,
+	10105, 10125, 10145, 10165, 10185, 10205, 10225, 10245,
+	10265, 10285, 10305, 10326, 10346, 10366, 10386, 10406,
+	10427, 10447, 10467, 10487, 10508, 10528, 10548, 10569,
+	10589, 10610, 10630, 10650, 10671, 10691, 10712, 10732,
+	10753, 10773, 10794, 10815, 10835, 10856, 10876, 10897,
+	10918, 10938, 10959, 10980, 11000, 11021, 11042, 11063,
+	11083, 11104, 11125, 11146, 11167, 11187, 11208, 11229,
+	11250, 11271, 11292, 11313, 11334, 11355, 11376, 11397,
+	11418, 11439, 11460, 11481, 11502, 11523, 11544, 11565,
+	11586, 11608, 11629, 11650, 11671, 11692, 11713, 11735,
+	11756, 11777, 11798, 11820, 11841, 11862, 11884, 11905,
+	11926, 11948, 11969, 11991, 12012, 12033, 12055, 12076,
+	12098, 12119, 12141, 12162, 12184, 12205, 12227, 12248,
+	12270, 12292, 12313, 12335, 12356, 12378, 12400, 12421,
+	12443, 12465, 12486, 12508, 12530, 12551, 12573, 12595,
+	12617, 12638, 12660, 12682, 12704, 12726, 12748, 12769,
+	12791, 12813, 12835, 12857, 12879, 12901, 12923, 12945,
+	12967, 12988, 13010, 13032, 13054, 13076, 13098, 13120,
+	13142, 13165, 13187, 13209, 13231, 13253, 13275, 13297,
+	13319, 13341, 13363, 13386, 13408, 13430, 13452, 13474,
+	13497, 13519, 13541, 13563, 13585, 13608, 13630, 13652,
+	13674, 13697, 13719, 13741, 13764, 13786, 13808, 13831,
+	13853, 13875, 13898, 13920, 13943, 13965, 13987, 14010,
+	14032, 14055, 14077, 14100, 14122, 14144, 14167, 14189,
+	14212, 14234, 14257, 14279, 14302, 14324, 14347, 14370,
+	14392, 14415, 14437, 14460, 14482, 14505, 14528, 14550,
+	14573, 14595, 14618, 14641, 14663, 14686, 14709, 14731,
+	14754, 14777, 14799, 14822, 14845, 14868, 14890, 14913,
+	14936, 14958, 14981, 15004, 15027, 15049, 15072, 15095,
+	15118, 15141, 15163, 15186, 15209, 15232, 15255, 15277,
+	15300, 15323, 15346, 15369, 15392, 15414, 15437, 15460,
+	15483, 15506, 15529, 15552, 15575, 15597, 15620, 15643,
+	15666, 15689, 15712, 15735, 15758, 15781, 15804, 15827,
+	15850, 15873, 15895, 15918, 15941, 15964, 15987, 16010,
+	16033, 16056, 16079, 16102, 16125, 16148, 16171, 16194,
+	16217, 16240, 16263, 16286, 16309, 16332, 16355, 16378,
+	16401, 16425, 16448, 16471, 16494, 16517, 16540, 16563,
+	16586, 16609, 16632, 16655, 16678, 16701, 16724, 16747,
+	16770, 16793, 16817, 16840, 16863, 16886, 16909, 16932,
+	16955, 16978, 17001, 17024, 17047, 17071, 17094, 17117,
+	17140, 17163, 17186, 17209, 17232, 17255, 17279, 17302,
+	17325, 17348, 17371, 17394, 17417, 17440, 17464, 17487,
+	17510, 17533, 17556, 17579, 17602, 17625, 17648, 17672,
+	17695, 17718, 17741, 17764, 17787, 17810, 17833, 17857,
+	17880, 17903, 17926, 17949, 17972, 17995, 18018, 18042,
+	18065, 18088, 18111, 18134, 18157, 18180, 18203, 18226,
+	18250, 18273, 18296, 18319, 18342, 18365, 18388, 18411,
+	18434, 18457, 18481, 18504, 18527, 18550, 18573, 18596,
+	18619, 18642, 18665, 18688, 18711, 18734, 18757, 18781,
+	18804, 18827, 18850, 18873, 18896, 18919, 18942, 18965,
+	18988, 19011, 19034, 19057, 19080, 19103, 19126, 19149,
+	19172, 19195, 19218, 19241, 19264, 19287, 19310, 19333,
+	19356, 19379, 19402, 19425, 19448, 19471, 19494, 19517,
+	19540, 19563, 19586, 19609, 19632, 19655, 19677, 19700,
+	19723, 19746, 19769, 19792, 19815, 19838, 19861, 19884,
+	19906, 19929, 19952, 19975, 19998, 20021, 20044, 20066,
+	20089, 20112, 20135, 20158, 20181, 20203, 20226, 20249,
+	20272, 20294, 20317, 20340, 20363, 20386, 20408, 20431,
+	20454, 20476, 20499, 20522, 20545, 20567, 20590, 20613,
+	20635, 20658, 20681, 20703, 20726, 20749, 20771, 20794,
+	20817, 20839, 20862, 20884, 20907, 20930, 20952, 20975,
+	20997, 21020, 21042, 21065, 21087, 21110, 21133, 21155,
+	21178, 21200, 21222, 21245, 21267, 21290, 21312, 21335,
+	21357, 21380, 21402, 21424, 21447, 21469, 21492, 21514,
+	21536, 21559, 21581, 21603, 21626, 21648, 21670, 21693,
+	21715, 21737, 21760, 21782, 21804, 21826, 21848, 21871,
+	21893, 21915, 21937, 21960, 21982, 22004, 22026, 22048,
+	22070, 22092, 22114, 22137, 22159, 22181, 22203, 22225,
+	22247, 22269, 22291, 22313, 22335, 22357, 22379, 22401,
+	22423, 22445, 22467, 22489, 22511, 22533, 22554, 22576,
+	22598, 22620, 22642, 22664, 22686, 22707, 22729, 22751,
+	22773, 22795, 22816, 22838, 22860, 22881, 22903, 22925,
+	22947, 22968, 22990, 23011, 23033, 23055, 23076, 23098,
+	23120, 23141, 23163, 23184, 23206, 23227, 23249, 23270,
+	23292, 23313, 23335, 23356, 23377, 23399, 23420, 23442,
+	23463, 23484, 23506, 23527, 23548, 23570, 23591, 23612,
+	23633, 23655, 23676, 23697, 23718, 23740, 23761, 23782,
+	23803, 23824, 23845, 23866, 23887, 23909, 23930, 23951,
+	23972, 23993, 24014, 24035, 24056, 24077, 24098, 24118,
+	24139, 24160, 24181, 24202, 24223, 24244, 24265, 24285,
+	24306, 24327, 24348, 24368, 24389, 24410, 24430, 24451,
+	24472, 24492, 24513, 24534, 24554, 24575, 24595, 24616,
+	24637, 24657, 24678, 24698, 24719, 24739, 24759, 24780,
+	24800, 24821, 24841, 24861, 24882, 24902, 24922, 24943,
+	24963, 24983, 25003, 25024, 25044, 25064, 25084, 25104,
+	25124, 25144, 25165, 25185, 25205, 25225, 25245, 25265,
+	25285, 25305, 25325, 25345, 25364, 25384, 25404, 25424,
+	25444, 25464, 25484, 25503, 25523, 25543, 25563, 25582,
+	25602, 25622, 25641, 25661, 25681, 25700, 25720, 25739,
+	25759, 25778, 25798, 25817, 25837, 25856, 25876, 25895,
+	25915, 25934, 25953, 25973, 25992, 26011, 26030, 26050,
+	26069, 26088, 26107, 26127, 26146, 26165, 26184, 26203,
+	26222, 26241, 26260, 26279, 26298, 26317, 26336, 26355,
+	26374, 26393, 26412, 26431, 26449, 26468, 26487, 26506,
+	26525, 26543, 26562, 26581, 26599, 26618, 26637, 26655,
+	26674, 26692, 26711, 26729, 26748, 26766, 26785, 26803,
+	26822, 26840, 26859, 26877, 26895, 26913, 26932, 26950,
+	26968, 26986, 27005, 27023, 27041, 27059, 27077, 27095,
+	27113, 27131, 27149, 27167, 27185, 27203, 27221, 27239,
+	27257, 27275, 27293, 27311, 27328, 27346, 27364, 27382,
+	27399, 27417, 27435, 27452, 27470, 27488, 27505, 27523,
+	27540, 27558, 27575, 27593, 27610, 27627, 27645, 27662,
+	27679, 27697, 27714, 27731, 27749, 27766, 27783, 27800,
+	27817, 27834, 27852, 27869, 27886, 27903, 27920, 27937,
+	27954, 27971, 27987, 28004, 28021, 28038, 28055, 28072,
+	28088, 28105, 28122, 28138, 28155, 28172, 28188, 28205,
+	28222, 28238, 28255, 28271, 28288, 28304, 28320, 28337,
+	28353, 28369, 28386, 28402, 28418, 28435, 28451, 28467,
+	28483, 28499, 28515, 28531, 28548, 28564, 28580, 28596,
+	28611, 28627, 28643, 28659, 28675, 28691, 28707, 28722,
+	28738, 28754, 28770, 28785, 28801, 28817, 28832, 28848,
+	28863, 28879, 28894, 28910, 28925, 28941, 28956, 28971,
+	28987, 29002, 29017, 29032, 29048, 29063, 29078, 29093,
+	29108, 29123, 29138, 29154, 29169, 29184, 29198, 29213,
+	29228, 29243, 29258, 29273, 29288, 29302, 29317, 29332,
+	29347, 29361, 29376, 29390, 29405, 29420, 29434, 29449,
+	29463, 29477, 29492, 29506, 29521, 29535, 29549, 29563,
+	29578, 29592, 29606, 29620, 29634, 29648, 29663, 29677,
+	29691, 29705, 29719, 29732, 29746, 29760, 29774, 29788,
+	29802, 29815, 29829, 29843, 29857, 29870, 29884, 29897,
+	29911, 29924, 29938, 29951, 29965, 29978, 29992, 30005,
+	30018, 30032, 30045, 30058, 30071, 30085, 30098, 30111,
+	30124, 30137, 30150, 30163, 30176, 30189, 30202, 30215,
+	30228, 30241, 30253, 30266, 30279, 30292, 30304, 30317,
+	30330, 30342, 30355, 30367, 30380, 30392, 30405, 30417,
+	30429, 30442, 30454, 30466, 30479, 30491, 30503, 30515,
+	30527, 30540, 30552, 30564, 30576, 30588, 30600, 30612,
+	30624, 30635, 30647, 30659, 30671, 30683, 30694, 30706,
+	30718, 30729, 30741, 30752, 30764, 30775, 30787, 30798,
+	30810, 30821, 30833, 30844, 30855, 30866, 30878, 30889,
+	30900, 30911, 30922, 30933, 30944, 30955, 30966, 30977,
+	30988, 30999, 31010, 31021, 31032, 31042, 31053, 31064,
+	31074, 31085, 31096, 31106, 31117, 31127, 31138, 31148,
+	31159, 31169, 31179, 31190, 31200, 31210, 31220, 31231,
+	31241, 31251, 31261, 31271, 31281, 31291, 31301, 31311,
+	31321, 31331, 31341, 31350, 31360, 31370, 31380, 31389,
+	31399, 31408, 31418, 31428, 31437, 31447, 31456, 31465,
+	31475, 31484, 31494, 31503, 31512, 31521, 31530, 31540,
+	31549, 31558, 31567, 31576, 31585, 31594, 31603, 31612,
+	31621, 31629, 31638, 31647, 31656, 31664, 31673, 31682,
+	31690, 31699, 31707, 31716, 31724, 31733, 31741, 31750,
+	31758, 31766, 31775, 31783, 31791, 31799, 31807, 31815,
+	31823, 31832, 31840, 31848, 31855, 31863, 31871, 31879,
+	31887, 31895, 31902, 31910, 31918, 31925, 31933, 31941,
+	31948, 31956, 31963, 31971, 31978, 31985, 31993, 32000,
+	32007, 32014, 32022, 32029, 32036, 32043, 32050, 32057,
+	32064, 32071, 32078, 32085, 32092, 32099, 32105, 32112,
+	32119, 32126, 32132, 32139, 32146, 32152, 32159, 32165,
+	32172, 32178, 32184, 32191, 32197, 32203, 32210, 32216,
+	32222, 32228, 32234, 32240, 32246, 32252, 32258, 32264,
+	32270, 32276, 32282, 32288, 32294, 32299, 32305, 32311,
+	32316, 32322, 32327, 32333, 32338, 32344, 32349, 32355,
+	32360, 32365, 32371, 32376, 32381, 32386, 32392, 32397,
+	32402, 32407, 32412, 32417, 32422, 32427, 32432, 32436,
+	32441, 32446, 32451, 32455, 32460, 32465, 32469, 32474,
+	32478, 32483, 32487, 32492, 32496, 32500, 32505, 32509,
+	32513, 32518, 32522, 32526, 32530, 32534, 32538, 32542,
+	32546, 32550, 32554, 32558, 32562, 32565, 32569, 32573,
+	32577, 32580, 32584, 32587, 32591, 32595, 32598, 32601,
+	32605, 32608, 32612, 32615, 32618, 32621, 32625, 32628,
+	32631, 32634, 32637, 32640, 32643, 32646, 32649, 32652,
+	32655, 32657, 32660, 32663, 32666, 32668, 32671, 32674,
+	32676, 32679, 32681, 32684, 32686, 32688, 32691, 32693,
+	32695, 32698, 32700, 32702, 32704, 32706, 32708, 32710,
+	32712, 32714, 32716, 32718, 32720, 32722, 32724, 32725,
+	32727, 32729, 32730, 32732, 32734, 32735, 32737, 32738,
+	32740, 32741, 32742, 32744, 32745, 32746, 32748, 32749,
+	32750, 32751, 32752, 32753, 32754, 32755, 32756, 32757,
+	32758, 32759, 32759, 32760, 32761, 32762, 32762, 32763,
+	32763, 32764, 32765, 32765, 32765, 32766, 32766, 32767,
+	32767, 32767, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767,
+};
+
+static const float32_t win_hamming_bias[WINDOW_BIAS_LEN] = {
+	0.000000000e+00f, 4.312088447e-03f, 8.624143599e-03f, 1.293613216e-02f,
+	1.724802082e-02f, 2.155977630e-02f, 2.587136527e-02f, 3.018275443e-02f,
+	3.449391045e-02f, 3.880480002e-02f, 4.311538980e-02f, 4.742564645e-02f,
+	5.173553661e-02f, 5.604502692e-02f, 6.035408399e-02f, 6.466267444e-02f,
+	6.897076486e-02f, 7.327832182e-02f, 7.758531189e-02f, 8.189170161e-02f,
+	8.619745751e-02f, 9.050254607e-02f, 9.480693380e-02f, 9.911058714e-02f,
+	1.034134725e-01f, 1.077155564e-01f, 1.120168051e-01f, 1.163171850e-01f,
+	1.206166625e-01f, 1.249152038e-01f, 1.292127752e-01f, 1.335093430e-01f,
+	1.378048733e-01f, 1.420993324e-01f, 1.463926864e-01f, 1.506849015e-01f,
+	1.549759435e-01f, 1.592657787e-01f, 1.635543730e-01f, 1.678416923e-01f,
+	1.721277027e-01f, 1.764123698e-01f, 1.806956597e-01f, 1.849775380e-01f,
+	1.892579705e-01f, 1.935369229e-01f, 1.978143609e-01f, 2.020902500e-01f,
+	2.063645558e-01f, 2.106372438e-01f, 2.149082794e-01f, 2.191776281e-01f,
+	2.234452551e-01f, 2.277111258e-01f, 2.319752054e-01f, 2.362374590e-01f,
+	2.404978518e-01f, 2.447563488e-01f, 2.490129150e-01f, 2.532675153e-01f,
+	2.575201146e-01f, 2.617706777e-01f, 2.660191693e-01f, 2.702655541e-01f,
+	2.745097967e-01f,
+};
+
+static const float32_t win_blackman_half[WINDOW_HALF_LEN] = {
+	4.900000000e-03f, 4.900212567e-03f, 4.900850271e-03f, 4.901913118e-03f,
+	4.903401118e-03f, 4.905314287e-03f, 4.907652643e-03f, 4.910416211e-03f,
+	4.913605017e-03f, 4.917219094e-03f, 4.921258479e-03f, 4.925723210e-03f,
+	4.930613335e-03f, 4.935928900e-03f, 4.941669960e-03f, 4.947836572e-03f,
+	4.954428798e-03f, 4.961446704e-03f, 4.968890361e-03f, 4.976759842e-03f,
+	4.985055226e-03f, 4.993776598e-03f, 5.002924043e-03f, 5.012497654e-03f,
+	5.022497526e-03f, 5.032923760e-03f, 5.043776459e-03f, 5.055055733e-03f,
+	5.066761694e-03f, 5.078894459e-03f, 5.091454149e-03f, 5.104440890e-03f,
+	5.117854812e-03f, 5.131696049e-03f, 5.145964738e-03f, 5.160661023e-03f,
+	5.175785049e-03f, 5.191336969e-03f, 5.207316937e-03f, 5.223725112e-03f,
+	5.240561657e-03f, 5.257826742e-03f, 5.275520538e-03f, 5.293643220e-03f,
+	5.312194970e-03f, 5.331175972e-03f, 5.350586414e-03f, 5.370426491e-03f,
+	5.390696399e-03f, 5.411396339e-03f, 5.432526518e-03f, 5.454087145e-03f,
+	5.476078434e-03f, 5.498500604e-03f, 5.521353876e-03f, 5.544638477e-03f,
+	5.568354639e-03f, 5.592502595e-03f, 5.617082585e-03f, 5.642094853e-03f,
+	5.667539646e-03f, 5.693417215e-03f, 5.719727816e-03f, 5.746471709e-03f,
+	5.773649158e-03f, 5.801260431e-03f, 5.829305801e-03f, 5.857785543e-03f,
+	5.886699940e-03f, 5.916049274e-03f, 5.945833836e-03f, 5.976053918e-03f,
+	6.006709817e-03f, 6.037801835e-03f, 6.069330276e-03f, 6.101295451e-03f,
+	6.133697672e-03f, 6.166537258e-03f, 6.199814529e-03f, 6.233529813e-03f,
+	6.267683438e-03f, 6.302275740e-03f, 6.337307055e-03f, 6.372777725e-03f,
+	6.408688098e-03f, 6.445038523e-03f, 6.481829355e-03f, 6.519060951e-03f,
+	6.556733675e-03f, 6.594847893e-03f, 6.633403974e-03f, 6.672402295e-03f,
+	6.711843232e-03f, 6.751727169e-03f, 6.792054492e-03f, 6.832825592e-03f,
+	6.874040864e-03f, 6.915700705e-03f, 6.957805518e-03f, 7.000355711e-03f,
+	7.043351692e-03f, 7.086793878e-03f, 7.130682686e-03f, 7.175018538e-03f,
+	7.219801862e-03f, 7.265033087e-03f, 7.310712648e-03f, 7.356840982e-03f,
+	7.403418533e-03f, 7.450445745e-03f, 7.497923069e-03f, 7.545850959e-03f,
+	7.594229873e-03f, 7.643060272e-03f, 7.692342622e-03f, 7.742077393e-03f,
+	7.792265057e-03f, 7.842906092e-03f, 7.894000979e-03f, 7.945550203e-03f,
+	7.997554252e-03f, 8.050013620e-03f, 8.102928804e-03f, 8.156300302e-03f,
+	8.210128620e-03f, 8.264414265e-03f, 8.319157749e-03f, 8.374359588e-03f,
+	8.430020301e-03f, 8.486140411e-03f, 8.542720446e-03f, 8.599760935e-03f,
+	8.657262414e-03f, 8.715225421e-03f, 8.773650497e-03f, 8.832538189e-03f,
+	8.891889045e-03f, 8.951703620e-03f, 9.011982470e-03f, 9.072726155e-03f,
+	9.133935241e-03f, 9.195610295e-03f, 9.257751888e-03f, 9.320360597e-03f,
+	9.383437001e-03f, 9.446981681e-03f, 9.510995225e-03f, 9.575478222e-03f,
+	9.640431267e-03f, 9.705854957e-03f, 9.771749892e-03f, 9.838116677e-03f,
+	9.904955921e-03f, 9.972268235e-03f, 1.004005423e-02f, 1.010831454e-02f,
+	1.017704977e-02f, 1.024626055e-02f, 1.031594752e-02f, 1.038611130e-02f,
+	1.045675253e-02f, 1.052787186e-02f, 1.059946993e-02f, 1.067154737e-02f,
+	1.074410486e-02f, 1.081714303e-02f, 1.089066254e-02f, 1.096466407e-02f,
+	1.103914827e-02f, 1.111411581e-02f, 1.118956736e-02f, 1.126550359e-02f,
+	1.134192520e-02f, 1.141883285e-02f, 1.149622723e-02f, 1.157410903e-02f,
+	1.165247895e-02f, 1.173133767e-02f, 1.181068591e-02f, 1.189052435e-02f,
+	1.197085370e-02f, 1.205167468e-02f, 1.213298800e-02f, 1.221479437e-02f,
+	1.229709450e-02f, 1.237988913e-02f, 1.246317898e-02f, 1.254696477e-02f,
+	1.263124724e-02f, 1.271602712e-02f, 1.280130515e-02f, 1.288708208e-02f,
+	1.297335864e-02f, 1.306013559e-02f, 1.314741368e-02f, 1.323519365e-02f,
+	1.332347628e-02f, 1.341226231e-02f, 1.350155252e-02f, 1.359134766e-02f,
+	1.368164852e-02f, 1.377245586e-02f, 1.386377046e-02f, 1.395559310e-02f,
+	1.404792456e-02f, 1.414076563e-02f, 1.423411710e-02f, 1.432797975e-02f,
+	1.442235439e-02f, 1.451724181e-02f, 1.461264281e-02f, 1.470855819e-02f,
+	1.480498877e-02f, 1.490193535e-02f, 1.499939875e-02f, 1.509737978e-02f,
+	1.519587925e-02f, 1.529489800e-02f, 1.539443685e-02f, 1.549449662e-02f,
+	1.559507814e-02f, 1.569618225e-02f, 1.579780978e-02f, 1.589996158e-02f,
+	1.600263848e-02f, 1.610584134e-02f, 1.620957098e-02f, 1.631382828e-02f,
+	1.641861408e-02f, 1.652392923e-02f, 1.662977460e-02f, 1.673615105e-02f,
+	1.684305944e-02f, 1.695050064e-02f, 1.705847552e-02f, 1.716698495e-02f,
+	1.727602980e-02f, 1.738561096e-02f, 1.749572931e-02f, 1.760638572e-02f,
+	1.771758109e-02f, 1.782931630e-02f, 1.794159225e-02f, 1.805440982e-02f,
+	1.816776992e-02f, 1.828167344e-02f, 1.839612128e-02f, 1.851111436e-02f,
+	1.862665357e-02f, 1.874273983e-02f, 1.885937404e-02f, 1.897655713e-02f,
+	1.909429000e-02f, 1.921257358e-02f, 1.933140880e-02f, 1.945079656e-02f,
+	1.957073780e-02f, 1.969123346e-02f, 1.981228445e-02f, 1.993389172e-02f,
+	2.005605620e-02f, 2.017877883e-02f, 2.030206056e-02f, 2.042590231e-02f,
+	2.055030505e-02f, 2.067526971e-02f, 2.080079725e-02f, 2.092688862e-02f,
+	2.105354478e-02f, 2.118076668e-02f, 2.130855529e-02f, 2.143691156e-02f,
+	2.156583645e-02f, 2.169533094e-02f, 2.182539600e-02f, 2.195603258e-02f,
+	2.208724168e-02f, 2.221902425e-02f, 2.235138128e-02f, 2.248431375e-02f,
+	2.261782263e-02f, 2.275190892e-02f, 2.288657359e-02f, 2.302181764e-02f,
+	2.315764205e-02f, 2.329404781e-02f, 2.343103592e-02f, 2.356860738e-02f,
+	2.370676318e-02f, 2.384550432e-02f, 2.398483180e-02f, 2.412474662e-02f,
+	2.426524980e-02f, 2.440634234e-02f, 2.454802524e-02f, 2.469029953e-02f,
+	2.483316620e-02f, 2.497662628e-02f, 2.512068078e-02f, 2.526533073e-02f,
+	2.541057713e-02f, 2.555642102e-02f, 2.570286342e-02f, 2.584990535e-02f,
+	2.599754784e-02f, 2.614579192e-02f, 2.629463862e-02f, 2.644408898e-02f,
+	2.659414402e-02f, 2.674480478e-02f, 2.689607230e-02f, 2.704794763e-02f,
+	2.720043179e-02f, 2.735352584e-02f, 2.750723081e-02f, 2.766154776e-02f,
+	2.781647773e-02f, 2.797202176e-02f, 2.812818091e-02f, 2.828495624e-02f,
+	2.844234878e-02f, 2.860035961e-02f, 2.875898977e-02f, 2.891824032e-02f,
+	2.907811232e-02f, 2.923860684e-02f, 2.939972493e-02f, 2.956146765e-02f,
+	2.972383608e-02f, 2.988683128e-02f, 3.005045431e-02f, 3.021470624e-02f,
+	3.037958815e-02f, 3.054510110e-02f, 3.071124618e-02f, 3.087802444e-02f,
+	3.104543697e-02f, 3.121348484e-02f, 3.138216914e-02f, 3.155149093e-02f,
+	3.172145130e-02f, 3.189205134e-02f, 3.206329211e-02f, 3.223517471e-02f,
+	3.240770023e-02f, 3.258086973e-02f, 3.275468432e-02f, 3.292914508e-02f,
+	3.310425310e-02f, 3.328000947e-02f, 3.345641528e-02f, 3.363347162e-02f,
+	3.381117959e-02f, 3.398954027e-02f, 3.416855476e-02f, 3.434822416e-02f,
+	3.452854957e-02f, 3.470953208e-02f, 3.489117279e-02f, 3.507347280e-02f,
+	3.525643321e-02f, 3.544005511e-02f, 3.562433962e-02f, 3.580928784e-02f,
+	3.599490086e-02f, 3.618117979e-02f, 3.636812574e-02f, 3.655573981e-02f,
+	3.674402311e-02f, 3.693297674e-02f, 3.712260182e-02f, 3.731289944e-02f,
+	3.750387073e-02f, 3.769551678e-02f, 3.788783871e-02f, 3.808083763e-02f,
+	3.827451465e-02f, 3.846887088e-02f, 3.866390743e-02f, 3.885962542e-02f,
+	3.905602596e-02f, 3.925311017e-02f, 3.945087915e-02f, 3.964933403e-02f,
+	3.984847591e-02f, 4.004830592e-02f, 4.024882516e-02f, 4.045003476e-02f,
+	4.065193584e-02f, 4.085452950e-02f, 4.105781687e-02f, 4.126179906e-02f,
+	4.146647719e-02f, 4.167185239e-02f, 4.187792576e-02f, 4.208469843e-02f,
+	4.229217152e-02f, 4.250034614e-02f, 4.270922341e-02f, 4.291880446e-02f,
+	4.312909040e-02f, 4.334008236e-02f, 4.355178145e-02f, 4.376418879e-02f,
+	4.397730550e-02f, 4.419113271e-02f, 4.440567153e-02f, 4.462092308e-02f,
+	4.483688848e-02f, 4.505356886e-02f, 4.527096533e-02f, 4.548907902e-02f,
+	4.570791104e-02f, 4.592746251e-02f, 4.614773456e-02f, 4.636872829e-02f,
+	4.659044484e-02f, 4.681288533e-02f, 4.703605086e-02f, 4.725994256e-02f,
+	4.748456155e-02f, 4.770990895e-02f, 4.793598587e-02f, 4.816279343e-02f,
+	4.839033276e-02f, 4.861860496e-02f, 4.884761116e-02f, 4.907735248e-02f,
+	4.930783002e-02f, 4.953904490e-02f, 4.977099825e-02f, 5.000369117e-02f,
+	5.023712479e-02f, 5.047130020e-02f, 5.070621854e-02f, 5.094188091e-02f,
+	5.117828842e-02f, 5.141544219e-02f, 5.165334334e-02f, 5.189199296e-02f,
+	5.213139217e-02f, 5.237154208e-02f, 5.261244381e-02f, 5.285409845e-02f,
+	5.309650713e-02f, 5.333967093e-02f, 5.358359099e-02f, 5.382826839e-02f,
+	5.407370424e-02f, 5.431989965e-02f, 5.456685573e-02f, 5.481457357e-02f,
+	5.506305428e-02f, 5.531229896e-02f, 5.556230871e-02f, 5.581308463e-02f,
+	5.606462782e-02f, 5.631693937e-02f, 5.657002040e-02f, 5.682387198e-02f,
+	5.707849522e-02f, 5.733389121e-02f, 5.759006104e-02f, 5.784700581e-02f,
+	5.810472661e-02f, 5.836322452e-02f, 5.862250065e-02f, 5.888255606e-02f,
+	5.914339186e-02f, 5.940500913e-02f, 5.966740896e-02f, 5.993059241e-02f,
+	6.019456059e-02f, 6.045931457e-02f, 6.072485544e-02f, 6.099118426e-02f,
+	6.125830212e-02f, 6.152621009e-02f, 6.179490925e-02f, 6.206440068e-02f,
+	6.233468544e-02f, 6.260576460e-02f, 6.287763925e-02f, 6.315031044e-02f,
+	6.342377924e-02f, 6.369804672e-02f, 6.397311394e-02f, 6.424898197e-02f,
+	6.452565186e-02f, 6.480312468e-02f, 6.508140148e-02f, 6.536048332e-02f,
+	6.564037126e-02f, 6.592106635e-02f, 6.620256965e-02f, 6.648488219e-02f,
+	6.676800504e-02f, 6.705193923e-02f, 6.733668582e-02f, 6.762224585e-02f,
+	6.790862037e-02f, 6.819581040e-02f, 6.848381699e-02f, 6.877264118e-02f,
+	6.906228400e-02f, 6.935274649e-02f, 6.964402968e-02f, 6.993613460e-02f,
+	7.022906227e-02f, 7.052281373e-02f, 7.081738999e-02f, 7.111279208e-02f,
+	7.140902102e-02f, 7.170607783e-02f, 7.200396353e-02f, 7.230267912e-02f,
+	7.260222563e-02f, 7.290260407e-02f, 7.320381543e-02f, 7.350586073e-02f,
+	7.380874098e-02f, 7.411245718e-02f, 7.441701032e-02f, 7.472240141e-02f,
+	7.502863143e-02f, 7.533570140e-02f, 7.564361229e-02f, 7.595236509e-02f,
+	7.626196081e-02f, 7.657240041e-02f, 7.688368488e-02f, 7.719581521e-02f,
+	7.750879237e-02f, 7.782261734e-02f, 7.813729109e-02f, 7.845281459e-02f,
+	7.876918882e-02f, 7.908641473e-02f, 7.940449330e-02f, 7.972342549e-02f,
+	8.004321225e-02f, 8.036385455e-02f, 8.068535333e-02f, 8.100770955e-02f,
+	8.133092416e-02f, 8.165499811e-02f, 8.197993233e-02f, 8.230572778e-02f,
+	8.263238540e-02f, 8.295990611e-02f, 8.328829085e-02f, 8.361754057e-02f,
+	8.394765617e-02f, 8.427863860e-02f, 8.461048877e-02f, 8.494320760e-02f,
+	8.527679602e-02f, 8.561125494e-02f, 8.594658527e-02f, 8.628278792e-02f,
+	8.661986380e-02f, 8.695781382e-02f, 8.729663886e-02f, 8.763633985e-02f,
+	8.797691766e-02f, 8.831837319e-02f, 8.866070733e-02f, 8.900392098e-02f,
+	8.934801501e-02f, 8.969299030e-02f, 9.003884774e-02f, 9.038558819e-02f,
+	9.073321253e-02f, 9.108172164e-02f, 9.143111637e-02f, 9.178139759e-02f,
+	9.213256615e-02f, 9.248462293e-02f, 9.283756876e-02f, 9.319140450e-02f,
+	9.354613101e-02f, 9.390174911e-02f, 9.425825966e-02f, 9.461566349e-02f,
+	9.497396143e-02f, 9.533315432e-02f, 9.569324299e-02f, 9.605422826e-02f,
+	9.641611095e-02f, 9.677889188e-02f, 9.714257187e-02f, 9.750715172e-02f,
+	9.787263225e-02f, 9.823901427e-02f, 9.860629856e-02f, 9.897448593e-02f,
+	9.934357718e-02f, 9.971357310e-02f, 1.000844745e-01f, 1.004562821e-01f,
+	1.008289967e-01f, 1.012026191e-01f, 1.015771501e-01f, 1.019525905e-01f,
+	1.023289409e-01f, 1.027062022e-01f, 1.030843751e-01f, 1.034634605e-01f,
+	1.038434589e-01f, 1.042243713e-01f, 1.046061982e-01f, 1.049889406e-01f,
+	1.053725990e-01f, 1.057571743e-01f, 1.061426672e-01f, 1.065290784e-01f,
+	1.069164085e-01f, 1.073046585e-01f, 1.076938288e-01f, 1.080839204e-01f,
+	1.084749338e-01f, 1.088668698e-01f, 1.092597291e-01f, 1.096535123e-01f,
+	1.100482202e-01f, 1.104438534e-01f, 1.108404127e-01f, 1.112378987e-01f,
+	1.116363120e-01f, 1.120356535e-01f, 1.124359236e-01f, 1.128371232e-01f,
+	1.132392528e-01f, 1.136423130e-01f, 1.140463047e-01f, 1.144512284e-01f,
+	1.148570847e-01f, 1.152638742e-01f, 1.156715978e-01f, 1.160802558e-01f,
+	1.164898490e-01f, 1.169003781e-01f, 1.173118435e-01f, 1.177242460e-01f,
+	1.181375862e-01f, 1.185518645e-01f, 1.189670817e-01f, 1.193832384e-01f,
+	1.198003351e-01f, 1.202183724e-01f, 1.206373510e-01f, 1.210572713e-01f,
+	1.214781340e-01f, 1.218999396e-01f, 1.223226887e-01f, 1.227463819e-01f,
+	1.231710197e-01f, 1.235966027e-01f, 1.240231314e-01f, 1.244506064e-01f,
+	1.248790281e-01f, 1.253083972e-01f, 1.257387142e-01f, 1.261699796e-01f,
+	1.266021938e-01f, 1.270353576e-01f, 1.274694712e-01f, 1.279045353e-01f,
+	1.283405504e-01f, 1.287775169e-01f, 1.292154354e-01f, 1.296543063e-01f,
+	1.300941301e-01f, 1.305349074e-01f, 1.309766385e-01f, 1.314193239e-01f,
+	1.318629642e-01f, 1.323075597e-01f, 1.327531109e-01f, 1.331996183e-01f,
+	1.336470824e-01f, 1.340955035e-01f, 1.345448821e-01f, 1.349952186e-01f,
+	1.354465135e-01f, 1.358987672e-01f, 1.363519801e-01f, 1.368061526e-01f,
+	1.372612851e-01f, 1.377173780e-01f, 1.381744317e-01f, 1.386324466e-01f,
+	1.390914232e-01f, 1.395513617e-01f, 1.400122625e-01f, 1.404741261e-01f,
+	1.409369528e-01f, 1.414007429e-01f, 1.418654968e-01f, 1.423312149e-01f,
+	1.427978975e-01f, 1.432655449e-01f, 1.437341576e-01f, 1.442037357e-01f,
+	1.446742797e-01f, 1.451457899e-01f, 1.456182665e-01f, 1.460917100e-01f,
+	1.465661205e-01f, 1.470414984e-01f, 1.475178440e-01f, 1.479951576e-01f,
+	1.484734394e-01f, 1.489526898e-01f, 1.494329090e-01f, 1.499140973e-01f,
+	1.503962550e-01f, 1.508793822e-01f, 1.513634793e-01f, 1.518485465e-01f,
+	1.523345840e-01f, 1.528215921e-01f, 1.533095711e-01f, 1.537985210e-01f,
+	1.542884423e-01f, 1.547793350e-01f, 1.552711993e-01f, 1.557640356e-01f,
+	1.562578439e-01f, 1.567526245e-01f, 1.572483776e-01f, 1.577451033e-01f,
+	1.582428018e-01f, 1.587414733e-01f, 1.592411179e-01f, 1.597417359e-01f,
+	1.602433273e-01f, 1.607458923e-01f, 1.612494311e-01f, 1.617539438e-01f,
+	1.622594304e-01f, 1.627658913e-01f, 1.632733263e-01f, 1.637817358e-01f,
+	1.642911198e-01f, 1.648014783e-01f, 1.653128115e-01f, 1.658251195e-01f,
+	1.663384023e-01f, 1.668526601e-01f, 1.673678929e-01f, 1.678841008e-01f,
+	1.684012838e-01f, 1.689194420e-01f, 1.694385755e-01f, 1.699586842e-01f,
+	1.704797683e-01f, 1.710018278e-01f, 1.715248626e-01f, 1.720488728e-01f,
+	1.725738585e-01f, 1.730998196e-01f, 1.736267562e-01f, 1.741546681e-01f,
+	1.746835555e-01f, 1.752134184e-01f, 1.757442566e-01f, 1.762760701e-01f,
+	1.768088590e-01f, 1.773426232e-01f, 1.778773627e-01f, 1.784130773e-01f,
+	1.789497671e-01f, 1.794874319e-01f, 1.800260718e-01f, 1.805656866e-01f,
+	1.811062762e-01f, 1.816478407e-01f, 1.821903797e-01f, 1.827338934e-01f,
+	1.832783815e-01f, 1.838238440e-01f, 1.843702808e-01f, 1.849176916e-01f,
+	1.854660764e-01f, 1.860154351e-01f, 1.865657675e-01f, 1.871170734e-01f,
+	1.876693528e-01f, 1.882226053e-01f, 1.887768310e-01f, 1.893320295e-01f,
+	1.898882008e-01f, 1.904453446e-01f, 1.910034608e-01f, 1.915625491e-01f,
+	1.921226093e-01f, 1.926836413e-01f, 1.932456448e-01f, 1.938086195e-01f,
+	1.943725653e-01f, 1.949374820e-01f, 1.955033692e-01f, 1.960702267e-01f,
+	1.966380543e-01f, 1.972068517e-01f, 1.977766187e-01f, 1.983473549e-01f,
+	1.989190601e-01f, 1.994917340e-01f, 2.000653764e-01f, 2.006399868e-01f,
+	2.012155650e-01f, 2.017921107e-01f, 2.023696235e-01f, 2.029481032e-01f,
+	2.035275494e-01f, 2.041079618e-01f, 2.046893400e-01f, 2.052716836e-01f,
+	2.058549924e-01f, 2.064392658e-01f, 2.070245037e-01f, 2.076107056e-01f,
+	2.081978710e-01f, 2.087859997e-01f, 2.093750912e-01f, 2.099651451e-01f,
+	2.105561610e-01f, 2.111481385e-01f, 2.117410771e-01f, 2.123349765e-01f,
+	2.129298361e-01f, 2.135256556e-01f, 2.141224345e-01f, 2.147201724e-01f,
+	2.153188687e-01f, 2.159185230e-01f, 2.165191348e-01f, 2.171207037e-01f,
+	2.177232291e-01f, 2.183267106e-01f, 2.189311476e-01f, 2.195365396e-01f,
+	2.201428862e-01f, 2.207501868e-01f, 2.213584408e-01f, 2.219676477e-01f,
+	2.225778070e-01f, 2.231889182e-01f, 2.238009806e-01f, 2.244139937e-01f,
+	2.250279570e-01f, 2.256428698e-01f, 2.262587315e-01f, 2.268755417e-01f,
+	2.274932996e-01f, 2.281120047e-01f, 2.287316564e-01f, 2.293522540e-01f,
+	2.299737969e-01f, 2.305962845e-01f, 2.312197161e-01f, 2.318440912e-01f,
+	2.324694089e-01f, 2.330956688e-01f, 2.337228700e-01f, 2.343510120e-01f,
+	2.349800941e-01f, 2.356101155e-01f, 2.362410757e-01f, 2.368729737e-01f,
+	2.375058091e-01f, 2.381395810e-01f, 2.387742887e-01f, 2.394099315e-01f,
+	2.400465087e-01f, 2.406840195e-01f, 2.413224632e-01f, 2.419618390e-01f,
+	2.426021462e-01f, 2.432433839e-01f, 2.438855514e-01f, 2.445286479e-01f,
+	2.451726727e-01f, 2.458176249e-01f, 2.464635037e-01f, 2.471103083e-01f,
+	2.477580379e-01f, 2.484066917e-01f, 2.490562688e-01f, 2.497067684e-01f,
+	2.503581896e-01f, 2.510105316e-01f, 2.516637936e-01f, 2.523179745e-01f,
+	2.529730737e-01f, 2.536290902e-01f, 2.542860231e-01f, 2.549438715e-01f,
+	2.556026345e-01f, 2.562623112e-01f, 2.569229006e-01f, 2.575844020e-01f,
+	2.582468142e-01f, 2.589101365e-01f, 2.595743677e-01f, 2.602395071e-01f,
+	2.609055536e-01f, 2.615725063e-01f, 2.622403641e-01f, 2.629091261e-01f,
+	2.635787914e-01f, 2.642493589e-01f, 2.649208276e-01f, 2.655931965e-01f,
+	2.662664646e-01f, 2.669406309e-01f, 2.676156943e-01f, 2.682916538e-01f,
+	2.689685083e-01f, 2.696462569e-01f, 2.703248984e-01f, 2.710044318e-01f,
+	2.716848560e-01f, 2.723661699e-01f, 2.730483724e-01f, 2.737314625e-01f,
+	2.744154390e-01f, 2.751003009e-01f, 2.757860470e-01f, 2.764726761e-01f,
+	2.771601873e-01f, 2.778485792e-01f, 2.785378509e-01f, 2.792280010e-01f,
+	2.799190285e-01f, 2.806109323e-01f, 2.813037110e-01f, 2.819973637e-01f,
+	2.826918889e-01f, 2.833872857e-01f, 2.840835527e-01f, 2.847806888e-01f,
+	2.854786927e-01f, 2.861775632e-01f, 2.868772991e-01f, 2.875778992e-01f,
+	2.882793622e-01f, 2.889816868e-01f, 2.896848718e-01f, 2.903889160e-01f,
+	2.910938180e-01f, 2.917995766e-01f, 2.925061905e-01f, 2.932136584e-01f,
+	2.939219790e-01f, 2.946311509e-01f, 2.953411729e-01f, 2.960520437e-01f,
+	2.967637619e-01f, 2.974763262e-01f, 2.981897352e-01f, 2.989039876e-01f,
+	2.996190820e-01f, 3.003350170e-01f, 3.010517914e-01f, 3.017694036e-01f,
+	3.024878524e-01f, 3.032071363e-01f, 3.039272539e-01f, 3.046482038e-01f,
+	3.053699846e-01f, 3.060925949e-01f, 3.068160332e-01f, 3.075402982e-01f,
+	3.082653883e-01f, 3.089913021e-01f, 3.097180381e-01f, 3.104455949e-01f,
+	3.111739710e-01f, 3.119031650e-01f, 3.126331753e-01f, 3.133640004e-01f,
+	3.140956389e-01f, 3.148280892e-01f, 3.155613499e-01f, 3.162954193e-01f,
+	3.170302960e-01f, 3.177659784e-01f, 3.185024650e-01f, 3.192397543e-01f,
+	3.199778446e-01f, 3.207167344e-01f, 3.214564222e-01f, 3.221969063e-01f,
+	3.229381851e-01f, 3.236802572e-01f, 3.244231208e-01f, 3.251667743e-01f,
+	3.259112162e-01f, 3.266564449e-01f, 3.274024586e-01f, 3.281492558e-01f,
+	3.288968348e-01f, 3.296451939e-01f, 3.303943316e-01f, 3.311442461e-01f,
+	3.318949357e-01f, 3.326463988e-01f, 3.333986338e-01f, 3.341516388e-01f,
+	3.349054122e-01f, 3.356599524e-01f, 3.364152575e-01f, 3.371713258e-01f,
+	3.379281557e-01f, 3.386857454e-01f, 3.394440931e-01f, 3.402031971e-01f,
+	3.409630557e-01f, 3.417236671e-01f, 3.424850294e-01f, 3.432471410e-01f,
+	3.440100000e-01f, 3.447736047e-01f, 3.455379532e-01f, 3.463030437e-01f,
+	3.470688745e-01f, 3.478354437e-01f, 3.486027495e-01f, 3.493707900e-01f,
+	3.501395635e-01f, 3.509090679e-01f, 3.516793016e-01f, 3.524502627e-01f,
+	3.532219492e-01f, 3.539943592e-01f, 3.547674910e-01f, 3.555413427e-01f,
+	3.563159122e-01f, 3.570911978e-01f, 3.578671974e-01f, 3.586439093e-01f,
+	3.594213314e-01f, 3.601994619e-01f, 3.609782987e-01f, 3.617578400e-01f,
+	3.625380838e-01f, 3.633190281e-01f, 3.641006710e-01f, 3.648830105e-01f,
+	3.656660446e-01f, 3.664497713e-01f, 3.672341887e-01f, 3.680192947e-01f,
+	3.688050873e-01f, 3.695915645e-01f, 3.703787244e-01f, 3.711665648e-01f,
+	3.719550837e-01f, 3.727442791e-01f, 3.735341489e-01f, 3.743246911e-01f,
+	3.751159036e-01f, 3.759077844e-01f, 3.767003313e-01f, 3.774935424e-01f,
+	3.782874154e-01f, 3.790819483e-01f, 3.798771391e-01f, 3.806729855e-01f,
+	3.814694855e-01f, 3.822666369e-01f, 3.830644377e-01f, 3.838628857e-01f,
+	3.846619787e-01f, 3.854617145e-01f, 3.862620912e-01f, 3.870631063e-01f,
+	3.878647579e-01f, 3.886670437e-01f, 3.894699616e-01f, 3.902735093e-01f,
+	3.910776846e-01f, 3.918824854e-01f, 3.926879094e-01f, 3.934939544e-01f,
+	3.943006183e-01f, 3.951078987e-01f, 3.959157934e-01f, 3.967243002e-01f,
+	3.975334168e-01f, 3.983431410e-01f, 3.991534706e-01f, 3.999644032e-01f,
+	4.007759365e-01f, 4.015880683e-01f, 4.024007964e-01f, 4.032141183e-01f,
+	4.040280318e-01f, 4.048425346e-01f, 4.056576244e-01f, 4.064732988e-01f,
+	4.072895556e-01f, 4.081063923e-01f, 4.089238067e-01f, 4.097417964e-01f,
+	4.105603590e-01f, 4.113794922e-01f, 4.121991936e-01f, 4.130194609e-01f,
+	4.138402916e-01f, 4.146616834e-01f, 4.154836338e-01f, 4.163061406e-01f,
+	4.171292012e-01f, 4.179528133e-01f, 4.187769745e-01f, 4.196016822e-01f,
+	4.204269342e-01f, 4.212527279e-01f, 4.220790609e-01f, 4.229059307e-01f,
+	4.237333350e-01f, 4.245612712e-01f, 4.253897369e-01f, 4.262187296e-01f,
+	4.270482467e-01f, 4.278782860e-01f, 4.287088447e-01f, 4.295399205e-01f,
+	4.303715108e-01f, 4.312036131e-01f, 4.320362249e-01f, 4.328693437e-01f,
+	4.337029669e-01f, 4.345370920e-01f, 4.353717165e-01f, 4.362068378e-01f,
+	4.370424533e-01f, 4.378785606e-01f, 4.387151569e-01f, 4.395522398e-01f,
+	4.403898067e-01f, 4.412278550e-01f, 4.420663821e-01f, 4.429053853e-01f,
+	4.437448622e-01f, 4.445848100e-01f, 4.454252262e-01f, 4.462661081e-01f,
+	4.471074532e-01f, 4.479492587e-01f, 4.487915221e-01f, 4.496342406e-01f,
+	4.504774117e-01f, 4.513210327e-01f, 4.521651010e-01f, 4.530096137e-01f,
+	4.538545684e-01f, 4.546999622e-01f, 4.555457926e-01f, 4.563920568e-01f,
+	4.572387521e-01f, 4.580858758e-01f, 4.589334252e-01f, 4.597813976e-01f,
+	4.606297902e-01f, 4.614786004e-01f, 4.623278255e-01f, 4.631774625e-01f,
+	4.640275089e-01f, 4.648779619e-01f, 4.657288187e-01f, 4.665800765e-01f,
+	4.674317326e-01f, 4.682837843e-01f, 4.691362286e-01f, 4.699890630e-01f,
+	4.708422844e-01f, 4.716958903e-01f, 4.725498777e-01f, 4.734042438e-01f,
+	4.742589859e-01f, 4.751141012e-01f, 4.759695867e-01f, 4.768254397e-01f,
+	4.776816574e-01f, 4.785382368e-01f, 4.793951752e-01f, 4.802524697e-01f,
+	4.811101175e-01f, 4.819681156e-01f, 4.828264613e-01f, 4.836851516e-01f,
+	4.845441837e-01f, 4.854035547e-01f, 4.862632616e-01f, 4.871233017e-01f,
+	4.879836720e-01f, 4.888443696e-01f, 4.897053916e-01f, 4.905667350e-01f,
+	4.914283970e-01f, 4.922903746e-01f, 4.931526650e-01f, 4.940152651e-01f,
+	4.948781720e-01f, 4.957413828e-01f, 4.966048946e-01f, 4.974687043e-01f,
+	4.983328090e-01f, 4.991972057e-01f, 5.000618915e-01f, 5.009268635e-01f,
+	5.017921185e-01f, 5.026576536e-01f, 5.035234659e-01f, 5.043895523e-01f,
+	5.052559099e-01f, 5.061225356e-01f, 5.069894263e-01f, 5.078565792e-01f,
+	5.087239912e-01f, 5.095916592e-01f, 5.104595802e-01f, 5.113277512e-01f,
+	5.121961692e-01f, 5.130648310e-01f, 5.139337337e-01f, 5.148028741e-01f,
+	5.156722493e-01f, 5.165418561e-01f, 5.174116915e-01f, 5.182817525e-01f,
+	5.191520358e-01f, 5.200225386e-01f, 5.208932575e-01f, 5.217641897e-01f,
+	5.226353319e-01f, 5.235066810e-01f, 5.243782340e-01f, 5.252499878e-01f,
+	5.261219392e-01f, 5.269940851e-01f, 5.278664223e-01f, 5.287389478e-01f,
+	5.296116584e-01f, 5.304845510e-01f, 5.313576224e-01f, 5.322308695e-01f,
+	5.331042891e-01f, 5.339778781e-01f, 5.348516333e-01f, 5.357255515e-01f,
+	5.365996295e-01f, 5.374738643e-01f, 5.383482526e-01f, 5.392227912e-01f,
+	5.400974769e-01f, 5.409723066e-01f, 5.418472770e-01f, 5.427223850e-01f,
+	5.435976273e-01f, 5.444730007e-01f, 5.453485021e-01f, 5.462241281e-01f,
+	5.470998757e-01f, 5.479757414e-01f, 5.488517222e-01f, 5.497278148e-01f,
+	5.506040159e-01f, 5.514803224e-01f, 5.523567309e-01f, 5.532332381e-01f,
+	5.541098410e-01f, 5.549865361e-01f, 5.558633203e-01f, 5.567401902e-01f,
+	5.576171426e-01f, 5.584941742e-01f, 5.593712817e-01f, 5.602484619e-01f,
+	5.611257115e-01f, 5.620030272e-01f, 5.628804056e-01f, 5.637578435e-01f,
+	5.646353376e-01f, 5.655128845e-01f, 5.663904811e-01f, 5.672681239e-01f,
+	5.681458096e-01f, 5.690235349e-01f, 5.699012966e-01f, 5.707790912e-01f,
+	5.716569154e-01f, 5.725347659e-01f, 5.734126394e-01f, 5.742905325e-01f,
+	5.751684419e-01f, 5.760463642e-01f, 5.769242960e-01f, 5.778022341e-01f,
+	5.786801750e-01f, 5.795581154e-01f, 5.804360520e-01f, 5.813139812e-01f,
+	5.821918999e-01f, 5.830698046e-01f, 5.839476919e-01f, 5.848255584e-01f,
+	5.857034008e-01f, 5.865812156e-01f, 5.874589995e-01f, 5.883367491e-01f,
+	5.892144609e-01f, 5.900921316e-01f, 5.909697578e-01f, 5.918473360e-01f,
+	5.927248629e-01f, 5.936023350e-01f, 5.944797488e-01f, 5.953571011e-01f,
+	5.962343883e-01f, 5.971116071e-01f, 5.979887539e-01f, 5.988658254e-01f,
+	5.997428182e-01f, 6.006197287e-01f, 6.014965535e-01f, 6.023732893e-01f,
+	6.032499325e-01f, 6.041264797e-01f, 6.050029274e-01f, 6.058792723e-01f,
+	6.067555107e-01f, 6.076316393e-01f, 6.085076546e-01f, 6.093835531e-01f,
+	6.102593314e-01f, 6.111349860e-01f, 6.120105133e-01f, 6.128859100e-01f,
+	6.137611725e-01f, 6.146362974e-01f, 6.155112812e-01f, 6.163861203e-01f,
+	6.172608113e-01f, 6.181353507e-01f, 6.190097351e-01f, 6.198839608e-01f,
+	6.207580244e-01f, 6.216319223e-01f, 6.225056512e-01f, 6.233792074e-01f,
+	6.242525875e-01f, 6.251257880e-01f, 6.259988052e-01f, 6.268716358e-01f,
+	6.277442761e-01f, 6.286167228e-01f, 6.294889721e-01f, 6.303610207e-01f,
+	6.312328649e-01f, 6.321045013e-01f, 6.329759263e-01f, 6.338471364e-01f,
+	6.347181280e-01f, 6.355888976e-01f, 6.364594417e-01f, 6.373297567e-01f,
+	6.381998390e-01f, 6.390696851e-01f, 6.399392915e-01f, 6.408086546e-01f,
+	6.416777709e-01f, 6.425466367e-01f, 6.434152486e-01f, 6.442836030e-01f,
+	6.451516962e-01f, 6.460195248e-01f, 6.468870852e-01f, 6.477543738e-01f,
+	6.486213871e-01f, 6.494881214e-01f, 6.503545732e-01f, 6.512207390e-01f,
+	6.520866150e-01f, 6.529521979e-01f, 6.538174839e-01f, 6.546824696e-01f,
+	6.555471513e-01f, 6.564115254e-01f, 6.572755884e-01f, 6.581393366e-01f,
+	6.590027665e-01f, 6.598658745e-01f, 6.607286570e-01f, 6.615911104e-01f,
+	6.624532311e-01f, 6.633150155e-01f, 6.641764600e-01f, 6.650375611e-01f,
+	6.658983150e-01f, 6.667587183e-01f, 6.676187673e-01f, 6.684784583e-01f,
+	6.693377879e-01f, 6.701967524e-01f, 6.710553482e-01f, 6.719135716e-01f,
+	6.727714191e-01f, 6.736288871e-01f, 6.744859719e-01f, 6.753426700e-01f,
+	6.761989777e-01f, 6.770548913e-01f, 6.779104074e-01f, 6.787655223e-01f,
+	6.796202323e-01f, 6.804745338e-01f, 6.813284233e-01f, 6.821818970e-01f,
+	6.830349515e-01f, 6.838875829e-01f, 6.847397879e-01f, 6.855915626e-01f,
+	6.864429035e-01f, 6.872938070e-01f, 6.881442694e-01f, 6.889942871e-01f,
+	6.898438565e-01f, 6.906929740e-01f, 6.915416358e-01f, 6.923898385e-01f,
+	6.932375784e-01f, 6.940848517e-01f, 6.949316550e-01f, 6.957779846e-01f,
+	6.966238368e-01f, 6.974692081e-01f, 6.983140947e-01f, 6.991584930e-01f,
+	7.000023995e-01f, 7.008458105e-01f, 7.016887223e-01f, 7.025311314e-01f,
+	7.033730340e-01f, 7.042144266e-01f, 7.050553055e-01f, 7.058956671e-01f,
+	7.067355077e-01f, 7.075748238e-01f, 7.084136116e-01f, 7.092518676e-01f,
+	7.100895880e-01f, 7.109267694e-01f, 7.117634080e-01f, 7.125995002e-01f,
+	7.134350424e-01f, 7.142700309e-01f, 7.151044621e-01f, 7.159383324e-01f,
+	7.167716381e-01f, 7.176043756e-01f, 7.184365413e-01f, 7.192681315e-01f,
+	7.200991426e-01f, 7.209295709e-01f, 7.217594129e-01f, 7.225886649e-01f,
+	7.234173232e-01f, 7.242453843e-01f, 7.250728445e-01f, 7.258997001e-01f,
+	7.267259476e-01f, 7.275515833e-01f, 7.283766036e-01f, 7.292010048e-01f,
+	7.300247833e-01f, 7.308479356e-01f, 7.316704579e-01f, 7.324923466e-01f,
+	7.333135981e-01f, 7.341342088e-01f, 7.349541751e-01f, 7.357734933e-01f,
+	7.365921598e-01f, 7.374101710e-01f, 7.382275233e-01f, 7.390442130e-01f,
+	7.398602365e-01f, 7.406755902e-01f, 7.414902706e-01f, 7.423042738e-01f,
+	7.431175965e-01f, 7.439302348e-01f, 7.447421853e-01f, 7.455534442e-01f,
+	7.463640081e-01f, 7.471738732e-01f, 7.479830360e-01f, 7.487914928e-01f,
+	7.495992401e-01f, 7.504062743e-01f, 7.512125916e-01f, 7.520181886e-01f,
+	7.528230616e-01f, 7.536272070e-01f, 7.544306212e-01f, 7.552333007e-01f,
+	7.560352417e-01f, 7.568364408e-01f, 7.576368943e-01f, 7.584365986e-01f,
+	7.592355502e-01f, 7.600337454e-01f, 7.608311806e-01f, 7.616278523e-01f,
+	7.624237569e-01f, 7.632188907e-01f, 7.640132503e-01f, 7.648068320e-01f,
+	7.655996322e-01f, 7.663916473e-01f, 7.671828739e-01f, 7.679733082e-01f,
+	7.687629468e-01f, 7.695517860e-01f, 7.703398223e-01f, 7.711270521e-01f,
+	7.719134718e-01f, 7.726990780e-01f, 7.734838669e-01f, 7.742678351e-01f,
+	7.750509790e-01f, 7.758332950e-01f, 7.766147796e-01f, 7.773954292e-01f,
+	7.781752403e-01f, 7.789542092e-01f, 7.797323326e-01f, 7.805096068e-01f,
+	7.812860282e-01f, 7.820615934e-01f, 7.828362988e-01f, 7.836101409e-01f,
+	7.843831160e-01f, 7.851552208e-01f, 7.859264516e-01f, 7.866968049e-01f,
+	7.874662773e-01f, 7.882348651e-01f, 7.890025649e-01f, 7.897693731e-01f,
+	7.905352862e-01f, 7.913003007e-01f, 7.920644131e-01f, 7.928276199e-01f,
+	7.935899176e-01f, 7.943513026e-01f, 7.951117715e-01f, 7.958713208e-01f,
+	7.966299469e-01f, 7.973876464e-01f, 7.981444158e-01f, 7.989002516e-01f,
+	7.996551503e-01f, 8.004091084e-01f, 8.011621224e-01f, 8.019141889e-01f,
+	8.026653044e-01f, 8.034154654e-01f, 8.041646684e-01f, 8.049129101e-01f,
+	8.056601868e-01f, 8.064064952e-01f, 8.071518317e-01f, 8.078961930e-01f,
+	8.086395756e-01f, 8.093819760e-01f, 8.101233908e-01f, 8.108638165e-01f,
+	8.116032498e-01f, 8.123416871e-01f, 8.130791250e-01f, 8.138155601e-01f,
+	8.145509890e-01f, 8.152854083e-01f, 8.160188144e-01f, 8.167512041e-01f,
+	8.174825738e-01f, 8.182129203e-01f, 8.189422400e-01f, 8.196705295e-01f,
+	8.203977856e-01f, 8.211240047e-01f, 8.218491834e-01f, 8.225733185e-01f,
+	8.232964064e-01f, 8.240184438e-01f, 8.247394274e-01f, 8.254593537e-01f,
+	8.261782193e-01f, 8.268960210e-01f, 8.276127553e-01f, 8.283284188e-01f,
+	8.290430083e-01f, 8.297565204e-01f, 8.304689516e-01f, 8.311802987e-01f,
+	8.318905583e-01f, 8.325997270e-01f, 8.333078016e-01f, 8.340147787e-01f,
+	8.347206549e-01f, 8.354254270e-01f, 8.361290916e-01f, 8.368316454e-01f,
+	8.375330851e-01f, 8.382334073e-01f, 8.389326089e-01f, 8.396306864e-01f,
+	8.403276365e-01f, 8.410234561e-01f, 8.417181417e-01f, 8.424116901e-01f,
+	8.431040980e-01f, 8.437953622e-01f, 8.444854793e-01f, 8.451744462e-01f,
+	8.458622594e-01f, 8.465489158e-01f, 8.472344122e-01f, 8.479187452e-01f,
+	8.486019116e-01f, 8.492839081e-01f, 8.499647316e-01f, 8.506443788e-01f,
+	8.513228465e-01f, 8.520001313e-01f, 8.526762302e-01f, 8.533511399e-01f,
+	8.540248572e-01f, 8.546973788e-01f, 8.553687016e-01f, 8.560388224e-01f,
+	8.567077380e-01f, 8.573754451e-01f, 8.580419406e-01f, 8.587072214e-01f,
+	8.593712842e-01f, 8.600341258e-01f, 8.606957432e-01f, 8.613561331e-01f,
+	8.620152924e-01f, 8.626732179e-01f, 8.633299065e-01f, 8.639853550e-01f,
+	8.646395604e-01f, 8.652925194e-01f, 8.659442289e-01f, 8.665946859e-01f,
+	8.672438871e-01f, 8.678918295e-01f, 8.685385100e-01f, 8.691839255e-01f,
+	8.698280729e-01f, 8.704709490e-01f, 8.711125508e-01f, 8.717528752e-01f,
+	8.723919191e-01f, 8.730296795e-01f, 8.736661533e-01f, 8.743013374e-01f,
+	8.749352288e-01f, 8.755678243e-01f, 8.761991211e-01f, 8.768291159e-01f,
+	8.774578059e-01f, 8.780851879e-01f, 8.787112589e-01f, 8.793360159e-01f,
+	8.799594560e-01f, 8.805815760e-01f, 8.812023730e-01f, 8.818218439e-01f,
+	8.824399859e-01f, 8.830567958e-01f, 8.836722708e-01f, 8.842864077e-01f,
+	8.848992038e-01f, 8.855106559e-01f, 8.861207612e-01f, 8.867295167e-01f,
+	8.873369194e-01f, 8.879429664e-01f, 8.885476547e-01f, 8.891509815e-01f,
+	8.897529437e-01f, 8.903535386e-01f, 8.909527631e-01f, 8.915506143e-01f,
+	8.921470894e-01f, 8.927421854e-01f, 8.933358994e-01f, 8.939282287e-01f,
+	8.945191702e-01f, 8.951087212e-01f, 8.956968786e-01f, 8.962836398e-01f,
+	8.968690018e-01f, 8.974529618e-01f, 8.980355169e-01f, 8.986166643e-01f,
+	8.991964012e-01f, 8.997747247e-01f, 9.003516320e-01f, 9.009271203e-01f,
+	9.015011868e-01f, 9.020738287e-01f, 9.026450432e-01f, 9.032148275e-01f,
+	9.037831788e-01f, 9.043500944e-01f, 9.049155715e-01f, 9.054796072e-01f,
+	9.060421989e-01f, 9.066033439e-01f, 9.071630392e-01f, 9.077212823e-01f,
+	9.082780704e-01f, 9.088334007e-01f, 9.093872706e-01f, 9.099396773e-01f,
+	9.104906181e-01f, 9.110400903e-01f, 9.115880912e-01f, 9.121346182e-01f,
+	9.126796685e-01f, 9.132232395e-01f, 9.137653285e-01f, 9.143059329e-01f,
+	9.148450500e-01f, 9.153826771e-01f, 9.159188116e-01f, 9.164534508e-01f,
+	9.169865923e-01f, 9.175182332e-01f, 9.180483710e-01f, 9.185770032e-01f,
+	9.191041270e-01f, 9.196297399e-01f, 9.201538394e-01f, 9.206764228e-01f,
+	9.211974875e-01f, 9.217170310e-01f, 9.222350508e-01f, 9.227515442e-01f,
+	9.232665088e-01f, 9.237799419e-01f, 9.242918411e-01f, 9.248022039e-01f,
+	9.253110276e-01f, 9.258183099e-01f, 9.263240481e-01f, 9.268282399e-01f,
+	9.273308826e-01f, 9.278319739e-01f, 9.283315112e-01f, 9.288294921e-01f,
+	9.293259141e-01f, 9.298207748e-01f, 9.303140717e-01f, 9.308058024e-01f,
+	9.312959644e-01f, 9.317845553e-01f, 9.322715727e-01f, 9.327570142e-01f,
+	9.332408773e-01f, 9.337231597e-01f, 9.342038591e-01f, 9.346829729e-01f,
+	9.351604989e-01f, 9.356364346e-01f, 9.361107777e-01f, 9.365835259e-01f,
+	9.370546768e-01f, 9.375242280e-01f, 9.379921773e-01f, 9.384585222e-01f,
+	9.389232606e-01f, 9.393863901e-01f, 9.398479083e-01f, 9.403078130e-01f,
+	9.407661020e-01f, 9.412227728e-01f, 9.416778233e-01f, 9.421312512e-01f,
+	9.425830543e-01f, 9.430332302e-01f, 9.434817767e-01f, 9.439286917e-01f,
+	9.443739729e-01f, 9.448176180e-01f, 9.452596249e-01f, 9.456999914e-01f,
+	9.461387152e-01f, 9.465757942e-01f, 9.470112262e-01f, 9.474450090e-01f,
+	9.478771405e-01f, 9.483076186e-01f, 9.487364409e-01f, 9.491636055e-01f,
+	9.495891102e-01f, 9.500129528e-01f, 9.504351314e-01f, 9.508556436e-01f,
+	9.512744875e-01f, 9.516916609e-01f, 9.521071618e-01f, 9.525209881e-01f,
+	9.529331377e-01f, 9.533436086e-01f, 9.537523987e-01f, 9.541595060e-01f,
+	9.545649284e-01f, 9.549686638e-01f, 9.553707104e-01f, 9.557710660e-01f,
+	9.561697287e-01f, 9.565666965e-01f, 9.569619674e-01f, 9.573555393e-01f,
+	9.577474104e-01f, 9.581375786e-01f, 9.585260421e-01f, 9.589127988e-01f,
+	9.592978469e-01f, 9.596811844e-01f, 9.600628093e-01f, 9.604427198e-01f,
+	9.608209139e-01f, 9.611973898e-01f, 9.615721456e-01f, 9.619451794e-01f,
+	9.623164893e-01f, 9.626860734e-01f, 9.630539300e-01f, 9.634200571e-01f,
+	9.637844529e-01f, 9.641471155e-01f, 9.645080433e-01f, 9.648672343e-01f,
+	9.652246867e-01f, 9.655803988e-01f, 9.659343688e-01f, 9.662865948e-01f,
+	9.666370751e-01f, 9.669858080e-01f, 9.673327916e-01f, 9.676780244e-01f,
+	9.680215044e-01f, 9.683632300e-01f, 9.687031994e-01f, 9.690414110e-01f,
+	9.693778631e-01f, 9.697125539e-01f, 9.700454818e-01f, 9.703766450e-01f,
+	9.707060420e-01f, 9.710336711e-01f, 9.713595305e-01f, 9.716836188e-01f,
+	9.720059341e-01f, 9.723264750e-01f, 9.726452398e-01f, 9.729622268e-01f,
+	9.732774346e-01f, 9.735908615e-01f, 9.739025058e-01f, 9.742123662e-01f,
+	9.745204409e-01f, 9.748267284e-01f, 9.751312272e-01f, 9.754339358e-01f,
+	9.757348526e-01f, 9.760339761e-01f, 9.763313048e-01f, 9.766268371e-01f,
+	9.769205717e-01f, 9.772125070e-01f, 9.775026415e-01f, 9.777909738e-01f,
+	9.780775024e-01f, 9.783622258e-01f, 9.786451427e-01f, 9.789262516e-01f,
+	9.792055511e-01f, 9.794830397e-01f, 9.797587161e-01f, 9.800325789e-01f,
+	9.803046266e-01f, 9.805748579e-01f, 9.808432715e-01f, 9.811098660e-01f,
+	9.813746400e-01f, 9.816375922e-01f, 9.818987212e-01f, 9.821580258e-01f,
+	9.824155046e-01f, 9.826711564e-01f, 9.829249798e-01f, 9.831769735e-01f,
+	9.834271362e-01f, 9.836754668e-01f, 9.839219639e-01f, 9.841666264e-01f,
+	9.844094528e-01f, 9.846504421e-01f, 9.848895930e-01f, 9.851269043e-01f,
+	9.853623748e-01f, 9.855960032e-01f, 9.858277885e-01f, 9.860577294e-01f,
+	9.862858248e-01f, 9.865120735e-01f, 9.867364743e-01f, 9.869590262e-01f,
+	9.871797280e-01f, 9.873985785e-01f, 9.876155768e-01f, 9.878307216e-01f,
+	9.880440118e-01f, 9.882554465e-01f, 9.884650244e-01f, 9.886727447e-01f,
+	9.888786061e-01f, 9.890826077e-01f, 9.892847484e-01f, 9.894850272e-01f,
+	9.896834431e-01f, 9.898799950e-01f, 9.900746820e-01f, 9.902675031e-01f,
+	9.904584573e-01f, 9.906475437e-01f, 9.908347612e-01f, 9.910201089e-01f,
+	9.912035859e-01f, 9.913851913e-01f, 9.915649241e-01f, 9.917427834e-01f,
+	9.919187683e-01f, 9.920928779e-01f, 9.922651113e-01f, 9.924354677e-01f,
+	9.926039462e-01f, 9.927705459e-01f, 9.929352660e-01f, 9.930981056e-01f,
+	9.932590640e-01f, 9.934181402e-01f, 9.935753336e-01f, 9.937306432e-01f,
+	9.938840683e-01f, 9.940356082e-01f, 9.941852620e-01f, 9.943330289e-01f,
+	9.944789084e-01f, 9.946228995e-01f, 9.947650015e-01f, 9.949052138e-01f,
+	9.950435357e-01f, 9.951799663e-01f, 9.953145051e-01f, 9.954471513e-01f,
+	9.955779043e-01f, 9.957067634e-01f, 9.958337279e-01f, 9.959587972e-01f,
+	9.960819707e-01f, 9.962032477e-01f, 9.963226276e-01f, 9.964401098e-01f,
+	9.965556938e-01f, 9.966693788e-01f, 9.967811645e-01f, 9.968910500e-01f,
+	9.969990350e-01f, 9.971051189e-01f, 9.972093011e-01f, 9.973115810e-01f,
+	9.974119583e-01f, 9.975104323e-01f, 9.976070025e-01f, 9.977016685e-01f,
+	9.977944298e-01f, 9.978852860e-01f, 9.979742364e-01f, 9.980612808e-01f,
+	9.981464186e-01f, 9.982296494e-01f, 9.983109728e-01f, 9.983903884e-01f,
+	9.984678958e-01f, 9.985434946e-01f, 9.986171843e-01f, 9.986889647e-01f,
+	9.987588353e-01f, 9.988267958e-01f, 9.988928458e-01f, 9.989569851e-01f,
+	9.990192133e-01f, 9.990795300e-01f, 9.991379350e-01f, 9.991944280e-01f,
+	9.992490086e-01f, 9.993016766e-01f, 9.993524318e-01f, 9.994012738e-01f,
+	9.994482024e-01f, 9.994932175e-01f, 9.995363186e-01f, 9.995775057e-01f,
+	9.996167786e-01f, 9.996541369e-01f, 9.996895806e-01f, 9.997231095e-01f,
+	9.997547233e-01f, 9.997844219e-01f, 9.998122052e-01f, 9.998380731e-01f,
+	9.998620253e-01f, 9.998840618e-01f, 9.999041824e-01f, 9.999223871e-01f,
+	9.999386758e-01f, 9.999530484e-01f, 9.999655047e-01f, 9.999760448e-01f,
+	9.999846686e-01f, 9.999913761e-01f, 9.999961671e-01f, 9.999990418e-01f,
+	1.000000000e+00f,
+};
+
+static const q15_t win_blackman_half_q15[WINDOW_HALF_LEN] = {
+	161, 161, 161, 161, 161, 161, 161, 161,
+	161, 161, 161, 161, 162, 162, 162, 162,
+	162, 163, 163, 163, 163, 164, 164, 164,
+	165, 165, 165, 166, 166, 166, 167, 167,
+	168, 168, 169, 169, 170, 170, 171, 171,
+	172, 172, 173, 173, 174, 175, 175, 176,
+	177, 177, 178, 179, 179, 180, 181, 182,
+	182, 183, 184, 185, 186, 187, 187, 188,
+	189, 190, 191, 192, 193, 194, 195, 196,
+	197, 198, 199, 200, 201, 202, 203, 204,
+	205, 207, 208, 209, 210, 211, 212, 214,
+	215, 216, 217, 219, 220, 221, 223, 224,
+	225, 227, 228, 229, 231, 232, 234, 235,
+	237, 238, 240, 241, 243, 244, 246, 247,
+	249, 250, 252, 254, 255, 257, 259, 260,
+	262, 264, 266, 267, 269, 271, 273, 274,
+	276, 278, 280, 282, 284, 286, 287, 289,
+	291, 293, 295, 297, 299, 301, 303, 305,
+	307, 310, 312, 314, 316, 318, 320, 322,
+	325, 327, 329, 331, 333, 336, 338, 340,
+	343, 345, 347, 350, 352, 354, 357, 359,
+	362, 364, 367, 369, 372, 374, 377, 379,
+	382, 384, 387, 390, 392, 395, 398, 400,
+	403, 406, 408, 411, 414, 417, 419, 422,
+	425, 428, 431, 434, 437, 439, 442, 445,
+	448, 451, 454, 457, 460, 463, 466, 469,
+	473, 476, 479, 482, 485, 488, 492, 495,
+	498, 501, 504, 508, 511, 514, 518, 521,
+	524, 528, 531, 535, 538, 541, 545, 548,
+	552, 555, 559, 563, 566, 570, 573, 577,
+	581, 584, 588, 592, 595, 599, 603, 607,
+	610, 614, 618, 622, 626, 630, 633, 637,
+	641, 645, 649, 653, 657, 661, 665, 669,
+	673, 677, 682, 686, 690, 694, 698, 702,
+	707, 711, 715, 719, 724, 728, 732, 737,
+	741, 746, 750, 754, 759, 763, 768, 772,
+	777, 781, 786, 791, 795, 800, 804, 809,
+	814, 818, 823, 828, 833, 837, 842, 847,
+	852, 857, 862, 867, 871, 876, 881, 886,
+	891, 896, 901, 906, 911, 917, 922, 927,
+	932, 937, 942, 948, 953, 958, 963, 969,
+	974, 979, 985, 990, 995, 1001, 1006, 1012,
+	1017, 1023, 1028, 1034, 1039, 1045, 1051, 1056,
+	1062, 1068, 1073, 1079, 1085, 1091, 1096, 1102,
+	1108, 1114, 1120, 1126, 1131, 1137, 1143, 1149,
+	1155, 1161, 1167, 1173, 1179, 1186, 1192, 1198,
+	1204, 1210, 1216, 1223, 1229, 1235, 1242, 1248,
+	1254, 1261, 1267, 1273, 1280, 1286, 1293, 1299,
+	1306, 1312, 1319, 1325, 1332, 1339, 1345, 1352,
+	1359, 1366, 1372, 1379, 1386, 1393, 1399, 1406,
+	1413, 1420, 1427, 1434, 1441, 1448, 1455, 1462,
+	1469, 1476, 1483, 1491, 1498, 1505, 1512, 1519,
+	1527, 1534, 1541, 1549, 1556, 1563, 1571, 1578,
+	1586, 1593, 1601, 1608, 1616, 1623, 1631, 1639,
+	1646, 1654, 1662, 1669, 1677, 1685, 1693, 1700,
+	1708, 1716, 1724, 1732, 1740, 1748, 1756, 1764,
+	1772, 1780, 1788, 1796, 1804, 1812, 1821, 1829,
+	1837, 1845, 1854, 1862, 1870, 1879, 1887, 1896,
+	1904, 1912, 1921, 1929, 1938, 1947, 1955, 1964,
+	1972, 1981, 1990, 1999, 2007, 2016, 2025, 2034,
+	2043, 2051, 2060, 2069, 2078, 2087, 2096, 2105,
+	2114, 2123, 2133, 2142, 2151, 2160, 2169, 2179,
+	2188, 2197, 2206, 2216, 2225, 2235, 2244, 2254,
+	2263, 2273, 2282, 2292, 2301, 2311, 2321, 2330,
+	2340, 2350, 2359, 2369, 2379, 2389, 2399, 2409,
+	2419, 2429, 2438, 2449, 2459, 2469, 2479, 2489,
+	2499, 2509, 2519, 2530, 2540, 2550, 2560, 2571,
+	2581, 2592, 2602, 2612, 2623, 2633, 2644, 2654,
+	2665, 2676, 2686, 2697, 2708, 2718, 2729, 2740,
+	2751, 2762, 2773, 2783, 2794, 2805, 2816, 2827,
+	2838, 2849, 2861, 2872, 2883, 2894, 2905, 2916,
+	2928, 2939, 2950, 2962, 2973, 2985, 2996, 3007,
+	3019, 3031, 3042, 3054, 3065, 3077, 3089, 3100,
+	3112, 3124, 3136, 3148, 3159, 3171, 3183, 3195,
+	3207, 3219, 3231, 3243, 3255, 3267, 3280, 3292,
+	3304, 3316, 3328, 3341, 3353, 3365, 3378, 3390,
+	3403, 3415, 3428, 3440, 3453, 3465, 3478, 3491,
+	3503, 3516, 3529, 3542, 3555, 3567, 3580, 3593,
+	3606, 3619, 3632, 3645, 3658, 3671, 3684, 3697,
+	3711, 3724, 3737, 3750, 3764, 3777, 3790, 3804,
+	3817, 3831, 3844, 3858, 3871, 3885, 3898, 3912,
+	3926, 3939, 3953, 3967, 3981, 3994, 4008, 4022,
+	4036, 4050, 4064, 4078, 4092, 4106, 4120, 4134,
+	4149, 4163, 4177, 4191, 4205, 4220, 4234, 4249,
+	4263, 4277, 4292, 4306, 4321, 4335, 4350, 4365,
+	4379, 4394, 4409, 4424, 4438, 4453, 4468, 4483,
+	4498, 4513, 4528, 4543, 4558, 4573, 4588, 4603,
+	4618, 4633, 4649, 4664, 4679, 4695, 4710, 4725,
+	4741, 4756, 4772, 4787, 4803, 4818, 4834, 4850,
+	4865, 4881, 4897, 4912, 4928, 4944, 4960, 4976,
+	4992, 5008, 5024, 5040, 5056, 5072, 5088, 5104,
+	5120, 5136, 5153, 5169, 5185, 5202, 5218, 5234,
+	5251, 5267, 5284, 5300, 5317, 5334, 5350, 5367,
+	5383, 5400, 5417, 5434, 5451, 5467, 5484, 5501,
+	5518, 5535, 5552, 5569, 5586, 5603, 5621, 5638,
+	5655, 5672, 5689, 5707, 5724, 5741, 5759, 5776,
+	5794, 5811, 5829, 5846, 5864, 5881, 5899, 5917,
+	5934, 5952, 5970, 5988, 6006, 6024, 6041, 6059,
+	6077, 6095, 6113, 6131, 6150, 6168, 6186, 6204,
+	6222, 6241, 6259, 6277, 6295, 6314, 6332, 6351,
+	6369, 6388, 6406, 6425, 6443, 6462, 6481, 6499,
+	6518, 6537, 6556, 6575, 6593, 6612, 6631, 6650,
+	6669, 6688, 6707, 6726, 6745, 6765, 6784, 6803,
+	6822, 6841, 6861, 6880, 6900, 6919, 6938, 6958,
+	6977, 6997, 7016, 7036, 7056, 7075, 7095, 7115,
+	7134, 7154, 7174, 7194, 7214, 7234, 7253, 7273,
+	7293, 7313, 7334, 7354, 7374, 7394, 7414, 7434,
+	7455, 7475, 7495, 7515, 7536, 7556, 7577, 7597,
+	7618, 7638, 7659, 7679, 7700, 7720, 7741, 7762,
+	7783, 7803, 7824, 7845, 7866, 7887, 7908, 7929,
+	7950, 7971, 7992, 8013, 8034, 8055, 8076, 8097,
+	8119, 8140, 8161, 8182, 8204, 8225, 8247, 8268,
+	8289, 8311, 8332, 8354, 8376, 8397, 8419, 8441,
+	8462, 8484, 8506, 8528, 8549, 8571, 8593, 8615,
+	8637, 8659, 8681, 8703, 8725, 8747, 8769, 8791,
+	8814, 8836, 8858, 8880, 8903, 8925, 8947, 8970,
+	8992, 9014, 9037, 9059, 9082, 9105, 9127, 9150,
+	9172, 9195, 9218, 9240, 9263, 9286, 9309, 9332,
+	9355, 9377, 9400, 9423, 9446, 9469, 9492, 9515,
+	9539, 9562, 9585, 9608, 9631, 9654, 9678, 9701,
+	9724, 9748, 9771, 9794, 9818, 9841, 9865, 9888,
+	9912, 9935, 9959, 9983, 10006, 10030, 10054, 10077,
+	10101, 10125, 10149, 10173, 10197, 10220, 10244, 10268,
+	10292, 10316, 10340, 10364, 10388, 10413, 10437, 10461,
+	10485, 10509, 10533, 10558, 10582, 10606, 10631, 10655,
+	10679, 10704, 10728, 10753, 10777, 10802, 10826, 10851,
+	10876, 10900, 10925, 10949, 10974, 10999, 11024, 11048,
+	11073, 11098, 11123, 11148, 11173, 11198, 11223, 11248,
+	11273, 11298, 11323, 11348, 11373, 11398, 11423, 11448,
+	11473, 11499, 11524, 11549, 11574, 11600, 11625, 11650,
+	11676, 11701, 11727, 11752, 11778, 11803, 11829, 11854,
+	11880, 11905, 11931, 11956, 11982, 12008, 12034, 12059,
+	12085, 12111, 12137, 12162, 12188, 12214, 12240, 12266,
+	12292, 12318, 12344, 12370, 12396, 12422, 12448, 12474,
+	12500, 12526, 12552, 12578, 12605, 12631, 12657, 12683,
+	12710, 12736, 12762, 12788, 12815, 12841, 12868, 12894,
+	12920, 12947, 12973, 13000, 13026, 13053, 13079, 13106,
+	13133, 13159, 13186, 13213, 13239, 13266, 13293, 13319,
+	13346, 13373, 13400, 13426, 13453, 13480, 13507, 13534,
+	13561, 13588, 13615, 13642, 13668, 13695, 13722, 13750,
+	13777, 13804, 13831, 13858, 13885, 13912, 13939, 13966,
+	13994, 14021, 14048, 14075, 14102, 14130, 14157, 14184,
+	14212, 14239, 14266, 14294, 14321, 14348, 14376, 14403,
+	14431, 14458, 14486, 14513, 14541, 14568, 14596, 14623,
+	14651, 14678, 14706, 14734, 14761, 14789, 14817, 14844,
+	14872, 14900, 14927, 14955, 14983, 15011, 15038, 15066,
+	15094, 15122, 15150, 15177, 15205, 15233, 15261, 15289,
+	15317, 15345, 15373, 15401, 15429, 15457, 15485, 15513,
+	15541, 15569, 15597, 15625, 15653, 15681, 15709, 15737,
+	15765, 15793, 15821, 15849, 15878, 15906, 15934, 15962,
+	15990, 16018, 16047, 16075, 16103, 16131, 16160, 16188,
+	16216, 16244, 16273, 16301, 16329, 16358, 16386, 16414,
+	16443, 16471, 16499, 16528, 16556, 16585, 16613, 16641,
+	16670, 16698, 16727, 16755, 16784, 16812, 16841, 16869,
+	16898, 16926, 16955, 16983, 17012, 17040, 17069, 17097,
+	17126, 17154, 17183, 17211, 17240, 17269, 17297, 17326,
+	17354, 17383, 17412, 17440, 17469, 17497, 17526, 17555,
+	17583, 17612, 17641, 17669, 17698, 17727, 17755, 17784,
+	17813, 17841, 17870, 17899, 17927, 17956, 17985, 18013,
+	18042, 18071, 18100, 18128, 18157, 18186, 18215, 18243,
+	18272, 18301, 18329, 18358, 18387, 18416, 18444, 18473,
+	18502, 18531, 18559, 18588, 18617, 18646, 18675, 18703,
+	18732, 18761, 18790, 18818, 18847, 18876, 18905, 18933,
+	18962, 18991, 19020, 19048, 19077, 19106, 19135, 19164,
+	19192, 19221, 19250, 19279, 19307, 19336, 19365, 19394,
+	19422, 19451, 19480, 19509, 19537, 19566, 19595, 19624,
+	19652, 19681, 19710, 19739, 19767, 19796, 19825, 19853,
+	19882, 19911, 19940, 19968, 19997, 20026, 20054, 20083,
+	20112, 20140, 20169, 20198, 20226, 20255, 20284, 20312,
+	20341, 20370, 20398, 20427, 20456, 20484, 20513, 20541,
+	20570, 20599, 20627, 20656, 20684, 20713, 20741, 20770,
+	20798, 20827, 20856, 20884, 20913, 20941, 20970, 20998,
+	21026, 21055, 21083, 21112, 21140, 21169, 21197, 21226,
+	21254, 21282, 21311, 21339, 21368, 21396, 21424, 21453,
+	21481, 21509, 21538, 21566, 21594, 21622, 21651, 21679,
+	21707, 21736, 21764, 21792, 21820, 21848, 21877, 21905,
+	21933, 21961, 21989, 22017, 22045, 22073, 22102, 22130,
+	22158, 22186, 22214, 22242, 22270, 22298, 22326, 22354,
+	22382, 22410, 22438, 22465, 22493, 22521, 22549, 22577,
+	22605, 22633, 22660, 22688, 22716, 22744, 22772, 22799,
+	22827, 22855, 22882, 22910, 22938, 22965, 22993, 23021,
+	23048, 23076, 23103, 23131, 23158, 23186, 23213, 23241,
+	23268, 23296, 23323, 23350, 23378, 23405, 23433, 23460,
+	23487, 23514, 23542, 23569, 23596, 23623, 23651, 23678,
+	23705, 23732, 23759, 23786, 23813, 23840, 23867, 23894,
+	23921, 23948, 23975, 24002, 24029, 24056, 24083, 24110,
+	24137, 24163, 24190, 24217, 24244, 24270, 24297, 24324,
+	24350, 24377, 24404, 24430, 24457, 24483, 24510, 24536,
+	24563, 24589, 24616, 24642, 24669, 24695, 24721, 24747,
+	24774, 24800, 24826, 24852, 24879, 24905, 24931, 24957,
+	24983, 25009, 25035, 25061, 25087, 25113, 25139, 25165,
+	25191, 25217, 25242, 25268, 25294, 25320, 25346, 25371,
+	25397, 25423, 25448, 25474, 25499, 25525, 25550, 25576,
+	25601, 25627, 25652, 25677, 25703, 25728, 25753, 25778,
+	25804, 25829, 25854, 25879, 25904, 25929, 25954, 25979,
+	26004, 26029, 26054, 26079, 26104, 26129, 26154, 26178,
+	26203, 26228, 26252, 26277, 26302, 26326, 26351, 26375,
+	26400, 26424, 26449, 26473, 26498, 26522, 26546, 26570,
+	26595, 26619, 26643, 26667, 26691, 26715, 26739, 26763,
+	26787, 26811, 26835, 26859, 26883, 26907, 26930, 26954,
+	26978, 27001, 27025, 27049, 27072, 27096, 27119, 27143,
+	27166, 27189, 27213, 27236, 27259, 27283, 27306, 27329,
+	27352, 27375, 27398, 27421, 27444, 27467, 27490, 27513,
+	27536, 27559, 27581, 27604, 27627, 27649, 27672, 27695,
+	27717, 27740, 27762, 27785, 27807, 27829, 27852, 27874,
+	27896, 27918, 27940, 27963, 27985, 28007, 28029, 28051,
+	28073, 28094, 28116, 28138, 28160, 28182, 28203, 28225,
+	28247, 28268, 28290, 28311, 28333, 28354, 28375, 28397,
+	28418, 28439, 28460, 28481, 28503, 28524, 28545, 28566,
+	28587, 28607, 28628, 28649, 28670, 28691, 28711, 28732,
+	28753, 28773, 28794, 28814, 28835, 28855, 28875, 28896,
+	28916, 28936, 28956, 28976, 28996, 29016, 29036, 29056,
+	29076, 29096, 29116, 29136, 29155, 29175, 29195, 29214,
+	29234, 29253, 29273, 29292, 29312, 29331, 29350, 29369,
+	29389, 29408, 29427, 29446, 29465, 29484, 29503, 29522,
+	29540, 29559, 29578, 29597, 29615, 29634, 29652, 29671,
+	29689, 29708, 29726, 29744, 29762, 29781, 29799, 29817,
+	29835, 29853, 29871, 29889, 29907, 29924, 29942, 29960,
+	29978, 29995, 30013, 30030, 30048, 30065, 30083, 30100,
+	30117, 30134, 30152, 30169, 30186, 30203, 30220, 30237,
+	30254, 30270, 30287, 30304, 30321, 30337, 30354, 30370,
+	30387, 30403, 30420, 30436, 30452, 30468, 30485, 30501,
+	30517, 30533, 30549, 30565, 30580, 30596, 30612, 30628,
+	30643, 30659, 30674, 30690, 30705, 30721, 30736, 30751,
+	30767, 30782, 30797, 30812, 30827, 30842, 30857, 30872,
+	30887, 30901, 30916, 30931, 30945, 30960, 30974, 30989,
+	31003, 31017, 31032, 31046, 31060, 31074, 31088, 31102,
+	31116, 31130, 31144, 31158, 31171, 31185, 31199, 31212,
+	31226, 31239, 31253, 31266, 31279, 31292, 31306, 31319,
+	31332, 31345, 31358, 31371, 31383, 31396, 31409, 31422,
+	31434, 31447, 31459, 31472, 31484, 31497, 31509, 31521,
+	31533, 31545, 31557, 31569, 31581, 31593, 31605, 31617,
+	31628, 31640, 31652, 31663, 31675, 31686, 31698, 31709,
+	31720, 31731, 31742, 31754, 31765, 31776, 31786, 31797,
+	31808, 31819, 31830, 31840, 31851, 31861, 31872, 31882,
+	31892, 31903, 31913, 31923, 31933, 31943, 31953, 31963,
+	31973, 31983, 31992, 32002, 32012, 32021, 32031, 32040,
+	32050, 32059, 32068, 32077, 32087, 32096, 32105, 32114,
+	32123, 32131, 32140, 32149, 32158, 32166, 32175, 32183,
+	32192, 32200, 32208, 32217, 32225, 32233, 32241, 32249,
+	32257, 32265, 32273, 32281, 32288, 32296, 32304, 32311,
+	32319, 32326, 32333, 32341, 32348, 32355, 32362, 32369,
+	32376, 32383, 32390, 32397, 32404, 32410, 32417, 32423,
+	32430, 32436, 32443, 32449, 32455, 32462, 32468, 32474,
+	32480, 32486, 32492, 32497, 32503, 32509, 32515, 32520,
+	32526, 32531, 32537, 32542, 32547, 32552, 32557, 32563,
+	32568, 32573, 32577, 32582, 32587, 32592, 32596, 32601,
+	32606, 32610, 32614, 32619, 32623, 32627, 32631, 32636,
+	32640, 32644, 32647, 32651, 32655, 32659, 32663, 32666,
+	32670, 32673, 32677, 32680, 32683, 32686, 32690, 32693,
+	32696, 32699, 32702, 32704, 32707, 32710, 32713, 32715,
+	32718, 32720, 32723, 32725, 32727, 32730, 32732, 32734,
+	32736, 32738, 32740, 32742, 32743, 32745, 32747, 32748,
+	32750, 32751, 32753, 32754, 32755, 32757, 32758, 32759,
+	32760, 32761, 32762, 32763, 32763, 32764, 32765, 32765,
+	32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767,
+};
+
+static const float32_t win_blackman_bias[WINDOW_BIAS_LEN] = {
+	0.000000000e+00f, 3.167242923e-03f, 6.334469240e-03f, 9.501662345e-03f,
+	1.266880563e-02f, 1.583588248e-02f, 1.900287630e-02f, 2.216977046e-02f,
+	2.533654834e-02f, 2.850319334e-02f, 3.166968881e-02f, 3.483601813e-02f,
+	3.800216467e-02f, 4.116811178e-02f, 4.433384282e-02f, 4.749934112e-02f,
+	5.066459004e-02f, 5.382957288e-02f, 5.699427299e-02f, 6.015867365e-02f,
+	6.332275819e-02f, 6.648650989e-02f, 6.964991202e-02f, 7.281294786e-02f,
+	7.597560066e-02f, 7.913785367e-02f, 8.229969012e-02f, 8.546109323e-02f,
+	8.862204619e-02f, 9.178253220e-02f, 9.494253442e-02f, 9.810203603e-02f,
+	1.012610201e-01f, 1.044194699e-01f, 1.075773684e-01f, 1.107346988e-01f,
+	1.138914440e-01f, 1.170475872e-01f, 1.202031114e-01f, 1.233579995e-01f,
+	1.265122346e-01f, 1.296657997e-01f, 1.328186777e-01f, 1.359708515e-01f,
+	1.391223040e-01f, 1.422730180e-01f, 1.454229765e-01f, 1.485721623e-01f,
+	1.517205581e-01f, 1.548681467e-01f, 1.580149109e-01f, 1.611608334e-01f,
+	1.643058968e-01f, 1.674500839e-01f, 1.705933772e-01f, 1.737357594e-01f,
+	1.768772131e-01f, 1.800177207e-01f, 1.831572648e-01f, 1.862958279e-01f,
+	1.894333923e-01f, 1.925699406e-01f, 1.957054550e-01f, 1.988399179e-01f,
+	2.019733117e-01f,
+};
+
+static const float32_t win_blackmanHarris_half[WINDOW_HALF_LEN] = {
+	6.000000000e-05f, 6.003328475e-05f, 6.013314128e-05f, 6.029957646e-05f,
+	6.053260172e-05f, 6.083223307e-05f, 6.119849109e-05f, 6.163140095e-05f,
+	6.213099237e-05f, 6.269729967e-05f, 6.333036171e-05f, 6.403022197e-05f,
+	6.479692846e-05f, 6.563053380e-05f, 6.653109515e-05f, 6.749867427e-05f,
+	6.853333749e-05f, 6.963515571e-05f, 7.080420439e-05f, 7.204056360e-05f,
+	7.334431794e-05f, 7.471555663e-05f, 7.615437342e-05f, 7.766086667e-05f,
+	7.923513929e-05f, 8.087729878e-05f, 8.258745720e-05f, 8.436573120e-05f,
+	8.621224199e-05f, 8.812711536e-05f, 9.011048167e-05f, 9.216247585e-05f,
+	9.428323744e-05f, 9.647291049e-05f, 9.873164369e-05f, 1.010595902e-04f,
+	1.034569080e-04f, 1.059237593e-04f, 1.084603111e-04f, 1.110667349e-04f,
+	1.137432069e-04f, 1.164899077e-04f, 1.193070226e-04f, 1.221947413e-04f,
+	1.251532583e-04f, 1.281827726e-04f, 1.312834877e-04f, 1.344556117e-04f,
+	1.376993573e-04f, 1.410149418e-04f, 1.444025870e-04f, 1.478625193e-04f,
+	1.513949697e-04f, 1.550001738e-04f, 1.586783717e-04f, 1.624298080e-04f,
+	1.662547322e-04f, 1.701533979e-04f, 1.741260637e-04f, 1.781729926e-04f,
+	1.822944520e-04f, 1.864907142e-04f, 1.907620558e-04f, 1.951087582e-04f,
+	1.995311072e-04f, 2.040293933e-04f, 2.086039114e-04f, 2.132549611e-04f,
+	2.179828465e-04f, 2.227878765e-04f, 2.276703642e-04f, 2.326306275e-04f,
+	2.376689889e-04f, 2.427857755e-04f, 2.479813186e-04f, 2.532559546e-04f,
+	2.586100241e-04f, 2.640438724e-04f, 2.695578494e-04f, 2.751523095e-04f,
+	2.808276117e-04f, 2.865841197e-04f, 2.924222014e-04f, 2.983422298e-04f,
+	3.043445820e-04f, 3.104296398e-04f, 3.165977899e-04f, 3.228494230e-04f,
+	3.291849348e-04f, 3.356047255e-04f, 3.421091996e-04f, 3.486987666e-04f,
+	3.553738402e-04f, 3.621348389e-04f, 3.689821856e-04f, 3.759163079e-04f,
+	3.829376379e-04f, 3.900466122e-04f, 3.972436722e-04f, 4.045292636e-04f,
+	4.119038368e-04f, 4.193678469e-04f, 4.269217532e-04f, 4.345660199e-04f,
+	4.423011156e-04f, 4.501275135e-04f, 4.580456915e-04f, 4.660561319e-04f,
+	4.741593215e-04f, 4.823557519e-04f, 4.906459191e-04f, 4.990303237e-04f,
+	5.075094708e-04f, 5.160838703e-04f, 5.247540363e-04f, 5.335204878e-04f,
+	5.423837481e-04f, 5.513443453e-04f, 5.604028119e-04f, 5.695596849e-04f,
+	5.788155061e-04f, 5.881708217e-04f, 5.976261824e-04f, 6.071821437e-04f,
+	6.168392653e-04f, 6.265981118e-04f, 6.364592522e-04f, 6.464232600e-04f,
+	6.564907134e-04f, 6.666621951e-04f, 6.769382923e-04f, 6.873195969e-04f,
+	6.978067051e-04f, 7.084002180e-04f, 7.191007409e-04f, 7.299088839e-04f,
+	7.408252615e-04f, 7.518504930e-04f, 7.629852018e-04f, 7.742300164e-04f,
+	7.855855695e-04f, 7.970524984e-04f, 8.086314449e-04f, 8.203230555e-04f,
+	8.321279813e-04f, 8.440468776e-04f, 8.560804047e-04f, 8.682292270e-04f,
+	8.804940138e-04f, 8.928754388e-04f, 9.053741802e-04f, 9.179909208e-04f,
+	9.307263480e-04f, 9.435811536e-04f, 9.565560341e-04f, 9.696516904e-04f,
+	9.828688280e-04f, 9.962081570e-04f, 1.009670392e-03f, 1.023256252e-03f,
+	1.036966461e-03f, 1.050801746e-03f, 1.064762841e-03f, 1.078850484e-03f,
+	1.093065414e-03f, 1.107408380e-03f, 1.121880131e-03f, 1.136481424e-03f,
+	1.151213018e-03f, 1.166075677e-03f, 1.181070171e-03f, 1.196197273e-03f,
+	1.211457761e-03f, 1.226852417e-03f, 1.242382029e-03f, 1.258047389e-03f,
+	1.273849291e-03f, 1.289788537e-03f, 1.305865933e-03f, 1.322082287e-03f,
+	1.338438414e-03f, 1.354935132e-03f, 1.371573265e-03f, 1.388353641e-03f,
+	1.405277091e-03f, 1.422344452e-03f, 1.439556566e-03f, 1.456914279e-03f,
+	1.474418440e-03f, 1.492069904e-03f, 1.509869531e-03f, 1.527818185e-03f,
+	1.545916732e-03f, 1.564166048e-03f, 1.582567007e-03f, 1.601120493e-03f,
+	1.619827392e-03f, 1.638688594e-03f, 1.657704994e-03f, 1.676877493e-03f,
+	1.696206994e-03f, 1.715694406e-03f, 1.735340642e-03f, 1.755146620e-03f,
+	1.775113262e-03f, 1.795241495e-03f, 1.815532250e-03f, 1.835986461e-03f,
+	1.856605070e-03f, 1.877389021e-03f, 1.898339262e-03f, 1.919456748e-03f,
+	1.940742435e-03f, 1.962197287e-03f, 1.983822270e-03f, 2.005618356e-03f,
+	2.027586520e-03f, 2.049727743e-03f, 2.072043009e-03f, 2.094533307e-03f,
+	2.117199630e-03f, 2.140042978e-03f, 2.163064352e-03f, 2.186264759e-03f,
+	2.209645211e-03f, 2.233206723e-03f, 2.256950315e-03f, 2.280877012e-03f,
+	2.304987844e-03f, 2.329283844e-03f, 2.353766049e-03f, 2.378435502e-03f,
+	2.403293250e-03f, 2.428340344e-03f, 2.453577839e-03f, 2.479006796e-03f,
+	2.504628280e-03f, 2.530443358e-03f, 2.556453104e-03f, 2.582658597e-03f,
+	2.609060917e-03f, 2.635661151e-03f, 2.662460391e-03f, 2.689459732e-03f,
+	2.716660272e-03f, 2.744063117e-03f, 2.771669375e-03f, 2.799480158e-03f,
+	2.827496583e-03f, 2.855719773e-03f, 2.884150853e-03f, 2.912790953e-03f,
+	2.941641208e-03f, 2.970702758e-03f, 2.999976744e-03f, 3.029464317e-03f,
+	3.059166626e-03f, 3.089084829e-03f, 3.119220087e-03f, 3.149573565e-03f,
+	3.180146432e-03f, 3.210939862e-03f, 3.241955033e-03f, 3.273193128e-03f,
+	3.304655333e-03f, 3.336342841e-03f, 3.368256845e-03f, 3.400398546e-03f,
+	3.432769148e-03f, 3.465369860e-03f, 3.498201894e-03f, 3.531266467e-03f,
+	3.564564800e-03f, 3.598098120e-03f, 3.631867655e-03f, 3.665874641e-03f,
+	3.700120315e-03f, 3.734605921e-03f, 3.769332705e-03f, 3.804301918e-03f,
+	3.839514817e-03f, 3.874972661e-03f, 3.910676714e-03f, 3.946628244e-03f,
+	3.982828525e-03f, 4.019278832e-03f, 4.055980447e-03f, 4.092934655e-03f,
+	4.130142746e-03f, 4.167606014e-03f, 4.205325756e-03f, 4.243303274e-03f,
+	4.281539876e-03f, 4.320036871e-03f, 4.358795575e-03f, 4.397817307e-03f,
+	4.437103390e-03f, 4.476655150e-03f, 4.516473921e-03f, 4.556561037e-03f,
+	4.596917839e-03f, 4.637545670e-03f, 4.678445880e-03f, 4.719619820e-03f,
+	4.761068847e-03f, 4.802794322e-03f, 4.844797610e-03f, 4.887080080e-03f,
+	4.929643104e-03f, 4.972488061e-03f, 5.015616332e-03f, 5.059029302e-03f,
+	5.102728362e-03f, 5.146714904e-03f, 5.190990326e-03f, 5.235556032e-03f,
+	5.280413426e-03f, 5.325563919e-03f, 5.371008925e-03f, 5.416749862e-03f,
+	5.462788153e-03f, 5.509125225e-03f, 5.555762507e-03f, 5.602701435e-03f,
+	5.649943446e-03f, 5.697489984e-03f, 5.745342495e-03f, 5.793502430e-03f,
+	5.841971243e-03f, 5.890750394e-03f, 5.939841344e-03f, 5.989245561e-03f,
+	6.038964516e-03f, 6.088999683e-03f, 6.139352540e-03f, 6.190024571e-03f,
+	6.241017262e-03f, 6.292332104e-03f, 6.343970590e-03f, 6.395934221e-03f,
+	6.448224497e-03f, 6.500842926e-03f, 6.553791018e-03f, 6.607070286e-03f,
+	6.660682250e-03f, 6.714628430e-03f, 6.768910354e-03f, 6.823529550e-03f,
+	6.878487553e-03f, 6.933785900e-03f, 6.989426132e-03f, 7.045409795e-03f,
+	7.101738438e-03f, 7.158413614e-03f, 7.215436879e-03f, 7.272809795e-03f,
+	7.330533926e-03f, 7.388610840e-03f, 7.447042109e-03f, 7.505829309e-03f,
+	7.564974020e-03f, 7.624477826e-03f, 7.684342313e-03f, 7.744569073e-03f,
+	7.805159700e-03f, 7.866115794e-03f, 7.927438955e-03f, 7.989130791e-03f,
+	8.051192910e-03f, 8.113626927e-03f, 8.176434459e-03f, 8.239617126e-03f,
+	8.303176553e-03f, 8.367114369e-03f, 8.431432204e-03f, 8.496131695e-03f,
+	8.561214481e-03f, 8.626682205e-03f, 8.692536514e-03f, 8.758779056e-03f,
+	8.825411487e-03f, 8.892435464e-03f, 8.959852647e-03f, 9.027664701e-03f,
+	9.095873294e-03f, 9.164480099e-03f, 9.233486790e-03f, 9.302895046e-03f,
+	9.372706549e-03f, 9.442922986e-03f, 9.513546046e-03f, 9.584577422e-03f,
+	9.656018809e-03f, 9.727871910e-03f, 9.800138426e-03f, 9.872820064e-03f,
+	9.945918536e-03f, 1.001943555e-02f, 1.009337284e-02f, 1.016773210e-02f,
+	1.024251508e-02f, 1.031772349e-02f, 1.039335907e-02f, 1.046942356e-02f,
+	1.054591868e-02f, 1.062284618e-02f, 1.070020781e-02f, 1.077800531e-02f,
+	1.085624044e-02f, 1.093491494e-02f, 1.101403058e-02f, 1.109358912e-02f,
+	1.117359232e-02f, 1.125404195e-02f, 1.133493978e-02f, 1.141628759e-02f,
+	1.149808714e-02f, 1.158034023e-02f, 1.166304864e-02f, 1.174621415e-02f,
+	1.182983856e-02f, 1.191392366e-02f, 1.199847123e-02f, 1.208348310e-02f,
+	1.216896105e-02f, 1.225490690e-02f, 1.234132244e-02f, 1.242820951e-02f,
+	1.251556990e-02f, 1.260340545e-02f, 1.269171797e-02f, 1.278050928e-02f,
+	1.286978122e-02f, 1.295953561e-02f, 1.304977429e-02f, 1.314049910e-02f,
+	1.323171188e-02f, 1.332341446e-02f, 1.341560870e-02f, 1.350829644e-02f,
+	1.360147954e-02f, 1.369515984e-02f, 1.378933922e-02f, 1.388401953e-02f,
+	1.397920262e-02f, 1.407489038e-02f, 1.417108466e-02f, 1.426778735e-02f,
+	1.436500031e-02f, 1.446272542e-02f, 1.456096457e-02f, 1.465971963e-02f,
+	1.475899250e-02f, 1.485878506e-02f, 1.495909921e-02f, 1.505993683e-02f,
+	1.516129984e-02f, 1.526319011e-02f, 1.536560957e-02f, 1.546856011e-02f,
+	1.557204365e-02f, 1.567606209e-02f, 1.578061734e-02f, 1.588571133e-02f,
+	1.599134597e-02f, 1.609752318e-02f, 1.620424490e-02f, 1.631151303e-02f,
+	1.641932952e-02f, 1.652769629e-02f, 1.663661528e-02f, 1.674608842e-02f,
+	1.685611766e-02f, 1.696670493e-02f, 1.707785219e-02f, 1.718956137e-02f,
+	1.730183442e-02f, 1.741467331e-02f, 1.752807997e-02f, 1.764205637e-02f,
+	1.775660446e-02f, 1.787172621e-02f, 1.798742358e-02f, 1.810369854e-02f,
+	1.822055305e-02f, 1.833798908e-02f, 1.845600861e-02f, 1.857461361e-02f,
+	1.869380605e-02f, 1.881358792e-02f, 1.893396121e-02f, 1.905492788e-02f,
+	1.917648993e-02f, 1.929864935e-02f, 1.942140812e-02f, 1.954476824e-02f,
+	1.966873170e-02f, 1.979330050e-02f, 1.991847664e-02f, 2.004426212e-02f,
+	2.017065894e-02f, 2.029766910e-02f, 2.042529462e-02f, 2.055353749e-02f,
+	2.068239974e-02f, 2.081188337e-02f, 2.094199041e-02f, 2.107272285e-02f,
+	2.120408273e-02f, 2.133607207e-02f, 2.146869287e-02f, 2.160194718e-02f,
+	2.173583702e-02f, 2.187036441e-02f, 2.200553138e-02f, 2.214133996e-02f,
+	2.227779219e-02f, 2.241489011e-02f, 2.255263574e-02f, 2.269103112e-02f,
+	2.283007830e-02f, 2.296977932e-02f, 2.311013622e-02f, 2.325115104e-02f,
+	2.339282584e-02f, 2.353516265e-02f, 2.367816353e-02f, 2.382183054e-02f,
+	2.396616571e-02f, 2.411117111e-02f, 2.425684879e-02f, 2.440320081e-02f,
+	2.455022922e-02f, 2.469793609e-02f, 2.484632348e-02f, 2.499539346e-02f,
+	2.514514807e-02f, 2.529558940e-02f, 2.544671950e-02f, 2.559854045e-02f,
+	2.575105431e-02f, 2.590426315e-02f, 2.605816905e-02f, 2.621277408e-02f,
+	2.636808032e-02f, 2.652408983e-02f, 2.668080470e-02f, 2.683822701e-02f,
+	2.699635882e-02f, 2.715520223e-02f, 2.731475931e-02f, 2.747503215e-02f,
+	2.763602282e-02f, 2.779773342e-02f, 2.796016603e-02f, 2.812332273e-02f,
+	2.828720561e-02f, 2.845181676e-02f, 2.861715827e-02f, 2.878323223e-02f,
+	2.895004073e-02f, 2.911758585e-02f, 2.928586970e-02f, 2.945489436e-02f,
+	2.962466194e-02f, 2.979517452e-02f, 2.996643420e-02f, 3.013844307e-02f,
+	3.031120324e-02f, 3.048471680e-02f, 3.065898584e-02f, 3.083401248e-02f,
+	3.100979880e-02f, 3.118634690e-02f, 3.136365890e-02f, 3.154173688e-02f,
+	3.172058295e-02f, 3.190019921e-02f, 3.208058777e-02f, 3.226175072e-02f,
+	3.244369018e-02f, 3.262640824e-02f, 3.280990701e-02f, 3.299418859e-02f,
+	3.317925508e-02f, 3.336510861e-02f, 3.355175125e-02f, 3.373918514e-02f,
+	3.392741236e-02f, 3.411643503e-02f, 3.430625525e-02f, 3.449687512e-02f,
+	3.468829677e-02f, 3.488052228e-02f, 3.507355377e-02f, 3.526739335e-02f,
+	3.546204311e-02f, 3.565750518e-02f, 3.585378165e-02f, 3.605087463e-02f,
+	3.624878624e-02f, 3.644751856e-02f, 3.664707372e-02f, 3.684745382e-02f,
+	3.704866096e-02f, 3.725069725e-02f, 3.745356480e-02f, 3.765726571e-02f,
+	3.786180209e-02f, 3.806717604e-02f, 3.827338966e-02f, 3.848044507e-02f,
+	3.868834436e-02f, 3.889708964e-02f, 3.910668302e-02f, 3.931712659e-02f,
+	3.952842245e-02f, 3.974057271e-02f, 3.995357948e-02f, 4.016744484e-02f,
+	4.038217091e-02f, 4.059775978e-02f, 4.081421355e-02f, 4.103153431e-02f,
+	4.124972417e-02f, 4.146878523e-02f, 4.168871957e-02f, 4.190952930e-02f,
+	4.213121651e-02f, 4.235378329e-02f, 4.257723173e-02f, 4.280156394e-02f,
+	4.302678199e-02f, 4.325288799e-02f, 4.347988401e-02f, 4.370777215e-02f,
+	4.393655450e-02f, 4.416623314e-02f, 4.439681016e-02f, 4.462828764e-02f,
+	4.486066767e-02f, 4.509395232e-02f, 4.532814369e-02f, 4.556324384e-02f,
+	4.579925485e-02f, 4.603617882e-02f, 4.627401780e-02f, 4.651277388e-02f,
+	4.675244912e-02f, 4.699304561e-02f, 4.723456541e-02f, 4.747701060e-02f,
+	4.772038323e-02f, 4.796468537e-02f, 4.820991910e-02f, 4.845608647e-02f,
+	4.870318955e-02f, 4.895123039e-02f, 4.920021106e-02f, 4.945013362e-02f,
+	4.970100011e-02f, 4.995281259e-02f, 5.020557312e-02f, 5.045928374e-02f,
+	5.071394650e-02f, 5.096956346e-02f, 5.122613664e-02f, 5.148366811e-02f,
+	5.174215990e-02f, 5.200161404e-02f, 5.226203258e-02f, 5.252341755e-02f,
+	5.278577099e-02f, 5.304909492e-02f, 5.331339138e-02f, 5.357866239e-02f,
+	5.384490997e-02f, 5.411213616e-02f, 5.438034297e-02f, 5.464953242e-02f,
+	5.491970653e-02f, 5.519086731e-02f, 5.546301677e-02f, 5.573615692e-02f,
+	5.601028977e-02f, 5.628541732e-02f, 5.656154158e-02f, 5.683866455e-02f,
+	5.711678822e-02f, 5.739591459e-02f, 5.767604565e-02f, 5.795718339e-02f,
+	5.823932979e-02f, 5.852248685e-02f, 5.880665655e-02f, 5.909184085e-02f,
+	5.937804175e-02f, 5.966526121e-02f, 5.995350121e-02f, 6.024276371e-02f,
+	6.053305068e-02f, 6.082436409e-02f, 6.111670588e-02f, 6.141007802e-02f,
+	6.170448246e-02f, 6.199992116e-02f, 6.229639605e-02f, 6.259390909e-02f,
+	6.289246222e-02f, 6.319205737e-02f, 6.349269649e-02f, 6.379438150e-02f,
+	6.409711432e-02f, 6.440089690e-02f, 6.470573115e-02f, 6.501161899e-02f,
+	6.531856233e-02f, 6.562656309e-02f, 6.593562318e-02f, 6.624574451e-02f,
+	6.655692897e-02f, 6.686917846e-02f, 6.718249489e-02f, 6.749688013e-02f,
+	6.781233609e-02f, 6.812886464e-02f, 6.844646767e-02f, 6.876514705e-02f,
+	6.908490466e-02f, 6.940574236e-02f, 6.972766203e-02f, 7.005066552e-02f,
+	7.037475470e-02f, 7.069993141e-02f, 7.102619752e-02f, 7.135355486e-02f,
+	7.168200528e-02f, 7.201155062e-02f, 7.234219271e-02f, 7.267393338e-02f,
+	7.300677447e-02f, 7.334071779e-02f, 7.367576516e-02f, 7.401191840e-02f,
+	7.434917931e-02f, 7.468754971e-02f, 7.502703139e-02f, 7.536762615e-02f,
+	7.570933579e-02f, 7.605216209e-02f, 7.639610684e-02f, 7.674117182e-02f,
+	7.708735879e-02f, 7.743466954e-02f, 7.778310584e-02f, 7.813266943e-02f,
+	7.848336208e-02f, 7.883518554e-02f, 7.918814157e-02f, 7.954223189e-02f,
+	7.989745826e-02f, 8.025382240e-02f, 8.061132604e-02f, 8.096997092e-02f,
+	8.132975874e-02f, 8.169069122e-02f, 8.205277007e-02f, 8.241599700e-02f,
+	8.278037370e-02f, 8.314590188e-02f, 8.351258321e-02f, 8.388041939e-02f,
+	8.424941209e-02f, 8.461956299e-02f, 8.499087375e-02f, 8.536334605e-02f,
+	8.573698153e-02f, 8.611178185e-02f, 8.648774867e-02f, 8.686488362e-02f,
+	8.724318833e-02f, 8.762266445e-02f, 8.800331360e-02f, 8.838513740e-02f,
+	8.876813746e-02f, 8.915231539e-02f, 8.953767281e-02f, 8.992421130e-02f,
+	9.031193246e-02f, 9.070083789e-02f, 9.109092915e-02f, 9.148220782e-02f,
+	9.187467549e-02f, 9.226833370e-02f, 9.266318402e-02f, 9.305922801e-02f,
+	9.345646720e-02f, 9.385490315e-02f, 9.425453738e-02f, 9.465537142e-02f,
+	9.505740680e-02f, 9.546064503e-02f, 9.586508763e-02f, 9.627073610e-02f,
+	9.667759194e-02f, 9.708565663e-02f, 9.749493167e-02f, 9.790541854e-02f,
+	9.831711871e-02f, 9.873003364e-02f, 9.914416480e-02f, 9.955951364e-02f,
+	9.997608162e-02f, 1.003938702e-01f, 1.008128807e-01f, 1.012331147e-01f,
+	1.016545736e-01f, 1.020772587e-01f, 1.025011715e-01f, 1.029263134e-01f,
+	1.033526857e-01f, 1.037802900e-01f, 1.042091274e-01f, 1.046391995e-01f,
+	1.050705077e-01f, 1.055030531e-01f, 1.059368373e-01f, 1.063718615e-01f,
+	1.068081271e-01f, 1.072456355e-01f, 1.076843879e-01f, 1.081243857e-01f,
+	1.085656302e-01f, 1.090081227e-01f, 1.094518645e-01f, 1.098968569e-01f,
+	1.103431011e-01f, 1.107905985e-01f, 1.112393503e-01f, 1.116893578e-01f,
+	1.121406223e-01f, 1.125931449e-01f, 1.130469269e-01f, 1.135019696e-01f,
+	1.139582742e-01f, 1.144158419e-01f, 1.148746739e-01f, 1.153347714e-01f,
+	1.157961356e-01f, 1.162587677e-01f, 1.167226688e-01f, 1.171878403e-01f,
+	1.176542831e-01f, 1.181219985e-01f, 1.185909876e-01f, 1.190612516e-01f,
+	1.195327916e-01f, 1.200056086e-01f, 1.204797040e-01f, 1.209550786e-01f,
+	1.214317337e-01f, 1.219096704e-01f, 1.223888896e-01f, 1.228693926e-01f,
+	1.233511803e-01f, 1.238342539e-01f, 1.243186143e-01f, 1.248042627e-01f,
+	1.252912000e-01f, 1.257794274e-01f, 1.262689457e-01f, 1.267597561e-01f,
+	1.272518595e-01f, 1.277452569e-01f, 1.282399493e-01f, 1.287359377e-01f,
+	1.292332230e-01f, 1.297318063e-01f, 1.302316884e-01f, 1.307328704e-01f,
+	1.312353531e-01f, 1.317391375e-01f, 1.322442244e-01f, 1.327506149e-01f,
+	1.332583097e-01f, 1.337673099e-01f, 1.342776162e-01f, 1.347892295e-01f,
+	1.353021508e-01f, 1.358163808e-01f, 1.363319205e-01f, 1.368487706e-01f,
+	1.373669320e-01f, 1.378864055e-01f, 1.384071919e-01f, 1.389292920e-01f,
+	1.394527066e-01f, 1.399774365e-01f, 1.405034825e-01f, 1.410308453e-01f,
+	1.415595257e-01f, 1.420895245e-01f, 1.426208423e-01f, 1.431534799e-01f,
+	1.436874380e-01f, 1.442227173e-01f, 1.447593186e-01f, 1.452972425e-01f,
+	1.458364897e-01f, 1.463770608e-01f, 1.469189566e-01f, 1.474621777e-01f,
+	1.480067247e-01f, 1.485525983e-01f, 1.490997990e-01f, 1.496483275e-01f,
+	1.501981845e-01f, 1.507493704e-01f, 1.513018859e-01f, 1.518557316e-01f,
+	1.524109080e-01f, 1.529674156e-01f, 1.535252551e-01f, 1.540844270e-01f,
+	1.546449317e-01f, 1.552067698e-01f, 1.557699418e-01f, 1.563344482e-01f,
+	1.569002895e-01f, 1.574674661e-01f, 1.580359786e-01f, 1.586058273e-01f,
+	1.591770128e-01f, 1.597495354e-01f, 1.603233956e-01f, 1.608985937e-01f,
+	1.614751303e-01f, 1.620530056e-01f, 1.626322202e-01f, 1.632127742e-01f,
+	1.637946682e-01f, 1.643779024e-01f, 1.649624772e-01f, 1.655483930e-01f,
+	1.661356500e-01f, 1.667242485e-01f, 1.673141889e-01f, 1.679054715e-01f,
+	1.684980964e-01f, 1.690920641e-01f, 1.696873747e-01f, 1.702840285e-01f,
+	1.708820257e-01f, 1.714813665e-01f, 1.720820512e-01f, 1.726840800e-01f,
+	1.732874531e-01f, 1.738921705e-01f, 1.744982326e-01f, 1.751056394e-01f,
+	1.757143912e-01f, 1.763244880e-01f, 1.769359299e-01f, 1.775487172e-01f,
+	1.781628498e-01f, 1.787783279e-01f, 1.793951516e-01f, 1.800133209e-01f,
+	1.806328359e-01f, 1.812536967e-01f, 1.818759032e-01f, 1.824994556e-01f,
+	1.831243537e-01f, 1.837505977e-01f, 1.843781875e-01f, 1.850071231e-01f,
+	1.856374044e-01f, 1.862690315e-01f, 1.869020042e-01f, 1.875363225e-01f,
+	1.881719863e-01f, 1.888089956e-01f, 1.894473502e-01f, 1.900870500e-01f,
+	1.907280949e-01f, 1.913704848e-01f, 1.920142195e-01f, 1.926592988e-01f,
+	1.933057227e-01f, 1.939534908e-01f, 1.946026031e-01f, 1.952530592e-01f,
+	1.959048591e-01f, 1.965580024e-01f, 1.972124889e-01f, 1.978683184e-01f,
+	1.985254906e-01f, 1.991840052e-01f, 1.998438620e-01f, 2.005050606e-01f,
+	2.011676008e-01f, 2.018314821e-01f, 2.024967043e-01f, 2.031632671e-01f,
+	2.038311700e-01f, 2.045004127e-01f, 2.051709948e-01f, 2.058429159e-01f,
+	2.065161756e-01f, 2.071907735e-01f, 2.078667091e-01f, 2.085439820e-01f,
+	2.092225918e-01f, 2.099025380e-01f, 2.105838200e-01f, 2.112664375e-01f,
+	2.119503898e-01f, 2.126356766e-01f, 2.133222971e-01f, 2.140102510e-01f,
+	2.146995376e-01f, 2.153901564e-01f, 2.160821068e-01f, 2.167753882e-01f,
+	2.174700000e-01f, 2.181659416e-01f, 2.188632123e-01f, 2.195618115e-01f,
+	2.202617386e-01f, 2.209629929e-01f, 2.216655737e-01f, 2.223694803e-01f,
+	2.230747120e-01f, 2.237812680e-01f, 2.244891478e-01f, 2.251983504e-01f,
+	2.259088752e-01f, 2.266207214e-01f, 2.273338882e-01f, 2.280483747e-01f,
+	2.287641803e-01f, 2.294813041e-01f, 2.301997452e-01f, 2.309195028e-01f,
+	2.316405760e-01f, 2.323629641e-01f, 2.330866660e-01f, 2.338116808e-01f,
+	2.345380078e-01f, 2.352656459e-01f, 2.359945942e-01f, 2.367248518e-01f,
+	2.374564177e-01f, 2.381892909e-01f, 2.389234705e-01f, 2.396589554e-01f,
+	2.403957446e-01f, 2.411338371e-01f, 2.418732318e-01f, 2.426139278e-01f,
+	2.433559239e-01f, 2.440992190e-01f, 2.448438121e-01f, 2.455897021e-01f,
+	2.463368878e-01f, 2.470853681e-01f, 2.478351418e-01f, 2.485862079e-01f,
+	2.493385650e-01f, 2.500922121e-01f, 2.508471479e-01f, 2.516033713e-01f,
+	2.523608809e-01f, 2.531196757e-01f, 2.538797542e-01f, 2.546411152e-01f,
+	2.554037576e-01f, 2.561676799e-01f, 2.569328808e-01f, 2.576993591e-01f,
+	2.584671134e-01f, 2.592361424e-01f, 2.600064447e-01f, 2.607780189e-01f,
+	2.615508637e-01f, 2.623249776e-01f, 2.631003592e-01f, 2.638770072e-01f,
+	2.646549200e-01f, 2.654340962e-01f, 2.662145344e-01f, 2.669962331e-01f,
+	2.677791907e-01f, 2.685634057e-01f, 2.693488768e-01f, 2.701356022e-01f,
+	2.709235805e-01f, 2.717128100e-01f, 2.725032893e-01f, 2.732950167e-01f,
+	2.740879907e-01f, 2.748822095e-01f, 2.756776716e-01f, 2.764743754e-01f,
+	2.772723191e-01f, 2.780715011e-01f, 2.788719198e-01f, 2.796735734e-01f,
+	2.804764601e-01f, 2.812805784e-01f, 2.820859264e-01f, 2.828925024e-01f,
+	2.837003046e-01f, 2.845093312e-01f, 2.853195805e-01f, 2.861310506e-01f,
+	2.869437397e-01f, 2.877576459e-01f, 2.885727675e-01f, 2.893891026e-01f,
+	2.902066492e-01f, 2.910254056e-01f, 2.918453697e-01f, 2.926665397e-01f,
+	2.934889136e-01f, 2.943124894e-01f, 2.951372653e-01f, 2.959632393e-01f,
+	2.967904093e-01f, 2.976187734e-01f, 2.984483295e-01f, 2.992790756e-01f,
+	3.001110097e-01f, 3.009441297e-01f, 3.017784335e-01f, 3.026139190e-01f,
+	3.034505842e-01f, 3.042884270e-01f, 3.051274452e-01f, 3.059676366e-01f,
+	3.068089991e-01f, 3.076515306e-01f, 3.084952288e-01f, 3.093400916e-01f,
+	3.101861168e-01f, 3.110333021e-01f, 3.118816452e-01f, 3.127311440e-01f,
+	3.135817962e-01f, 3.144335994e-01f, 3.152865515e-01f, 3.161406500e-01f,
+	3.169958927e-01f, 3.178522772e-01f, 3.187098012e-01f, 3.195684622e-01f,
+	3.204282581e-01f, 3.212891862e-01f, 3.221512443e-01f, 3.230144299e-01f,
+	3.238787406e-01f, 3.247441739e-01f, 3.256107274e-01f, 3.264783986e-01f,
+	3.273471850e-01f, 3.282170841e-01f, 3.290880933e-01f, 3.299602102e-01f,
+	3.308334322e-01f, 3.317077568e-01f, 3.325831813e-01f, 3.334597032e-01f,
+	3.343373199e-01f, 3.352160288e-01f, 3.360958272e-01f, 3.369767125e-01f,
+	3.378586820e-01f, 3.387417331e-01f, 3.396258631e-01f, 3.405110692e-01f,
+	3.413973488e-01f, 3.422846992e-01f, 3.431731175e-01f, 3.440626011e-01f,
+	3.449531472e-01f, 3.458447530e-01f, 3.467374157e-01f, 3.476311324e-01f,
+	3.485259005e-01f, 3.494217169e-01f, 3.503185789e-01f, 3.512164837e-01f,
+	3.521154282e-01f, 3.530154097e-01f, 3.539164252e-01f, 3.548184719e-01f,
+	3.557215467e-01f, 3.566256467e-01f, 3.575307690e-01f, 3.584369105e-01f,
+	3.593440684e-01f, 3.602522395e-01f, 3.611614210e-01f, 3.620716096e-01f,
+	3.629828024e-01f, 3.638949964e-01f, 3.648081885e-01f, 3.657223755e-01f,
+	3.666375543e-01f, 3.675537220e-01f, 3.684708752e-01f, 3.693890110e-01f,
+	3.703081261e-01f, 3.712282173e-01f, 3.721492816e-01f, 3.730713156e-01f,
+	3.739943161e-01f, 3.749182801e-01f, 3.758432041e-01f, 3.767690850e-01f,
+	3.776959195e-01f, 3.786237043e-01f, 3.795524361e-01f, 3.804821116e-01f,
+	3.814127275e-01f, 3.823442805e-01f, 3.832767672e-01f, 3.842101843e-01f,
+	3.851445283e-01f, 3.860797960e-01f, 3.870159838e-01f, 3.879530884e-01f,
+	3.888911064e-01f, 3.898300342e-01f, 3.907698685e-01f, 3.917106058e-01f,
+	3.926522426e-01f, 3.935947754e-01f, 3.945382007e-01f, 3.954825150e-01f,
+	3.964277147e-01f, 3.973737963e-01f, 3.983207562e-01f, 3.992685909e-01f,
+	4.002172968e-01f, 4.011668702e-01f, 4.021173075e-01f, 4.030686052e-01f,
+	4.040207595e-01f, 4.049737668e-01f, 4.059276235e-01f, 4.068823259e-01f,
+	4.078378702e-01f, 4.087942528e-01f, 4.097514699e-01f, 4.107095179e-01f,
+	4.116683928e-01f, 4.126280911e-01f, 4.135886089e-01f, 4.145499424e-01f,
+	4.155120879e-01f, 4.164750415e-01f, 4.174387993e-01f, 4.184033577e-01f,
+	4.193687126e-01f, 4.203348602e-01f, 4.213017967e-01f, 4.222695182e-01f,
+	4.232380207e-01f, 4.242073003e-01f, 4.251773532e-01f, 4.261481753e-01f,
+	4.271197627e-01f, 4.280921115e-01f, 4.290652176e-01f, 4.300390771e-01f,
+	4.310136859e-01f, 4.319890401e-01f, 4.329651356e-01f, 4.339419683e-01f,
+	4.349195342e-01f, 4.358978292e-01f, 4.368768493e-01f, 4.378565904e-01f,
+	4.388370482e-01f, 4.398182188e-01f, 4.408000980e-01f, 4.417826816e-01f,
+	4.427659654e-01f, 4.437499454e-01f, 4.447346173e-01f, 4.457199769e-01f,
+	4.467060200e-01f, 4.476927424e-01f, 4.486801398e-01f, 4.496682081e-01f,
+	4.506569429e-01f, 4.516463400e-01f, 4.526363951e-01f, 4.536271039e-01f,
+	4.546184621e-01f, 4.556104654e-01f, 4.566031093e-01f, 4.575963897e-01f,
+	4.585903022e-01f, 4.595848423e-01f, 4.605800057e-01f, 4.615757880e-01f,
+	4.625721848e-01f, 4.635691916e-01f, 4.645668041e-01f, 4.655650179e-01f,
+	4.665638283e-01f, 4.675632311e-01f, 4.685632217e-01f, 4.695637956e-01f,
+	4.705649483e-01f, 4.715666754e-01f, 4.725689722e-01f, 4.735718343e-01f,
+	4.745752571e-01f, 4.755792361e-01f, 4.765837666e-01f, 4.775888441e-01f,
+	4.785944641e-01f, 4.796006218e-01f, 4.806073127e-01f, 4.816145322e-01f,
+	4.826222756e-01f, 4.836305382e-01f, 4.846393155e-01f, 4.856486026e-01f,
+	4.866583951e-01f, 4.876686880e-01f, 4.886794769e-01f, 4.896907568e-01f,
+	4.907025231e-01f, 4.917147711e-01f, 4.927274960e-01f, 4.937406930e-01f,
+	4.947543573e-01f, 4.957684843e-01f, 4.967830690e-01f, 4.977981067e-01f,
+	4.988135925e-01f, 4.998295217e-01f, 5.008458893e-01f, 5.018626906e-01f,
+	5.028799206e-01f, 5.038975745e-01f, 5.049156475e-01f, 5.059341345e-01f,
+	5.069530308e-01f, 5.079723313e-01f, 5.089920313e-01f, 5.100121256e-01f,
+	5.110326095e-01f, 5.120534778e-01f, 5.130747258e-01f, 5.140963483e-01f,
+	5.151183404e-01f, 5.161406971e-01f, 5.171634133e-01f, 5.181864842e-01f,
+	5.192099045e-01f, 5.202336694e-01f, 5.212577737e-01f, 5.222822123e-01f,
+	5.233069803e-01f, 5.243320725e-01f, 5.253574838e-01f, 5.263832091e-01f,
+	5.274092434e-01f, 5.284355814e-01f, 5.294622182e-01f, 5.304891484e-01f,
+	5.315163671e-01f, 5.325438689e-01f, 5.335716488e-01f, 5.345997015e-01f,
+	5.356280219e-01f, 5.366566048e-01f, 5.376854450e-01f, 5.387145372e-01f,
+	5.397438762e-01f, 5.407734568e-01f, 5.418032737e-01f, 5.428333217e-01f,
+	5.438635955e-01f, 5.448940899e-01f, 5.459247995e-01f, 5.469557190e-01f,
+	5.479868433e-01f, 5.490181668e-01f, 5.500496844e-01f, 5.510813907e-01f,
+	5.521132803e-01f, 5.531453479e-01f, 5.541775882e-01f, 5.552099957e-01f,
+	5.562425652e-01f, 5.572752912e-01f, 5.583081683e-01f, 5.593411911e-01f,
+	5.603743543e-01f, 5.614076524e-01f, 5.624410799e-01f, 5.634746315e-01f,
+	5.645083017e-01f, 5.655420850e-01f, 5.665759760e-01f, 5.676099692e-01f,
+	5.686440592e-01f, 5.696782404e-01f, 5.707125073e-01f, 5.717468545e-01f,
+	5.727812765e-01f, 5.738157677e-01f, 5.748503225e-01f, 5.758849356e-01f,
+	5.769196012e-01f, 5.779543139e-01f, 5.789890681e-01f, 5.800238583e-01f,
+	5.810586789e-01f, 5.820935242e-01f, 5.831283887e-01f, 5.841632668e-01f,
+	5.851981529e-01f, 5.862330414e-01f, 5.872679267e-01f, 5.883028031e-01f,
+	5.893376650e-01f, 5.903725067e-01f, 5.914073227e-01f, 5.924421072e-01f,
+	5.934768546e-01f, 5.945115592e-01f, 5.955462154e-01f, 5.965808174e-01f,
+	5.976153595e-01f, 5.986498361e-01f, 5.996842415e-01f, 6.007185699e-01f,
+	6.017528156e-01f, 6.027869729e-01f, 6.038210361e-01f, 6.048549994e-01f,
+	6.058888570e-01f, 6.069226033e-01f, 6.079562324e-01f, 6.089897386e-01f,
+	6.100231161e-01f, 6.110563592e-01f, 6.120894620e-01f, 6.131224187e-01f,
+	6.141552236e-01f, 6.151878709e-01f, 6.162203546e-01f, 6.172526692e-01f,
+	6.182848086e-01f, 6.193167670e-01f, 6.203485388e-01f, 6.213801179e-01f,
+	6.224114985e-01f, 6.234426748e-01f, 6.244736410e-01f, 6.255043911e-01f,
+	6.265349194e-01f, 6.275652198e-01f, 6.285952866e-01f, 6.296251139e-01f,
+	6.306546957e-01f, 6.316840261e-01f, 6.327130994e-01f, 6.337419094e-01f,
+	6.347704505e-01f, 6.357987165e-01f, 6.368267016e-01f, 6.378543999e-01f,
+	6.388818055e-01f, 6.399089123e-01f, 6.409357145e-01f, 6.419622061e-01f,
+	6.429883811e-01f, 6.440142336e-01f, 6.450397576e-01f, 6.460649472e-01f,
+	6.470897964e-01f, 6.481142992e-01f, 6.491384496e-01f, 6.501622417e-01f,
+	6.511856694e-01f, 6.522087268e-01f, 6.532314078e-01f, 6.542537065e-01f,
+	6.552756168e-01f, 6.562971328e-01f, 6.573182483e-01f, 6.583389575e-01f,
+	6.593592543e-01f, 6.603791326e-01f, 6.613985864e-01f, 6.624176097e-01f,
+	6.634361965e-01f, 6.644543407e-01f, 6.654720362e-01f, 6.664892770e-01f,
+	6.675060571e-01f, 6.685223704e-01f, 6.695382108e-01f, 6.705535723e-01f,
+	6.715684488e-01f, 6.725828343e-01f, 6.735967226e-01f, 6.746101077e-01f,
+	6.756229835e-01f, 6.766353440e-01f, 6.776471830e-01f, 6.786584944e-01f,
+	6.796692722e-01f, 6.806795103e-01f, 6.816892026e-01f, 6.826983429e-01f,
+	6.837069252e-01f, 6.847149434e-01f, 6.857223914e-01f, 6.867292630e-01f,
+	6.877355522e-01f, 6.887412528e-01f, 6.897463587e-01f, 6.907508638e-01f,
+	6.917547619e-01f, 6.927580471e-01f, 6.937607131e-01f, 6.947627537e-01f,
+	6.957641630e-01f, 6.967649347e-01f, 6.977650627e-01f, 6.987645409e-01f,
+	6.997633631e-01f, 7.007615233e-01f, 7.017590152e-01f, 7.027558327e-01f,
+	7.037519698e-01f, 7.047474202e-01f, 7.057421778e-01f, 7.067362364e-01f,
+	7.077295900e-01f, 7.087222323e-01f, 7.097141572e-01f, 7.107053586e-01f,
+	7.116958304e-01f, 7.126855662e-01f, 7.136745601e-01f, 7.146628059e-01f,
+	7.156502973e-01f, 7.166370283e-01f, 7.176229927e-01f, 7.186081843e-01f,
+	7.195925970e-01f, 7.205762247e-01f, 7.215590611e-01f, 7.225411001e-01f,
+	7.235223355e-01f, 7.245027613e-01f, 7.254823712e-01f, 7.264611590e-01f,
+	7.274391187e-01f, 7.284162441e-01f, 7.293925289e-01f, 7.303679671e-01f,
+	7.313425525e-01f, 7.323162789e-01f, 7.332891402e-01f, 7.342611302e-01f,
+	7.352322427e-01f, 7.362024717e-01f, 7.371718109e-01f, 7.381402542e-01f,
+	7.391077955e-01f, 7.400744285e-01f, 7.410401472e-01f, 7.420049454e-01f,
+	7.429688169e-01f, 7.439317556e-01f, 7.448937553e-01f, 7.458548100e-01f,
+	7.468149133e-01f, 7.477740593e-01f, 7.487322418e-01f, 7.496894545e-01f,
+	7.506456915e-01f, 7.516009464e-01f, 7.525552133e-01f, 7.535084860e-01f,
+	7.544607582e-01f, 7.554120240e-01f, 7.563622772e-01f, 7.573115116e-01f,
+	7.582597211e-01f, 7.592068996e-01f, 7.601530410e-01f, 7.610981391e-01f,
+	7.620421878e-01f, 7.629851811e-01f, 7.639271128e-01f, 7.648679767e-01f,
+	7.658077669e-01f, 7.667464771e-01f, 7.676841013e-01f, 7.686206334e-01f,
+	7.695560672e-01f, 7.704903967e-01f, 7.714236158e-01f, 7.723557184e-01f,
+	7.732866984e-01f, 7.742165497e-01f, 7.751452663e-01f, 7.760728420e-01f,
+	7.769992709e-01f, 7.779245467e-01f, 7.788486635e-01f, 7.797716152e-01f,
+	7.806933957e-01f, 7.816139990e-01f, 7.825334190e-01f, 7.834516496e-01f,
+	7.843686849e-01f, 7.852845187e-01f, 7.861991451e-01f, 7.871125579e-01f,
+	7.880247513e-01f, 7.889357190e-01f, 7.898454552e-01f, 7.907539538e-01f,
+	7.916612087e-01f, 7.925672140e-01f, 7.934719637e-01f, 7.943754517e-01f,
+	7.952776721e-01f, 7.961786189e-01f, 7.970782860e-01f, 7.979766675e-01f,
+	7.988737575e-01f, 7.997695498e-01f, 8.006640387e-01f, 8.015572180e-01f,
+	8.024490819e-01f, 8.033396244e-01f, 8.042288394e-01f, 8.051167212e-01f,
+	8.060032638e-01f, 8.068884611e-01f, 8.077723073e-01f, 8.086547965e-01f,
+	8.095359227e-01f, 8.104156801e-01f, 8.112940626e-01f, 8.121710645e-01f,
+	8.130466798e-01f, 8.139209026e-01f, 8.147937270e-01f, 8.156651473e-01f,
+	8.165351574e-01f, 8.174037515e-01f, 8.182709237e-01f, 8.191366683e-01f,
+	8.200009794e-01f, 8.208638510e-01f, 8.217252774e-01f, 8.225852527e-01f,
+	8.234437712e-01f, 8.243008270e-01f, 8.251564142e-01f, 8.260105271e-01f,
+	8.268631599e-01f, 8.277143068e-01f, 8.285639621e-01f, 8.294121198e-01f,
+	8.302587743e-01f, 8.311039198e-01f, 8.319475505e-01f, 8.327896607e-01f,
+	8.336302447e-01f, 8.344692966e-01f, 8.353068109e-01f, 8.361427817e-01f,
+	8.369772033e-01f, 8.378100701e-01f, 8.386413763e-01f, 8.394711162e-01f,
+	8.402992842e-01f, 8.411258746e-01f, 8.419508818e-01f, 8.427742999e-01f,
+	8.435961235e-01f, 8.444163469e-01f, 8.452349643e-01f, 8.460519703e-01f,
+	8.468673591e-01f, 8.476811252e-01f, 8.484932629e-01f, 8.493037667e-01f,
+	8.501126309e-01f, 8.509198501e-01f, 8.517254186e-01f, 8.525293308e-01f,
+	8.533315812e-01f, 8.541321643e-01f, 8.549310745e-01f, 8.557283063e-01f,
+	8.565238541e-01f, 8.573177126e-01f, 8.581098760e-01f, 8.589003391e-01f,
+	8.596890962e-01f, 8.604761420e-01f, 8.612614708e-01f, 8.620450774e-01f,
+	8.628269562e-01f, 8.636071018e-01f, 8.643855088e-01f, 8.651621718e-01f,
+	8.659370853e-01f, 8.667102439e-01f, 8.674816423e-01f, 8.682512751e-01f,
+	8.690191369e-01f, 8.697852223e-01f, 8.705495260e-01f, 8.713120427e-01f,
+	8.720727670e-01f, 8.728316936e-01f, 8.735888172e-01f, 8.743441325e-01f,
+	8.750976342e-01f, 8.758493170e-01f, 8.765991757e-01f, 8.773472049e-01f,
+	8.780933995e-01f, 8.788377542e-01f, 8.795802637e-01f, 8.803209230e-01f,
+	8.810597266e-01f, 8.817966695e-01f, 8.825317465e-01f, 8.832649524e-01f,
+	8.839962820e-01f, 8.847257302e-01f, 8.854532918e-01f, 8.861789617e-01f,
+	8.869027348e-01f, 8.876246060e-01f, 8.883445702e-01f, 8.890626222e-01f,
+	8.897787571e-01f, 8.904929697e-01f, 8.912052550e-01f, 8.919156080e-01f,
+	8.926240236e-01f, 8.933304969e-01f, 8.940350227e-01f, 8.947375961e-01f,
+	8.954382122e-01f, 8.961368660e-01f, 8.968335524e-01f, 8.975282667e-01f,
+	8.982210037e-01f, 8.989117586e-01f, 8.996005266e-01f, 9.002873026e-01f,
+	9.009720818e-01f, 9.016548594e-01f, 9.023356304e-01f, 9.030143900e-01f,
+	9.036911335e-01f, 9.043658559e-01f, 9.050385524e-01f, 9.057092183e-01f,
+	9.063778488e-01f, 9.070444390e-01f, 9.077089843e-01f, 9.083714799e-01f,
+	9.090319210e-01f, 9.096903029e-01f, 9.103466210e-01f, 9.110008704e-01f,
+	9.116530466e-01f, 9.123031449e-01f, 9.129511605e-01f, 9.135970889e-01f,
+	9.142409255e-01f, 9.148826655e-01f, 9.155223045e-01f, 9.161598378e-01f,
+	9.167952608e-01f, 9.174285690e-01f, 9.180597578e-01f, 9.186888227e-01f,
+	9.193157592e-01f, 9.199405627e-01f, 9.205632288e-01f, 9.211837530e-01f,
+	9.218021307e-01f, 9.224183577e-01f, 9.230324293e-01f, 9.236443412e-01f,
+	9.242540891e-01f, 9.248616684e-01f, 9.254670748e-01f, 9.260703039e-01f,
+	9.266713514e-01f, 9.272702129e-01f, 9.278668841e-01f, 9.284613607e-01f,
+	9.290536384e-01f, 9.296437129e-01f, 9.302315800e-01f, 9.308172353e-01f,
+	9.314006747e-01f, 9.319818939e-01f, 9.325608888e-01f, 9.331376550e-01f,
+	9.337121885e-01f, 9.342844850e-01f, 9.348545405e-01f, 9.354223508e-01f,
+	9.359879117e-01f, 9.365512191e-01f, 9.371122691e-01f, 9.376710574e-01f,
+	9.382275801e-01f, 9.387818330e-01f, 9.393338122e-01f, 9.398835137e-01f,
+	9.404309333e-01f, 9.409760673e-01f, 9.415189115e-01f, 9.420594621e-01f,
+	9.425977150e-01f, 9.431336665e-01f, 9.436673125e-01f, 9.441986492e-01f,
+	9.447276727e-01f, 9.452543791e-01f, 9.457787647e-01f, 9.463008255e-01f,
+	9.468205578e-01f, 9.473379578e-01f, 9.478530216e-01f, 9.483657456e-01f,
+	9.488761260e-01f, 9.493841590e-01f, 9.498898410e-01f, 9.503931682e-01f,
+	9.508941369e-01f, 9.513927436e-01f, 9.518889844e-01f, 9.523828559e-01f,
+	9.528743544e-01f, 9.533634762e-01f, 9.538502179e-01f, 9.543345757e-01f,
+	9.548165463e-01f, 9.552961260e-01f, 9.557733114e-01f, 9.562480988e-01f,
+	9.567204850e-01f, 9.571904662e-01f, 9.576580393e-01f, 9.581232006e-01f,
+	9.585859468e-01f, 9.590462744e-01f, 9.595041802e-01f, 9.599596606e-01f,
+	9.604127125e-01f, 9.608633323e-01f, 9.613115170e-01f, 9.617572630e-01f,
+	9.622005672e-01f, 9.626414263e-01f, 9.630798370e-01f, 9.635157961e-01f,
+	9.639493004e-01f, 9.643803467e-01f, 9.648089319e-01f, 9.652350527e-01f,
+	9.656587060e-01f, 9.660798887e-01f, 9.664985977e-01f, 9.669148300e-01f,
+	9.673285823e-01f, 9.677398517e-01f, 9.681486352e-01f, 9.685549297e-01f,
+	9.689587322e-01f, 9.693600397e-01f, 9.697588494e-01f, 9.701551581e-01f,
+	9.705489630e-01f, 9.709402612e-01f, 9.713290498e-01f, 9.717153259e-01f,
+	9.720990867e-01f, 9.724803293e-01f, 9.728590508e-01f, 9.732352486e-01f,
+	9.736089197e-01f, 9.739800615e-01f, 9.743486712e-01f, 9.747147460e-01f,
+	9.750782833e-01f, 9.754392803e-01f, 9.757977344e-01f, 9.761536429e-01f,
+	9.765070032e-01f, 9.768578127e-01f, 9.772060687e-01f, 9.775517686e-01f,
+	9.778949100e-01f, 9.782354902e-01f, 9.785735068e-01f, 9.789089571e-01f,
+	9.792418388e-01f, 9.795721494e-01f, 9.798998863e-01f, 9.802250473e-01f,
+	9.805476297e-01f, 9.808676314e-01f, 9.811850498e-01f, 9.814998826e-01f,
+	9.818121275e-01f, 9.821217821e-01f, 9.824288442e-01f, 9.827333114e-01f,
+	9.830351816e-01f, 9.833344524e-01f, 9.836311216e-01f, 9.839251871e-01f,
+	9.842166465e-01f, 9.845054979e-01f, 9.847917389e-01f, 9.850753675e-01f,
+	9.853563816e-01f, 9.856347790e-01f, 9.859105578e-01f, 9.861837157e-01f,
+	9.864542509e-01f, 9.867221613e-01f, 9.869874448e-01f, 9.872500996e-01f,
+	9.875101236e-01f, 9.877675150e-01f, 9.880222717e-01f, 9.882743919e-01f,
+	9.885238737e-01f, 9.887707153e-01f, 9.890149148e-01f, 9.892564704e-01f,
+	9.894953802e-01f, 9.897316426e-01f, 9.899652557e-01f, 9.901962177e-01f,
+	9.904245271e-01f, 9.906501820e-01f, 9.908731808e-01f, 9.910935217e-01f,
+	9.913112033e-01f, 9.915262238e-01f, 9.917385816e-01f, 9.919482751e-01f,
+	9.921553029e-01f, 9.923596632e-01f, 9.925613547e-01f, 9.927603757e-01f,
+	9.929567249e-01f, 9.931504007e-01f, 9.933414016e-01f, 9.935297264e-01f,
+	9.937153734e-01f, 9.938983415e-01f, 9.940786291e-01f, 9.942562349e-01f,
+	9.944311577e-01f, 9.946033961e-01f, 9.947729488e-01f, 9.949398145e-01f,
+	9.951039921e-01f, 9.952654802e-01f, 9.954242776e-01f, 9.955803833e-01f,
+	9.957337959e-01f, 9.958845144e-01f, 9.960325376e-01f, 9.961778644e-01f,
+	9.963204937e-01f, 9.964604245e-01f, 9.965976558e-01f, 9.967321863e-01f,
+	9.968640153e-01f, 9.969931416e-01f, 9.971195644e-01f, 9.972432826e-01f,
+	9.973642954e-01f, 9.974826018e-01f, 9.975982010e-01f, 9.977110920e-01f,
+	9.978212741e-01f, 9.979287464e-01f, 9.980335081e-01f, 9.981355584e-01f,
+	9.982348965e-01f, 9.983315218e-01f, 9.984254335e-01f, 9.985166308e-01f,
+	9.986051131e-01f, 9.986908798e-01f, 9.987739302e-01f, 9.988542636e-01f,
+	9.989318795e-01f, 9.990067772e-01f, 9.990789563e-01f, 9.991484162e-01f,
+	9.992151563e-01f, 9.992791762e-01f, 9.993404753e-01f, 9.993990533e-01f,
+	9.994549097e-01f, 9.995080440e-01f, 9.995584558e-01f, 9.996061449e-01f,
+	9.996511108e-01f, 9.996933531e-01f, 9.997328717e-01f, 9.997696661e-01f,
+	9.998037361e-01f, 9.998350814e-01f, 9.998637018e-01f, 9.998895972e-01f,
+	9.999127672e-01f, 9.999332118e-01f, 9.999509307e-01f, 9.999659239e-01f,
+	9.999781911e-01f, 9.999877325e-01f, 9.999945477e-01f, 9.999986369e-01f,
+	1.000000000e+00f,
+};
+
+static const q15_t win_blackmanHarris_half_q15[WINDOW_HALF_LEN] = {
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 2,
+	2, 2, 2, 2, 2, 2, 2, 3,
+	3, 3, 3, 3, 3, 3, 3, 3,
+	3, 3, 3, 3, 3, 3, 4, 4,
+	4, 4, 4, 4, 4, 4, 4, 4,
+	5, 5, 5, 5, 5, 5, 5, 5,
+	5, 6, 6, 6, 6, 6, 6, 6,
+	7, 7, 7, 7, 7, 7, 7, 8,
+	8, 8, 8, 8, 8, 9, 9, 9,
+	9, 9, 10, 10, 10, 10, 10, 11,
+	11, 11, 11, 11, 12, 12, 12, 12,
+	13, 13, 13, 13, 13, 14, 14, 14,
+	14, 15, 15, 15, 16, 16, 16, 16,
+	17, 17, 17, 17, 18, 18, 18, 19,
+	19, 19, 20, 20, 20, 21, 21, 21,
+	22, 22, 22, 23, 23, 23, 24, 24,
+	24, 25, 25, 25, 26, 26, 26, 27,
+	27, 28, 28, 28, 29, 29, 30, 30,
+	30, 31, 31, 32, 32, 33, 33, 34,
+	34, 34, 35, 35, 36, 36, 37, 37,
+	38, 38, 39, 39, 40, 40, 41, 41,
+	42, 42, 43, 43, 44, 44, 45, 45,
+	46, 47, 47, 48, 48, 49, 49, 50,
+	51, 51, 52, 52, 53, 54, 54, 55,
+	56, 56, 57, 58, 58, 59, 59, 60,
+	61, 62, 62, 63, 64, 64, 65, 66,
+	66, 67, 68, 69, 69, 70, 71, 72,
+	72, 73, 74, 75, 76, 76, 77, 78,
+	79, 80, 80, 81, 82, 83, 84, 85,
+	85, 86, 87, 88, 89, 90, 91, 92,
+	93, 94, 95, 95, 96, 97, 98, 99,
+	100, 101, 102, 103, 104, 105, 106, 107,
+	108, 109, 110, 111, 112, 114, 115, 116,
+	117, 118, 119, 120, 121, 122, 124, 125,
+	126, 127, 128, 129, 131, 132, 133, 134,
+	135, 137, 138, 139, 140, 142, 143, 144,
+	145, 147, 148, 149, 151, 152, 153, 155,
+	156, 157, 159, 160, 162, 163, 164, 166,
+	167, 169, 170, 172, 173, 175, 176, 177,
+	179, 181, 182, 184, 185, 187, 188, 190,
+	191, 193, 195, 196, 198, 200, 201, 203,
+	205, 206, 208, 210, 211, 213, 215, 217,
+	218, 220, 222, 224, 225, 227, 229, 231,
+	233, 235, 236, 238, 240, 242, 244, 246,
+	248, 250, 252, 254, 256, 258, 260, 262,
+	264, 266, 268, 270, 272, 274, 276, 278,
+	281, 283, 285, 287, 289, 291, 294, 296,
+	298, 300, 303, 305, 307, 309, 312, 314,
+	316, 319, 321, 324, 326, 328, 331, 333,
+	336, 338, 341, 343, 346, 348, 351, 353,
+	356, 358, 361, 364, 366, 369, 371, 374,
+	377, 379, 382, 385, 388, 390, 393, 396,
+	399, 402, 404, 407, 410, 413, 416, 419,
+	422, 425, 428, 431, 434, 437, 440, 443,
+	446, 449, 452, 455, 458, 461, 464, 468,
+	471, 474, 477, 480, 484, 487, 490, 493,
+	497, 500, 504, 507, 510, 514, 517, 521,
+	524, 527, 531, 534, 538, 542, 545, 549,
+	552, 556, 560, 563, 567, 571, 574, 578,
+	582, 586, 589, 593, 597, 601, 605, 609,
+	613, 616, 620, 624, 628, 632, 636, 640,
+	645, 649, 653, 657, 661, 665, 669, 673,
+	678, 682, 686, 691, 695, 699, 703, 708,
+	712, 717, 721, 726, 730, 734, 739, 744,
+	748, 753, 757, 762, 767, 771, 776, 781,
+	785, 790, 795, 800, 804, 809, 814, 819,
+	824, 829, 834, 839, 844, 849, 854, 859,
+	864, 869, 874, 879, 885, 890, 895, 900,
+	906, 911, 916, 922, 927, 932, 938, 943,
+	949, 954, 960, 965, 971, 976, 982, 988,
+	993, 999, 1005, 1010, 1016, 1022, 1028, 1034,
+	1039, 1045, 1051, 1057, 1063, 1069, 1075, 1081,
+	1087, 1093, 1099, 1106, 1112, 1118, 1124, 1130,
+	1137, 1143, 1149, 1156, 1162, 1168, 1175, 1181,
+	1188, 1194, 1201, 1207, 1214, 1221, 1227, 1234,
+	1241, 1247, 1254, 1261, 1268, 1275, 1281, 1288,
+	1295, 1302, 1309, 1316, 1323, 1330, 1337, 1345,
+	1352, 1359, 1366, 1373, 1381, 1388, 1395, 1403,
+	1410, 1417, 1425, 1432, 1440, 1447, 1455, 1462,
+	1470, 1478, 1485, 1493, 1501, 1509, 1516, 1524,
+	1532, 1540, 1548, 1556, 1564, 1572, 1580, 1588,
+	1596, 1604, 1612, 1620, 1629, 1637, 1645, 1653,
+	1662, 1670, 1679, 1687, 1695, 1704, 1713, 1721,
+	1730, 1738, 1747, 1756, 1764, 1773, 1782, 1791,
+	1800, 1808, 1817, 1826, 1835, 1844, 1853, 1862,
+	1872, 1881, 1890, 1899, 1908, 1918, 1927, 1936,
+	1946, 1955, 1965, 1974, 1984, 1993, 2003, 2012,
+	2022, 2032, 2041, 2051, 2061, 2071, 2081, 2090,
+	2100, 2110, 2120, 2130, 2140, 2150, 2161, 2171,
+	2181, 2191, 2201, 2212, 2222, 2232, 2243, 2253,
+	2264, 2274, 2285, 2295, 2306, 2317, 2327, 2338,
+	2349, 2360, 2371, 2381, 2392, 2403, 2414, 2425,
+	2436, 2447, 2458, 2470, 2481, 2492, 2503, 2515,
+	2526, 2537, 2549, 2560, 2572, 2583, 2595, 2606,
+	2618, 2630, 2641, 2653, 2665, 2677, 2689, 2701,
+	2713, 2725, 2737, 2749, 2761, 2773, 2785, 2797,
+	2809, 2822, 2834, 2846, 2859, 2871, 2884, 2896,
+	2909, 2921, 2934, 2947, 2959, 2972, 2985, 2998,
+	3011, 3023, 3036, 3049, 3062, 3075, 3089, 3102,
+	3115, 3128, 3141, 3155, 3168, 3181, 3195, 3208,
+	3222, 3235, 3249, 3262, 3276, 3290, 3303, 3317,
+	3331, 3345, 3359, 3373, 3387, 3401, 3415, 3429,
+	3443, 3457, 3471, 3486, 3500, 3514, 3529, 3543,
+	3557, 3572, 3587, 3601, 3616, 3630, 3645, 3660,
+	3675, 3689, 3704, 3719, 3734, 3749, 3764, 3779,
+	3794, 3810, 3825, 3840, 3855, 3871, 3886, 3901,
+	3917, 3932, 3948, 3963, 3979, 3995, 4010, 4026,
+	4042, 4058, 4074, 4090, 4106, 4122, 4138, 4154,
+	4170, 4186, 4202, 4218, 4235, 4251, 4267, 4284,
+	4300, 4317, 4333, 4350, 4367, 4383, 4400, 4417,
+	4434, 4450, 4467, 4484, 4501, 4518, 4535, 4552,
+	4570, 4587, 4604, 4621, 4639, 4656, 4673, 4691,
+	4708, 4726, 4743, 4761, 4779, 4796, 4814, 4832,
+	4850, 4868, 4886, 4904, 4922, 4940, 4958, 4976,
+	4994, 5012, 5031, 5049, 5067, 5086, 5104, 5123,
+	5141, 5160, 5179, 5197, 5216, 5235, 5253, 5272,
+	5291, 5310, 5329, 5348, 5367, 5386, 5405, 5425,
+	5444, 5463, 5483, 5502, 5521, 5541, 5560, 5580,
+	5599, 5619, 5639, 5659, 5678, 5698, 5718, 5738,
+	5758, 5778, 5798, 5818, 5838, 5858, 5878, 5899,
+	5919, 5939, 5960, 5980, 6001, 6021, 6042, 6062,
+	6083, 6104, 6124, 6145, 6166, 6187, 6208, 6229,
+	6250, 6271, 6292, 6313, 6334, 6355, 6377, 6398,
+	6419, 6441, 6462, 6484, 6505, 6527, 6548, 6570,
+	6592, 6614, 6635, 6657, 6679, 6701, 6723, 6745,
+	6767, 6789, 6811, 6834, 6856, 6878, 6900, 6923,
+	6945, 6968, 6990, 7013, 7035, 7058, 7081, 7103,
+	7126, 7149, 7172, 7195, 7218, 7241, 7264, 7287,
+	7310, 7333, 7356, 7379, 7403, 7426, 7449, 7473,
+	7496, 7520, 7543, 7567, 7590, 7614, 7638, 7662,
+	7685, 7709, 7733, 7757, 7781, 7805, 7829, 7853,
+	7877, 7901, 7926, 7950, 7974, 7999, 8023, 8047,
+	8072, 8096, 8121, 8146, 8170, 8195, 8220, 8245,
+	8269, 8294, 8319, 8344, 8369, 8394, 8419, 8444,
+	8469, 8495, 8520, 8545, 8570, 8596, 8621, 8647,
+	8672, 8698, 8723, 8749, 8775, 8800, 8826, 8852,
+	8878, 8903, 8929, 8955, 8981, 9007, 9033, 9060,
+	9086, 9112, 9138, 9164, 9191, 9217, 9243, 9270,
+	9296, 9323, 9349, 9376, 9403, 9429, 9456, 9483,
+	9509, 9536, 9563, 9590, 9617, 9644, 9671, 9698,
+	9725, 9752, 9780, 9807, 9834, 9861, 9889, 9916,
+	9943, 9971, 9998, 10026, 10054, 10081, 10109, 10136,
+	10164, 10192, 10220, 10248, 10275, 10303, 10331, 10359,
+	10387, 10415, 10443, 10472, 10500, 10528, 10556, 10585,
+	10613, 10641, 10670, 10698, 10727, 10755, 10784, 10812,
+	10841, 10869, 10898, 10927, 10956, 10984, 11013, 11042,
+	11071, 11100, 11129, 11158, 11187, 11216, 11245, 11274,
+	11303, 11333, 11362, 11391, 11420, 11450, 11479, 11509,
+	11538, 11568, 11597, 11627, 11656, 11686, 11716, 11745,
+	11775, 11805, 11835, 11864, 11894, 11924, 11954, 11984,
+	12014, 12044, 12074, 12104, 12134, 12164, 12195, 12225,
+	12255, 12285, 12316, 12346, 12376, 12407, 12437, 12468,
+	12498, 12529, 12559, 12590, 12620, 12651, 12682, 12712,
+	12743, 12774, 12805, 12836, 12866, 12897, 12928, 12959,
+	12990, 13021, 13052, 13083, 13114, 13145, 13177, 13208,
+	13239, 13270, 13301, 13333, 13364, 13395, 13427, 13458,
+	13490, 13521, 13552, 13584, 13616, 13647, 13679, 13710,
+	13742, 13774, 13805, 13837, 13869, 13900, 13932, 13964,
+	13996, 14028, 14060, 14092, 14123, 14155, 14187, 14219,
+	14251, 14284, 14316, 14348, 14380, 14412, 14444, 14476,
+	14509, 14541, 14573, 14605, 14638, 14670, 14702, 14735,
+	14767, 14800, 14832, 14864, 14897, 14929, 14962, 14995,
+	15027, 15060, 15092, 15125, 15158, 15190, 15223, 15256,
+	15288, 15321, 15354, 15387, 15419, 15452, 15485, 15518,
+	15551, 15584, 15617, 15650, 15683, 15716, 15749, 15782,
+	15815, 15848, 15881, 15914, 15947, 15980, 16013, 16046,
+	16079, 16113, 16146, 16179, 16212, 16245, 16279, 16312,
+	16345, 16378, 16412, 16445, 16478, 16512, 16545, 16578,
+	16612, 16645, 16679, 16712, 16746, 16779, 16812, 16846,
+	16879, 16913, 16946, 16980, 17013, 17047, 17081, 17114,
+	17148, 17181, 17215, 17249, 17282, 17316, 17349, 17383,
+	17417, 17450, 17484, 17518, 17551, 17585, 17619, 17653,
+	17686, 17720, 17754, 17788, 17821, 17855, 17889, 17923,
+	17956, 17990, 18024, 18058, 18092, 18125, 18159, 18193,
+	18227, 18261, 18295, 18328, 18362, 18396, 18430, 18464,
+	18498, 18532, 18566, 18599, 18633, 18667, 18701, 18735,
+	18769, 18803, 18837, 18871, 18905, 18938, 18972, 19006,
+	19040, 19074, 19108, 19142, 19176, 19210, 19244, 19278,
+	19311, 19345, 19379, 19413, 19447, 19481, 19515, 19549,
+	19583, 19617, 19650, 19684, 19718, 19752, 19786, 19820,
+	19854, 19888, 19922, 19955, 19989, 20023, 20057, 20091,
+	20125, 20158, 20192, 20226, 20260, 20294, 20328, 20361,
+	20395, 20429, 20463, 20497, 20530, 20564, 20598, 20632,
+	20665, 20699, 20733, 20766, 20800, 20834, 20868, 20901,
+	20935, 20969, 21002, 21036, 21069, 21103, 21137, 21170,
+	21204, 21237, 21271, 21305, 21338, 21372, 21405, 21439,
+	21472, 21506, 21539, 21572, 21606, 21639, 21673, 21706,
+	21739, 21773, 21806, 21840, 21873, 21906, 21939, 21973,
+	22006, 22039, 22072, 22106, 22139, 22172, 22205, 22238,
+	22271, 22305, 22338, 22371, 22404, 22437, 22470, 22503,
+	22536, 22569, 22602, 22635, 22667, 22700, 22733, 22766,
+	22799, 22832, 22864, 22897, 22930, 22963, 22995, 23028,
+	23061, 23093, 23126, 23158, 23191, 23223, 23256, 23288,
+	23321, 23353, 23386, 23418, 23450, 23483, 23515, 23547,
+	23580, 23612, 23644, 23676, 23708, 23741, 23773, 23805,
+	23837, 23869, 23901, 23933, 23965, 23997, 24028, 24060,
+	24092, 24124, 24156, 24187, 24219, 24251, 24282, 24314,
+	24346, 24377, 24409, 24440, 24472, 24503, 24534, 24566,
+	24597, 24628, 24660, 24691, 24722, 24753, 24784, 24816,
+	24847, 24878, 24909, 24940, 24971, 25001, 25032, 25063,
+	25094, 25125, 25155, 25186, 25217, 25247, 25278, 25309,
+	25339, 25370, 25400, 25430, 25461, 25491, 25521, 25552,
+	25582, 25612, 25642, 25672, 25702, 25732, 25762, 25792,
+	25822, 25852, 25882, 25911, 25941, 25971, 26000, 26030,
+	26060, 26089, 26119, 26148, 26177, 26207, 26236, 26265,
+	26295, 26324, 26353, 26382, 26411, 26440, 26469, 26498,
+	26527, 26556, 26584, 26613, 26642, 26671, 26699, 26728,
+	26756, 26785, 26813, 26841, 26870, 26898, 26926, 26954,
+	26983, 27011, 27039, 27067, 27095, 27123, 27150, 27178,
+	27206, 27234, 27261, 27289, 27316, 27344, 27371, 27399,
+	27426, 27453, 27481, 27508, 27535, 27562, 27589, 27616,
+	27643, 27670, 27697, 27723, 27750, 27777, 27803, 27830,
+	27856, 27883, 27909, 27936, 27962, 27988, 28014, 28041,
+	28067, 28093, 28119, 28144, 28170, 28196, 28222, 28247,
+	28273, 28299, 28324, 28350, 28375, 28400, 28426, 28451,
+	28476, 28501, 28526, 28551, 28576, 28601, 28626, 28651,
+	28675, 28700, 28724, 28749, 28773, 28798, 28822, 28846,
+	28871, 28895, 28919, 28943, 28967, 28991, 29015, 29038,
+	29062, 29086, 29109, 29133, 29156, 29180, 29203, 29226,
+	29250, 29273, 29296, 29319, 29342, 29365, 29387, 29410,
+	29433, 29456, 29478, 29501, 29523, 29545, 29568, 29590,
+	29612, 29634, 29656, 29678, 29700, 29722, 29744, 29766,
+	29787, 29809, 29830, 29852, 29873, 29894, 29916, 29937,
+	29958, 29979, 30000, 30021, 30042, 30062, 30083, 30104,
+	30124, 30145, 30165, 30185, 30206, 30226, 30246, 30266,
+	30286, 30306, 30326, 30345, 30365, 30385, 30404, 30424,
+	30443, 30463, 30482, 30501, 30520, 30539, 30558, 30577,
+	30596, 30615, 30633, 30652, 30670, 30689, 30707, 30726,
+	30744, 30762, 30780, 30798, 30816, 30834, 30852, 30869,
+	30887, 30905, 30922, 30940, 30957, 30974, 30991, 31008,
+	31025, 31042, 31059, 31076, 31093, 31109, 31126, 31142,
+	31159, 31175, 31191, 31208, 31224, 31240, 31256, 31272,
+	31287, 31303, 31319, 31334, 31350, 31365, 31381, 31396,
+	31411, 31426, 31441, 31456, 31471, 31486, 31500, 31515,
+	31529, 31544, 31558, 31572, 31587, 31601, 31615, 31629,
+	31643, 31657, 31670, 31684, 31697, 31711, 31724, 31738,
+	31751, 31764, 31777, 31790, 31803, 31816, 31829, 31841,
+	31854, 31866, 31879, 31891, 31903, 31915, 31927, 31939,
+	31951, 31963, 31975, 31987, 31998, 32010, 32021, 32032,
+	32044, 32055, 32066, 32077, 32088, 32099, 32109, 32120,
+	32131, 32141, 32151, 32162, 32172, 32182, 32192, 32202,
+	32212, 32222, 32232, 32241, 32251, 32260, 32270, 32279,
+	32288, 32297, 32306, 32315, 32324, 32333, 32342, 32350,
+	32359, 32367, 32376, 32384, 32392, 32400, 32408, 32416,
+	32424, 32432, 32439, 32447, 32454, 32462, 32469, 32476,
+	32483, 32490, 32497, 32504, 32511, 32518, 32524, 32531,
+	32537, 32544, 32550, 32556, 32562, 32568, 32574, 32580,
+	32586, 32591, 32597, 32602, 32608, 32613, 32618, 32623,
+	32628, 32633, 32638, 32643, 32647, 32652, 32657, 32661,
+	32665, 32669, 32674, 32678, 32682, 32686, 32689, 32693,
+	32697, 32700, 32704, 32707, 32710, 32713, 32716, 32719,
+	32722, 32725, 32728, 32730, 32733, 32735, 32738, 32740,
+	32742, 32744, 32746, 32748, 32750, 32752, 32754, 32755,
+	32757, 32758, 32759, 32760, 32762, 32763, 32764, 32764,
+	32765, 32766, 32766, 32767, 32767, 32767, 32767, 32767,
+	32767,
+};
+
+static const float32_t win_blackmanHarris_bias[WINDOW_BIAS_LEN] = {
+	0.000000000e+00f, 2.475608067e-03f, 4.951207913e-03f, 7.426791314e-03f,
+	9.902350049e-03f, 1.237787589e-02f, 1.485336063e-02f, 1.732879602e-02f,
+	1.980417385e-02f, 2.227948589e-02f, 2.475472391e-02f, 2.722987969e-02f,
+	2.970494498e-02f, 3.217991156e-02f, 3.465477120e-02f, 3.712951565e-02f,
+	3.960413668e-02f, 4.207862604e-02f, 4.455297548e-02f, 4.702717677e-02f,
+	4.950122165e-02f, 5.197510186e-02f, 5.444880915e-02f, 5.692233526e-02f,
+	5.939567191e-02f, 6.186881086e-02f, 6.434174381e-02f, 6.681446249e-02f,
+	6.928695863e-02f, 7.175922393e-02f, 7.423125011e-02f, 7.670302886e-02f,
+	7.917455190e-02f, 8.164581090e-02f, 8.411679757e-02f, 8.658750358e-02f,
+	8.905792061e-02f, 9.152804033e-02f, 9.399785440e-02f, 9.646735449e-02f,
+	9.893653225e-02f, 1.014053793e-01f, 1.038738873e-01f, 1.063420479e-01f,
+	1.088098527e-01f, 1.112772934e-01f, 1.137443614e-01f, 1.162110485e-01f,
+	1.186773462e-01f, 1.211432461e-01f, 1.236087399e-01f, 1.260738189e-01f,
+	1.285384749e-01f, 1.310026994e-01f, 1.334664839e-01f, 1.359298199e-01f,
+	1.383926990e-01f, 1.408551126e-01f, 1.433170524e-01f, 1.457785097e-01f,
+	1.482394761e-01f, 1.506999430e-01f, 1.531599020e-01f, 1.556193443e-01f,
+	1.580782616e-01f,
+};
+
+static const float32_t win_kaiser_half[WINDOW_HALF_LEN] = {
+	1.332513998e-03f, 1.356677629e-03f, 1.381047730e-03f, 1.405625294e-03f,
+	1.430411316e-03f, 1.455406792e-03f, 1.480612722e-03f, 1.506030107e-03f,
+	1.531659951e-03f, 1.557503260e-03f, 1.583561042e-03f, 1.609834307e-03f,
+	1.636324068e-03f, 1.663031339e-03f, 1.689957138e-03f, 1.717102483e-03f,
+	1.744468395e-03f, 1.772055898e-03f, 1.799866018e-03f, 1.827899783e-03f,
+	1.856158222e-03f, 1.884642367e-03f, 1.913353253e-03f, 1.942291916e-03f,
+	1.971459394e-03f, 2.000856730e-03f, 2.030484964e-03f, 2.060345143e-03f,
+	2.090438314e-03f, 2.120765526e-03f, 2.151327830e-03f, 2.182126280e-03f,
+	2.213161932e-03f, 2.244435843e-03f, 2.275949074e-03f, 2.307702687e-03f,
+	2.339697745e-03f, 2.371935316e-03f, 2.404416467e-03f, 2.437142270e-03f,
+	2.470113796e-03f, 2.503332120e-03f, 2.536798320e-03f, 2.570513473e-03f,
+	2.604478662e-03f, 2.638694969e-03f, 2.673163479e-03f, 2.707885279e-03f,
+	2.742861459e-03f, 2.778093110e-03f, 2.813581325e-03f, 2.849327199e-03f,
+	2.885331831e-03f, 2.921596319e-03f, 2.958121766e-03f, 2.994909274e-03f,
+	3.031959949e-03f, 3.069274899e-03f, 3.106855234e-03f, 3.144702065e-03f,
+	3.182816505e-03f, 3.221199671e-03f, 3.259852681e-03f, 3.298776653e-03f,
+	3.337972709e-03f, 3.377441974e-03f, 3.417185572e-03f, 3.457204632e-03f,
+	3.497500283e-03f, 3.538073655e-03f, 3.578925884e-03f, 3.620058105e-03f,
+	3.661471454e-03f, 3.703167071e-03f, 3.745146097e-03f, 3.787409677e-03f,
+	3.829958954e-03f, 3.872795076e-03f, 3.915919192e-03f, 3.959332452e-03f,
+	4.003036011e-03f, 4.047031021e-03f, 4.091318641e-03f, 4.135900029e-03f,
+	4.180776344e-03f, 4.225948750e-03f, 4.271418410e-03f, 4.317186491e-03f,
+	4.363254160e-03f, 4.409622588e-03f, 4.456292945e-03f, 4.503266406e-03f,
+	4.550544146e-03f, 4.598127341e-03f, 4.646017172e-03f, 4.694214818e-03f,
+	4.742721462e-03f, 4.791538290e-03f, 4.840666486e-03f, 4.890107240e-03f,
+	4.939861741e-03f, 4.989931181e-03f, 5.040316753e-03f, 5.091019652e-03f,
+	5.142041076e-03f, 5.193382224e-03f, 5.245044295e-03f, 5.297028492e-03f,
+	5.349336019e-03f, 5.401968083e-03f, 5.454925889e-03f, 5.508210649e-03f,
+	5.561823572e-03f, 5.615765872e-03f, 5.670038762e-03f, 5.724643460e-03f,
+	5.779581182e-03f, 5.834853148e-03f, 5.890460580e-03f, 5.946404700e-03f,
+	6.002686733e-03f, 6.059307905e-03f, 6.116269444e-03f, 6.173572580e-03f,
+	6.231218543e-03f, 6.289208566e-03f, 6.347543884e-03f, 6.406225733e-03f,
+	6.465255351e-03f, 6.524633976e-03f, 6.584362850e-03f, 6.644443216e-03f,
+	6.704876316e-03f, 6.765663398e-03f, 6.826805708e-03f, 6.888304495e-03f,
+	6.950161009e-03f, 7.012376503e-03f, 7.074952229e-03f, 7.137889443e-03f,
+	7.201189402e-03f, 7.264853363e-03f, 7.328882586e-03f, 7.393278332e-03f,
+	7.458041864e-03f, 7.523174446e-03f, 7.588677343e-03f, 7.654551823e-03f,
+	7.720799154e-03f, 7.787420606e-03f, 7.854417451e-03f, 7.921790961e-03f,
+	7.989542411e-03f, 8.057673077e-03f, 8.126184236e-03f, 8.195077167e-03f,
+	8.264353149e-03f, 8.334013465e-03f, 8.404059396e-03f, 8.474492228e-03f,
+	8.545313247e-03f, 8.616523738e-03f, 8.688124991e-03f, 8.760118295e-03f,
+	8.832504941e-03f, 8.905286222e-03f, 8.978463432e-03f, 9.052037866e-03f,
+	9.126010820e-03f, 9.200383591e-03f, 9.275157480e-03f, 9.350333786e-03f,
+	9.425913811e-03f, 9.501898858e-03f, 9.578290230e-03f, 9.655089235e-03f,
+	9.732297177e-03f, 9.809915365e-03f, 9.887945109e-03f, 9.966387718e-03f,
+	1.004524450e-02f, 1.012451678e-02f, 1.020420586e-02f, 1.028431306e-02f,
+	1.036483970e-02f, 1.044578709e-02f, 1.052715655e-02f, 1.060894940e-02f,
+	1.069116697e-02f, 1.077381057e-02f, 1.085688153e-02f, 1.094038117e-02f,
+	1.102431082e-02f, 1.110867181e-02f, 1.119346546e-02f, 1.127869310e-02f,
+	1.136435606e-02f, 1.145045568e-02f, 1.153699328e-02f, 1.162397020e-02f,
+	1.171138777e-02f, 1.179924732e-02f, 1.188755021e-02f, 1.197629775e-02f,
+	1.206549129e-02f, 1.215513217e-02f, 1.224522173e-02f, 1.233576131e-02f,
+	1.242675225e-02f, 1.251819589e-02f, 1.261009359e-02f, 1.270244668e-02f,
+	1.279525650e-02f, 1.288852442e-02f, 1.298225177e-02f, 1.307643991e-02f,
+	1.317109017e-02f, 1.326620392e-02f, 1.336178251e-02f, 1.345782728e-02f,
+	1.355433959e-02f, 1.365132080e-02f, 1.374877226e-02f, 1.384669532e-02f,
+	1.394509134e-02f, 1.404396168e-02f, 1.414330769e-02f, 1.424313074e-02f,
+	1.434343219e-02f, 1.444421338e-02f, 1.454547570e-02f, 1.464722049e-02f,
+	1.474944912e-02f, 1.485216296e-02f, 1.495536336e-02f, 1.505905170e-02f,
+	1.516322933e-02f, 1.526789763e-02f, 1.537305795e-02f, 1.547871168e-02f,
+	1.558486017e-02f, 1.569150479e-02f, 1.579864692e-02f, 1.590628792e-02f,
+	1.601442917e-02f, 1.612307204e-02f, 1.623221789e-02f, 1.634186810e-02f,
+	1.645202404e-02f, 1.656268709e-02f, 1.667385862e-02f, 1.678554001e-02f,
+	1.689773263e-02f, 1.701043785e-02f, 1.712365705e-02f, 1.723739162e-02f,
+	1.735164292e-02f, 1.746641233e-02f, 1.758170123e-02f, 1.769751101e-02f,
+	1.781384303e-02f, 1.793069869e-02f, 1.804807935e-02f, 1.816598640e-02f,
+	1.828442122e-02f, 1.840338519e-02f, 1.852287969e-02f, 1.864290610e-02f,
+	1.876346582e-02f, 1.888456021e-02f, 1.900619066e-02f, 1.912835855e-02f,
+	1.925106528e-02f, 1.937431221e-02f, 1.949810075e-02f, 1.962243226e-02f,
+	1.974730813e-02f, 1.987272976e-02f, 1.999869852e-02f, 2.012521580e-02f,
+	2.025228299e-02f, 2.037990146e-02f, 2.050807262e-02f, 2.063679784e-02f,
+	2.076607851e-02f, 2.089591601e-02f, 2.102631174e-02f, 2.115726708e-02f,
+	2.128878342e-02f, 2.142086214e-02f, 2.155350463e-02f, 2.168671228e-02f,
+	2.182048648e-02f, 2.195482860e-02f, 2.208974005e-02f, 2.222522221e-02f,
+	2.236127647e-02f, 2.249790420e-02f, 2.263510681e-02f, 2.277288568e-02f,
+	2.291124220e-02f, 2.305017775e-02f, 2.318969372e-02f, 2.332979150e-02f,
+	2.347047247e-02f, 2.361173803e-02f, 2.375358956e-02f, 2.389602845e-02f,
+	2.403905609e-02f, 2.418267386e-02f, 2.432688315e-02f, 2.447168534e-02f,
+	2.461708183e-02f, 2.476307400e-02f, 2.490966323e-02f, 2.505685092e-02f,
+	2.520463844e-02f, 2.535302718e-02f, 2.550201854e-02f, 2.565161389e-02f,
+	2.580181462e-02f, 2.595262211e-02f, 2.610403775e-02f, 2.625606292e-02f,
+	2.640869900e-02f, 2.656194739e-02f, 2.671580946e-02f, 2.687028659e-02f,
+	2.702538017e-02f, 2.718109159e-02f, 2.733742221e-02f, 2.749437343e-02f,
+	2.765194662e-02f, 2.781014317e-02f, 2.796896445e-02f, 2.812841184e-02f,
+	2.828848673e-02f, 2.844919049e-02f, 2.861052451e-02f, 2.877249015e-02f,
+	2.893508880e-02f, 2.909832183e-02f, 2.926219062e-02f, 2.942669655e-02f,
+	2.959184098e-02f, 2.975762531e-02f, 2.992405089e-02f, 3.009111910e-02f,
+	3.025883132e-02f, 3.042718892e-02f, 3.059619326e-02f, 3.076584573e-02f,
+	3.093614768e-02f, 3.110710050e-02f, 3.127870555e-02f, 3.145096419e-02f,
+	3.162387780e-02f, 3.179744775e-02f, 3.197167539e-02f, 3.214656209e-02f,
+	3.232210923e-02f, 3.249831815e-02f, 3.267519023e-02f, 3.285272683e-02f,
+	3.303092931e-02f, 3.320979903e-02f, 3.338933735e-02f, 3.356954563e-02f,
+	3.375042522e-02f, 3.393197749e-02f, 3.411420379e-02f, 3.429710547e-02f,
+	3.448068390e-02f, 3.466494042e-02f, 3.484987639e-02f, 3.503549316e-02f,
+	3.522179207e-02f, 3.540877449e-02f, 3.559644175e-02f, 3.578479521e-02f,
+	3.597383621e-02f, 3.616356611e-02f, 3.635398623e-02f, 3.654509793e-02f,
+	3.673690255e-02f, 3.692940143e-02f, 3.712259591e-02f, 3.731648733e-02f,
+	3.751107703e-02f, 3.770636635e-02f, 3.790235661e-02f, 3.809904916e-02f,
+	3.829644533e-02f, 3.849454646e-02f, 3.869335386e-02f, 3.889286888e-02f,
+	3.909309283e-02f, 3.929402706e-02f, 3.949567288e-02f, 3.969803162e-02f,
+	3.990110460e-02f, 4.010489314e-02f, 4.030939857e-02f, 4.051462221e-02f,
+	4.072056537e-02f, 4.092722937e-02f, 4.113461552e-02f, 4.134272514e-02f,
+	4.155155955e-02f, 4.176112005e-02f, 4.197140795e-02f, 4.218242456e-02f,
+	4.239417119e-02f, 4.260664915e-02f, 4.281985973e-02f, 4.303380424e-02f,
+	4.324848399e-02f, 4.346390026e-02f, 4.368005436e-02f, 4.389694759e-02f,
+	4.411458123e-02f, 4.433295659e-02f, 4.455207495e-02f, 4.477193761e-02f,
+	4.499254584e-02f, 4.521390095e-02f, 4.543600421e-02f, 4.565885691e-02f,
+	4.588246032e-02f, 4.610681574e-02f, 4.633192443e-02f, 4.655778767e-02f,
+	4.678440675e-02f, 4.701178292e-02f, 4.723991747e-02f, 4.746881166e-02f,
+	4.769846675e-02f, 4.792888403e-02f, 4.816006474e-02f, 4.839201016e-02f,
+	4.862472154e-02f, 4.885820013e-02f, 4.909244721e-02f, 4.932746402e-02f,
+	4.956325181e-02f, 4.979981184e-02f, 5.003714536e-02f, 5.027525360e-02f,
+	5.051413782e-02f, 5.075379927e-02f, 5.099423917e-02f, 5.123545878e-02f,
+	5.147745932e-02f, 5.172024203e-02f, 5.196380815e-02f, 5.220815890e-02f,
+	5.245329552e-02f, 5.269921924e-02f, 5.294593126e-02f, 5.319343283e-02f,
+	5.344172516e-02f, 5.369080946e-02f, 5.394068696e-02f, 5.419135886e-02f,
+	5.444282638e-02f, 5.469509074e-02f, 5.494815312e-02f, 5.520201475e-02f,
+	5.545667682e-02f, 5.571214054e-02f, 5.596840710e-02f, 5.622547769e-02f,
+	5.648335352e-02f, 5.674203577e-02f, 5.700152564e-02f, 5.726182430e-02f,
+	5.752293295e-02f, 5.778485276e-02f, 5.804758491e-02f, 5.831113059e-02f,
+	5.857549096e-02f, 5.884066720e-02f, 5.910666048e-02f, 5.937347196e-02f,
+	5.964110281e-02f, 5.990955420e-02f, 6.017882728e-02f, 6.044892321e-02f,
+	6.071984314e-02f, 6.099158823e-02f, 6.126415962e-02f, 6.153755847e-02f,
+	6.181178592e-02f, 6.208684310e-02f, 6.236273117e-02f, 6.263945125e-02f,
+	6.291700448e-02f, 6.319539198e-02f, 6.347461490e-02f, 6.375467436e-02f,
+	6.403557147e-02f, 6.431730736e-02f, 6.459988314e-02f, 6.488329994e-02f,
+	6.516755886e-02f, 6.545266101e-02f, 6.573860751e-02f, 6.602539944e-02f,
+	6.631303792e-02f, 6.660152405e-02f, 6.689085891e-02f, 6.718104360e-02f,
+	6.747207920e-02f, 6.776396682e-02f, 6.805670752e-02f, 6.835030240e-02f,
+	6.864475252e-02f, 6.894005897e-02f, 6.923622281e-02f, 6.953324512e-02f,
+	6.983112696e-02f, 7.012986939e-02f, 7.042947347e-02f, 7.072994026e-02f,
+	7.103127082e-02f, 7.133346619e-02f, 7.163652742e-02f, 7.194045556e-02f,
+	7.224525164e-02f, 7.255091671e-02f, 7.285745181e-02f, 7.316485795e-02f,
+	7.347313618e-02f, 7.378228751e-02f, 7.409231298e-02f, 7.440321359e-02f,
+	7.471499037e-02f, 7.502764433e-02f, 7.534117647e-02f, 7.565558781e-02f,
+	7.597087935e-02f, 7.628705208e-02f, 7.660410700e-02f, 7.692204511e-02f,
+	7.724086739e-02f, 7.756057484e-02f, 7.788116843e-02f, 7.820264914e-02f,
+	7.852501795e-02f, 7.884827584e-02f, 7.917242376e-02f, 7.949746270e-02f,
+	7.982339360e-02f, 8.015021744e-02f, 8.047793515e-02f, 8.080654771e-02f,
+	8.113605604e-02f, 8.146646111e-02f, 8.179776385e-02f, 8.212996520e-02f,
+	8.246306608e-02f, 8.279706745e-02f, 8.313197021e-02f, 8.346777529e-02f,
+	8.380448362e-02f, 8.414209611e-02f, 8.448061367e-02f, 8.482003721e-02f,
+	8.516036764e-02f, 8.550160585e-02f, 8.584375275e-02f, 8.618680923e-02f,
+	8.653077618e-02f, 8.687565448e-02f, 8.722144502e-02f, 8.756814867e-02f,
+	8.791576632e-02f, 8.826429884e-02f, 8.861374708e-02f, 8.896411192e-02f,
+	8.931539421e-02f, 8.966759481e-02f, 9.002071458e-02f, 9.037475435e-02f,
+	9.072971498e-02f, 9.108559731e-02f, 9.144240216e-02f, 9.180013038e-02f,
+	9.215878279e-02f, 9.251836022e-02f, 9.287886349e-02f, 9.324029340e-02f,
+	9.360265079e-02f, 9.396593645e-02f, 9.433015118e-02f, 9.469529580e-02f,
+	9.506137109e-02f, 9.542837785e-02f, 9.579631686e-02f, 9.616518892e-02f,
+	9.653499479e-02f, 9.690573525e-02f, 9.727741109e-02f, 9.765002305e-02f,
+	9.802357191e-02f, 9.839805843e-02f, 9.877348336e-02f, 9.914984745e-02f,
+	9.952715144e-02f, 9.990539609e-02f, 1.002845821e-01f, 1.006647103e-01f,
+	1.010457813e-01f, 1.014277958e-01f, 1.018107547e-01f, 1.021946586e-01f,
+	1.025795082e-01f, 1.029653042e-01f, 1.033520474e-01f, 1.037397384e-01f,
+	1.041283779e-01f, 1.045179666e-01f, 1.049085053e-01f, 1.052999945e-01f,
+	1.056924349e-01f, 1.060858274e-01f, 1.064801724e-01f, 1.068754706e-01f,
+	1.072717228e-01f, 1.076689296e-01f, 1.080670916e-01f, 1.084662094e-01f,
+	1.088662838e-01f, 1.092673153e-01f, 1.096693046e-01f, 1.100722522e-01f,
+	1.104761589e-01f, 1.108810253e-01f, 1.112868519e-01f, 1.116936394e-01f,
+	1.121013883e-01f, 1.125100993e-01f, 1.129197730e-01f, 1.133304099e-01f,
+	1.137420106e-01f, 1.141545757e-01f, 1.145681059e-01f, 1.149826016e-01f,
+	1.153980634e-01f, 1.158144919e-01f, 1.162318877e-01f, 1.166502512e-01f,
+	1.170695831e-01f, 1.174898838e-01f, 1.179111540e-01f, 1.183333941e-01f,
+	1.187566047e-01f, 1.191807863e-01f, 1.196059394e-01f, 1.200320646e-01f,
+	1.204591622e-01f, 1.208872330e-01f, 1.213162772e-01f, 1.217462955e-01f,
+	1.221772883e-01f, 1.226092560e-01f, 1.230421993e-01f, 1.234761185e-01f,
+	1.239110141e-01f, 1.243468866e-01f, 1.247837365e-01f, 1.252215641e-01f,
+	1.256603699e-01f, 1.261001545e-01f, 1.265409181e-01f, 1.269826613e-01f,
+	1.274253845e-01f, 1.278690880e-01f, 1.283137724e-01f, 1.287594380e-01f,
+	1.292060852e-01f, 1.296537144e-01f, 1.301023261e-01f, 1.305519206e-01f,
+	1.310024983e-01f, 1.314540596e-01f, 1.319066048e-01f, 1.323601344e-01f,
+	1.328146486e-01f, 1.332701479e-01f, 1.337266326e-01f, 1.341841031e-01f,
+	1.346425596e-01f, 1.351020026e-01f, 1.355624324e-01f, 1.360238492e-01f,
+	1.364862535e-01f, 1.369496455e-01f, 1.374140255e-01f, 1.378793939e-01f,
+	1.383457509e-01f, 1.388130969e-01f, 1.392814322e-01f, 1.397507569e-01f,
+	1.402210714e-01f, 1.406923760e-01f, 1.411646710e-01f, 1.416379565e-01f,
+	1.421122329e-01f, 1.425875004e-01f, 1.430637593e-01f, 1.435410097e-01f,
+	1.440192520e-01f, 1.444984864e-01f, 1.449787130e-01f, 1.454599321e-01f,
+	1.459421439e-01f, 1.464253487e-01f, 1.469095466e-01f, 1.473947377e-01f,
+	1.478809224e-01f, 1.483681008e-01f, 1.488562731e-01f, 1.493454393e-01f,
+	1.498355998e-01f, 1.503267547e-01f, 1.508189041e-01f, 1.513120481e-01f,
+	1.518061870e-01f, 1.523013208e-01f, 1.527974497e-01f, 1.532945739e-01f,
+	1.537926934e-01f, 1.542918083e-01f, 1.547919188e-01f, 1.552930250e-01f,
+	1.557951269e-01f, 1.562982247e-01f, 1.568023184e-01f, 1.573074082e-01f,
+	1.578134941e-01f, 1.583205761e-01f, 1.588286544e-01f, 1.593377289e-01f,
+	1.598477998e-01f, 1.603588671e-01f, 1.608709308e-01f, 1.613839910e-01f,
+	1.618980477e-01f, 1.624131009e-01f, 1.629291506e-01f, 1.634461968e-01f,
+	1.639642396e-01f, 1.644832790e-01f, 1.650033148e-01f, 1.655243472e-01f,
+	1.660463761e-01f, 1.665694014e-01f, 1.670934232e-01f, 1.676184414e-01f,
+	1.681444560e-01f, 1.686714668e-01f, 1.691994740e-01f, 1.697284773e-01f,
+	1.702584767e-01f, 1.707894722e-01f, 1.713214636e-01f, 1.718544509e-01f,
+	1.723884340e-01f, 1.729234128e-01f, 1.734593872e-01f, 1.739963571e-01f,
+	1.745343223e-01f, 1.750732827e-01f, 1.756132382e-01f, 1.761541888e-01f,
+	1.766961341e-01f, 1.772390741e-01f, 1.777830086e-01f, 1.783279375e-01f,
+	1.788738606e-01f, 1.794207778e-01f, 1.799686887e-01f, 1.805175933e-01f,
+	1.810674914e-01f, 1.816183828e-01f, 1.821702672e-01f, 1.827231445e-01f,
+	1.832770144e-01f, 1.838318767e-01f, 1.843877312e-01f, 1.849445776e-01f,
+	1.855024158e-01f, 1.860612454e-01f, 1.866210662e-01f, 1.871818780e-01f,
+	1.877436804e-01f, 1.883064733e-01f, 1.888702562e-01f, 1.894350290e-01f,
+	1.900007913e-01f, 1.905675429e-01f, 1.911352834e-01f, 1.917040126e-01f,
+	1.922737300e-01f, 1.928444354e-01f, 1.934161285e-01f, 1.939888089e-01f,
+	1.945624762e-01f, 1.951371302e-01f, 1.957127704e-01f, 1.962893965e-01f,
+	1.968670081e-01f, 1.974456049e-01f, 1.980251864e-01f, 1.986057524e-01f,
+	1.991873023e-01f, 1.997698357e-01f, 2.003533524e-01f, 2.009378518e-01f,
+	2.015233335e-01f, 2.021097971e-01f, 2.026972422e-01f, 2.032856683e-01f,
+	2.038750750e-01f, 2.044654618e-01f, 2.050568282e-01f, 2.056491739e-01f,
+	2.062424982e-01f, 2.068368008e-01f, 2.074320812e-01f, 2.080283387e-01f,
+	2.086255731e-01f, 2.092237836e-01f, 2.098229699e-01f, 2.104231314e-01f,
+	2.110242676e-01f, 2.116263779e-01f, 2.122294619e-01f, 2.128335188e-01f,
+	2.134385483e-01f, 2.140445497e-01f, 2.146515225e-01f, 2.152594661e-01f,
+	2.158683799e-01f, 2.164782633e-01f, 2.170891157e-01f, 2.177009366e-01f,
+	2.183137253e-01f, 2.189274812e-01f, 2.195422037e-01f, 2.201578922e-01f,
+	2.207745459e-01f, 2.213921644e-01f, 2.220107469e-01f, 2.226302928e-01f,
+	2.232508013e-01f, 2.238722720e-01f, 2.244947040e-01f, 2.251180967e-01f,
+	2.257424494e-01f, 2.263677614e-01f, 2.269940320e-01f, 2.276212605e-01f,
+	2.282494461e-01f, 2.288785883e-01f, 2.295086861e-01f, 2.301397389e-01f,
+	2.307717460e-01f, 2.314047066e-01f, 2.320386199e-01f, 2.326734852e-01f,
+	2.333093017e-01f, 2.339460686e-01f, 2.345837852e-01f, 2.352224506e-01f,
+	2.358620640e-01f, 2.365026247e-01f, 2.371441319e-01f, 2.377865846e-01f,
+	2.384299822e-01f, 2.390743237e-01f, 2.397196083e-01f, 2.403658352e-01f,
+	2.410130035e-01f, 2.416611123e-01f, 2.423101609e-01f, 2.429601483e-01f,
+	2.436110736e-01f, 2.442629360e-01f, 2.449157345e-01f, 2.455694683e-01f,
+	2.462241364e-01f, 2.468797379e-01f, 2.475362720e-01f, 2.481937376e-01f,
+	2.488521339e-01f, 2.495114599e-01f, 2.501717147e-01f, 2.508328972e-01f,
+	2.514950066e-01f, 2.521580418e-01f, 2.528220019e-01f, 2.534868859e-01f,
+	2.541526928e-01f, 2.548194216e-01f, 2.554870714e-01f, 2.561556410e-01f,
+	2.568251295e-01f, 2.574955358e-01f, 2.581668590e-01f, 2.588390979e-01f,
+	2.595122515e-01f, 2.601863188e-01f, 2.608612987e-01f, 2.615371902e-01f,
+	2.622139921e-01f, 2.628917034e-01f, 2.635703230e-01f, 2.642498498e-01f,
+	2.649302827e-01f, 2.656116206e-01f, 2.662938624e-01f, 2.669770068e-01f,
+	2.676610530e-01f, 2.683459995e-01f, 2.690318454e-01f, 2.697185895e-01f,
+	2.704062306e-01f, 2.710947676e-01f, 2.717841993e-01f, 2.724745244e-01f,
+	2.731657419e-01f, 2.738578504e-01f, 2.745508489e-01f, 2.752447361e-01f,
+	2.759395108e-01f, 2.766351718e-01f, 2.773317178e-01f, 2.780291476e-01f,
+	2.787274600e-01f, 2.794266537e-01f, 2.801267275e-01f, 2.808276801e-01f,
+	2.815295101e-01f, 2.822322164e-01f, 2.829357977e-01f, 2.836402527e-01f,
+	2.843455800e-01f, 2.850517784e-01f, 2.857588465e-01f, 2.864667830e-01f,
+	2.871755867e-01f, 2.878852561e-01f, 2.885957899e-01f, 2.893071868e-01f,
+	2.900194454e-01f, 2.907325644e-01f, 2.914465424e-01f, 2.921613780e-01f,
+	2.928770698e-01f, 2.935936165e-01f, 2.943110166e-01f, 2.950292687e-01f,
+	2.957483715e-01f, 2.964683234e-01f, 2.971891232e-01f, 2.979107692e-01f,
+	2.986332602e-01f, 2.993565947e-01f, 3.000807712e-01f, 3.008057882e-01f,
+	3.015316442e-01f, 3.022583379e-01f, 3.029858678e-01f, 3.037142322e-01f,
+	3.044434298e-01f, 3.051734590e-01f, 3.059043184e-01f, 3.066360063e-01f,
+	3.073685214e-01f, 3.081018620e-01f, 3.088360266e-01f, 3.095710137e-01f,
+	3.103068217e-01f, 3.110434490e-01f, 3.117808942e-01f, 3.125191556e-01f,
+	3.132582316e-01f, 3.139981207e-01f, 3.147388213e-01f, 3.154803317e-01f,
+	3.162226503e-01f, 3.169657756e-01f, 3.177097060e-01f, 3.184544397e-01f,
+	3.191999752e-01f, 3.199463108e-01f, 3.206934448e-01f, 3.214413757e-01f,
+	3.221901017e-01f, 3.229396211e-01f, 3.236899324e-01f, 3.244410338e-01f,
+	3.251929236e-01f, 3.259456001e-01f, 3.266990617e-01f, 3.274533065e-01f,
+	3.282083330e-01f, 3.289641393e-01f, 3.297207237e-01f, 3.304780845e-01f,
+	3.312362200e-01f, 3.319951283e-01f, 3.327548078e-01f, 3.335152566e-01f,
+	3.342764731e-01f, 3.350384553e-01f, 3.358012016e-01f, 3.365647100e-01f,
+	3.373289789e-01f, 3.380940064e-01f, 3.388597907e-01f, 3.396263300e-01f,
+	3.403936224e-01f, 3.411616662e-01f, 3.419304594e-01f, 3.427000002e-01f,
+	3.434702868e-01f, 3.442413172e-01f, 3.450130897e-01f, 3.457856024e-01f,
+	3.465588533e-01f, 3.473328406e-01f, 3.481075623e-01f, 3.488830166e-01f,
+	3.496592016e-01f, 3.504361154e-01f, 3.512137559e-01f, 3.519921213e-01f,
+	3.527712097e-01f, 3.535510191e-01f, 3.543315475e-01f, 3.551127930e-01f,
+	3.558947536e-01f, 3.566774274e-01f, 3.574608123e-01f, 3.582449065e-01f,
+	3.590297078e-01f, 3.598152143e-01f, 3.606014240e-01f, 3.613883349e-01f,
+	3.621759449e-01f, 3.629642521e-01f, 3.637532543e-01f, 3.645429496e-01f,
+	3.653333359e-01f, 3.661244111e-01f, 3.669161733e-01f, 3.677086203e-01f,
+	3.685017500e-01f, 3.692955604e-01f, 3.700900494e-01f, 3.708852148e-01f,
+	3.716810547e-01f, 3.724775668e-01f, 3.732747491e-01f, 3.740725995e-01f,
+	3.748711158e-01f, 3.756702959e-01f, 3.764701376e-01f, 3.772706388e-01f,
+	3.780717974e-01f, 3.788736112e-01f, 3.796760780e-01f, 3.804791956e-01f,
+	3.812829619e-01f, 3.820873747e-01f, 3.828924318e-01f, 3.836981310e-01f,
+	3.845044701e-01f, 3.853114468e-01f, 3.861190590e-01f, 3.869273045e-01f,
+	3.877361809e-01f, 3.885456861e-01f, 3.893558178e-01f, 3.901665738e-01f,
+	3.909779518e-01f, 3.917899495e-01f, 3.926025647e-01f, 3.934157951e-01f,
+	3.942296383e-01f, 3.950440923e-01f, 3.958591545e-01f, 3.966748228e-01f,
+	3.974910947e-01f, 3.983079681e-01f, 3.991254405e-01f, 3.999435097e-01f,
+	4.007621733e-01f, 4.015814289e-01f, 4.024012743e-01f, 4.032217071e-01f,
+	4.040427248e-01f, 4.048643252e-01f, 4.056865058e-01f, 4.065092644e-01f,
+	4.073325984e-01f, 4.081565055e-01f, 4.089809834e-01f, 4.098060295e-01f,
+	4.106316416e-01f, 4.114578171e-01f, 4.122845536e-01f, 4.131118488e-01f,
+	4.139397002e-01f, 4.147681053e-01f, 4.155970617e-01f, 4.164265670e-01f,
+	4.172566186e-01f, 4.180872142e-01f, 4.189183512e-01f, 4.197500271e-01f,
+	4.205822396e-01f, 4.214149860e-01f, 4.222482639e-01f, 4.230820708e-01f,
+	4.239164041e-01f, 4.247512614e-01f, 4.255866402e-01f, 4.264225378e-01f,
+	4.272589518e-01f, 4.280958797e-01f, 4.289333188e-01f, 4.297712667e-01f,
+	4.306097207e-01f, 4.314486784e-01f, 4.322881371e-01f, 4.331280942e-01f,
+	4.339685472e-01f, 4.348094936e-01f, 4.356509306e-01f, 4.364928557e-01f,
+	4.373352663e-01f, 4.381781597e-01f, 4.390215335e-01f, 4.398653848e-01f,
+	4.407097112e-01f, 4.415545099e-01f, 4.423997784e-01f, 4.432455139e-01f,
+	4.440917139e-01f, 4.449383756e-01f, 4.457854965e-01f, 4.466330737e-01f,
+	4.474811047e-01f, 4.483295868e-01f, 4.491785173e-01f, 4.500278934e-01f,
+	4.508777126e-01f, 4.517279720e-01f, 4.525786690e-01f, 4.534298008e-01f,
+	4.542813648e-01f, 4.551333582e-01f, 4.559857783e-01f, 4.568386222e-01f,
+	4.576918874e-01f, 4.585455710e-01f, 4.593996703e-01f, 4.602541825e-01f,
+	4.611091048e-01f, 4.619644345e-01f, 4.628201688e-01f, 4.636763049e-01f,
+	4.645328400e-01f, 4.653897713e-01f, 4.662470961e-01f, 4.671048115e-01f,
+	4.679629147e-01f, 4.688214028e-01f, 4.696802731e-01f, 4.705395228e-01f,
+	4.713991489e-01f, 4.722591488e-01f, 4.731195194e-01f, 4.739802580e-01f,
+	4.748413617e-01f, 4.757028276e-01f, 4.765646529e-01f, 4.774268348e-01f,
+	4.782893702e-01f, 4.791522565e-01f, 4.800154905e-01f, 4.808790696e-01f,
+	4.817429907e-01f, 4.826072510e-01f, 4.834718475e-01f, 4.843367774e-01f,
+	4.852020377e-01f, 4.860676255e-01f, 4.869335378e-01f, 4.877997719e-01f,
+	4.886663246e-01f, 4.895331930e-01f, 4.904003743e-01f, 4.912678654e-01f,
+	4.921356633e-01f, 4.930037652e-01f, 4.938721681e-01f, 4.947408689e-01f,
+	4.956098647e-01f, 4.964791525e-01f, 4.973487294e-01f, 4.982185922e-01f,
+	4.990887381e-01f, 4.999591639e-01f, 5.008298668e-01f, 5.017008437e-01f,
+	5.025720915e-01f, 5.034436073e-01f, 5.043153880e-01f, 5.051874306e-01f,
+	5.060597320e-01f, 5.069322891e-01f, 5.078050991e-01f, 5.086781587e-01f,
+	5.095514649e-01f, 5.104250147e-01f, 5.112988050e-01f, 5.121728328e-01f,
+	5.130470948e-01f, 5.139215882e-01f, 5.147963097e-01f, 5.156712562e-01f,
+	5.165464248e-01f, 5.174218122e-01f, 5.182974155e-01f, 5.191732313e-01f,
+	5.200492568e-01f, 5.209254886e-01f, 5.218019238e-01f, 5.226785591e-01f,
+	5.235553915e-01f, 5.244324178e-01f, 5.253096349e-01f, 5.261870395e-01f,
+	5.270646286e-01f, 5.279423991e-01f, 5.288203476e-01f, 5.296984712e-01f,
+	5.305767666e-01f, 5.314552306e-01f, 5.323338600e-01f, 5.332126518e-01f,
+	5.340916026e-01f, 5.349707093e-01f, 5.358499688e-01f, 5.367293777e-01f,
+	5.376089330e-01f, 5.384886313e-01f, 5.393684695e-01f, 5.402484444e-01f,
+	5.411285528e-01f, 5.420087913e-01f, 5.428891568e-01f, 5.437696461e-01f,
+	5.446502560e-01f, 5.455309831e-01f, 5.464118242e-01f, 5.472927761e-01f,
+	5.481738356e-01f, 5.490549993e-01f, 5.499362640e-01f, 5.508176265e-01f,
+	5.516990834e-01f, 5.525806316e-01f, 5.534622677e-01f, 5.543439884e-01f,
+	5.552257905e-01f, 5.561076707e-01f, 5.569896256e-01f, 5.578716521e-01f,
+	5.587537467e-01f, 5.596359062e-01f, 5.605181272e-01f, 5.614004066e-01f,
+	5.622827408e-01f, 5.631651267e-01f, 5.640475609e-01f, 5.649300400e-01f,
+	5.658125608e-01f, 5.666951199e-01f, 5.675777140e-01f, 5.684603397e-01f,
+	5.693429937e-01f, 5.702256727e-01f, 5.711083732e-01f, 5.719910919e-01f,
+	5.728738256e-01f, 5.737565707e-01f, 5.746393240e-01f, 5.755220820e-01f,
+	5.764048414e-01f, 5.772875989e-01f, 5.781703510e-01f, 5.790530944e-01f,
+	5.799358257e-01f, 5.808185414e-01f, 5.817012382e-01f, 5.825839128e-01f,
+	5.834665616e-01f, 5.843491813e-01f, 5.852317685e-01f, 5.861143198e-01f,
+	5.869968317e-01f, 5.878793009e-01f, 5.887617240e-01f, 5.896440974e-01f,
+	5.905264178e-01f, 5.914086818e-01f, 5.922908859e-01f, 5.931730267e-01f,
+	5.940551008e-01f, 5.949371046e-01f, 5.958190349e-01f, 5.967008880e-01f,
+	5.975826606e-01f, 5.984643493e-01f, 5.993459505e-01f, 6.002274608e-01f,
+	6.011088768e-01f, 6.019901950e-01f, 6.028714118e-01f, 6.037525240e-01f,
+	6.046335278e-01f, 6.055144200e-01f, 6.063951971e-01f, 6.072758554e-01f,
+	6.081563916e-01f, 6.090368022e-01f, 6.099170837e-01f, 6.107972326e-01f,
+	6.116772454e-01f, 6.125571185e-01f, 6.134368486e-01f, 6.143164321e-01f,
+	6.151958655e-01f, 6.160751453e-01f, 6.169542679e-01f, 6.178332299e-01f,
+	6.187120278e-01f, 6.195906581e-01f, 6.204691171e-01f, 6.213474015e-01f,
+	6.222255076e-01f, 6.231034320e-01f, 6.239811711e-01f, 6.248587214e-01f,
+	6.257360793e-01f, 6.266132414e-01f, 6.274902041e-01f, 6.283669638e-01f,
+	6.292435170e-01f, 6.301198602e-01f, 6.309959898e-01f, 6.318719023e-01f,
+	6.327475941e-01f, 6.336230617e-01f, 6.344983014e-01f, 6.353733098e-01f,
+	6.362480834e-01f, 6.371226184e-01f, 6.379969114e-01f, 6.388709589e-01f,
+	6.397447572e-01f, 6.406183027e-01f, 6.414915920e-01f, 6.423646213e-01f,
+	6.432373873e-01f, 6.441098862e-01f, 6.449821146e-01f, 6.458540687e-01f,
+	6.467257451e-01f, 6.475971402e-01f, 6.484682503e-01f, 6.493390720e-01f,
+	6.502096015e-01f, 6.510798353e-01f, 6.519497699e-01f, 6.528194016e-01f,
+	6.536887269e-01f, 6.545577420e-01f, 6.554264436e-01f, 6.562948278e-01f,
+	6.571628912e-01f, 6.580306302e-01f, 6.588980411e-01f, 6.597651203e-01f,
+	6.606318643e-01f, 6.614982694e-01f, 6.623643319e-01f, 6.632300484e-01f,
+	6.640954152e-01f, 6.649604287e-01f, 6.658250852e-01f, 6.666893812e-01f,
+	6.675533130e-01f, 6.684168770e-01f, 6.692800697e-01f, 6.701428873e-01f,
+	6.710053262e-01f, 6.718673829e-01f, 6.727290537e-01f, 6.735903350e-01f,
+	6.744512232e-01f, 6.753117146e-01f, 6.761718056e-01f, 6.770314925e-01f,
+	6.778907719e-01f, 6.787496399e-01f, 6.796080931e-01f, 6.804661277e-01f,
+	6.813237401e-01f, 6.821809268e-01f, 6.830376839e-01f, 6.838940081e-01f,
+	6.847498955e-01f, 6.856053425e-01f, 6.864603456e-01f, 6.873149011e-01f,
+	6.881690053e-01f, 6.890226546e-01f, 6.898758453e-01f, 6.907285739e-01f,
+	6.915808367e-01f, 6.924326300e-01f, 6.932839502e-01f, 6.941347937e-01f,
+	6.949851567e-01f, 6.958350358e-01f, 6.966844272e-01f, 6.975333272e-01f,
+	6.983817323e-01f, 6.992296388e-01f, 7.000770430e-01f, 7.009239414e-01f,
+	7.017703302e-01f, 7.026162058e-01f, 7.034615646e-01f, 7.043064029e-01f,
+	7.051507171e-01f, 7.059945035e-01f, 7.068377585e-01f, 7.076804785e-01f,
+	7.085226597e-01f, 7.093642985e-01f, 7.102053914e-01f, 7.110459346e-01f,
+	7.118859245e-01f, 7.127253575e-01f, 7.135642298e-01f, 7.144025380e-01f,
+	7.152402782e-01f, 7.160774470e-01f, 7.169140405e-01f, 7.177500552e-01f,
+	7.185854875e-01f, 7.194203336e-01f, 7.202545900e-01f, 7.210882529e-01f,
+	7.219213189e-01f, 7.227537841e-01f, 7.235856450e-01f, 7.244168979e-01f,
+	7.252475392e-01f, 7.260775652e-01f, 7.269069723e-01f, 7.277357568e-01f,
+	7.285639152e-01f, 7.293914437e-01f, 7.302183387e-01f, 7.310445967e-01f,
+	7.318702139e-01f, 7.326951866e-01f, 7.335195114e-01f, 7.343431845e-01f,
+	7.351662023e-01f, 7.359885611e-01f, 7.368102574e-01f, 7.376312875e-01f,
+	7.384516477e-01f, 7.392713344e-01f, 7.400903441e-01f, 7.409086730e-01f,
+	7.417263175e-01f, 7.425432740e-01f, 7.433595390e-01f, 7.441751086e-01f,
+	7.449899794e-01f, 7.458041477e-01f, 7.466176098e-01f, 7.474303622e-01f,
+	7.482424013e-01f, 7.490537233e-01f, 7.498643247e-01f, 7.506742019e-01f,
+	7.514833513e-01f, 7.522917691e-01f, 7.530994519e-01f, 7.539063960e-01f,
+	7.547125978e-01f, 7.555180537e-01f, 7.563227600e-01f, 7.571267132e-01f,
+	7.579299097e-01f, 7.587323458e-01f, 7.595340180e-01f, 7.603349226e-01f,
+	7.611350560e-01f, 7.619344147e-01f, 7.627329950e-01f, 7.635307934e-01f,
+	7.643278062e-01f, 7.651240299e-01f, 7.659194609e-01f, 7.667140955e-01f,
+	7.675079302e-01f, 7.683009614e-01f, 7.690931856e-01f, 7.698845990e-01f,
+	7.706751982e-01f, 7.714649796e-01f, 7.722539396e-01f, 7.730420746e-01f,
+	7.738293810e-01f, 7.746158553e-01f, 7.754014939e-01f, 7.761862933e-01f,
+	7.769702497e-01f, 7.777533598e-01f, 7.785356200e-01f, 7.793170266e-01f,
+	7.800975761e-01f, 7.808772650e-01f, 7.816560897e-01f, 7.824340466e-01f,
+	7.832111323e-01f, 7.839873431e-01f, 7.847626755e-01f, 7.855371259e-01f,
+	7.863106910e-01f, 7.870833669e-01f, 7.878551504e-01f, 7.886260378e-01f,
+	7.893960255e-01f, 7.901651101e-01f, 7.909332880e-01f, 7.917005558e-01f,
+	7.924669098e-01f, 7.932323466e-01f, 7.939968626e-01f, 7.947604543e-01f,
+	7.955231183e-01f, 7.962848510e-01f, 7.970456489e-01f, 7.978055084e-01f,
+	7.985644262e-01f, 7.993223987e-01f, 8.000794224e-01f, 8.008354937e-01f,
+	8.015906093e-01f, 8.023447657e-01f, 8.030979592e-01f, 8.038501866e-01f,
+	8.046014442e-01f, 8.053517286e-01f, 8.061010363e-01f, 8.068493639e-01f,
+	8.075967080e-01f, 8.083430649e-01f, 8.090884313e-01f, 8.098328037e-01f,
+	8.105761786e-01f, 8.113185527e-01f, 8.120599224e-01f, 8.128002843e-01f,
+	8.135396350e-01f, 8.142779709e-01f, 8.150152888e-01f, 8.157515851e-01f,
+	8.164868564e-01f, 8.172210993e-01f, 8.179543104e-01f, 8.186864863e-01f,
+	8.194176234e-01f, 8.201477185e-01f, 8.208767680e-01f, 8.216047687e-01f,
+	8.223317171e-01f, 8.230576097e-01f, 8.237824432e-01f, 8.245062143e-01f,
+	8.252289194e-01f, 8.259505553e-01f, 8.266711185e-01f, 8.273906057e-01f,
+	8.281090134e-01f, 8.288263384e-01f, 8.295425772e-01f, 8.302577265e-01f,
+	8.309717829e-01f, 8.316847431e-01f, 8.323966037e-01f, 8.331073614e-01f,
+	8.338170127e-01f, 8.345255545e-01f, 8.352329832e-01f, 8.359392957e-01f,
+	8.366444885e-01f, 8.373485584e-01f, 8.380515020e-01f, 8.387533160e-01f,
+	8.394539971e-01f, 8.401535420e-01f, 8.408519473e-01f, 8.415492098e-01f,
+	8.422453262e-01f, 8.429402931e-01f, 8.436341074e-01f, 8.443267656e-01f,
+	8.450182646e-01f, 8.457086009e-01f, 8.463977715e-01f, 8.470857730e-01f,
+	8.477726020e-01f, 8.484582555e-01f, 8.491427301e-01f, 8.498260225e-01f,
+	8.505081296e-01f, 8.511890480e-01f, 8.518687746e-01f, 8.525473060e-01f,
+	8.532246392e-01f, 8.539007708e-01f, 8.545756976e-01f, 8.552494164e-01f,
+	8.559219240e-01f, 8.565932172e-01f, 8.572632928e-01f, 8.579321476e-01f,
+	8.585997784e-01f, 8.592661820e-01f, 8.599313552e-01f, 8.605952949e-01f,
+	8.612579978e-01f, 8.619194608e-01f, 8.625796808e-01f, 8.632386546e-01f,
+	8.638963790e-01f, 8.645528508e-01f, 8.652080670e-01f, 8.658620243e-01f,
+	8.665147198e-01f, 8.671661501e-01f, 8.678163122e-01f, 8.684652030e-01f,
+	8.691128194e-01f, 8.697591582e-01f, 8.704042163e-01f, 8.710479907e-01f,
+	8.716904782e-01f, 8.723316758e-01f, 8.729715804e-01f, 8.736101888e-01f,
+	8.742474981e-01f, 8.748835051e-01f, 8.755182067e-01f, 8.761516001e-01f,
+	8.767836819e-01f, 8.774144493e-01f, 8.780438992e-01f, 8.786720285e-01f,
+	8.792988342e-01f, 8.799243133e-01f, 8.805484627e-01f, 8.811712795e-01f,
+	8.817927606e-01f, 8.824129031e-01f, 8.830317038e-01f, 8.836491599e-01f,
+	8.842652684e-01f, 8.848800261e-01f, 8.854934303e-01f, 8.861054779e-01f,
+	8.867161659e-01f, 8.873254914e-01f, 8.879334514e-01f, 8.885400430e-01f,
+	8.891452633e-01f, 8.897491092e-01f, 8.903515779e-01f, 8.909526664e-01f,
+	8.915523718e-01f, 8.921506913e-01f, 8.927476218e-01f, 8.933431605e-01f,
+	8.939373045e-01f, 8.945300509e-01f, 8.951213968e-01f, 8.957113394e-01f,
+	8.962998757e-01f, 8.968870029e-01f, 8.974727181e-01f, 8.980570185e-01f,
+	8.986399012e-01f, 8.992213635e-01f, 8.998014023e-01f, 9.003800150e-01f,
+	9.009571986e-01f, 9.015329505e-01f, 9.021072677e-01f, 9.026801474e-01f,
+	9.032515869e-01f, 9.038215833e-01f, 9.043901339e-01f, 9.049572359e-01f,
+	9.055228866e-01f, 9.060870830e-01f, 9.066498225e-01f, 9.072111024e-01f,
+	9.077709198e-01f, 9.083292721e-01f, 9.088861564e-01f, 9.094415701e-01f,
+	9.099955105e-01f, 9.105479747e-01f, 9.110989602e-01f, 9.116484642e-01f,
+	9.121964840e-01f, 9.127430169e-01f, 9.132880602e-01f, 9.138316113e-01f,
+	9.143736674e-01f, 9.149142260e-01f, 9.154532843e-01f, 9.159908398e-01f,
+	9.165268896e-01f, 9.170614313e-01f, 9.175944622e-01f, 9.181259797e-01f,
+	9.186559811e-01f, 9.191844638e-01f, 9.197114253e-01f, 9.202368629e-01f,
+	9.207607740e-01f, 9.212831561e-01f, 9.218040065e-01f, 9.223233228e-01f,
+	9.228411023e-01f, 9.233573425e-01f, 9.238720408e-01f, 9.243851947e-01f,
+	9.248968017e-01f, 9.254068593e-01f, 9.259153648e-01f, 9.264223158e-01f,
+	9.269277098e-01f, 9.274315443e-01f, 9.279338168e-01f, 9.284345248e-01f,
+	9.289336659e-01f, 9.294312375e-01f, 9.299272371e-01f, 9.304216625e-01f,
+	9.309145110e-01f, 9.314057802e-01f, 9.318954678e-01f, 9.323835712e-01f,
+	9.328700881e-01f, 9.333550161e-01f, 9.338383526e-01f, 9.343200955e-01f,
+	9.348002421e-01f, 9.352787902e-01f, 9.357557375e-01f, 9.362310814e-01f,
+	9.367048197e-01f, 9.371769500e-01f, 9.376474699e-01f, 9.381163771e-01f,
+	9.385836694e-01f, 9.390493442e-01f, 9.395133995e-01f, 9.399758327e-01f,
+	9.404366417e-01f, 9.408958241e-01f, 9.413533777e-01f, 9.418093001e-01f,
+	9.422635891e-01f, 9.427162424e-01f, 9.431672579e-01f, 9.436166331e-01f,
+	9.440643659e-01f, 9.445104541e-01f, 9.449548954e-01f, 9.453976877e-01f,
+	9.458388286e-01f, 9.462783160e-01f, 9.467161477e-01f, 9.471523216e-01f,
+	9.475868353e-01f, 9.480196869e-01f, 9.484508740e-01f, 9.488803946e-01f,
+	9.493082465e-01f, 9.497344276e-01f, 9.501589357e-01f, 9.505817687e-01f,
+	9.510029245e-01f, 9.514224010e-01f, 9.518401960e-01f, 9.522563076e-01f,
+	9.526707336e-01f, 9.530834719e-01f, 9.534945204e-01f, 9.539038772e-01f,
+	9.543115402e-01f, 9.547175072e-01f, 9.551217764e-01f, 9.555243456e-01f,
+	9.559252128e-01f, 9.563243761e-01f, 9.567218333e-01f, 9.571175826e-01f,
+	9.575116220e-01f, 9.579039494e-01f, 9.582945629e-01f, 9.586834606e-01f,
+	9.590706404e-01f, 9.594561005e-01f, 9.598398388e-01f, 9.602218536e-01f,
+	9.606021428e-01f, 9.609807045e-01f, 9.613575369e-01f, 9.617326380e-01f,
+	9.621060060e-01f, 9.624776390e-01f, 9.628475351e-01f, 9.632156924e-01f,
+	9.635821091e-01f, 9.639467834e-01f, 9.643097134e-01f, 9.646708973e-01f,
+	9.650303333e-01f, 9.653880195e-01f, 9.657439542e-01f, 9.660981355e-01f,
+	9.664505618e-01f, 9.668012311e-01f, 9.671501418e-01f, 9.674972921e-01f,
+	9.678426802e-01f, 9.681863044e-01f, 9.685281629e-01f, 9.688682541e-01f,
+	9.692065762e-01f, 9.695431275e-01f, 9.698779063e-01f, 9.702109110e-01f,
+	9.705421398e-01f, 9.708715910e-01f, 9.711992631e-01f, 9.715251543e-01f,
+	9.718492630e-01f, 9.721715876e-01f, 9.724921264e-01f, 9.728108779e-01f,
+	9.731278403e-01f, 9.734430122e-01f, 9.737563919e-01f, 9.740679778e-01f,
+	9.743777683e-01f, 9.746857620e-01f, 9.749919572e-01f, 9.752963523e-01f,
+	9.755989459e-01f, 9.758997364e-01f, 9.761987223e-01f, 9.764959021e-01f,
+	9.767912742e-01f, 9.770848372e-01f, 9.773765896e-01f, 9.776665300e-01f,
+	9.779546567e-01f, 9.782409684e-01f, 9.785254637e-01f, 9.788081411e-01f,
+	9.790889991e-01f, 9.793680364e-01f, 9.796452515e-01f, 9.799206429e-01f,
+	9.801942095e-01f, 9.804659496e-01f, 9.807358620e-01f, 9.810039453e-01f,
+	9.812701981e-01f, 9.815346191e-01f, 9.817972070e-01f, 9.820579603e-01f,
+	9.823168778e-01f, 9.825739582e-01f, 9.828292002e-01f, 9.830826024e-01f,
+	9.833341636e-01f, 9.835838824e-01f, 9.838317578e-01f, 9.840777883e-01f,
+	9.843219727e-01f, 9.845643098e-01f, 9.848047984e-01f, 9.850434372e-01f,
+	9.852802250e-01f, 9.855151606e-01f, 9.857482429e-01f, 9.859794706e-01f,
+	9.862088425e-01f, 9.864363576e-01f, 9.866620146e-01f, 9.868858123e-01f,
+	9.871077498e-01f, 9.873278258e-01f, 9.875460391e-01f, 9.877623888e-01f,
+	9.879768737e-01f, 9.881894927e-01f, 9.884002446e-01f, 9.886091286e-01f,
+	9.888161434e-01f, 9.890212881e-01f, 9.892245616e-01f, 9.894259628e-01f,
+	9.896254907e-01f, 9.898231444e-01f, 9.900189228e-01f, 9.902128249e-01f,
+	9.904048497e-01f, 9.905949962e-01f, 9.907832636e-01f, 9.909696507e-01f,
+	9.911541567e-01f, 9.913367807e-01f, 9.915175216e-01f, 9.916963787e-01f,
+	9.918733509e-01f, 9.920484373e-01f, 9.922216372e-01f, 9.923929495e-01f,
+	9.925623734e-01f, 9.927299081e-01f, 9.928955527e-01f, 9.930593064e-01f,
+	9.932211682e-01f, 9.933811375e-01f, 9.935392133e-01f, 9.936953950e-01f,
+	9.938496815e-01f, 9.940020723e-01f, 9.941525665e-01f, 9.943011633e-01f,
+	9.944478621e-01f, 9.945926619e-01f, 9.947355622e-01f, 9.948765621e-01f,
+	9.950156610e-01f, 9.951528581e-01f, 9.952881528e-01f, 9.954215443e-01f,
+	9.955530320e-01f, 9.956826151e-01f, 9.958102931e-01f, 9.959360653e-01f,
+	9.960599311e-01f, 9.961818897e-01f, 9.963019407e-01f, 9.964200833e-01f,
+	9.965363170e-01f, 9.966506411e-01f, 9.967630552e-01f, 9.968735586e-01f,
+	9.969821507e-01f, 9.970888311e-01f, 9.971935990e-01f, 9.972964542e-01f,
+	9.973973959e-01f, 9.974964237e-01f, 9.975935370e-01f, 9.976887355e-01f,
+	9.977820185e-01f, 9.978733857e-01f, 9.979628365e-01f, 9.980503705e-01f,
+	9.981359872e-01f, 9.982196862e-01f, 9.983014672e-01f, 9.983813295e-01f,
+	9.984592730e-01f, 9.985352971e-01f, 9.986094014e-01f, 9.986815857e-01f,
+	9.987518494e-01f, 9.988201924e-01f, 9.988866141e-01f, 9.989511143e-01f,
+	9.990136927e-01f, 9.990743488e-01f, 9.991330825e-01f, 9.991898934e-01f,
+	9.992447812e-01f, 9.992977457e-01f, 9.993487865e-01f, 9.993979034e-01f,
+	9.994450962e-01f, 9.994903646e-01f, 9.995337084e-01f, 9.995751273e-01f,
+	9.996146212e-01f, 9.996521899e-01f, 9.996878331e-01f, 9.997215507e-01f,
+	9.997533425e-01f, 9.997832083e-01f, 9.998111480e-01f, 9.998371614e-01f,
+	9.998612485e-01f, 9.998834091e-01f, 9.999036430e-01f, 9.999219502e-01f,
+	9.999383306e-01f, 9.999527840e-01f, 9.999653105e-01f, 9.999759100e-01f,
+	9.999845823e-01f, 9.999913275e-01f, 9.999961456e-01f, 9.999990364e-01f,
+	1.000000000e+00f,
+};
+
+static const q15_t win_kaiser_half_q15[WINDOW_HALF_LEN] = {
+	44, 44, 45, 46, 47, 48, 49, 49,
+	50, 51, 52, 53, 54, 54, 55, 56,
+	57, 58, 59, 60, 61, 62, 63, 64,
+	65, 66, 67, 68, 68, 69, 70, 72,
+	73, 74, 75, 76, 77, 78, 79, 80,
+	81, 82, 83, 84, 85, 86, 88, 89,
+	90, 91, 92, 93, 95, 96, 97, 98,
+	99, 101, 102, 103, 104, 106, 107, 108,
+	109, 111, 112, 113, 115, 116, 117, 119,
+	120, 121, 123, 124, 126, 127, 128, 130,
+	131, 133, 134, 136, 137, 138, 140, 141,
+	143, 144, 146, 148, 149, 151, 152, 154,
+	155, 157, 159, 160, 162, 164, 165, 167,
+	168, 170, 172, 174, 175, 177, 179, 180,
+	182, 184, 186, 188, 189, 191, 193, 195,
+	197, 199, 200, 202, 204, 206, 208, 210,
+	212, 214, 216, 218, 220, 222, 224, 226,
+	228, 230, 232, 234, 236, 238, 240, 242,
+	244, 247, 249, 251, 253, 255, 257, 260,
+	262, 264, 266, 269, 271, 273, 275, 278,
+	280, 282, 285, 287, 289, 292, 294, 297,
+	299, 301, 304, 306, 309, 311, 314, 316,
+	319, 321, 324, 327, 329, 332, 334, 337,
+	340, 342, 345, 348, 350, 353, 356, 358,
+	361, 364, 367, 370, 372, 375, 378, 381,
+	384, 387, 390, 392, 395, 398, 401, 404,
+	407, 410, 413, 416, 419, 422, 425, 428,
+	432, 435, 438, 441, 444, 447, 451, 454,
+	457, 460, 463, 467, 470, 473, 477, 480,
+	483, 487, 490, 493, 497, 500, 504, 507,
+	511, 514, 518, 521, 525, 528, 532, 535,
+	539, 543, 546, 550, 554, 557, 561, 565,
+	569, 572, 576, 580, 584, 588, 591, 595,
+	599, 603, 607, 611, 615, 619, 623, 627,
+	631, 635, 639, 643, 647, 651, 655, 659,
+	664, 668, 672, 676, 680, 685, 689, 693,
+	698, 702, 706, 711, 715, 719, 724, 728,
+	733, 737, 742, 746, 751, 755, 760, 764,
+	769, 774, 778, 783, 788, 792, 797, 802,
+	807, 811, 816, 821, 826, 831, 836, 841,
+	845, 850, 855, 860, 865, 870, 875, 880,
+	886, 891, 896, 901, 906, 911, 916, 922,
+	927, 932, 938, 943, 948, 953, 959, 964,
+	970, 975, 981, 986, 992, 997, 1003, 1008,
+	1014, 1019, 1025, 1031, 1036, 1042, 1048, 1053,
+	1059, 1065, 1071, 1077, 1082, 1088, 1094, 1100,
+	1106, 1112, 1118, 1124, 1130, 1136, 1142, 1148,
+	1154, 1160, 1166, 1173, 1179, 1185, 1191, 1198,
+	1204, 1210, 1216, 1223, 1229, 1236, 1242, 1248,
+	1255, 1261, 1268, 1274, 1281, 1288, 1294, 1301,
+	1307, 1314, 1321, 1328, 1334, 1341, 1348, 1355,
+	1362, 1368, 1375, 1382, 1389, 1396, 1403, 1410,
+	1417, 1424, 1431, 1438, 1446, 1453, 1460, 1467,
+	1474, 1482, 1489, 1496, 1503, 1511, 1518, 1526,
+	1533, 1540, 1548, 1555, 1563, 1571, 1578, 1586,
+	1593, 1601, 1609, 1616, 1624, 1632, 1640, 1647,
+	1655, 1663, 1671, 1679, 1687, 1695, 1703, 1711,
+	1719, 1727, 1735, 1743, 1751, 1759, 1768, 1776,
+	1784, 1792, 1801, 1809, 1817, 1826, 1834, 1842,
+	1851, 1859, 1868, 1876, 1885, 1893, 1902, 1911,
+	1919, 1928, 1937, 1946, 1954, 1963, 1972, 1981,
+	1990, 1999, 2008, 2016, 2025, 2034, 2044, 2053,
+	2062, 2071, 2080, 2089, 2098, 2108, 2117, 2126,
+	2135, 2145, 2154, 2164, 2173, 2182, 2192, 2201,
+	2211, 2220, 2230, 2240, 2249, 2259, 2269, 2278,
+	2288, 2298, 2308, 2318, 2328, 2337, 2347, 2357,
+	2367, 2377, 2387, 2397, 2408, 2418, 2428, 2438,
+	2448, 2459, 2469, 2479, 2489, 2500, 2510, 2521,
+	2531, 2542, 2552, 2563, 2573, 2584, 2594, 2605,
+	2616, 2626, 2637, 2648, 2659, 2669, 2680, 2691,
+	2702, 2713, 2724, 2735, 2746, 2757, 2768, 2779,
+	2791, 2802, 2813, 2824, 2835, 2847, 2858, 2869,
+	2881, 2892, 2904, 2915, 2927, 2938, 2950, 2961,
+	2973, 2985, 2996, 3008, 3020, 3032, 3043, 3055,
+	3067, 3079, 3091, 3103, 3115, 3127, 3139, 3151,
+	3163, 3175, 3188, 3200, 3212, 3224, 3237, 3249,
+	3261, 3274, 3286, 3299, 3311, 3324, 3336, 3349,
+	3361, 3374, 3387, 3399, 3412, 3425, 3438, 3450,
+	3463, 3476, 3489, 3502, 3515, 3528, 3541, 3554,
+	3567, 3580, 3594, 3607, 3620, 3633, 3647, 3660,
+	3673, 3687, 3700, 3714, 3727, 3741, 3754, 3768,
+	3781, 3795, 3809, 3822, 3836, 3850, 3864, 3878,
+	3891, 3905, 3919, 3933, 3947, 3961, 3975, 3989,
+	4004, 4018, 4032, 4046, 4060, 4075, 4089, 4103,
+	4118, 4132, 4146, 4161, 4175, 4190, 4205, 4219,
+	4234, 4248, 4263, 4278, 4293, 4307, 4322, 4337,
+	4352, 4367, 4382, 4397, 4412, 4427, 4442, 4457,
+	4472, 4488, 4503, 4518, 4533, 4549, 4564, 4579,
+	4595, 4610, 4626, 4641, 4657, 4672, 4688, 4704,
+	4719, 4735, 4751, 4766, 4782, 4798, 4814, 4830,
+	4846, 4862, 4878, 4894, 4910, 4926, 4942, 4958,
+	4974, 4991, 5007, 5023, 5039, 5056, 5072, 5089,
+	5105, 5122, 5138, 5155, 5171, 5188, 5204, 5221,
+	5238, 5255, 5271, 5288, 5305, 5322, 5339, 5356,
+	5373, 5390, 5407, 5424, 5441, 5458, 5475, 5493,
+	5510, 5527, 5544, 5562, 5579, 5596, 5614, 5631,
+	5649, 5666, 5684, 5702, 5719, 5737, 5754, 5772,
+	5790, 5808, 5826, 5843, 5861, 5879, 5897, 5915,
+	5933, 5951, 5969, 5987, 6006, 6024, 6042, 6060,
+	6079, 6097, 6115, 6134, 6152, 6170, 6189, 6207,
+	6226, 6245, 6263, 6282, 6300, 6319, 6338, 6357,
+	6375, 6394, 6413, 6432, 6451, 6470, 6489, 6508,
+	6527, 6546, 6565, 6584, 6604, 6623, 6642, 6661,
+	6681, 6700, 6719, 6739, 6758, 6778, 6797, 6817,
+	6836, 6856, 6875, 6895, 6915, 6935, 6954, 6974,
+	6994, 7014, 7034, 7054, 7074, 7094, 7114, 7134,
+	7154, 7174, 7194, 7214, 7234, 7255, 7275, 7295,
+	7315, 7336, 7356, 7377, 7397, 7418, 7438, 7459,
+	7479, 7500, 7521, 7541, 7562, 7583, 7603, 7624,
+	7645, 7666, 7687, 7708, 7729, 7750, 7771, 7792,
+	7813, 7834, 7855, 7876, 7898, 7919, 7940, 7961,
+	7983, 8004, 8025, 8047, 8068, 8090, 8111, 8133,
+	8154, 8176, 8198, 8219, 8241, 8263, 8284, 8306,
+	8328, 8350, 8372, 8394, 8416, 8438, 8460, 8482,
+	8504, 8526, 8548, 8570, 8592, 8614, 8637, 8659,
+	8681, 8704, 8726, 8748, 8771, 8793, 8816, 8838,
+	8861, 8883, 8906, 8928, 8951, 8974, 8996, 9019,
+	9042, 9065, 9088, 9110, 9133, 9156, 9179, 9202,
+	9225, 9248, 9271, 9294, 9317, 9341, 9364, 9387,
+	9410, 9433, 9457, 9480, 9503, 9527, 9550, 9574,
+	9597, 9620, 9644, 9668, 9691, 9715, 9738, 9762,
+	9786, 9809, 9833, 9857, 9881, 9904, 9928, 9952,
+	9976, 10000, 10024, 10048, 10072, 10096, 10120, 10144,
+	10168, 10192, 10216, 10241, 10265, 10289, 10313, 10338,
+	10362, 10386, 10411, 10435, 10460, 10484, 10508, 10533,
+	10558, 10582, 10607, 10631, 10656, 10681, 10705, 10730,
+	10755, 10779, 10804, 10829, 10854, 10879, 10904, 10929,
+	10954, 10979, 11004, 11029, 11054, 11079, 11104, 11129,
+	11154, 11179, 11204, 11230, 11255, 11280, 11305, 11331,
+	11356, 11381, 11407, 11432, 11458, 11483, 11509, 11534,
+	11560, 11585, 11611, 11636, 11662, 11688, 11713, 11739,
+	11765, 11790, 11816, 11842, 11868, 11894, 11919, 11945,
+	11971, 11997, 12023, 12049, 12075, 12101, 12127, 12153,
+	12179, 12205, 12231, 12258, 12284, 12310, 12336, 12362,
+	12389, 12415, 12441, 12468, 12494, 12520, 12547, 12573,
+	12599, 12626, 12652, 12679, 12705, 12732, 12758, 12785,
+	12812, 12838, 12865, 12891, 12918, 12945, 12972, 12998,
+	13025, 13052, 13079, 13105, 13132, 13159, 13186, 13213,
+	13240, 13267, 13294, 13320, 13347, 13374, 13401, 13429,
+	13456, 13483, 13510, 13537, 13564, 13591, 13618, 13645,
+	13673, 13700, 13727, 13754, 13782, 13809, 13836, 13864,
+	13891, 13918, 13946, 13973, 14000, 14028, 14055, 14083,
+	14110, 14138, 14165, 14193, 14220, 14248, 14275, 14303,
+	14331, 14358, 14386, 14414, 14441, 14469, 14497, 14524,
+	14552, 14580, 14607, 14635, 14663, 14691, 14719, 14747,
+	14774, 14802, 14830, 14858, 14886, 14914, 14942, 14970,
+	14998, 15026, 15054, 15082, 15110, 15138, 15166, 15194,
+	15222, 15250, 15278, 15306, 15334, 15362, 15390, 15419,
+	15447, 15475, 15503, 15531, 15560, 15588, 15616, 15644,
+	15673, 15701, 15729, 15757, 15786, 15814, 15842, 15871,
+	15899, 15927, 15956, 15984, 16013, 16041, 16069, 16098,
+	16126, 16155, 16183, 16212, 16240, 16269, 16297, 16326,
+	16354, 16383, 16411, 16440, 16468, 16497, 16525, 16554,
+	16583, 16611, 16640, 16668, 16697, 16726, 16754, 16783,
+	16812, 16840, 16869, 16898, 16926, 16955, 16984, 17012,
+	17041, 17070, 17098, 17127, 17156, 17185, 17213, 17242,
+	17271, 17300, 17328, 17357, 17386, 17415, 17444, 17472,
+	17501, 17530, 17559, 17588, 17616, 17645, 17674, 17703,
+	17732, 17761, 17789, 17818, 17847, 17876, 17905, 17934,
+	17963, 17991, 18020, 18049, 18078, 18107, 18136, 18165,
+	18194, 18223, 18251, 18280, 18309, 18338, 18367, 18396,
+	18425, 18454, 18483, 18512, 18541, 18569, 18598, 18627,
+	18656, 18685, 18714, 18743, 18772, 18801, 18830, 18859,
+	18888, 18917, 18945, 18974, 19003, 19032, 19061, 19090,
+	19119, 19148, 19177, 19206, 19235, 19264, 19293, 19321,
+	19350, 19379, 19408, 19437, 19466, 19495, 19524, 19553,
+	19582, 19610, 19639, 19668, 19697, 19726, 19755, 19784,
+	19813, 19841, 19870, 19899, 19928, 19957, 19986, 20015,
+	20043, 20072, 20101, 20130, 20159, 20188, 20216, 20245,
+	20274, 20303, 20332, 20360, 20389, 20418, 20447, 20475,
+	20504, 20533, 20562, 20590, 20619, 20648, 20676, 20705,
+	20734, 20763, 20791, 20820, 20849, 20877, 20906, 20935,
+	20963, 20992, 21020, 21049, 21078, 21106, 21135, 21163,
+	21192, 21220, 21249, 21278, 21306, 21335, 21363, 21392,
+	21420, 21449, 21477, 21505, 21534, 21562, 21591, 21619,
+	21648, 21676, 21704, 21733, 21761, 21789, 21818, 21846,
+	21874, 21903, 21931, 21959, 21988, 22016, 22044, 22072,
+	22100, 22129, 22157, 22185, 22213, 22241, 22269, 22298,
+	22326, 22354, 22382, 22410, 22438, 22466, 22494, 22522,
+	22550, 22578, 22606, 22634, 22662, 22690, 22718, 22745,
+	22773, 22801, 22829, 22857, 22885, 22912, 22940, 22968,
+	22996, 23023, 23051, 23079, 23106, 23134, 23162, 23189,
+	23217, 23244, 23272, 23300, 23327, 23355, 23382, 23410,
+	23437, 23464, 23492, 23519, 23547, 23574, 23601, 23629,
+	23656, 23683, 23710, 23738, 23765, 23792, 23819, 23846,
+	23874, 23901, 23928, 23955, 23982, 24009, 24036, 24063,
+	24090, 24117, 24144, 24171, 24198, 24224, 24251, 24278,
+	24305, 24332, 24358, 24385, 24412, 24439, 24465, 24492,
+	24518, 24545, 24572, 24598, 24625, 24651, 24678, 24704,
+	24730, 24757, 24783, 24810, 24836, 24862, 24888, 24915,
+	24941, 24967, 24993, 25019, 25045, 25072, 25098, 25124,
+	25150, 25176, 25202, 25228, 25253, 25279, 25305, 25331,
+	25357, 25383, 25408, 25434, 25460, 25485, 25511, 25537,
+	25562, 25588, 25613, 25639, 25664, 25690, 25715, 25740,
+	25766, 25791, 25816, 25842, 25867, 25892, 25917, 25942,
+	25968, 25993, 26018, 26043, 26068, 26093, 26118, 26142,
+	26167, 26192, 26217, 26242, 26267, 26291, 26316, 26341,
+	26365, 26390, 26414, 26439, 26463, 26488, 26512, 26537,
+	26561, 26585, 26610, 26634, 26658, 26682, 26706, 26731,
+	26755, 26779, 26803, 26827, 26851, 26875, 26898, 26922,
+	26946, 26970, 26994, 27017, 27041, 27065, 27088, 27112,
+	27135, 27159, 27182, 27206, 27229, 27253, 27276, 27299,
+	27323, 27346, 27369, 27392, 27415, 27438, 27461, 27484,
+	27507, 27530, 27553, 27576, 27599, 27621, 27644, 27667,
+	27690, 27712, 27735, 27757, 27780, 27802, 27825, 27847,
+	27869, 27892, 27914, 27936, 27958, 27981, 28003, 28025,
+	28047, 28069, 28091, 28113, 28135, 28156, 28178, 28200,
+	28222, 28243, 28265, 28287, 28308, 28330, 28351, 28373,
+	28394, 28415, 28437, 28458, 28479, 28500, 28521, 28543,
+	28564, 28585, 28606, 28626, 28647, 28668, 28689, 28710,
+	28730, 28751, 28772, 28792, 28813, 28833, 28854, 28874,
+	28895, 28915, 28935, 28955, 28976, 28996, 29016, 29036,
+	29056, 29076, 29096, 29116, 29136, 29155, 29175, 29195,
+	29214, 29234, 29254, 29273, 29293, 29312, 29331, 29351,
+	29370, 29389, 29408, 29428, 29447, 29466, 29485, 29504,
+	29523, 29541, 29560, 29579, 29598, 29616, 29635, 29654,
+	29672, 29691, 29709, 29727, 29746, 29764, 29782, 29801,
+	29819, 29837, 29855, 29873, 29891, 29909, 29927, 29944,
+	29962, 29980, 29998, 30015, 30033, 30050, 30068, 30085,
+	30103, 30120, 30137, 30154, 30171, 30189, 30206, 30223,
+	30240, 30257, 30273, 30290, 30307, 30324, 30340, 30357,
+	30374, 30390, 30407, 30423, 30439, 30456, 30472, 30488,
+	30504, 30520, 30536, 30552, 30568, 30584, 30600, 30616,
+	30632, 30647, 30663, 30678, 30694, 30709, 30725, 30740,
+	30756, 30771, 30786, 30801, 30816, 30831, 30846, 30861,
+	30876, 30891, 30906, 30920, 30935, 30950, 30964, 30979,
+	30993, 31008, 31022, 31036, 31051, 31065, 31079, 31093,
+	31107, 31121, 31135, 31149, 31162, 31176, 31190, 31204,
+	31217, 31231, 31244, 31258, 31271, 31284, 31297, 31311,
+	31324, 31337, 31350, 31363, 31376, 31389, 31401, 31414,
+	31427, 31439, 31452, 31465, 31477, 31489, 31502, 31514,
+	31526, 31538, 31551, 31563, 31575, 31587, 31599, 31610,
+	31622, 31634, 31645, 31657, 31669, 31680, 31692, 31703,
+	31714, 31726, 31737, 31748, 31759, 31770, 31781, 31792,
+	31803, 31814, 31824, 31835, 31846, 31856, 31867, 31877,
+	31887, 31898, 31908, 31918, 31928, 31939, 31949, 31959,
+	31968, 31978, 31988, 31998, 32007, 32017, 32027, 32036,
+	32046, 32055, 32064, 32074, 32083, 32092, 32101, 32110,
+	32119, 32128, 32137, 32146, 32154, 32163, 32172, 32180,
+	32189, 32197, 32205, 32214, 32222, 32230, 32238, 32246,
+	32254, 32262, 32270, 32278, 32286, 32293, 32301, 32309,
+	32316, 32324, 32331, 32338, 32346, 32353, 32360, 32367,
+	32374, 32381, 32388, 32395, 32402, 32408, 32415, 32422,
+	32428, 32435, 32441, 32447, 32454, 32460, 32466, 32472,
+	32478, 32484, 32490, 32496, 32502, 32507, 32513, 32519,
+	32524, 32530, 32535, 32541, 32546, 32551, 32556, 32561,
+	32566, 32571, 32576, 32581, 32586, 32591, 32595, 32600,
+	32605, 32609, 32614, 32618, 32622, 32627, 32631, 32635,
+	32639, 32643, 32647, 32651, 32655, 32658, 32662, 32666,
+	32669, 32673, 32676, 32679, 32683, 32686, 32689, 32692,
+	32695, 32698, 32701, 32704, 32707, 32710, 32712, 32715,
+	32718, 32720, 32722, 32725, 32727, 32729, 32732, 32734,
+	32736, 32738, 32740, 32741, 32743, 32745, 32747, 32748,
+	32750, 32751, 32753, 32754, 32755, 32757, 32758, 32759,
+	32760, 32761, 32762, 32763, 32763, 32764, 32765, 32765,
+	32766, 32766, 32767, 32767, 32767, 32767, 32767, 32767,
+	32767,
+};
+
+static const float32_t win_kaiser_bias[WINDOW_BIAS_LEN] = {
+	0.000000000e+00f, 3.137152907e-03f, 6.274291361e-03f, 9.411400907e-03f,
+	1.254846709e-02f, 1.568547545e-02f, 1.882241154e-02f, 2.195926088e-02f,
+	2.509600902e-02f, 2.823264149e-02f, 3.136914382e-02f, 3.450550152e-02f,
+	3.764170013e-02f, 4.077772514e-02f, 4.391356207e-02f, 4.704919643e-02f,
+	5.018461369e-02f, 5.331979935e-02f, 5.645473888e-02f, 5.958941776e-02f,
+	6.272382144e-02f, 6.585793537e-02f, 6.899174500e-02f, 7.212523574e-02f,
+	7.525839303e-02f, 7.839120226e-02f, 8.152364883e-02f, 8.465571813e-02f,
+	8.778739551e-02f, 9.091866633e-02f, 9.404951594e-02f, 9.717992965e-02f,
+	1.003098928e-01f, 1.034393906e-01f, 1.065684084e-01f, 1.096969315e-01f,
+	1.128249451e-01f, 1.159524343e-01f, 1.190793845e-01f, 1.222057808e-01f,
+	1.253316084e-01f, 1.284568524e-01f, 1.315814979e-01f, 1.347055301e-01f,
+	1.378289340e-01f, 1.409516947e-01f, 1.440737973e-01f, 1.471952266e-01f,
+	1.503159679e-01f, 1.534360059e-01f, 1.565553256e-01f, 1.596739120e-01f,
+	1.627917499e-01f, 1.659088243e-01f, 1.690251198e-01f, 1.721406214e-01f,
+	1.752553138e-01f, 1.783691818e-01f, 1.814822100e-01f, 1.845943832e-01f,
+	1.877056861e-01f, 1.908161031e-01f, 1.939256190e-01f, 1.970342183e-01f,
+	2.001418854e-01f,
+};
+
+static const float32_t win_flatTop_half[WINDOW_HALF_LEN] = {
+	-4.210510000e-04f, -4.211114377e-04f, -4.212927533e-04f, -4.215949551e-04f,
+	-4.220180564e-04f, -4.225620760e-04f, -4.232270382e-04f, -4.240129726e-04f,
+	-4.249199141e-04f, -4.259479031e-04f, -4.270969853e-04f, -4.283672118e-04f,
+	-4.297586390e-04f, -4.312713287e-04f, -4.329053483e-04f, -4.346607701e-04f,
+	-4.365376722e-04f, -4.385361379e-04f, -4.406562557e-04f, -4.428981196e-04f,
+	-4.452618291e-04f, -4.477474887e-04f, -4.503552085e-04f, -4.530851039e-04f,
+	-4.559372955e-04f, -4.589119094e-04f, -4.620090769e-04f, -4.652289347e-04f,
+	-4.685716248e-04f, -4.720372945e-04f, -4.756260962e-04f, -4.793381881e-04f,
+	-4.831737331e-04f, -4.871328999e-04f, -4.912158621e-04f, -4.954227987e-04f,
+	-4.997538941e-04f, -5.042093378e-04f, -5.087893246e-04f, -5.134940546e-04f,
+	-5.183237330e-04f, -5.232785703e-04f, -5.283587824e-04f, -5.335645900e-04f,
+	-5.388962195e-04f, -5.443539022e-04f, -5.499378746e-04f, -5.556483784e-04f,
+	-5.614856606e-04f, -5.674499732e-04f, -5.735415735e-04f, -5.797607237e-04f,
+	-5.861076915e-04f, -5.925827494e-04f, -5.991861752e-04f, -6.059182516e-04f,
+	-6.127792667e-04f, -6.197695135e-04f, -6.268892900e-04f, -6.341388995e-04f,
+	-6.415186500e-04f, -6.490288548e-04f, -6.566698323e-04f, -6.644419056e-04f,
+	-6.723454031e-04f, -6.803806580e-04f, -6.885480086e-04f, -6.968477980e-04f,
+	-7.052803745e-04f, -7.138460911e-04f, -7.225453059e-04f, -7.313783818e-04f,
+	-7.403456867e-04f, -7.494475932e-04f, -7.586844790e-04f, -7.680567264e-04f,
+	-7.775647229e-04f, -7.872088604e-04f, -7.969895360e-04f, -8.069071513e-04f,
+	-8.169621128e-04f, -8.271548319e-04f, -8.374857246e-04f, -8.479552115e-04f,
+	-8.585637183e-04f, -8.693116750e-04f, -8.801995165e-04f, -8.912276823e-04f,
+	-9.023966167e-04f, -9.137067685e-04f, -9.251585911e-04f, -9.367525426e-04f,
+	-9.484890855e-04f, -9.603686871e-04f, -9.723918191e-04f, -9.845589577e-04f,
+	-9.968705839e-04f, -1.009327183e-03f, -1.021929244e-03f, -1.034677262e-03f,
+	-1.047571736e-03f, -1.060613167e-03f, -1.073802065e-03f, -1.087138940e-03f,
+	-1.100624309e-03f, -1.114258693e-03f, -1.128042616e-03f, -1.141976607e-03f,
+	-1.156061200e-03f, -1.170296932e-03f, -1.184684346e-03f, -1.199223987e-03f,
+	-1.213916406e-03f, -1.228762158e-03f, -1.243761800e-03f, -1.258915896e-03f,
+	-1.274225013e-03f, -1.289689721e-03f, -1.305310595e-03f, -1.321088215e-03f,
+	-1.337023164e-03f, -1.353116028e-03f, -1.369367399e-03f, -1.385777871e-03f,
+	-1.402348044e-03f, -1.419078521e-03f, -1.435969907e-03f, -1.453022813e-03f,
+	-1.470237854e-03f, -1.487615648e-03f, -1.505156816e-03f, -1.522861985e-03f,
+	-1.540731783e-03f, -1.558766844e-03f, -1.576967805e-03f, -1.595335305e-03f,
+	-1.613869989e-03f, -1.632572504e-03f, -1.651443502e-03f, -1.670483637e-03f,
+	-1.689693567e-03f, -1.709073955e-03f, -1.728625465e-03f, -1.748348765e-03f,
+	-1.768244528e-03f, -1.788313430e-03f, -1.808556148e-03f, -1.828973365e-03f,
+	-1.849565766e-03f, -1.870334041e-03f, -1.891278879e-03f, -1.912400978e-03f,
+	-1.933701035e-03f, -1.955179751e-03f, -1.976837830e-03f, -1.998675981e-03f,
+	-2.020694914e-03f, -2.042895343e-03f, -2.065277984e-03f, -2.087843557e-03f,
+	-2.110592784e-03f, -2.133526392e-03f, -2.156645108e-03f, -2.179949663e-03f,
+	-2.203440793e-03f, -2.227119232e-03f, -2.250985722e-03f, -2.275041004e-03f,
+	-2.299285824e-03f, -2.323720928e-03f, -2.348347068e-03f, -2.373164995e-03f,
+	-2.398175466e-03f, -2.423379239e-03f, -2.448777073e-03f, -2.474369732e-03f,
+	-2.500157981e-03f, -2.526142588e-03f, -2.552324323e-03f, -2.578703958e-03f,
+	-2.605282267e-03f, -2.632060029e-03f, -2.659038022e-03f, -2.686217027e-03f,
+	-2.713597828e-03f, -2.741181211e-03f, -2.768967963e-03f, -2.796958874e-03f,
+	-2.825154736e-03f, -2.853556343e-03f, -2.882164489e-03f, -2.910979974e-03f,
+	-2.940003596e-03f, -2.969236157e-03f, -2.998678459e-03f, -3.028331308e-03f,
+	-3.058195510e-03f, -3.088271873e-03f, -3.118561208e-03f, -3.149064326e-03f,
+	-3.179782040e-03f, -3.210715164e-03f, -3.241864515e-03f, -3.273230910e-03f,
+	-3.304815168e-03f, -3.336618110e-03f, -3.368640558e-03f, -3.400883334e-03f,
+	-3.433347262e-03f, -3.466033169e-03f, -3.498941881e-03f, -3.532074225e-03f,
+	-3.565431032e-03f, -3.599013130e-03f, -3.632821350e-03f, -3.666856526e-03f,
+	-3.701119490e-03f, -3.735611075e-03f, -3.770332117e-03f, -3.805283451e-03f,
+	-3.840465913e-03f, -3.875880341e-03f, -3.911527572e-03f, -3.947408446e-03f,
+	-3.983523800e-03f, -4.019874474e-03f, -4.056461310e-03f, -4.093285147e-03f,
+	-4.130346827e-03f, -4.167647191e-03f, -4.205187081e-03f, -4.242967339e-03f,
+	-4.280988809e-03f, -4.319252332e-03f, -4.357758751e-03f, -4.396508911e-03f,
+	-4.435503653e-03f, -4.474743821e-03f, -4.514230259e-03f, -4.553963809e-03f,
+	-4.593945315e-03f, -4.634175620e-03f, -4.674655567e-03f, -4.715385999e-03f,
+	-4.756367757e-03f, -4.797601684e-03f, -4.839088623e-03f, -4.880829414e-03f,
+	-4.922824898e-03f, -4.965075916e-03f, -5.007583308e-03f, -5.050347914e-03f,
+	-5.093370571e-03f, -5.136652119e-03f, -5.180193395e-03f, -5.223995235e-03f,
+	-5.268058476e-03f, -5.312383953e-03f, -5.356972499e-03f, -5.401824948e-03f,
+	-5.446942132e-03f, -5.492324882e-03f, -5.537974029e-03f, -5.583890402e-03f,
+	-5.630074828e-03f, -5.676528133e-03f, -5.723251144e-03f, -5.770244685e-03f,
+	-5.817509577e-03f, -5.865046642e-03f, -5.912856700e-03f, -5.960940569e-03f,
+	-6.009299066e-03f, -6.057933006e-03f, -6.106843201e-03f, -6.156030465e-03f,
+	-6.205495607e-03f, -6.255239434e-03f, -6.305262753e-03f, -6.355566369e-03f,
+	-6.406151084e-03f, -6.457017697e-03f, -6.508167009e-03f, -6.559599813e-03f,
+	-6.611316906e-03f, -6.663319078e-03f, -6.715607119e-03f, -6.768181816e-03f,
+	-6.821043954e-03f, -6.874194316e-03f, -6.927633682e-03f, -6.981362828e-03f,
+	-7.035382530e-03f, -7.089693560e-03f, -7.144296688e-03f, -7.199192681e-03f,
+	-7.254382302e-03f, -7.309866314e-03f, -7.365645473e-03f, -7.421720536e-03f,
+	-7.478092256e-03f, -7.534761381e-03f, -7.591728658e-03f, -7.648994830e-03f,
+	-7.706560637e-03f, -7.764426816e-03f, -7.822594100e-03f, -7.881063219e-03f,
+	-7.939834900e-03f, -7.998909867e-03f, -8.058288838e-03f, -8.117972530e-03f,
+	-8.177961655e-03f, -8.238256922e-03f, -8.298859037e-03f, -8.359768699e-03f,
+	-8.420986608e-03f, -8.482513456e-03f, -8.544349933e-03f, -8.606496725e-03f,
+	-8.668954512e-03f, -8.731723973e-03f, -8.794805781e-03f, -8.858200604e-03f,
+	-8.921909107e-03f, -8.985931952e-03f, -9.050269793e-03f, -9.114923282e-03f,
+	-9.179893067e-03f, -9.245179789e-03f, -9.310784088e-03f, -9.376706595e-03f,
+	-9.442947940e-03f, -9.509508745e-03f, -9.576389631e-03f, -9.643591211e-03f,
+	-9.711114094e-03f, -9.778958885e-03f, -9.847126181e-03f, -9.915616577e-03f,
+	-9.984430662e-03f, -1.005356902e-02f, -1.012303223e-02f, -1.019282086e-02f,
+	-1.026293548e-02f, -1.033337665e-02f, -1.040414494e-02f, -1.047524088e-02f,
+	-1.054666503e-02f, -1.061841792e-02f, -1.069050009e-02f, -1.076291207e-02f,
+	-1.083565438e-02f, -1.090872753e-02f, -1.098213204e-02f, -1.105586841e-02f,
+	-1.112993714e-02f, -1.120433871e-02f, -1.127907363e-02f, -1.135414236e-02f,
+	-1.142954538e-02f, -1.150528315e-02f, -1.158135614e-02f, -1.165776480e-02f,
+	-1.173450958e-02f, -1.181159092e-02f, -1.188900926e-02f, -1.196676501e-02f,
+	-1.204485860e-02f, -1.212329045e-02f, -1.220206096e-02f, -1.228117054e-02f,
+	-1.236061957e-02f, -1.244040844e-02f, -1.252053753e-02f, -1.260100721e-02f,
+	-1.268181785e-02f, -1.276296980e-02f, -1.284446341e-02f, -1.292629903e-02f,
+	-1.300847699e-02f, -1.309099762e-02f, -1.317386123e-02f, -1.325706815e-02f,
+	-1.334061866e-02f, -1.342451308e-02f, -1.350875169e-02f, -1.359333476e-02f,
+	-1.367826258e-02f, -1.376353540e-02f, -1.384915349e-02f, -1.393511709e-02f,
+	-1.402142644e-02f, -1.410808178e-02f, -1.419508333e-02f, -1.428243131e-02f,
+	-1.437012591e-02f, -1.445816735e-02f, -1.454655581e-02f, -1.463529147e-02f,
+	-1.472437450e-02f, -1.481380508e-02f, -1.490358335e-02f, -1.499370946e-02f,
+	-1.508418355e-02f, -1.517500575e-02f, -1.526617618e-02f, -1.535769494e-02f,
+	-1.544956215e-02f, -1.554177789e-02f, -1.563434224e-02f, -1.572725528e-02f,
+	-1.582051708e-02f, -1.591412768e-02f, -1.600808714e-02f, -1.610239549e-02f,
+	-1.619705275e-02f, -1.629205895e-02f, -1.638741408e-02f, -1.648311816e-02f,
+	-1.657917116e-02f, -1.667557306e-02f, -1.677232383e-02f, -1.686942343e-02f,
+	-1.696687180e-02f, -1.706466888e-02f, -1.716281460e-02f, -1.726130888e-02f,
+	-1.736015162e-02f, -1.745934272e-02f, -1.755888207e-02f, -1.765876953e-02f,
+	-1.775900498e-02f, -1.785958827e-02f, -1.796051924e-02f, -1.806179773e-02f,
+	-1.816342355e-02f, -1.826539652e-02f, -1.836771644e-02f, -1.847038310e-02f,
+	-1.857339627e-02f, -1.867675573e-02f, -1.878046123e-02f, -1.888451251e-02f,
+	-1.898890931e-02f, -1.909365135e-02f, -1.919873835e-02f, -1.930416999e-02f,
+	-1.940994598e-02f, -1.951606598e-02f, -1.962252967e-02f, -1.972933669e-02f,
+	-1.983648669e-02f, -1.994397930e-02f, -2.005181413e-02f, -2.015999080e-02f,
+	-2.026850889e-02f, -2.037736799e-02f, -2.048656767e-02f, -2.059610749e-02f,
+	-2.070598699e-02f, -2.081620571e-02f, -2.092676317e-02f, -2.103765888e-02f,
+	-2.114889234e-02f, -2.126046302e-02f, -2.137237041e-02f, -2.148461397e-02f,
+	-2.159719313e-02f, -2.171010733e-02f, -2.182335600e-02f, -2.193693855e-02f,
+	-2.205085436e-02f, -2.216510283e-02f, -2.227968333e-02f, -2.239459520e-02f,
+	-2.250983780e-02f, -2.262541045e-02f, -2.274131248e-02f, -2.285754319e-02f,
+	-2.297410187e-02f, -2.309098779e-02f, -2.320820023e-02f, -2.332573844e-02f,
+	-2.344360164e-02f, -2.356178907e-02f, -2.368029994e-02f, -2.379913345e-02f,
+	-2.391828877e-02f, -2.403776508e-02f, -2.415756153e-02f, -2.427767727e-02f,
+	-2.439811142e-02f, -2.451886310e-02f, -2.463993141e-02f, -2.476131543e-02f,
+	-2.488301424e-02f, -2.500502689e-02f, -2.512735243e-02f, -2.524998989e-02f,
+	-2.537293828e-02f, -2.549619660e-02f, -2.561976383e-02f, -2.574363896e-02f,
+	-2.586782094e-02f, -2.599230871e-02f, -2.611710119e-02f, -2.624219731e-02f,
+	-2.636759595e-02f, -2.649329601e-02f, -2.661929635e-02f, -2.674559583e-02f,
+	-2.687219329e-02f, -2.699908754e-02f, -2.712627741e-02f, -2.725376167e-02f,
+	-2.738153912e-02f, -2.750960852e-02f, -2.763796861e-02f, -2.776661813e-02f,
+	-2.789555580e-02f, -2.802478031e-02f, -2.815429036e-02f, -2.828408462e-02f,
+	-2.841416174e-02f, -2.854452037e-02f, -2.867515912e-02f, -2.880607661e-02f,
+	-2.893727144e-02f, -2.906874218e-02f, -2.920048739e-02f, -2.933250562e-02f,
+	-2.946479540e-02f, -2.959735524e-02f, -2.973018365e-02f, -2.986327910e-02f,
+	-2.999664007e-02f, -3.013026499e-02f, -3.026415231e-02f, -3.039830045e-02f,
+	-3.053270781e-02f, -3.066737276e-02f, -3.080229369e-02f, -3.093746894e-02f,
+	-3.107289686e-02f, -3.120857575e-02f, -3.134450393e-02f, -3.148067967e-02f,
+	-3.161710126e-02f, -3.175376695e-02f, -3.189067497e-02f, -3.202782354e-02f,
+	-3.216521087e-02f, -3.230283514e-02f, -3.244069452e-02f, -3.257878717e-02f,
+	-3.271711123e-02f, -3.285566480e-02f, -3.299444601e-02f, -3.313345292e-02f,
+	-3.327268361e-02f, -3.341213613e-02f, -3.355180851e-02f, -3.369169878e-02f,
+	-3.383180492e-02f, -3.397212493e-02f, -3.411265677e-02f, -3.425339838e-02f,
+	-3.439434770e-02f, -3.453550264e-02f, -3.467686109e-02f, -3.481842094e-02f,
+	-3.496018004e-02f, -3.510213624e-02f, -3.524428736e-02f, -3.538663122e-02f,
+	-3.552916559e-02f, -3.567188826e-02f, -3.581479697e-02f, -3.595788948e-02f,
+	-3.610116348e-02f, -3.624461670e-02f, -3.638824681e-02f, -3.653205147e-02f,
+	-3.667602834e-02f, -3.682017504e-02f, -3.696448920e-02f, -3.710896839e-02f,
+	-3.725361020e-02f, -3.739841219e-02f, -3.754337189e-02f, -3.768848683e-02f,
+	-3.783375451e-02f, -3.797917242e-02f, -3.812473803e-02f, -3.827044877e-02f,
+	-3.841630210e-02f, -3.856229541e-02f, -3.870842610e-02f, -3.885469155e-02f,
+	-3.900108911e-02f, -3.914761613e-02f, -3.929426993e-02f, -3.944104780e-02f,
+	-3.958794704e-02f, -3.973496490e-02f, -3.988209863e-02f, -4.002934547e-02f,
+	-4.017670263e-02f, -4.032416728e-02f, -4.047173661e-02f, -4.061940778e-02f,
+	-4.076717791e-02f, -4.091504412e-02f, -4.106300351e-02f, -4.121105317e-02f,
+	-4.135919014e-02f, -4.150741148e-02f, -4.165571420e-02f, -4.180409532e-02f,
+	-4.195255181e-02f, -4.210108064e-02f, -4.224967877e-02f, -4.239834311e-02f,
+	-4.254707058e-02f, -4.269585807e-02f, -4.284470246e-02f, -4.299360059e-02f,
+	-4.314254931e-02f, -4.329154542e-02f, -4.344058572e-02f, -4.358966700e-02f,
+	-4.373878600e-02f, -4.388793947e-02f, -4.403712413e-02f, -4.418633668e-02f,
+	-4.433557381e-02f, -4.448483217e-02f, -4.463410841e-02f, -4.478339915e-02f,
+	-4.493270101e-02f, -4.508201057e-02f, -4.523132439e-02f, -4.538063903e-02f,
+	-4.552995101e-02f, -4.567925685e-02f, -4.582855303e-02f, -4.597783603e-02f,
+	-4.612710230e-02f, -4.627634828e-02f, -4.642557038e-02f, -4.657476499e-02f,
+	-4.672392850e-02f, -4.687305725e-02f, -4.702214759e-02f, -4.717119583e-02f,
+	-4.732019827e-02f, -4.746915120e-02f, -4.761805088e-02f, -4.776689354e-02f,
+	-4.791567541e-02f, -4.806439269e-02f, -4.821304157e-02f, -4.836161821e-02f,
+	-4.851011876e-02f, -4.865853933e-02f, -4.880687605e-02f, -4.895512500e-02f,
+	-4.910328224e-02f, -4.925134383e-02f, -4.939930580e-02f, -4.954716415e-02f,
+	-4.969491488e-02f, -4.984255396e-02f, -4.999007735e-02f, -5.013748098e-02f,
+	-5.028476076e-02f, -5.043191259e-02f, -5.057893234e-02f, -5.072581588e-02f,
+	-5.087255905e-02f, -5.101915765e-02f, -5.116560750e-02f, -5.131190436e-02f,
+	-5.145804401e-02f, -5.160402219e-02f, -5.174983462e-02f, -5.189547700e-02f,
+	-5.204094502e-02f, -5.218623435e-02f, -5.233134062e-02f, -5.247625948e-02f,
+	-5.262098653e-02f, -5.276551736e-02f, -5.290984754e-02f, -5.305397262e-02f,
+	-5.319788814e-02f, -5.334158961e-02f, -5.348507252e-02f, -5.362833235e-02f,
+	-5.377136456e-02f, -5.391416459e-02f, -5.405672786e-02f, -5.419904976e-02f,
+	-5.434112567e-02f, -5.448295097e-02f, -5.462452100e-02f, -5.476583108e-02f,
+	-5.490687651e-02f, -5.504765259e-02f, -5.518815458e-02f, -5.532837774e-02f,
+	-5.546831729e-02f, -5.560796845e-02f, -5.574732642e-02f, -5.588638637e-02f,
+	-5.602514345e-02f, -5.616359282e-02f, -5.630172957e-02f, -5.643954883e-02f,
+	-5.657704567e-02f, -5.671421515e-02f, -5.685105233e-02f, -5.698755222e-02f,
+	-5.712370985e-02f, -5.725952020e-02f, -5.739497825e-02f, -5.753007895e-02f,
+	-5.766481723e-02f, -5.779918802e-02f, -5.793318622e-02f, -5.806680670e-02f,
+	-5.820004434e-02f, -5.833289397e-02f, -5.846535043e-02f, -5.859740853e-02f,
+	-5.872906306e-02f, -5.886030878e-02f, -5.899114047e-02f, -5.912155286e-02f,
+	-5.925154066e-02f, -5.938109859e-02f, -5.951022132e-02f, -5.963890353e-02f,
+	-5.976713986e-02f, -5.989492495e-02f, -6.002225341e-02f, -6.014911984e-02f,
+	-6.027551882e-02f, -6.040144491e-02f, -6.052689265e-02f, -6.065185658e-02f,
+	-6.077633120e-02f, -6.090031101e-02f, -6.102379049e-02f, -6.114676408e-02f,
+	-6.126922624e-02f, -6.139117139e-02f, -6.151259393e-02f, -6.163348826e-02f,
+	-6.175384875e-02f, -6.187366976e-02f, -6.199294563e-02f, -6.211167068e-02f,
+	-6.222983921e-02f, -6.234744552e-02f, -6.246448389e-02f, -6.258094856e-02f,
+	-6.269683378e-02f, -6.281213377e-02f, -6.292684274e-02f, -6.304095489e-02f,
+	-6.315446438e-02f, -6.326736537e-02f, -6.337965201e-02f, -6.349131843e-02f,
+	-6.360235873e-02f, -6.371276700e-02f, -6.382253734e-02f, -6.393166380e-02f,
+	-6.404014042e-02f, -6.414796124e-02f, -6.425512028e-02f, -6.436161153e-02f,
+	-6.446742897e-02f, -6.457256659e-02f, -6.467701832e-02f, -6.478077811e-02f,
+	-6.488383989e-02f, -6.498619755e-02f, -6.508784500e-02f, -6.518877610e-02f,
+	-6.528898473e-02f, -6.538846472e-02f, -6.548720992e-02f, -6.558521413e-02f,
+	-6.568247117e-02f, -6.577897481e-02f, -6.587471884e-02f, -6.596969701e-02f,
+	-6.606390308e-02f, -6.615733075e-02f, -6.624997377e-02f, -6.634182581e-02f,
+	-6.643288059e-02f, -6.652313176e-02f, -6.661257298e-02f, -6.670119791e-02f,
+	-6.678900017e-02f, -6.687597338e-02f, -6.696211115e-02f, -6.704740707e-02f,
+	-6.713185471e-02f, -6.721544764e-02f, -6.729817940e-02f, -6.738004354e-02f,
+	-6.746103358e-02f, -6.754114303e-02f, -6.762036539e-02f, -6.769869413e-02f,
+	-6.777612274e-02f, -6.785264468e-02f, -6.792825338e-02f, -6.800294228e-02f,
+	-6.807670480e-02f, -6.814953436e-02f, -6.822142434e-02f, -6.829236814e-02f,
+	-6.836235912e-02f, -6.843139064e-02f, -6.849945605e-02f, -6.856654869e-02f,
+	-6.863266188e-02f, -6.869778893e-02f, -6.876192314e-02f, -6.882505781e-02f,
+	-6.888718620e-02f, -6.894830159e-02f, -6.900839722e-02f, -6.906746635e-02f,
+	-6.912550221e-02f, -6.918249801e-02f, -6.923844698e-02f, -6.929334229e-02f,
+	-6.934717716e-02f, -6.939994475e-02f, -6.945163823e-02f, -6.950225077e-02f,
+	-6.955177550e-02f, -6.960020557e-02f, -6.964753410e-02f, -6.969375421e-02f,
+	-6.973885901e-02f, -6.978284158e-02f, -6.982569503e-02f, -6.986741243e-02f,
+	-6.990798685e-02f, -6.994741134e-02f, -6.998567896e-02f, -7.002278275e-02f,
+	-7.005871573e-02f, -7.009347093e-02f, -7.012704137e-02f, -7.015942005e-02f,
+	-7.019059997e-02f, -7.022057411e-02f, -7.024933545e-02f, -7.027687697e-02f,
+	-7.030319162e-02f, -7.032827237e-02f, -7.035211216e-02f, -7.037470392e-02f,
+	-7.039604059e-02f, -7.041611510e-02f, -7.043492035e-02f, -7.045244926e-02f,
+	-7.046869473e-02f, -7.048364965e-02f, -7.049730691e-02f, -7.050965940e-02f,
+	-7.052069997e-02f, -7.053042151e-02f, -7.053881686e-02f, -7.054587889e-02f,
+	-7.055160044e-02f, -7.055597435e-02f, -7.055899346e-02f, -7.056065059e-02f,
+	-7.056093857e-02f, -7.055985021e-02f, -7.055737833e-02f, -7.055351573e-02f,
+	-7.054825522e-02f, -7.054158958e-02f, -7.053351161e-02f, -7.052401410e-02f,
+	-7.051308982e-02f, -7.050073154e-02f, -7.048693205e-02f, -7.047168411e-02f,
+	-7.045498047e-02f, -7.043681390e-02f, -7.041717715e-02f, -7.039606296e-02f,
+	-7.037346409e-02f, -7.034937328e-02f, -7.032378327e-02f, -7.029668678e-02f,
+	-7.026807655e-02f, -7.023794531e-02f, -7.020628579e-02f, -7.017309070e-02f,
+	-7.013835277e-02f, -7.010206471e-02f, -7.006421924e-02f, -7.002480906e-02f,
+	-6.998382689e-02f, -6.994126544e-02f, -6.989711740e-02f, -6.985137549e-02f,
+	-6.980403240e-02f, -6.975508083e-02f, -6.970451349e-02f, -6.965232306e-02f,
+	-6.959850225e-02f, -6.954304375e-02f, -6.948594025e-02f, -6.942718445e-02f,
+	-6.936676904e-02f, -6.930468671e-02f, -6.924093014e-02f, -6.917549205e-02f,
+	-6.910836510e-02f, -6.903954200e-02f, -6.896901544e-02f, -6.889677811e-02f,
+	-6.882282270e-02f, -6.874714190e-02f, -6.866972841e-02f, -6.859057492e-02f,
+	-6.850967412e-02f, -6.842701873e-02f, -6.834260142e-02f, -6.825641490e-02f,
+	-6.816845188e-02f, -6.807870506e-02f, -6.798716713e-02f, -6.789383081e-02f,
+	-6.779868881e-02f, -6.770173384e-02f, -6.760295862e-02f, -6.750235585e-02f,
+	-6.739991826e-02f, -6.729563858e-02f, -6.718950952e-02f, -6.708152382e-02f,
+	-6.697167421e-02f, -6.685995343e-02f, -6.674635421e-02f, -6.663086930e-02f,
+	-6.651349145e-02f, -6.639421341e-02f, -6.627302793e-02f, -6.614992778e-02f,
+	-6.602490572e-02f, -6.589795452e-02f, -6.576906696e-02f, -6.563823582e-02f,
+	-6.550545387e-02f, -6.537071392e-02f, -6.523400876e-02f, -6.509533119e-02f,
+	-6.495467403e-02f, -6.481203007e-02f, -6.466739215e-02f, -6.452075310e-02f,
+	-6.437210573e-02f, -6.422144290e-02f, -6.406875745e-02f, -6.391404224e-02f,
+	-6.375729012e-02f, -6.359849397e-02f, -6.343764665e-02f, -6.327474106e-02f,
+	-6.310977008e-02f, -6.294272662e-02f, -6.277360357e-02f, -6.260239386e-02f,
+	-6.242909041e-02f, -6.225368615e-02f, -6.207617402e-02f, -6.189654698e-02f,
+	-6.171479797e-02f, -6.153091998e-02f, -6.134490597e-02f, -6.115674894e-02f,
+	-6.096644188e-02f, -6.077397780e-02f, -6.057934972e-02f, -6.038255066e-02f,
+	-6.018357366e-02f, -5.998241177e-02f, -5.977905804e-02f, -5.957350556e-02f,
+	-5.936574739e-02f, -5.915577663e-02f, -5.894358639e-02f, -5.872916977e-02f,
+	-5.851251991e-02f, -5.829362994e-02f, -5.807249302e-02f, -5.784910230e-02f,
+	-5.762345097e-02f, -5.739553220e-02f, -5.716533920e-02f, -5.693286519e-02f,
+	-5.669810338e-02f, -5.646104702e-02f, -5.622168936e-02f, -5.598002367e-02f,
+	-5.573604322e-02f, -5.548974132e-02f, -5.524111126e-02f, -5.499014638e-02f,
+	-5.473684000e-02f, -5.448118548e-02f, -5.422317618e-02f, -5.396280549e-02f,
+	-5.370006680e-02f, -5.343495352e-02f, -5.316745907e-02f, -5.289757691e-02f,
+	-5.262530048e-02f, -5.235062326e-02f, -5.207353874e-02f, -5.179404043e-02f,
+	-5.151212184e-02f, -5.122777653e-02f, -5.094099803e-02f, -5.065177993e-02f,
+	-5.036011581e-02f, -5.006599928e-02f, -4.976942397e-02f, -4.947038351e-02f,
+	-4.916887157e-02f, -4.886488183e-02f, -4.855840797e-02f, -4.824944372e-02f,
+	-4.793798280e-02f, -4.762401897e-02f, -4.730754600e-02f, -4.698855768e-02f,
+	-4.666704781e-02f, -4.634301022e-02f, -4.601643876e-02f, -4.568732729e-02f,
+	-4.535566970e-02f, -4.502145991e-02f, -4.468469182e-02f, -4.434535940e-02f,
+	-4.400345660e-02f, -4.365897742e-02f, -4.331191586e-02f, -4.296226596e-02f,
+	-4.261002177e-02f, -4.225517735e-02f, -4.189772681e-02f, -4.153766425e-02f,
+	-4.117498382e-02f, -4.080967967e-02f, -4.044174599e-02f, -4.007117699e-02f,
+	-3.969796688e-02f, -3.932210992e-02f, -3.894360038e-02f, -3.856243256e-02f,
+	-3.817860077e-02f, -3.779209936e-02f, -3.740292270e-02f, -3.701106517e-02f,
+	-3.661652118e-02f, -3.621928518e-02f, -3.581935163e-02f, -3.541671501e-02f,
+	-3.501136983e-02f, -3.460331064e-02f, -3.419253199e-02f, -3.377902846e-02f,
+	-3.336279468e-02f, -3.294382527e-02f, -3.252211490e-02f, -3.209765825e-02f,
+	-3.167045005e-02f, -3.124048502e-02f, -3.080775795e-02f, -3.037226362e-02f,
+	-2.993399685e-02f, -2.949295248e-02f, -2.904912540e-02f, -2.860251050e-02f,
+	-2.815310272e-02f, -2.770089700e-02f, -2.724588833e-02f, -2.678807172e-02f,
+	-2.632744222e-02f, -2.586399488e-02f, -2.539772481e-02f, -2.492862712e-02f,
+	-2.445669698e-02f, -2.398192957e-02f, -2.350432009e-02f, -2.302386378e-02f,
+	-2.254055592e-02f, -2.205439180e-02f, -2.156536676e-02f, -2.107347615e-02f,
+	-2.057871535e-02f, -2.008107980e-02f, -1.958056493e-02f, -1.907716623e-02f,
+	-1.857087921e-02f, -1.806169941e-02f, -1.754962240e-02f, -1.703464378e-02f,
+	-1.651675919e-02f, -1.599596430e-02f, -1.547225479e-02f, -1.494562642e-02f,
+	-1.441607492e-02f, -1.388359610e-02f, -1.334818579e-02f, -1.280983984e-02f,
+	-1.226855415e-02f, -1.172432463e-02f, -1.117714724e-02f, -1.062701798e-02f,
+	-1.007393287e-02f, -9.517887966e-03f, -8.958879355e-03f, -8.396903163e-03f,
+	-7.831955549e-03f, -7.264032704e-03f, -6.693130855e-03f, -6.119246262e-03f,
+	-5.542375222e-03f, -4.962514063e-03f, -4.379659152e-03f, -3.793806886e-03f,
+	-3.204953703e-03f, -2.613096072e-03f, -2.018230498e-03f, -1.420353525e-03f,
+	-8.194617275e-04f, -2.155517205e-04f, 3.913798469e-04f, 1.001336289e-03f,
+	1.614320885e-03f, 2.230336874e-03f, 2.849387462e-03f, 3.471475818e-03f,
+	4.096605070e-03f, 4.724778314e-03f, 5.355998605e-03f, 5.990268962e-03f,
+	6.627592367e-03f, 7.267971762e-03f, 7.911410054e-03f, 8.557910109e-03f,
+	9.207474757e-03f, 9.860106789e-03f, 1.051580896e-02f, 1.117458397e-02f,
+	1.183643452e-02f, 1.250136322e-02f, 1.316937268e-02f, 1.384046545e-02f,
+	1.451464406e-02f, 1.519191098e-02f, 1.587226865e-02f, 1.655571946e-02f,
+	1.724226579e-02f, 1.793190995e-02f, 1.862465421e-02f, 1.932050082e-02f,
+	2.001945197e-02f, 2.072150982e-02f, 2.142667648e-02f, 2.213495404e-02f,
+	2.284634453e-02f, 2.356084993e-02f, 2.427847221e-02f, 2.499921327e-02f,
+	2.572307498e-02f, 2.645005916e-02f, 2.718016761e-02f, 2.791340207e-02f,
+	2.864976423e-02f, 2.938925576e-02f, 3.013187827e-02f, 3.087763333e-02f,
+	3.162652248e-02f, 3.237854720e-02f, 3.313370894e-02f, 3.389200911e-02f,
+	3.465344905e-02f, 3.541803008e-02f, 3.618575349e-02f, 3.695662048e-02f,
+	3.773063226e-02f, 3.850778996e-02f, 3.928809467e-02f, 4.007154746e-02f,
+	4.085814932e-02f, 4.164790123e-02f, 4.244080409e-02f, 4.323685880e-02f,
+	4.403606617e-02f, 4.483842699e-02f, 4.564394201e-02f, 4.645261191e-02f,
+	4.726443735e-02f, 4.807941894e-02f, 4.889755723e-02f, 4.971885273e-02f,
+	5.054330592e-02f, 5.137091722e-02f, 5.220168700e-02f, 5.303561560e-02f,
+	5.387270329e-02f, 5.471295032e-02f, 5.555635688e-02f, 5.640292312e-02f,
+	5.725264912e-02f, 5.810553495e-02f, 5.896158061e-02f, 5.982078606e-02f,
+	6.068315121e-02f, 6.154867593e-02f, 6.241736002e-02f, 6.328920326e-02f,
+	6.416420538e-02f, 6.504236604e-02f, 6.592368488e-02f, 6.680816147e-02f,
+	6.769579535e-02f, 6.858658600e-02f, 6.948053285e-02f, 7.037763529e-02f,
+	7.127789266e-02f, 7.218130426e-02f, 7.308786931e-02f, 7.399758703e-02f,
+	7.491045655e-02f, 7.582647696e-02f, 7.674564733e-02f, 7.766796663e-02f,
+	7.859343384e-02f, 7.952204784e-02f, 8.045380748e-02f, 8.138871157e-02f,
+	8.232675887e-02f, 8.326794807e-02f, 8.421227783e-02f, 8.515974674e-02f,
+	8.611035338e-02f, 8.706409624e-02f, 8.802097377e-02f, 8.898098439e-02f,
+	8.994412644e-02f, 9.091039823e-02f, 9.187979801e-02f, 9.285232399e-02f,
+	9.382797432e-02f, 9.480674711e-02f, 9.578864041e-02f, 9.677365221e-02f,
+	9.776178047e-02f, 9.875302310e-02f, 9.974737794e-02f, 1.007448428e-01f,
+	1.017454154e-01f, 1.027490934e-01f, 1.037558746e-01f, 1.047657565e-01f,
+	1.057787366e-01f, 1.067948124e-01f, 1.078139814e-01f, 1.088362409e-01f,
+	1.098615884e-01f, 1.108900210e-01f, 1.119215360e-01f, 1.129561307e-01f,
+	1.139938021e-01f, 1.150345473e-01f, 1.160783633e-01f, 1.171252471e-01f,
+	1.181751957e-01f, 1.192282059e-01f, 1.202842745e-01f, 1.213433983e-01f,
+	1.224055740e-01f, 1.234707983e-01f, 1.245390677e-01f, 1.256103789e-01f,
+	1.266847283e-01f, 1.277621125e-01f, 1.288425277e-01f, 1.299259704e-01f,
+	1.310124368e-01f, 1.321019231e-01f, 1.331944257e-01f, 1.342899405e-01f,
+	1.353884638e-01f, 1.364899914e-01f, 1.375945195e-01f, 1.387020439e-01f,
+	1.398125605e-01f, 1.409260651e-01f, 1.420425535e-01f, 1.431620213e-01f,
+	1.442844644e-01f, 1.454098782e-01f, 1.465382583e-01f, 1.476696002e-01f,
+	1.488038994e-01f, 1.499411513e-01f, 1.510813511e-01f, 1.522244943e-01f,
+	1.533705759e-01f, 1.545195913e-01f, 1.556715355e-01f, 1.568264036e-01f,
+	1.579841907e-01f, 1.591448916e-01f, 1.603085013e-01f, 1.614750147e-01f,
+	1.626444266e-01f, 1.638167317e-01f, 1.649919247e-01f, 1.661700003e-01f,
+	1.673509531e-01f, 1.685347776e-01f, 1.697214682e-01f, 1.709110195e-01f,
+	1.721034258e-01f, 1.732986814e-01f, 1.744967806e-01f, 1.756977176e-01f,
+	1.769014866e-01f, 1.781080817e-01f, 1.793174969e-01f, 1.805297263e-01f,
+	1.817447638e-01f, 1.829626032e-01f, 1.841832385e-01f, 1.854066634e-01f,
+	1.866328717e-01f, 1.878618569e-01f, 1.890936129e-01f, 1.903281331e-01f,
+	1.915654110e-01f, 1.928054402e-01f, 1.940482140e-01f, 1.952937258e-01f,
+	1.965419689e-01f, 1.977929365e-01f, 1.990466219e-01f, 2.003030182e-01f,
+	2.015621184e-01f, 2.028239157e-01f, 2.040884030e-01f, 2.053555733e-01f,
+	2.066254193e-01f, 2.078979340e-01f, 2.091731101e-01f, 2.104509403e-01f,
+	2.117314173e-01f, 2.130145337e-01f, 2.143002821e-01f, 2.155886549e-01f,
+	2.168796447e-01f, 2.181732437e-01f, 2.194694444e-01f, 2.207682391e-01f,
+	2.220696199e-01f, 2.233735791e-01f, 2.246801088e-01f, 2.259892011e-01f,
+	2.273008480e-01f, 2.286150414e-01f, 2.299317734e-01f, 2.312510357e-01f,
+	2.325728202e-01f, 2.338971187e-01f, 2.352239228e-01f, 2.365532241e-01f,
+	2.378850144e-01f, 2.392192852e-01f, 2.405560279e-01f, 2.418952341e-01f,
+	2.432368950e-01f, 2.445810020e-01f, 2.459275465e-01f, 2.472765197e-01f,
+	2.486279127e-01f, 2.499817167e-01f, 2.513379227e-01f, 2.526965218e-01f,
+	2.540575050e-01f, 2.554208632e-01f, 2.567865873e-01f, 2.581546680e-01f,
+	2.595250962e-01f, 2.608978625e-01f, 2.622729577e-01f, 2.636503723e-01f,
+	2.650300970e-01f, 2.664121221e-01f, 2.677964383e-01f, 2.691830358e-01f,
+	2.705719051e-01f, 2.719630364e-01f, 2.733564201e-01f, 2.747520463e-01f,
+	2.761499051e-01f, 2.775499867e-01f, 2.789522812e-01f, 2.803567784e-01f,
+	2.817634685e-01f, 2.831723412e-01f, 2.845833864e-01f, 2.859965940e-01f,
+	2.874119536e-01f, 2.888294551e-01f, 2.902490879e-01f, 2.916708418e-01f,
+	2.930947063e-01f, 2.945206708e-01f, 2.959487249e-01f, 2.973788579e-01f,
+	2.988110592e-01f, 3.002453181e-01f, 3.016816238e-01f, 3.031199655e-01f,
+	3.045603325e-01f, 3.060027138e-01f, 3.074470984e-01f, 3.088934754e-01f,
+	3.103418337e-01f, 3.117921622e-01f, 3.132444499e-01f, 3.146986855e-01f,
+	3.161548578e-01f, 3.176129554e-01f, 3.190729672e-01f, 3.205348816e-01f,
+	3.219986873e-01f, 3.234643729e-01f, 3.249319267e-01f, 3.264013372e-01f,
+	3.278725928e-01f, 3.293456818e-01f, 3.308205926e-01f, 3.322973133e-01f,
+	3.337758322e-01f, 3.352561375e-01f, 3.367382171e-01f, 3.382220592e-01f,
+	3.397076518e-01f, 3.411949829e-01f, 3.426840404e-01f, 3.441748121e-01f,
+	3.456672858e-01f, 3.471614495e-01f, 3.486572907e-01f, 3.501547972e-01f,
+	3.516539567e-01f, 3.531547566e-01f, 3.546571847e-01f, 3.561612284e-01f,
+	3.576668751e-01f, 3.591741124e-01f, 3.606829275e-01f, 3.621933078e-01f,
+	3.637052405e-01f, 3.652187131e-01f, 3.667337125e-01f, 3.682502261e-01f,
+	3.697682408e-01f, 3.712877439e-01f, 3.728087222e-01f, 3.743311629e-01f,
+	3.758550527e-01f, 3.773803787e-01f, 3.789071277e-01f, 3.804352866e-01f,
+	3.819648419e-01f, 3.834957806e-01f, 3.850280893e-01f, 3.865617546e-01f,
+	3.880967632e-01f, 3.896331016e-01f, 3.911707563e-01f, 3.927097138e-01f,
+	3.942499606e-01f, 3.957914830e-01f, 3.973342674e-01f, 3.988783002e-01f,
+	4.004235675e-01f, 4.019700557e-01f, 4.035177510e-01f, 4.050666394e-01f,
+	4.066167072e-01f, 4.081679403e-01f, 4.097203249e-01f, 4.112738469e-01f,
+	4.128284923e-01f, 4.143842470e-01f, 4.159410969e-01f, 4.174990279e-01f,
+	4.190580257e-01f, 4.206180762e-01f, 4.221791650e-01f, 4.237412778e-01f,
+	4.253044004e-01f, 4.268685183e-01f, 4.284336171e-01f, 4.299996823e-01f,
+	4.315666996e-01f, 4.331346542e-01f, 4.347035318e-01f, 4.362733176e-01f,
+	4.378439970e-01f, 4.394155555e-01f, 4.409879781e-01f, 4.425612503e-01f,
+	4.441353573e-01f, 4.457102842e-01f, 4.472860161e-01f, 4.488625383e-01f,
+	4.504398357e-01f, 4.520178935e-01f, 4.535966966e-01f, 4.551762301e-01f,
+	4.567564788e-01f, 4.583374277e-01f, 4.599190618e-01f, 4.615013657e-01f,
+	4.630843244e-01f, 4.646679226e-01f, 4.662521451e-01f, 4.678369767e-01f,
+	4.694224019e-01f, 4.710084054e-01f, 4.725949720e-01f, 4.741820861e-01f,
+	4.757697323e-01f, 4.773578952e-01f, 4.789465593e-01f, 4.805357090e-01f,
+	4.821253287e-01f, 4.837154030e-01f, 4.853059162e-01f, 4.868968525e-01f,
+	4.884881965e-01f, 4.900799322e-01f, 4.916720441e-01f, 4.932645163e-01f,
+	4.948573331e-01f, 4.964504786e-01f, 4.980439369e-01f, 4.996376923e-01f,
+	5.012317288e-01f, 5.028260305e-01f, 5.044205814e-01f, 5.060153656e-01f,
+	5.076103669e-01f, 5.092055695e-01f, 5.108009572e-01f, 5.123965140e-01f,
+	5.139922236e-01f, 5.155880701e-01f, 5.171840372e-01f, 5.187801087e-01f,
+	5.203762684e-01f, 5.219725002e-01f, 5.235687876e-01f, 5.251651146e-01f,
+	5.267614646e-01f, 5.283578214e-01f, 5.299541687e-01f, 5.315504900e-01f,
+	5.331467690e-01f, 5.347429893e-01f, 5.363391343e-01f, 5.379351876e-01f,
+	5.395311328e-01f, 5.411269533e-01f, 5.427226326e-01f, 5.443181541e-01f,
+	5.459135013e-01f, 5.475086576e-01f, 5.491036063e-01f, 5.506983308e-01f,
+	5.522928145e-01f, 5.538870407e-01f, 5.554809927e-01f, 5.570746538e-01f,
+	5.586680072e-01f, 5.602610363e-01f, 5.618537241e-01f, 5.634460541e-01f,
+	5.650380093e-01f, 5.666295729e-01f, 5.682207281e-01f, 5.698114580e-01f,
+	5.714017459e-01f, 5.729915747e-01f, 5.745809276e-01f, 5.761697876e-01f,
+	5.777581379e-01f, 5.793459614e-01f, 5.809332413e-01f, 5.825199605e-01f,
+	5.841061020e-01f, 5.856916489e-01f, 5.872765841e-01f, 5.888608905e-01f,
+	5.904445512e-01f, 5.920275490e-01f, 5.936098669e-01f, 5.951914879e-01f,
+	5.967723947e-01f, 5.983525703e-01f, 5.999319975e-01f, 6.015106593e-01f,
+	6.030885384e-01f, 6.046656178e-01f, 6.062418802e-01f, 6.078173085e-01f,
+	6.093918854e-01f, 6.109655939e-01f, 6.125384166e-01f, 6.141103364e-01f,
+	6.156813359e-01f, 6.172513981e-01f, 6.188205056e-01f, 6.203886412e-01f,
+	6.219557876e-01f, 6.235219276e-01f, 6.250870439e-01f, 6.266511191e-01f,
+	6.282141361e-01f, 6.297760774e-01f, 6.313369259e-01f, 6.328966642e-01f,
+	6.344552749e-01f, 6.360127408e-01f, 6.375690446e-01f, 6.391241688e-01f,
+	6.406780962e-01f, 6.422308094e-01f, 6.437822911e-01f, 6.453325239e-01f,
+	6.468814906e-01f, 6.484291736e-01f, 6.499755557e-01f, 6.515206195e-01f,
+	6.530643477e-01f, 6.546067228e-01f, 6.561477276e-01f, 6.576873445e-01f,
+	6.592255564e-01f, 6.607623458e-01f, 6.622976953e-01f, 6.638315875e-01f,
+	6.653640052e-01f, 6.668949309e-01f, 6.684243472e-01f, 6.699522368e-01f,
+	6.714785822e-01f, 6.730033663e-01f, 6.745265715e-01f, 6.760481805e-01f,
+	6.775681759e-01f, 6.790865405e-01f, 6.806032568e-01f, 6.821183074e-01f,
+	6.836316751e-01f, 6.851433424e-01f, 6.866532921e-01f, 6.881615068e-01f,
+	6.896679691e-01f, 6.911726618e-01f, 6.926755674e-01f, 6.941766688e-01f,
+	6.956759485e-01f, 6.971733893e-01f, 6.986689739e-01f, 7.001626849e-01f,
+	7.016545051e-01f, 7.031444172e-01f, 7.046324040e-01f, 7.061184481e-01f,
+	7.076025323e-01f, 7.090846393e-01f, 7.105647520e-01f, 7.120428531e-01f,
+	7.135189253e-01f, 7.149929515e-01f, 7.164649144e-01f, 7.179347968e-01f,
+	7.194025817e-01f, 7.208682517e-01f, 7.223317897e-01f, 7.237931787e-01f,
+	7.252524014e-01f, 7.267094407e-01f, 7.281642794e-01f, 7.296169006e-01f,
+	7.310672871e-01f, 7.325154219e-01f, 7.339612878e-01f, 7.354048678e-01f,
+	7.368461449e-01f, 7.382851020e-01f, 7.397217222e-01f, 7.411559885e-01f,
+	7.425878838e-01f, 7.440173913e-01f, 7.454444939e-01f, 7.468691748e-01f,
+	7.482914170e-01f, 7.497112036e-01f, 7.511285177e-01f, 7.525433425e-01f,
+	7.539556612e-01f, 7.553654568e-01f, 7.567727127e-01f, 7.581774119e-01f,
+	7.595795377e-01f, 7.609790734e-01f, 7.623760023e-01f, 7.637703075e-01f,
+	7.651619724e-01f, 7.665509804e-01f, 7.679373147e-01f, 7.693209588e-01f,
+	7.707018960e-01f, 7.720801097e-01f, 7.734555833e-01f, 7.748283004e-01f,
+	7.761982443e-01f, 7.775653985e-01f, 7.789297466e-01f, 7.802912721e-01f,
+	7.816499586e-01f, 7.830057896e-01f, 7.843587488e-01f, 7.857088198e-01f,
+	7.870559862e-01f, 7.884002317e-01f, 7.897415401e-01f, 7.910798950e-01f,
+	7.924152802e-01f, 7.937476795e-01f, 7.950770767e-01f, 7.964034557e-01f,
+	7.977268002e-01f, 7.990470942e-01f, 8.003643216e-01f, 8.016784664e-01f,
+	8.029895124e-01f, 8.042974437e-01f, 8.056022444e-01f, 8.069038985e-01f,
+	8.082023900e-01f, 8.094977031e-01f, 8.107898219e-01f, 8.120787306e-01f,
+	8.133644134e-01f, 8.146468545e-01f, 8.159260381e-01f, 8.172019487e-01f,
+	8.184745705e-01f, 8.197438878e-01f, 8.210098850e-01f, 8.222725466e-01f,
+	8.235318570e-01f, 8.247878007e-01f, 8.260403622e-01f, 8.272895261e-01f,
+	8.285352769e-01f, 8.297775992e-01f, 8.310164778e-01f, 8.322518972e-01f,
+	8.334838423e-01f, 8.347122977e-01f, 8.359372482e-01f, 8.371586787e-01f,
+	8.383765741e-01f, 8.395909191e-01f, 8.408016988e-01f, 8.420088982e-01f,
+	8.432125021e-01f, 8.444124957e-01f, 8.456088641e-01f, 8.468015923e-01f,
+	8.479906655e-01f, 8.491760689e-01f, 8.503577877e-01f, 8.515358072e-01f,
+	8.527101127e-01f, 8.538806895e-01f, 8.550475231e-01f, 8.562105988e-01f,
+	8.573699021e-01f, 8.585254185e-01f, 8.596771336e-01f, 8.608250329e-01f,
+	8.619691021e-01f, 8.631093268e-01f, 8.642456927e-01f, 8.653781856e-01f,
+	8.665067913e-01f, 8.676314955e-01f, 8.687522843e-01f, 8.698691434e-01f,
+	8.709820589e-01f, 8.720910168e-01f, 8.731960030e-01f, 8.742970038e-01f,
+	8.753940052e-01f, 8.764869934e-01f, 8.775759546e-01f, 8.786608751e-01f,
+	8.797417412e-01f, 8.808185393e-01f, 8.818912558e-01f, 8.829598771e-01f,
+	8.840243896e-01f, 8.850847801e-01f, 8.861410349e-01f, 8.871931409e-01f,
+	8.882410846e-01f, 8.892848527e-01f, 8.903244321e-01f, 8.913598096e-01f,
+	8.923909721e-01f, 8.934179064e-01f, 8.944405995e-01f, 8.954590384e-01f,
+	8.964732103e-01f, 8.974831022e-01f, 8.984887013e-01f, 8.994899947e-01f,
+	9.004869698e-01f, 9.014796139e-01f, 9.024679143e-01f, 9.034518584e-01f,
+	9.044314338e-01f, 9.054066278e-01f, 9.063774281e-01f, 9.073438223e-01f,
+	9.083057981e-01f, 9.092633431e-01f, 9.102164452e-01f, 9.111650921e-01f,
+	9.121092718e-01f, 9.130489722e-01f, 9.139841812e-01f, 9.149148869e-01f,
+	9.158410774e-01f, 9.167627408e-01f, 9.176798653e-01f, 9.185924392e-01f,
+	9.195004508e-01f, 9.204038883e-01f, 9.213027403e-01f, 9.221969952e-01f,
+	9.230866415e-01f, 9.239716678e-01f, 9.248520628e-01f, 9.257278150e-01f,
+	9.265989134e-01f, 9.274653466e-01f, 9.283271035e-01f, 9.291841731e-01f,
+	9.300365442e-01f, 9.308842060e-01f, 9.317271475e-01f, 9.325653579e-01f,
+	9.333988264e-01f, 9.342275421e-01f, 9.350514945e-01f, 9.358706729e-01f,
+	9.366850667e-01f, 9.374946655e-01f, 9.382994587e-01f, 9.390994360e-01f,
+	9.398945870e-01f, 9.406849016e-01f, 9.414703694e-01f, 9.422509802e-01f,
+	9.430267242e-01f, 9.437975910e-01f, 9.445635709e-01f, 9.453246539e-01f,
+	9.460808301e-01f, 9.468320897e-01f, 9.475784231e-01f, 9.483198204e-01f,
+	9.490562723e-01f, 9.497877690e-01f, 9.505143010e-01f, 9.512358591e-01f,
+	9.519524338e-01f, 9.526640158e-01f, 9.533705958e-01f, 9.540721648e-01f,
+	9.547687135e-01f, 9.554602330e-01f, 9.561467142e-01f, 9.568281482e-01f,
+	9.575045262e-01f, 9.581758394e-01f, 9.588420791e-01f, 9.595032365e-01f,
+	9.601593030e-01f, 9.608102702e-01f, 9.614561296e-01f, 9.620968727e-01f,
+	9.627324912e-01f, 9.633629768e-01f, 9.639883212e-01f, 9.646085165e-01f,
+	9.652235544e-01f, 9.658334269e-01f, 9.664381262e-01f, 9.670376442e-01f,
+	9.676319732e-01f, 9.682211054e-01f, 9.688050332e-01f, 9.693837488e-01f,
+	9.699572448e-01f, 9.705255137e-01f, 9.710885480e-01f, 9.716463403e-01f,
+	9.721988835e-01f, 9.727461701e-01f, 9.732881932e-01f, 9.738249456e-01f,
+	9.743564203e-01f, 9.748826104e-01f, 9.754035089e-01f, 9.759191090e-01f,
+	9.764294040e-01f, 9.769343873e-01f, 9.774340521e-01f, 9.779283920e-01f,
+	9.784174004e-01f, 9.789010711e-01f, 9.793793975e-01f, 9.798523735e-01f,
+	9.803199929e-01f, 9.807822495e-01f, 9.812391373e-01f, 9.816906503e-01f,
+	9.821367825e-01f, 9.825775281e-01f, 9.830128814e-01f, 9.834428365e-01f,
+	9.838673880e-01f, 9.842865301e-01f, 9.847002574e-01f, 9.851085645e-01f,
+	9.855114459e-01f, 9.859088965e-01f, 9.863009110e-01f, 9.866874842e-01f,
+	9.870686110e-01f, 9.874442865e-01f, 9.878145058e-01f, 9.881792638e-01f,
+	9.885385559e-01f, 9.888923774e-01f, 9.892407235e-01f, 9.895835897e-01f,
+	9.899209715e-01f, 9.902528644e-01f, 9.905792641e-01f, 9.909001663e-01f,
+	9.912155668e-01f, 9.915254613e-01f, 9.918298459e-01f, 9.921287166e-01f,
+	9.924220693e-01f, 9.927099002e-01f, 9.929922056e-01f, 9.932689817e-01f,
+	9.935402249e-01f, 9.938059316e-01f, 9.940660984e-01f, 9.943207216e-01f,
+	9.945697982e-01f, 9.948133246e-01f, 9.950512978e-01f, 9.952837146e-01f,
+	9.955105719e-01f, 9.957318668e-01f, 9.959475963e-01f, 9.961577576e-01f,
+	9.963623479e-01f, 9.965613646e-01f, 9.967548049e-01f, 9.969426664e-01f,
+	9.971249465e-01f, 9.973016429e-01f, 9.974727532e-01f, 9.976382753e-01f,
+	9.977982068e-01f, 9.979525457e-01f, 9.981012899e-01f, 9.982444375e-01f,
+	9.983819867e-01f, 9.985139355e-01f, 9.986402823e-01f, 9.987610253e-01f,
+	9.988761630e-01f, 9.989856939e-01f, 9.990896165e-01f, 9.991879295e-01f,
+	9.992806315e-01f, 9.993677213e-01f, 9.994491978e-01f, 9.995250600e-01f,
+	9.995953067e-01f, 9.996599371e-01f, 9.997189503e-01f, 9.997723455e-01f,
+	9.998201221e-01f, 9.998622794e-01f, 9.998988169e-01f, 9.999297340e-01f,
+	9.999550304e-01f, 9.999747057e-01f, 9.999887597e-01f, 9.999971922e-01f,
+	1.000000003e+00f,
+};
+
+static const q15_t win_flatTop_half_q15[WINDOW_HALF_LEN] = {
+	-14, -14, -14, -14, -14, -14, -14, -14,
+	-14, -14, -14, -14, -14, -14, -14, -14,
+	-14, -14, -14, -15, -15, -15, -15, -15,
+	-15, -15, -15, -15, -15, -15, -16, -16,
+	-16, -16, -16, -16, -16, -17, -17, -17,
+	-17, -17, -17, -17, -18, -18, -18, -18,
+	-18, -19, -19, -19, -19, -19, -20, -20,
+	-20, -20, -21, -21, -21, -21, -22, -22,
+	-22, -22, -23, -23, -23, -23, -24, -24,
+	-24, -25, -25, -25, -25, -26, -26, -26,
+	-27, -27, -27, -28, -28, -28, -29, -29,
+	-30, -30, -30, -31, -31, -31, -32, -32,
+	-33, -33, -33, -34, -34, -35, -35, -36,
+	-36, -37, -37, -37, -38, -38, -39, -39,
+	-40, -40, -41, -41, -42, -42, -43, -43,
+	-44, -44, -45, -45, -46, -47, -47, -48,
+	-48, -49, -49, -50, -50, -51, -52, -52,
+	-53, -53, -54, -55, -55, -56, -57, -57,
+	-58, -59, -59, -60, -61, -61, -62, -63,
+	-63, -64, -65, -65, -66, -67, -68, -68,
+	-69, -70, -71, -71, -72, -73, -74, -75,
+	-75, -76, -77, -78, -79, -79, -80, -81,
+	-82, -83, -84, -84, -85, -86, -87, -88,
+	-89, -90, -91, -92, -93, -94, -94, -95,
+	-96, -97, -98, -99, -100, -101, -102, -103,
+	-104, -105, -106, -107, -108, -109, -110, -111,
+	-113, -114, -115, -116, -117, -118, -119, -120,
+	-121, -122, -124, -125, -126, -127, -128, -129,
+	-131, -132, -133, -134, -135, -137, -138, -139,
+	-140, -142, -143, -144, -145, -147, -148, -149,
+	-151, -152, -153, -155, -156, -157, -159, -160,
+	-161, -163, -164, -165, -167, -168, -170, -171,
+	-173, -174, -176, -177, -178, -180, -181, -183,
+	-184, -186, -188, -189, -191, -192, -194, -195,
+	-197, -199, -200, -202, -203, -205, -207, -208,
+	-210, -212, -213, -215, -217, -218, -220, -222,
+	-224, -225, -227, -229, -231, -232, -234, -236,
+	-238, -240, -241, -243, -245, -247, -249, -251,
+	-253, -254, -256, -258, -260, -262, -264, -266,
+	-268, -270, -272, -274, -276, -278, -280, -282,
+	-284, -286, -288, -290, -292, -294, -297, -299,
+	-301, -303, -305, -307, -309, -312, -314, -316,
+	-318, -320, -323, -325, -327, -329, -332, -334,
+	-336, -339, -341, -343, -346, -348, -350, -353,
+	-355, -357, -360, -362, -365, -367, -370, -372,
+	-375, -377, -379, -382, -385, -387, -390, -392,
+	-395, -397, -400, -402, -405, -408, -410, -413,
+	-416, -418, -421, -424, -426, -429, -432, -434,
+	-437, -440, -443, -445, -448, -451, -454, -457,
+	-459, -462, -465, -468, -471, -474, -477, -480,
+	-482, -485, -488, -491, -494, -497, -500, -503,
+	-506, -509, -512, -515, -518, -521, -525, -528,
+	-531, -534, -537, -540, -543, -546, -550, -553,
+	-556, -559, -562, -566, -569, -572, -575, -579,
+	-582, -585, -589, -592, -595, -599, -602, -605,
+	-609, -612, -615, -619, -622, -626, -629, -633,
+	-636, -640, -643, -646, -650, -654, -657, -661,
+	-664, -668, -671, -675, -678, -682, -686, -689,
+	-693, -697, -700, -704, -708, -711, -715, -719,
+	-723, -726, -730, -734, -738, -741, -745, -749,
+	-753, -757, -760, -764, -768, -772, -776, -780,
+	-784, -788, -792, -796, -799, -803, -807, -811,
+	-815, -819, -823, -827, -831, -835, -840, -844,
+	-848, -852, -856, -860, -864, -868, -872, -876,
+	-881, -885, -889, -893, -897, -901, -906, -910,
+	-914, -918, -923, -927, -931, -935, -940, -944,
+	-948, -953, -957, -961, -966, -970, -974, -979,
+	-983, -987, -992, -996, -1000, -1005, -1009, -1014,
+	-1018, -1023, -1027, -1032, -1036, -1041, -1045, -1049,
+	-1054, -1058, -1063, -1068, -1072, -1077, -1081, -1086,
+	-1090, -1095, -1099, -1104, -1109, -1113, -1118, -1122,
+	-1127, -1132, -1136, -1141, -1146, -1150, -1155, -1160,
+	-1164, -1169, -1174, -1178, -1183, -1188, -1192, -1197,
+	-1202, -1207, -1211, -1216, -1221, -1225, -1230, -1235,
+	-1240, -1245, -1249, -1254, -1259, -1264, -1268, -1273,
+	-1278, -1283, -1288, -1292, -1297, -1302, -1307, -1312,
+	-1317, -1321, -1326, -1331, -1336, -1341, -1346, -1350,
+	-1355, -1360, -1365, -1370, -1375, -1380, -1384, -1389,
+	-1394, -1399, -1404, -1409, -1414, -1419, -1423, -1428,
+	-1433, -1438, -1443, -1448, -1453, -1458, -1463, -1467,
+	-1472, -1477, -1482, -1487, -1492, -1497, -1502, -1507,
+	-1511, -1516, -1521, -1526, -1531, -1536, -1541, -1546,
+	-1551, -1555, -1560, -1565, -1570, -1575, -1580, -1585,
+	-1590, -1594, -1599, -1604, -1609, -1614, -1619, -1624,
+	-1628, -1633, -1638, -1643, -1648, -1653, -1657, -1662,
+	-1667, -1672, -1677, -1681, -1686, -1691, -1696, -1701,
+	-1705, -1710, -1715, -1720, -1724, -1729, -1734, -1738,
+	-1743, -1748, -1753, -1757, -1762, -1767, -1771, -1776,
+	-1781, -1785, -1790, -1795, -1799, -1804, -1808, -1813,
+	-1818, -1822, -1827, -1831, -1836, -1840, -1845, -1849,
+	-1854, -1858, -1863, -1867, -1872, -1876, -1881, -1885,
+	-1890, -1894, -1898, -1903, -1907, -1911, -1916, -1920,
+	-1924, -1929, -1933, -1937, -1942, -1946, -1950, -1954,
+	-1958, -1963, -1967, -1971, -1975, -1979, -1983, -1987,
+	-1992, -1996, -2000, -2004, -2008, -2012, -2016, -2020,
+	-2024, -2027, -2031, -2035, -2039, -2043, -2047, -2051,
+	-2054, -2058, -2062, -2066, -2069, -2073, -2077, -2080,
+	-2084, -2088, -2091, -2095, -2098, -2102, -2106, -2109,
+	-2112, -2116, -2119, -2123, -2126, -2129, -2133, -2136,
+	-2139, -2143, -2146, -2149, -2152, -2155, -2159, -2162,
+	-2165, -2168, -2171, -2174, -2177, -2180, -2183, -2186,
+	-2189, -2191, -2194, -2197, -2200, -2203, -2205, -2208,
+	-2211, -2213, -2216, -2218, -2221, -2223, -2226, -2228,
+	-2231, -2233, -2235, -2238, -2240, -2242, -2245, -2247,
+	-2249, -2251, -2253, -2255, -2257, -2259, -2261, -2263,
+	-2265, -2267, -2269, -2271, -2272, -2274, -2276, -2277,
+	-2279, -2281, -2282, -2284, -2285, -2287, -2288, -2289,
+	-2291, -2292, -2293, -2295, -2296, -2297, -2298, -2299,
+	-2300, -2301, -2302, -2303, -2304, -2305, -2305, -2306,
+	-2307, -2307, -2308, -2309, -2309, -2310, -2310, -2310,
+	-2311, -2311, -2311, -2312, -2312, -2312, -2312, -2312,
+	-2312, -2312, -2312, -2312, -2312, -2312, -2311, -2311,
+	-2311, -2310, -2310, -2309, -2309, -2308, -2307, -2307,
+	-2306, -2305, -2304, -2303, -2303, -2302, -2301, -2299,
+	-2298, -2297, -2296, -2295, -2293, -2292, -2290, -2289,
+	-2287, -2286, -2284, -2282, -2281, -2279, -2277, -2275,
+	-2273, -2271, -2269, -2267, -2265, -2262, -2260, -2258,
+	-2255, -2253, -2250, -2248, -2245, -2242, -2239, -2237,
+	-2234, -2231, -2228, -2225, -2222, -2218, -2215, -2212,
+	-2209, -2205, -2202, -2198, -2195, -2191, -2187, -2183,
+	-2180, -2176, -2172, -2168, -2164, -2159, -2155, -2151,
+	-2146, -2142, -2138, -2133, -2128, -2124, -2119, -2114,
+	-2109, -2104, -2099, -2094, -2089, -2084, -2079, -2073,
+	-2068, -2063, -2057, -2051, -2046, -2040, -2034, -2028,
+	-2022, -2016, -2010, -2004, -1998, -1991, -1985, -1979,
+	-1972, -1966, -1959, -1952, -1945, -1938, -1931, -1924,
+	-1917, -1910, -1903, -1896, -1888, -1881, -1873, -1866,
+	-1858, -1850, -1842, -1834, -1826, -1818, -1810, -1802,
+	-1794, -1785, -1777, -1768, -1760, -1751, -1742, -1733,
+	-1724, -1715, -1706, -1697, -1688, -1679, -1669, -1660,
+	-1650, -1641, -1631, -1621, -1611, -1601, -1591, -1581,
+	-1571, -1561, -1550, -1540, -1529, -1519, -1508, -1497,
+	-1486, -1475, -1464, -1453, -1442, -1431, -1419, -1408,
+	-1396, -1385, -1373, -1361, -1349, -1337, -1325, -1313,
+	-1301, -1289, -1276, -1264, -1251, -1238, -1226, -1213,
+	-1200, -1187, -1174, -1161, -1147, -1134, -1120, -1107,
+	-1093, -1080, -1066, -1052, -1038, -1024, -1010, -995,
+	-981, -966, -952, -937, -923, -908, -893, -878,
+	-863, -848, -832, -817, -801, -786, -770, -754,
+	-739, -723, -707, -691, -674, -658, -642, -625,
+	-609, -592, -575, -558, -541, -524, -507, -490,
+	-472, -455, -437, -420, -402, -384, -366, -348,
+	-330, -312, -294, -275, -257, -238, -219, -201,
+	-182, -163, -144, -124, -105, -86, -66, -47,
+	-27, -7, 13, 33, 53, 73, 93, 114,
+	134, 155, 176, 196, 217, 238, 259, 280,
+	302, 323, 345, 366, 388, 410, 432, 454,
+	476, 498, 520, 542, 565, 588, 610, 633,
+	656, 679, 702, 725, 749, 772, 796, 819,
+	843, 867, 891, 915, 939, 963, 987, 1012,
+	1036, 1061, 1086, 1111, 1136, 1161, 1186, 1211,
+	1236, 1262, 1287, 1313, 1339, 1365, 1391, 1417,
+	1443, 1469, 1496, 1522, 1549, 1575, 1602, 1629,
+	1656, 1683, 1711, 1738, 1765, 1793, 1820, 1848,
+	1876, 1904, 1932, 1960, 1988, 2017, 2045, 2074,
+	2103, 2131, 2160, 2189, 2218, 2247, 2277, 2306,
+	2336, 2365, 2395, 2425, 2455, 2485, 2515, 2545,
+	2575, 2606, 2636, 2667, 2698, 2729, 2759, 2791,
+	2822, 2853, 2884, 2916, 2947, 2979, 3011, 3043,
+	3075, 3107, 3139, 3171, 3203, 3236, 3269, 3301,
+	3334, 3367, 3400, 3433, 3466, 3499, 3533, 3566,
+	3600, 3634, 3667, 3701, 3735, 3769, 3804, 3838,
+	3872, 3907, 3941, 3976, 4011, 4046, 4081, 4116,
+	4151, 4187, 4222, 4257, 4293, 4329, 4365, 4400,
+	4436, 4473, 4509, 4545, 4581, 4618, 4654, 4691,
+	4728, 4765, 4802, 4839, 4876, 4913, 4951, 4988,
+	5026, 5063, 5101, 5139, 5177, 5215, 5253, 5291,
+	5330, 5368, 5406, 5445, 5484, 5523, 5561, 5600,
+	5639, 5679, 5718, 5757, 5797, 5836, 5876, 5916,
+	5955, 5995, 6035, 6075, 6116, 6156, 6196, 6237,
+	6277, 6318, 6359, 6399, 6440, 6481, 6522, 6564,
+	6605, 6646, 6688, 6729, 6771, 6812, 6854, 6896,
+	6938, 6980, 7022, 7064, 7107, 7149, 7192, 7234,
+	7277, 7320, 7362, 7405, 7448, 7491, 7534, 7578,
+	7621, 7664, 7708, 7751, 7795, 7839, 7883, 7926,
+	7970, 8014, 8059, 8103, 8147, 8191, 8236, 8280,
+	8325, 8370, 8414, 8459, 8504, 8549, 8594, 8639,
+	8685, 8730, 8775, 8821, 8866, 8912, 8957, 9003,
+	9049, 9095, 9141, 9187, 9233, 9279, 9325, 9372,
+	9418, 9464, 9511, 9557, 9604, 9651, 9698, 9745,
+	9791, 9838, 9886, 9933, 9980, 10027, 10074, 10122,
+	10169, 10217, 10264, 10312, 10360, 10408, 10455, 10503,
+	10551, 10599, 10647, 10696, 10744, 10792, 10840, 10889,
+	10937, 10986, 11034, 11083, 11132, 11180, 11229, 11278,
+	11327, 11376, 11425, 11474, 11523, 11572, 11621, 11671,
+	11720, 11769, 11819, 11868, 11918, 11967, 12017, 12067,
+	12117, 12166, 12216, 12266, 12316, 12366, 12416, 12466,
+	12516, 12566, 12617, 12667, 12717, 12767, 12818, 12868,
+	12919, 12969, 13020, 13070, 13121, 13172, 13222, 13273,
+	13324, 13375, 13426, 13477, 13528, 13579, 13630, 13681,
+	13732, 13783, 13834, 13885, 13936, 13988, 14039, 14090,
+	14142, 14193, 14244, 14296, 14347, 14399, 14450, 14502,
+	14553, 14605, 14657, 14708, 14760, 14812, 14863, 14915,
+	14967, 15019, 15071, 15122, 15174, 15226, 15278, 15330,
+	15382, 15434, 15486, 15538, 15590, 15642, 15694, 15746,
+	15798, 15850, 15903, 15955, 16007, 16059, 16111, 16163,
+	16215, 16268, 16320, 16372, 16424, 16477, 16529, 16581,
+	16633, 16686, 16738, 16790, 16842, 16895, 16947, 16999,
+	17052, 17104, 17156, 17209, 17261, 17313, 17366, 17418,
+	17470, 17522, 17575, 17627, 17679, 17732, 17784, 17836,
+	17888, 17941, 17993, 18045, 18098, 18150, 18202, 18254,
+	18306, 18359, 18411, 18463, 18515, 18567, 18619, 18672,
+	18724, 18776, 18828, 18880, 18932, 18984, 19036, 19088,
+	19140, 19192, 19244, 19296, 19348, 19400, 19451, 19503,
+	19555, 19607, 19659, 19710, 19762, 19814, 19865, 19917,
+	19969, 20020, 20072, 20123, 20175, 20226, 20278, 20329,
+	20380, 20432, 20483, 20534, 20585, 20637, 20688, 20739,
+	20790, 20841, 20892, 20943, 20994, 21045, 21095, 21146,
+	21197, 21248, 21298, 21349, 21400, 21450, 21501, 21551,
+	21602, 21652, 21702, 21752, 21803, 21853, 21903, 21953,
+	22003, 22053, 22103, 22153, 22203, 22252, 22302, 22352,
+	22401, 22451, 22500, 22550, 22599, 22648, 22698, 22747,
+	22796, 22845, 22894, 22943, 22992, 23041, 23089, 23138,
+	23187, 23235, 23284, 23332, 23381, 23429, 23477, 23525,
+	23573, 23621, 23669, 23717, 23765, 23813, 23860, 23908,
+	23956, 24003, 24050, 24098, 24145, 24192, 24239, 24286,
+	24333, 24380, 24427, 24473, 24520, 24567, 24613, 24659,
+	24706, 24752, 24798, 24844, 24890, 24936, 24982, 25027,
+	25073, 25118, 25164, 25209, 25254, 25300, 25345, 25390,
+	25434, 25479, 25524, 25569, 25613, 25658, 25702, 25746,
+	25790, 25834, 25878, 25922, 25966, 26010, 26053, 26097,
+	26140, 26183, 26226, 26269, 26312, 26355, 26398, 26441,
+	26483, 26526, 26568, 26610, 26652, 26694, 26736, 26778,
+	26820, 26861, 26903, 26944, 26985, 27027, 27068, 27109,
+	27149, 27190, 27231, 27271, 27312, 27352, 27392, 27432,
+	27472, 27512, 27551, 27591, 27630, 27670, 27709, 27748,
+	27787, 27826, 27865, 27903, 27942, 27980, 28018, 28056,
+	28094, 28132, 28170, 28208, 28245, 28282, 28320, 28357,
+	28394, 28431, 28467, 28504, 28540, 28577, 28613, 28649,
+	28685, 28721, 28756, 28792, 28827, 28863, 28898, 28933,
+	28968, 29002, 29037, 29072, 29106, 29140, 29174, 29208,
+	29242, 29276, 29309, 29342, 29376, 29409, 29442, 29474,
+	29507, 29540, 29572, 29604, 29636, 29668, 29700, 29732,
+	29763, 29795, 29826, 29857, 29888, 29919, 29949, 29980,
+	30010, 30040, 30071, 30100, 30130, 30160, 30189, 30219,
+	30248, 30277, 30306, 30334, 30363, 30391, 30419, 30448,
+	30475, 30503, 30531, 30558, 30586, 30613, 30640, 30667,
+	30693, 30720, 30746, 30772, 30798, 30824, 30850, 30876,
+	30901, 30926, 30951, 30976, 31001, 31026, 31050, 31075,
+	31099, 31123, 31146, 31170, 31194, 31217, 31240, 31263,
+	31286, 31309, 31331, 31353, 31376, 31398, 31419, 31441,
+	31463, 31484, 31505, 31526, 31547, 31567, 31588, 31608,
+	31628, 31648, 31668, 31688, 31707, 31727, 31746, 31765,
+	31784, 31802, 31821, 31839, 31857, 31875, 31893, 31910,
+	31928, 31945, 31962, 31979, 31996, 32012, 32029, 32045,
+	32061, 32077, 32092, 32108, 32123, 32138, 32153, 32168,
+	32183, 32197, 32211, 32225, 32239, 32253, 32267, 32280,
+	32293, 32306, 32319, 32332, 32344, 32357, 32369, 32381,
+	32392, 32404, 32415, 32427, 32438, 32449, 32459, 32470,
+	32480, 32490, 32500, 32510, 32520, 32529, 32538, 32547,
+	32556, 32565, 32574, 32582, 32590, 32598, 32606, 32613,
+	32621, 32628, 32635, 32642, 32649, 32655, 32662, 32668,
+	32674, 32680, 32685, 32691, 32696, 32701, 32706, 32710,
+	32715, 32719, 32723, 32727, 32731, 32735, 32738, 32741,
+	32744, 32747, 32750, 32752, 32755, 32757, 32759, 32761,
+	32762, 32763, 32765, 32766, 32767, 32767, 32767, 32767,
+	32767,
+};
+
+static const float32_t win_flatTop_bias[WINDOW_BIAS_LEN] = {
+	0.000000000e+00f, 5.342044608e-04f, 1.068512211e-03f, 1.603026520e-03f,
+	2.137850623e-03f, 2.673087697e-03f, 3.208840848e-03f, 3.745213087e-03f,
+	4.282307316e-03f, 4.820226307e-03f, 5.359072687e-03f, 5.898948915e-03f,
+	6.439957268e-03f, 6.982199820e-03f, 7.525778426e-03f, 8.070794703e-03f,
+	8.617350014e-03f, 9.165545444e-03f, 9.715481792e-03f, 1.026725955e-02f,
+	1.082097887e-02f, 1.137673957e-02f, 1.193464112e-02f, 1.249478259e-02f,
+	1.305726266e-02f, 1.362217961e-02f, 1.418963128e-02f, 1.475971507e-02f,
+	1.533252792e-02f, 1.590816627e-02f, 1.648672610e-02f, 1.706830286e-02f,
+	1.765299148e-02f, 1.824088633e-02f, 1.883208126e-02f, 1.942666952e-02f,
+	2.002474378e-02f, 2.062639610e-02f, 2.123171794e-02f, 2.184080012e-02f,
+	2.245373280e-02f, 2.307060550e-02f, 2.369150707e-02f, 2.431652565e-02f,
+	2.494574870e-02f, 2.557926296e-02f, 2.621715445e-02f, 2.685950843e-02f,
+	2.750640942e-02f, 2.815794119e-02f, 2.881418672e-02f, 2.947522820e-02f,
+	3.014114702e-02f, 3.081202378e-02f, 3.148793824e-02f, 3.216896932e-02f,
+	3.285519512e-02f, 3.354669287e-02f, 3.424353894e-02f, 3.494580884e-02f,
+	3.565357719e-02f, 3.636691771e-02f, 3.708590323e-02f, 3.781060567e-02f,
+	3.854109604e-02f,
+};
+
+const window_table_t window_tables[WINDOW_TYPE_NUM] = {
+	{ win_hanning_half, win_hanning_half_q15, 5.000000000e-01f, 1.500000000e+00f, 2.000000000e+00f, { 5.000000000e-01f, 5.000000000e-01f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f }, 2, win_hanning_bias },		// HANNING
+	{ win_hamming_half, win_hamming_half_q15, 5.400000000e-01f, 1.362825789e+00f, 2.000000000e+00f, { 5.400000000e-01f, 4.600000000e-01f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f }, 2, win_hamming_bias },		// HAMMING
+	{ win_blackman_half, win_blackman_half_q15, 4.232300000e-01f, 1.708538027e+00f, 3.000000000e+00f, { 4.232300000e-01f, 4.975500000e-01f, 7.922000000e-02f, 0.000000000e+00f, 0.000000000e+00f }, 3, win_blackman_bias },		// BLACKMAN
+	{ win_blackmanHarris_half, win_blackmanHarris_half_q15, 3.587500000e-01f, 2.004352938e+00f, 4.000000000e+00f, { 3.587500000e-01f, 4.882900000e-01f, 1.412800000e-01f, 1.168000000e-02f, 0.000000000e+00f }, 4, win_blackmanHarris_bias },		// BLACKMAN_HARRIS
+	{ win_kaiser_half, win_kaiser_half_q15, 4.208001265e-01f, 1.721374235e+00f, 2.914397835e+00f, { 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f, 0.000000000e+00f }, 0, win_kaiser_bias },		// KAISER
+	{ win_flatTop_half, win_flatTop_half_q15, 2.155789500e-01f, 3.770246447e+00f, 5.000000000e+00f, { 2.155789500e-01f, 4.166315800e-01f, 2.772631580e-01f, 8.357894700e-02f, 6.947368000e-03f }, 5, win_flatTop_bias },		// FLAT_TOP
+};
+
+/**
+ * @brief       获取窗函数描述
+ * @param       window_type: 窗函数类型
+ * @retval      窗函数描述，类型无效时返回 NULL
+ */
+const window_table_t *window_get(uint8_t window_type)
+{
+	if(window_type < 1 || window_type > WINDOW_TYPE_NUM)
+		return NULL;
+
+	return &window_tables[window_type - 1];
+}
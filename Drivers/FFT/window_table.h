@@ -0,0 +1,52 @@
+#ifndef _WINDOW_TABLE_H
+#define _WINDOW_TABLE_H
+
+#include "main.h"
+#include "arm_math.h"
+
+#define WINDOW_TABLE_LEN    4096						// 窗表长度，需与 gen_window_table.py 生成时一致
+#define WINDOW_HALF_LEN     (WINDOW_TABLE_LEN / 2 + 1)	// 半窗点数
+#define WINDOW_COEF_MAX     5							// 余弦和窗系数个数上限，需与 gen_window_table.py 一致
+#define WINDOW_BIAS_LEN     65							// 插值DFT偏差表点数，需与 gen_window_table.py 一致
+
+enum{
+    HANNING = 1,            // 汉宁窗
+    HAMMING = 2,            // 汉明窗
+    BLACKMAN = 3,           // 布莱克曼窗
+    BLACKMAN_HARRIS = 4,    // 布莱克曼-哈里斯窗
+    KAISER = 5,             // 凯泽窗（beta = 8.6）
+    FLAT_TOP = 6            // 平顶窗
+};
+#define WINDOW_TYPE_NUM     6
+
+// 窗函数描述，表与参数均由 gen_window_table.py 离线生成并存放于 Flash
+typedef struct{
+	const float32_t *half;	// 半窗 w[0] ~ w[N/2]，DFT-even 形式，w[n] = w[N-n]
+	const q15_t *half_q15;	// 同一半窗的 q15 定点形式，定点流水线使用
+	float32_t cg;			// 相干增益 sum(w) / N
+	float32_t enbw;			// 等效噪声带宽，单位 bin
+	float32_t mainlobe;		// 主瓣半宽（到第一零点），单位 bin
+	float32_t a[WINDOW_COEF_MAX];	// 余弦和窗系数，w[n] = a0 - a1*cos(2*pi*n/N) + a2*cos(4*pi*n/N) - ...
+	uint8_t ncoef;			// 系数个数，非余弦和窗（凯泽窗）为 0，此时频谱核无闭式
+	const float32_t *bias;	// 插值DFT偏差表：偏移 0.5*i/(WINDOW_BIAS_LEN-1) bin 时 Jacobsen 式比值的取值，单调递增
+} window_table_t;
+
+extern const window_table_t window_tables[WINDOW_TYPE_NUM];
+
+const window_table_t *window_get(uint8_t window_type);
+
+/**
+ * @brief       取长度为 n 的窗的第 i 个点
+ * @note		n 须为 2 的幂且不大于 WINDOW_TABLE_LEN，按步长从半窗表中抽取
+ * @param       win: 窗函数描述
+ * @param		i:   下标，0 ~ n-1
+ * @param		n:   窗长度
+ * @retval      窗函数值
+ */
+static inline float32_t window_at(const window_table_t *win, uint32_t i, uint32_t n)
+{
+	uint32_t step = WINDOW_TABLE_LEN / n;
+	return (i <= n / 2) ? win->half[i * step] : win->half[(n - i) * step];
+}
+
+#endif
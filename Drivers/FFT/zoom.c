@@ -0,0 +1,279 @@
+#include "FFT.h"
+#include "zoom.h"
+#include "peak.h"
+
+#if (ZOOM_CHUNK % ZOOM_DECIM) != 0
+#error "ZOOM_CHUNK 须为 ZOOM_DECIM 的整数倍"
+#endif
+#if (ZOOM_LEN % (ZOOM_CHUNK / ZOOM_DECIM)) != 0
+#error "ZOOM_LEN 须为每块抽取输出点数的整数倍"
+#endif
+#if (2 * ZOOM_LEN < FFT_PLAN_MIN_SIZE) || (2 * ZOOM_LEN > FFT_PLAN_MAX_SIZE)
+#error "ZOOM_LEN 的复数FFT须由 FFT 计划中 2*ZOOM_LEN 点实数FFT的内部实例提供"
+#endif
+
+#define ZOOM_SETTLE         ((ZOOM_TAPS1 + ZOOM_TAPS2 * ZOOM_DECIM1 + ZOOM_DECIM - 1) / ZOOM_DECIM)	// 滤波器填满前的输出点数，丢弃
+
+static float32_t zoom_h1[ZOOM_TAPS1];			// 第一级滤波器系数，zoom_init 后只读，各实例共用
+static float32_t zoom_h2[ZOOM_TAPS2];			// 第二级滤波器系数
+
+
+/**
+ * @brief       设计窗函数法低通滤波器
+ * @note		布莱克曼窗加权的 sinc，截止频率取本级输出的奈奎斯特频率 1/(2*D)，直流增益归一为 1；
+ *				可用带宽 ZOOM_PASS 与过渡带关于截止频率对称，阶数按过渡带宽度选定
+ * @param       h:		系数输出
+ * @param		taps:	阶数
+ * @param		D:		本级抽取倍数
+ * @retval      无
+ */
+static void zoom_design(float32_t *h, uint32_t taps, uint32_t D)
+{
+	uint32_t i;
+	float32_t fc = 0.5f / (float32_t)D;
+	float32_t m = 0.5f * (float32_t)(taps - 1);
+	float32_t sum = 0.0f;
+
+	for(i = 0; i < taps; ++i)
+	{
+		float32_t t = (float32_t)i - m;
+		float32_t a = 2.0f * PI * (float32_t)i / (float32_t)(taps - 1);
+		float32_t w = 0.42f - 0.5f * cosf(a) + 0.08f * cosf(2.0f * a);
+		float32_t s = (fabsf(t) < 1e-6f) ? 2.0f * fc : sinf(2.0f * PI * fc * t) / (PI * t);
+		h[i] = s * w;
+		sum += h[i];
+	}
+	for(i = 0; i < taps; ++i)
+		h[i] /= sum;
+}
+
+/**
+ * @brief       设计抗混叠滤波器，上电后调用一次
+ * @note		系数由全部 Zoom-FFT 实例共用，之后只读
+ * @param       无
+ * @retval      无
+ */
+void zoom_init(void)
+{
+	zoom_design(zoom_h1, ZOOM_TAPS1, ZOOM_DECIM1);
+	zoom_design(zoom_h2, ZOOM_TAPS2, ZOOM_DECIM2);
+}
+
+/**
+ * @brief       停止全部细化
+ * @note		采集流不连续时调用，下次 zoom_center 重新对准并从头累积
+ * @param       zm:	Zoom-FFT 实例
+ * @retval      无
+ */
+void zoom_reset(zoom_t *zm)
+{
+	uint32_t s;
+
+	for(s = 0; s < ZOOM_SLOTS; ++s)
+	{
+		zm->slot[s].active = 0;
+		zm->slot[s].npk = 0;
+	}
+}
+
+/**
+ * @brief       设置输入采样率并停止全部细化
+ * @note		新实例使用前须调用一次；采样率改变后已累积的样本与本振均失效
+ * @param       zm:	Zoom-FFT 实例
+ * @param		fs:	采样率，单位 Hz
+ * @retval      无
+ */
+void zoom_set_rate(zoom_t *zm, float32_t fs)
+{
+	zm->fs = fs;
+	zoom_reset(zm);
+}
+
+/**
+ * @brief       对准细化中心
+ * @note		中心偏离不超过 ZOOM_RECENTER(fs) 时保持原状态继续累积；否则清空滤波器与累积的样本，
+ *				上一次的局部谱结果一并作废
+ * @param       zm:		Zoom-FFT 实例
+ * @param		slot:	细化槽，0 ~ ZOOM_SLOTS-1
+ * @param		fc:		中心频率，单位 Hz；不大于 0 时停用该槽
+ * @retval      无
+ */
+void zoom_center(zoom_t *zm, uint32_t slot, float32_t fc)
+{
+	zoom_slot_t *z;
+	uint32_t c;
+	float32_t w;
+
+	if(slot >= ZOOM_SLOTS)
+		return;
+	z = &zm->slot[slot];
+	if(fc <= 0.0f)
+	{
+		z->active = 0;
+		z->npk = 0;
+		return;
+	}
+	if(z->active && fabsf(fc - z->fc) <= ZOOM_RECENTER(zm->fs))
+		return;
+
+	w = 2.0f * PI * fc / zm->fs;
+	z->fc = fc;
+	z->rot_re = cosf(w);
+	z->rot_im = -sinf(w);
+	z->osc_re = 1.0f;
+	z->osc_im = 0.0f;
+	for(c = 0; c < 2; ++c)
+	{
+		arm_fir_decimate_init_f32(&z->d1[c], ZOOM_TAPS1, ZOOM_DECIM1, zoom_h1, z->st1[c], ZOOM_CHUNK);
+		arm_fir_decimate_init_f32(&z->d2[c], ZOOM_TAPS2, ZOOM_DECIM2, zoom_h2, z->st2[c], ZOOM_OUT1);
+	}
+	z->cnt = 0;
+	z->skip = ZOOM_SETTLE;
+	z->npk = 0;
+	z->active = 1;
+}
+
+/**
+ * @brief       由累积满的复样本计算局部谱并找峰
+ * @note		加窗后做 ZOOM_LEN 点复数FFT（原地），幅值平方按零频居中重排，只在 ±ZOOM_PASS/2 的可用带宽内找峰，
+ *				弱于最强峰 ZOOM_PEAK_REL 的峰舍去；分数bin由幅值的抛物线插值得到；幅度按混频减半、窗相干增益折算
+ * @param       zm:	Zoom-FFT 实例
+ * @param		z:	细化槽
+ * @retval      无
+ */
+static void zoom_spectrum(zoom_t *zm, zoom_slot_t *z)
+{
+	float32_t *pw = zm->p;
+	const window_table_t *win = window_get(ZOOM_WINDOW);
+	const fft_plan_t *p = fft_plan_get(2 * ZOOM_LEN);
+	uint32_t i, cnt;
+	uint32_t lo = (uint32_t)((0.5f - 0.5f * ZOOM_PASS) * ZOOM_LEN);
+	uint32_t hi = ZOOM_LEN - lo;
+	uint32_t sep = (uint32_t)ceilf(win->mainlobe);
+	float32_t df = ZOOM_RESOLUTION(zm->fs);
+	float32_t scale = 2.0f / ((float32_t)ZOOM_LEN * win->cg);
+	float32_t thresh;
+	peak_t pk[ZOOM_MAX_PEAKS];
+
+	for(i = 0; i < ZOOM_LEN; ++i)
+	{
+		float32_t w = window_at(win, i, ZOOM_LEN);
+		z->buf[2 * i] *= w;
+		z->buf[2 * i + 1] *= w;
+	}
+	arm_cfft_f32(&p->rfft.Sint, z->buf, 0, 1);
+	arm_cmplx_mag_squared_f32(z->buf, &pw[ZOOM_LEN / 2], ZOOM_LEN / 2);
+	arm_cmplx_mag_squared_f32(&z->buf[ZOOM_LEN], pw, ZOOM_LEN / 2);
+
+	thresh = peak_noise_floor(&pw[lo], hi - lo, zm->floor) * PEAK_SNR_RATIO;
+	cnt = peak_find(&pw[lo], hi - lo, thresh, sep, pk, ZOOM_MAX_PEAKS);
+	while(cnt > 1 && pk[cnt - 1].p < pk[0].p * ZOOM_PEAK_REL)
+		cnt--;				// 汉宁窗旁瓣只有 -31 dB，远弱于最强峰的局部极大值视为旁瓣
+	for(i = 0; i < cnt; ++i)
+	{
+		uint32_t k = lo + pk[i].k;
+		float32_t l, c, r, d;
+
+		arm_sqrt_f32(pw[k - 1], &l);
+		arm_sqrt_f32(pw[k], &c);
+		arm_sqrt_f32(pw[k + 1], &r);
+		d = interp_parabolic(l, c, r);
+		z->pk_f[i] = z->fc + ((float32_t)k - (float32_t)(ZOOM_LEN / 2) + d) * df;
+		z->pk_A[i] = c * scale;
+	}
+	z->npk = cnt;
+}
+
+/**
+ * @brief       送入一段连续采集的样本
+ * @note		各活动槽按 ZOOM_CHUNK 分块：码值转电压后与本振相乘得到 I/Q 两路，
+ *				再经两级抽取；本振由复数旋转递推，每块归一化一次抑制幅度漂移。
+ *				送入的样本须与上一次首尾相接，否则先调用 zoom_reset
+ * @param       zm:		Zoom-FFT 实例
+ * @param		x:		ADC 码值
+ * @param		n:		样本数，须为 ZOOM_CHUNK 的整数倍
+ * @param		lsb:	每个码值对应的电压
+ * @param		bias:	直流电平，单位 V，混频前扣除
+ * @retval      1：有槽得到了新的局部谱；0：无
+ */
+uint8_t zoom_feed(zoom_t *zm, const uint16_t *x, uint32_t n, float32_t lsb, float32_t bias)
+{
+	uint32_t s, pos, i, c;
+	uint8_t ready = 0;
+
+	for(s = 0; s < ZOOM_SLOTS; ++s)
+	{
+		zoom_slot_t *z = &zm->slot[s];
+		if(!z->active)
+			continue;
+
+		for(pos = 0; pos + ZOOM_CHUNK <= n; pos += ZOOM_CHUNK)
+		{
+			float32_t ore = z->osc_re, oim = z->osc_im, g;
+
+			for(i = 0; i < ZOOM_CHUNK; ++i)
+			{
+				float32_t v = (float32_t)x[pos + i] * lsb - bias;
+				float32_t t = ore * z->rot_re - oim * z->rot_im;
+
+				zm->mix[0][i] = v * ore;
+				zm->mix[1][i] = v * oim;
+				oim = ore * z->rot_im + oim * z->rot_re;
+				ore = t;
+			}
+			arm_sqrt_f32(ore * ore + oim * oim, &g);
+			z->osc_re = ore / g;
+			z->osc_im = oim / g;
+
+			for(c = 0; c < 2; ++c)
+			{
+				arm_fir_decimate_f32(&z->d1[c], zm->mix[c], zm->mid[c], ZOOM_CHUNK);
+				arm_fir_decimate_f32(&z->d2[c], zm->mid[c], zm->out[c], ZOOM_OUT1);
+			}
+
+			for(i = 0; i < ZOOM_OUT2; ++i)
+			{
+				if(z->skip > 0)
+				{
+					z->skip--;
+					continue;
+				}
+				z->buf[2 * z->cnt] = zm->out[0][i];
+				z->buf[2 * z->cnt + 1] = zm->out[1][i];
+				if(++z->cnt == ZOOM_LEN)
+				{
+					zoom_spectrum(zm, z);
+					z->cnt = 0;
+					ready = 1;
+				}
+			}
+		}
+	}
+	return ready;
+}
+
+/**
+ * @brief       取最近一次局部谱的峰值
+ * @note		结果保持到下一次局部谱算出或重新对准为止
+ * @param       zm:		Zoom-FFT 实例
+ * @param		slot:	细化槽
+ * @param		f:		峰值频率输出，单位 Hz，至少 ZOOM_MAX_PEAKS 个，按幅度降序
+ * @param		A:		峰值幅度输出，单位 V，可为 NULL
+ * @retval      峰值个数，尚无结果时为 0
+ */
+uint32_t zoom_get(const zoom_t *zm, uint32_t slot, float32_t *f, float32_t *A)
+{
+	uint32_t i;
+	const zoom_slot_t *z;
+
+	if(slot >= ZOOM_SLOTS)
+		return 0;
+	z = &zm->slot[slot];
+	for(i = 0; i < z->npk; ++i)
+	{
+		f[i] = z->pk_f[i];
+		if(A != NULL)
+			A[i] = z->pk_A[i];
+	}
+	return z->npk;
+}
@@ -0,0 +1,75 @@
+#ifndef _ZOOM_H
+#define _ZOOM_H
+
+#include "main.h"
+#include "arm_math.h"
+#include "window_table.h"
+#include "fft_plan.h"
+#include "peak.h"
+
+/*
+ * Zoom-FFT 局部细化
+ * 粗谱分辨率为 fs / FFT_SIZE，两音相距小于主瓣时只剩一个峰。
+ * 这里把每个粗峰复混频到基带，经两级 arm_fir_decimate_f32 抽取 ZOOM_DECIM 倍后
+ * 累积 ZOOM_LEN 个复样本做一次小点数 arm_cfft_f32，观测时长为 ZOOM_DECIM*ZOOM_LEN 个输入样本，
+ * 分辨率与同样长度的全带FFT相同，内存与运算量只是其一小部分。
+ * 采集帧须首尾相接，观测跨越多帧，每 ZOOM_FRAMES 帧得到一次局部谱。
+ * 采样率 fs 由 zoom_set_rate 设置；FFT_SIZE 取自 FFT.h，使用 ZOOM_FRAMES 前须先包含 FFT.h
+ */
+
+#define ZOOM_SLOTS          2                   // 同时细化的粗峰个数
+#define ZOOM_DECIM1         8                   // 第一级抽取倍数
+#define ZOOM_DECIM2         4                   // 第二级抽取倍数
+#define ZOOM_DECIM          (ZOOM_DECIM1 * ZOOM_DECIM2)
+#define ZOOM_TAPS1          64                  // 第一级抗混叠滤波器阶数
+#define ZOOM_TAPS2          112                 // 第二级抗混叠滤波器阶数
+#define ZOOM_LEN            512                 // 局部谱点数（复数FFT长度）
+#define ZOOM_CHUNK          256                 // 每次混频/抽取的输入样本数，须为 ZOOM_DECIM 的整数倍
+#define ZOOM_PASS           0.4f                // 可用带宽占抽取后采样率的比例（双边），带边留给过渡带
+#define ZOOM_WINDOW         HANNING             // 局部谱所用窗，主瓣窄以分辨近距双音
+#define ZOOM_MAX_PEAKS      2                   // 每个粗峰附近保留的峰值个数
+#define ZOOM_PEAK_REL       0.01f               // 次峰相对最强峰的功率比下限（-20 dB）
+#define ZOOM_RECENTER(fs)   ((fs) / (ZOOM_DECIM * 8))		// 粗峰偏离中心超过该值（Hz）时重新对准
+
+#define ZOOM_FRAMES         (ZOOM_DECIM * ZOOM_LEN / FFT_SIZE)	// 每得到一次局部谱所需的帧数
+#define ZOOM_RESOLUTION(fs) ((fs) / (ZOOM_DECIM * ZOOM_LEN))	// 局部谱bin间隔，单位 Hz
+#define ZOOM_OUT1           (ZOOM_CHUNK / ZOOM_DECIM1)		// 每块第一级输出点数
+#define ZOOM_OUT2           (ZOOM_CHUNK / ZOOM_DECIM)		// 每块第二级输出点数
+
+// 每个粗峰的细化状态，I/Q 两路各自一组两级抽取器
+typedef struct{
+	uint8_t active;
+	float32_t fc;								// 混频中心频率，单位 Hz
+	float32_t rot_re, rot_im;					// 每样本相位旋转 e^(-j*2*pi*fc/fs)
+	float32_t osc_re, osc_im;					// 当前本振
+	arm_fir_decimate_instance_f32 d1[2];		// 第一级抽取器，[0] 为 I 路，[1] 为 Q 路
+	arm_fir_decimate_instance_f32 d2[2];		// 第二级抽取器
+	float32_t st1[2][ZOOM_TAPS1 + ZOOM_CHUNK - 1];
+	float32_t st2[2][ZOOM_TAPS2 + ZOOM_OUT1 - 1];
+	float32_t buf[2 * ZOOM_LEN];				// 抽取后的复样本，实虚交错
+	uint32_t cnt;								// buf 中已有的复样本数
+	uint32_t skip;								// 尚需丢弃的输出点数
+	uint32_t npk;								// 最近一次局部谱的峰值个数
+	float32_t pk_f[ZOOM_MAX_PEAKS];				// 峰值频率，单位 Hz，按幅度降序
+	float32_t pk_A[ZOOM_MAX_PEAKS];				// 峰值幅度，单位 V
+} zoom_slot_t;
+
+// Zoom-FFT 实例，每个分析通道一个（约 17KB），由调用者分配
+typedef struct{
+	zoom_slot_t slot[ZOOM_SLOTS];
+	float32_t mix[2][ZOOM_CHUNK];				// 混频结果，各槽共用
+	float32_t mid[2][ZOOM_OUT1];				// 第一级输出，各槽共用
+	float32_t out[2][ZOOM_OUT2];				// 第二级输出，各槽共用
+	float32_t p[ZOOM_LEN];						// 局部谱幅值平方，零频移到中央
+	float32_t floor[PEAK_FLOOR_NUM];			// 噪声基底中位数的抽样
+	float32_t fs;								// 输入采样率，单位 Hz
+} zoom_t;
+
+void zoom_init(void);
+void zoom_reset(zoom_t *zm);
+void zoom_set_rate(zoom_t *zm, float32_t fs);
+void zoom_center(zoom_t *zm, uint32_t slot, float32_t fc);
+uint8_t zoom_feed(zoom_t *zm, const uint16_t *x, uint32_t n, float32_t lsb, float32_t bias);
+uint32_t zoom_get(const zoom_t *zm, uint32_t slot, float32_t *f, float32_t *A);
+
+#endif
@@ -0,0 +1,417 @@
+#include "bench.h"
+#include "FFT.h"
+#include "track.h"
+#include "decim.h"
+#include "usart.h"
+#include "ACQ.h"
+#include "fft_plan.h"
+#include "mem_section.h"
+#include "adc_conv.h"
+
+static float32_t bench_spec[FFT_SIZE] MEM_SRAM1;	// 测试用频谱，FFT_SIZE / 2 个复数点；与采集缓冲区同在 SRAM1
+static float32_t bench_sram[FFT_SIZE] MEM_SRAM1;	// 内存争用测试的 SRAM1 输出缓冲区
+static float32_t bench_out[FFT_SIZE / 2];		// 测试用幅值输出
+static uint16_t bench_adc[FFT_SIZE];			// 测试用ADC帧，两个正弦叠加
+static volatile uint32_t bench_sink;			// 防止结果被优化掉
+static decim_t bench_decim;						// 测试用抽取器
+static analyzer_t bench_an[2];					// 成对变换测试用的两个分析器，与 an[0] 共用工作缓冲区
+
+extern analyzer_t an[];
+extern void arm_radix8_butterfly_f32(float32_t *pSrc, uint16_t fftLen, const float32_t *pCoef, uint16_t twidCoefModifier);
+
+
+/**
+ * @brief       使能 DWT 周期计数器
+ * @param       无
+ * @retval      无
+ */
+void bench_init(void)
+{
+	CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+	DWT->CYCCNT = 0;
+	DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+/**
+ * @brief       测量函数耗时
+ * @note		重复 BENCH_REPEAT 次取最小值，排除中断与首次取指的干扰
+ * @param       fn:	被测函数
+ * @retval      最少周期数
+ */
+uint32_t bench_measure(void (*fn)(void))
+{
+	uint32_t i, t, best = 0xFFFFFFFFU;
+
+	for(i = 0; i < BENCH_REPEAT; ++i)
+	{
+		t = BENCH_CYCLES();
+		fn();
+		t = BENCH_CYCLES() - t;
+		if(t < best)
+			best = t;
+	}
+	return best;
+}
+
+/**
+ * @brief       输出一项测试结果
+ * @param       name:	测试项名称
+ * @param		cycles:	周期数
+ * @retval      无
+ */
+void bench_report(const char *name, uint32_t cycles)
+{
+	printf("[bench] %-32s %8lu cyc  %8.1f us\r\n", name, (unsigned long)cycles,
+			(float)cycles * 1e6f / (float)SystemCoreClock);
+}
+
+/**
+ * @brief       找最大值下标，模拟峰值搜索
+ * @param       v:	数据
+ * @param		n:	点数
+ * @retval      最大值下标
+ */
+static uint32_t bench_argmax(const float32_t *v, uint32_t n)
+{
+	uint32_t k, idx = 0;
+	float32_t m = v[0];
+
+	for(k = 1; k < n; ++k)
+	{
+		if(v[k] > m)
+		{
+			m = v[k];
+			idx = k;
+		}
+	}
+	return idx;
+}
+
+/**
+ * @brief       旧流程：逐点求模后搜索峰值
+ */
+static void bench_case_mag(void)
+{
+	arm_cmplx_mag_f32(bench_spec, bench_out, FFT_SIZE / 2);
+	bench_sink = bench_argmax(bench_out, FFT_SIZE / 2);
+}
+
+/**
+ * @brief       新流程：在模平方上搜索峰值，仅对峰值及两侧共 3 个bin开方
+ */
+static void bench_case_mag_sq(void)
+{
+	uint32_t k, i;
+	float32_t m;
+
+	arm_cmplx_mag_squared_f32(bench_spec, bench_out, FFT_SIZE / 2);
+	k = bench_argmax(bench_out, FFT_SIZE / 2);
+	if(k == 0)
+		k = 1;
+	if(k == FFT_SIZE / 2 - 1)
+		k--;
+	for(i = k - 1; i <= k + 1; ++i)
+	{
+		arm_sqrt_f32(bench_out[i], &m);
+		bench_sink += (uint32_t)m;
+	}
+}
+
+/**
+ * @brief       全帧捕获：加窗、FFT、峰值搜索、相位差与最小二乘
+ */
+static void bench_case_frame(void)
+{
+	process_signal(&an[0], FFT_Feed(&an[0], bench_adc, 0));
+}
+
+/**
+ * @brief       两帧各做一次实数FFT
+ */
+static void bench_case_fft_two(void)
+{
+	FFT_start(&bench_an[0], bench_adc, BLACKMAN_HARRIS);
+	FFT_start(&bench_an[1], bench_adc, BLACKMAN_HARRIS);
+}
+
+/**
+ * @brief       两帧合为一次复数FFT再拆分
+ */
+static void bench_case_fft_pair(void)
+{
+	bench_sink += FFT_StartPair(&bench_an[0], &bench_an[1], bench_adc, bench_adc, BLACKMAN_HARRIS);
+}
+
+/**
+ * @brief       两帧完整分析，逐帧处理
+ */
+static void bench_case_frame_two(void)
+{
+	process_signal(&bench_an[0], bench_adc);
+	process_signal(&bench_an[1], bench_adc);
+}
+
+/**
+ * @brief       两帧完整分析，成对变换
+ */
+static void bench_case_frame_pair(void)
+{
+	process_pair(&bench_an[0], &bench_an[1], bench_adc, bench_adc);
+}
+
+#if (FFT_PIPELINES == (FFT_PIPE_F32 | FFT_PIPE_Q31))
+/**
+ * @brief       浮点流水线：码值转浮点加窗、实数FFT与幅值平方
+ */
+static void bench_case_fft_f32(void)
+{
+	FFT_start(&bench_an[0], bench_adc, BLACKMAN_HARRIS);
+	arm_cmplx_mag_squared_f32(bench_an[0].spec, bench_an[0].work->mag_sq.f, FFT_SIZE / 2);
+}
+
+/**
+ * @brief       定点流水线：块浮点加窗、q31 复数FFT与拆分、幅值平方
+ */
+static void bench_case_fft_q31(void)
+{
+	FFT_StartQ31(&bench_an[0], bench_adc, BLACKMAN_HARRIS);
+	arm_cmplx_mag_squared_q31(bench_an[0].work->buf.q, bench_an[0].work->mag_sq.q, FFT_SIZE / 2);
+}
+
+/**
+ * @brief       一帧完整分析，流水线由 bench_an[0] 的设置决定
+ */
+static void bench_case_frame_one(void)
+{
+	process_signal(&bench_an[0], bench_adc);
+}
+#endif
+
+#if (FFT_PIPELINES & FFT_PIPE_F32)
+/**
+ * @brief       码值转浮点后做一次实数FFT，输入输出均在 SRAM1
+ */
+static void bench_case_rfft_sram(void)
+{
+	arm_q15_to_float((const q15_t *)bench_adc, bench_spec, FFT_SIZE);
+	arm_rfft_fast_f32(&fft_plan_get(FFT_SIZE)->rfft, bench_spec, bench_sram, 0);
+}
+
+/**
+ * @brief       同上，输入输出在分析器工作缓冲区中，MEM_CCM 生效时位于 CCM
+ */
+static void bench_case_rfft_work(void)
+{
+	float32_t *buf = an[0].work->buf.f;
+
+	arm_q15_to_float((const q15_t *)bench_adc, buf, FFT_SIZE);
+	arm_rfft_fast_f32(&fft_plan_get(FFT_SIZE)->rfft, buf, buf + FFT_SIZE, 0);
+}
+
+/**
+ * @brief       内存争用：同一变换分别在 SRAM1 与工作缓冲区上运行，采集DMA停止与持续写入 SRAM1 时各测一次
+ * @note		DMA 持续写入时优先用三重交替模式，写入速率最高；多通道时退回 TIM3 触发。
+ *				测完停止采集并恢复采集源，main 随后按正常流程重新启动
+ * @param       无
+ * @retval      无
+ */
+static void bench_mem(void)
+{
+	uint32_t c_sram, c_work, c_sram_dma, c_work_dma;
+	uint8_t src = ACQ.src;
+	float32_t fs;
+
+	c_sram = bench_measure(bench_case_rfft_sram);
+	c_work = bench_measure(bench_case_rfft_work);
+
+	ACQ_SetSource(ACQ_SRC_TRIPLE);
+	ACQ_Start(ACQ_MODE_STREAM);
+	fs = ACQ_SampleRate();
+	c_sram_dma = bench_measure(bench_case_rfft_sram);
+	c_work_dma = bench_measure(bench_case_rfft_work);
+	ACQ_Stop();
+	ACQ_SetSource(src);
+
+	printf("[bench] work buffer in %s, DMA at %.0f Hz\r\n",
+			MEM_IN_CCM(an[0].work) ? "CCM" : "SRAM", fs);
+	bench_report("rfft SRAM1, DMA idle", c_sram);
+	bench_report("rfft SRAM1, DMA running", c_sram_dma);
+	bench_report("rfft work buf, DMA idle", c_work);
+	bench_report("rfft work buf, DMA running", c_work_dma);
+	bench_report("SRAM1 contention", c_sram_dma - c_sram);
+}
+#endif
+
+/**
+ * @brief       热点函数：码值转浮点加窗
+ */
+static void bench_case_k_win(void)
+{
+	adc_conv_win_f32(bench_adc, window_get(BLACKMAN_HARRIS)->half, WINDOW_TABLE_LEN / FFT_SIZE,
+						ADC_GAIN, ADC_OFFSET, bench_sram, NULL, FFT_SIZE);
+}
+
+/**
+ * @brief       热点函数：FFT_SIZE / 2 点复数FFT，主体为基 8 蝶形
+ */
+static void bench_case_k_cfft(void)
+{
+	arm_cfft_f32(&fft_plan_get(FFT_SIZE)->rfft.Sint, bench_sram, 0, 0);
+}
+
+/**
+ * @brief       热点函数：求模平方
+ */
+static void bench_case_k_mag_sq(void)
+{
+	arm_cmplx_mag_squared_f32(bench_spec, bench_out, FFT_SIZE / 2);
+}
+
+/**
+ * @brief       热点函数：两音时域最小二乘
+ */
+static void bench_case_k_lsq(void)
+{
+	static const float32_t f[2] = { 1234.5f, 3210.7f };
+	float32_t I[2], Q[2];
+
+	bench_sink += lsq_solve(&an[0].work->lsq, f, 2, SAMPLE_RATE, bench_adc, FFT_SIZE, ADC_GAIN, 1.65f, I, Q);
+}
+
+/**
+ * @brief       测量一个热点函数并注明其运行位置
+ * @note		同一函数在 Flash 与 SRAM2 中的耗时须分两次编译比较：切换 mem_section.h 中对应的 MEM_RAMFUNC_* 开关
+ * @param       name:	测试项名称
+ * @param		addr:	被测函数的地址
+ * @param		fn:		测试项
+ * @retval      无
+ */
+static void bench_kernel(const char *name, uint32_t addr, void (*fn)(void))
+{
+	uint32_t cycles = bench_measure(fn);
+
+	printf("[bench] %-32s %8lu cyc  %8.1f us  %s\r\n", name, (unsigned long)cycles,
+			(float)cycles * 1e6f / (float)SystemCoreClock, MEM_IN_FLASH(addr) ? "flash" : "SRAM2");
+}
+
+/**
+ * @brief       跟踪模式：同样长度的样本按 TRACK_BLOCK 分块更新
+ */
+static void bench_case_track(void)
+{
+	uint32_t i;
+
+	for(i = 0; i < FFT_SIZE; i += TRACK_BLOCK)
+		bench_sink += track_block(bench_adc + i);
+}
+
+/**
+ * @brief       抽取前端：DECIM_IN_BLOCK 个过采样样本经 CIC 与补偿FIR 得到一跳
+ */
+static void bench_case_decim(void)
+{
+	uint8_t g;
+	uint32_t i;
+
+	for(i = 0; i + DECIM_IN_BLOCK <= FFT_SIZE; i += DECIM_IN_BLOCK)
+		bench_sink += (decim_process(&bench_decim, bench_adc + i, 1, 0, &g) != NULL);
+}
+
+/**
+ * @brief       运行全部基准测试
+ * @param       无
+ * @retval      无
+ */
+void bench_run(void)
+{
+	uint32_t i, seed = 1U;
+	uint32_t c_mag, c_mag_sq, c_frame, c_track, c_zoom, c_decim, c_two, c_pair;
+#if (FFT_PIPELINES == (FFT_PIPE_F32 | FFT_PIPE_Q31))
+	uint32_t c_f32, c_q31;
+#endif
+
+	bench_init();
+
+	// 伪随机频谱
+	for(i = 0; i < FFT_SIZE; ++i)
+	{
+		seed = seed * 1664525U + 1013904223U;
+		bench_spec[i] = (float32_t)(int32_t)seed * (1.0f / 2147483648.0f);
+	}
+
+	// 1234.5 Hz 0.8 V 与 3210.7 Hz 0.5 V 叠加在 1.65 V 上
+	for(i = 0; i < FFT_SIZE; ++i)
+	{
+		float32_t v = 1.65f + 0.8f * arm_sin_f32(2.0f * PI * fmodf(1234.5f * i / SAMPLE_RATE, 1.0f))
+							+ 0.5f * arm_sin_f32(2.0f * PI * fmodf(3210.7f * i / SAMPLE_RATE, 1.0f));
+		bench_adc[i] = (uint16_t)(v / ADC_GAIN);
+	}
+
+	printf("\r\n[bench] FFT_SIZE = %d, per frame\r\n", FFT_SIZE);
+
+	c_mag = bench_measure(bench_case_mag);
+	c_mag_sq = bench_measure(bench_case_mag_sq);
+	bench_report("mag + peak search", c_mag);
+	bench_report("mag_squared + peak + 3 sqrt", c_mag_sq);
+	bench_report("saving", c_mag - c_mag_sq);
+
+	// 两次捕获结果一致即锁定，随后测量跟踪模式的同长度开销
+	c_frame = bench_measure(bench_case_frame);
+	FFT_SetZoom(&an[0], 1);
+	c_zoom = bench_measure(bench_case_frame);		// 取最小值，不含每 ZOOM_FRAMES 帧一次的局部谱FFT
+	FFT_SetZoom(&an[0], 0);
+	bench_report("full-frame + zoom mix/decimate", c_zoom);
+
+	// 两帧成对：一次 FFT_SIZE 点复数FFT 代替两次 FFT_SIZE 点实数FFT
+	for(i = 0; i < 2; ++i)
+		analyzer_init(&bench_an[i], an[0].work, NULL);
+	c_two = bench_measure(bench_case_fft_two);
+	c_pair = bench_measure(bench_case_fft_pair);
+	bench_report("2 x rfft, window + transform", c_two);
+	bench_report("paired cfft + split", c_pair);
+	c_two = bench_measure(bench_case_frame_two);
+	c_pair = bench_measure(bench_case_frame_pair);
+	bench_report("2 x full-frame", c_two);
+	bench_report("paired full-frame", c_pair);
+
+#if (FFT_PIPELINES == (FFT_PIPE_F32 | FFT_PIPE_Q31))
+	// 同一帧分别经浮点与定点流水线；工作缓冲区按只编译单条流水线时的大小折算
+	c_f32 = bench_measure(bench_case_fft_f32);
+	c_q31 = bench_measure(bench_case_fft_q31);
+	bench_report("f32 window + rfft + mag_sq", c_f32);
+	bench_report("q31 window + cfft/split + mag_sq", c_q31);
+	c_f32 = bench_measure(bench_case_frame_one);
+	FFT_SetPipeline(&bench_an[0], FFT_PIPE_Q31);
+	c_q31 = bench_measure(bench_case_frame_one);
+	FFT_SetPipeline(&bench_an[0], FFT_PIPE_F32);
+	bench_report("f32 full-frame", c_f32);
+	bench_report("q31 full-frame", c_q31);
+	printf("[bench] %-32s %8lu B  %8lu B\r\n", "work buffer f32 / q31",
+			(unsigned long)((2 * FFT_SIZE + FFT_SIZE / 2) * sizeof(float32_t)),
+			(unsigned long)((FFT_SIZE + FFT_SIZE / 2) * sizeof(q31_t)));
+#endif
+
+#if (FFT_PIPELINES & FFT_PIPE_F32)
+	bench_mem();
+#endif
+
+	// 热点函数，各自注明运行位置
+	bench_kernel("adc_conv_win_f32", (uint32_t)adc_conv_win_f32, bench_case_k_win);
+	bench_kernel("cfft (radix8 butterflies)", (uint32_t)arm_radix8_butterfly_f32, bench_case_k_cfft);
+	bench_kernel("cmplx_mag_squared", (uint32_t)arm_cmplx_mag_squared_f32, bench_case_k_mag_sq);
+	bench_kernel("lsq_solve, 2 tones", (uint32_t)lsq_solve, bench_case_k_lsq);
+
+	// 抽取前端按每个输入样本折算，与帧长无关
+	decim_reset(&bench_decim);
+	c_decim = bench_measure(bench_case_decim);
+	bench_report("CIC + FIR decimate, per frame", c_decim);
+	printf("[bench] %-32s %8.2f cyc/sample\r\n", "CIC + FIR decimate", (float)c_decim / (float)FFT_SIZE);
+	track_acquired(&an[0], 2);
+	if(track_acquired(&an[0], 2))
+	{
+		c_track = bench_measure(bench_case_track);
+		track_unlock();
+		bench_report("full-frame acquisition", c_frame);
+		bench_report("tracking, same samples", c_track);
+	}
+}
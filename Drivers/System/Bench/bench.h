@@ -0,0 +1,21 @@
+#ifndef __BENCH_H
+#define __BENCH_H
+
+#include "main.h"
+
+/*
+ * 基于 DWT 周期计数器的性能基准
+ * 每个测试项重复 BENCH_REPEAT 次取最小值，结果由串口输出，单位为 CPU 周期
+ */
+
+#define BENCH_ENABLE        0                   // 置 1 时上电后运行一次全部基准测试
+#define BENCH_REPEAT        8                   // 每项重复次数
+
+#define BENCH_CYCLES()      (DWT->CYCCNT)       // 当前周期计数
+
+void bench_init(void);
+uint32_t bench_measure(void (*fn)(void));
+void bench_report(const char *name, uint32_t cycles);
+void bench_run(void);
+
+#endif
@@ -0,0 +1,28 @@
+#include "mem_section.h"
+#include <string.h>
+
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+extern uint32_t _sccmram, _eccmram;			// 链接脚本给出的 CCM 段边界
+extern uint32_t _ssram2, _esram2;			// 链接脚本给出的 SRAM2 段边界
+extern uint32_t _siramfunc, _sramfunc, _eramfunc;	// RAM 函数在 Flash 中的加载地址与在 SRAM2 中的边界
+#endif
+
+
+/**
+ * @brief       清零 CCM 与 SRAM2 分区，复制 RAM 函数
+ * @note		Keil 下各执行区的 ZI 段与 RAM 中的代码由 __scatterload 在 main 之前处理完毕，本函数为空；
+ *				GCC 下这些分区为 NOLOAD，启动文件只处理 .data 与 .bss，须在使用其中变量、调用 RAM 函数之前调用一次。
+ *				复制代码后以 DSB/ISB 保证取指看到新内容。CCM 时钟 CCMDATARAMEN 复位后即已使能
+ * @param       无
+ * @retval      无
+ */
+void mem_init(void)
+{
+#if defined(__GNUC__) && !defined(__ARMCC_VERSION)
+	memset(&_sccmram, 0, (uint32_t)&_eccmram - (uint32_t)&_sccmram);
+	memset(&_ssram2, 0, (uint32_t)&_esram2 - (uint32_t)&_ssram2);
+	memcpy(&_sramfunc, &_siramfunc, (uint32_t)&_eramfunc - (uint32_t)&_sramfunc);
+	__DSB();
+	__ISB();
+#endif
+}
@@ -0,0 +1,59 @@
+#ifndef __MEM_SECTION_H
+#define __MEM_SECTION_H
+
+/*
+ * 内存分区
+ * STM32F407 的 RAM 分为三块：
+ *   SRAM1  0x20000000  112KB   DMA 可访问，采集缓冲区所在，DMA 搬运时与 CPU 在总线矩阵上争用
+ *   SRAM2  0x2001C000   16KB   DMA 可访问，RAM 中运行的函数也放在这里
+ *   CCM    0x10000000   64KB   仅 CPU 经 D 总线访问，零等待，DMA 与取指均不可达
+ * 只由 CPU 读写的大缓冲区（FFT 工作缓冲区、分析器历史与最小二乘状态）放入 CCM，避开 DMA 争用；
+ * DMA 目标只能放在 SRAM1/2。
+ * 各分区在 MDK-ARM/Signal_seperate.sct（Keil）与 STM32F407VETx_FLASH.ld.S（GCC）中定义，
+ * 标记的变量均为零初始化，不得带初始值
+ *
+ * RAM 中运行的热点函数
+ * 168MHz 下 Flash 有 5 个等待周期，靠 ART 预取与 1KB 指令缓存掩盖，循环体较大或跳转频繁时仍会停顿。
+ * 下列开关按需打开，选中的函数链接到 SRAM2 执行：Keil 下由 __scatterload 在 main 之前从 Flash 复制，
+ * GCC 下由 mem_init 复制。库函数按目标文件放置，本工程的函数用 MEM_RAMFUNC 标记。
+ * SRAM2 经 S 总线取指，与 SRAM1 上的采集DMA及 CCM 上的数据访问互不争用。
+ * 默认全部关闭，先用 bench 分别在 Flash 与 SRAM2 中测量，确有收益再打开。
+ * 本文件同时由分散加载文件与 GCC 链接脚本经预处理包含，MEM_LINKER 有定义时只保留开关
+ */
+
+#define MEM_CCM_ENABLE      1                   // 置 0 时 MEM_CCM 不生效，变量按默认规则放入 SRAM
+
+#define MEM_RAMFUNC_LSQ     0                   // lsq_solve：时域最小二乘的逐点投影
+#define MEM_RAMFUNC_RADIX8  0                   // arm_radix8_butterfly_f32：复数FFT的基 8 蝶形（库函数）
+#define MEM_RAMFUNC_MAG     0                   // arm_cmplx_mag_squared_f32：谱峰搜索用的功率谱（库函数）
+#define MEM_RAMFUNC_WIN     0                   // adc_conv_win_f32：码值转换与加窗
+
+#ifndef MEM_LINKER
+
+#include "main.h"
+
+#if defined(__CC_ARM)
+#define MEM_SECTION(name)   __attribute__((section(name), zero_init))	// ARMCC5 需显式声明为 ZI 段
+#else
+#define MEM_SECTION(name)   __attribute__((section(name)))				// armclang / GCC 中 .bss 前缀的段即为 ZI 段
+#endif
+
+#if MEM_CCM_ENABLE
+#define MEM_CCM             MEM_SECTION(".bss.ccmram")		// 仅 CPU 访问的缓冲区，放入 CCM
+#else
+#define MEM_CCM
+#endif
+#define MEM_SRAM1           MEM_SECTION(".bss.sram1")		// 放入 SRAM1，DMA 目标
+#define MEM_SRAM2           MEM_SECTION(".bss.sram2")		// 放入 SRAM2，DMA 目标
+
+// 函数放入 SRAM2 执行；段名与 HAL 的 __RAM_FUNC 相同，禁止内联以免被展开回 Flash 中的调用者
+#define MEM_RAMFUNC         __attribute__((section(".RamFunc"), noinline))
+
+#define MEM_IN_CCM(p)       (((uint32_t)(p) & 0xFFFF0000U) == 0x10000000U)	// 地址是否位于 CCM
+#define MEM_IN_FLASH(p)     (((uint32_t)(p) & 0xFFF00000U) == 0x08000000U)	// 地址是否位于 Flash
+
+void mem_init(void);
+
+#endif
+
+#endif
@@ -0,0 +1,120 @@
+#include "FFT.h"
+#include "test_signal.h"
+#include <pthread.h>
+#include <stdlib.h>
+#include <math.h>
+
+/*
+ * 多分析器并行
+ * NA 个分析器各有自己的 analyzer_work_t，分别在独立线程中连续分析 FRAMES 帧合成的双音信号；
+ * 结果须与同样的分析器依次串行运行时逐位相同，且最后一帧的频率、幅度、相位与注入值一致
+ */
+
+#define NA                  8					// 分析器（线程）数
+#define FRAMES              16				// 每个分析器分析的连续帧数
+#define FS                  40000.0
+#define TOL_F               0.01				// 频率误差上限，单位 Hz
+#define TOL_A               1e-3				// 幅度误差上限，单位 V
+#define TOL_PHI             5e-3				// 相位误差上限，单位 rad
+
+void dsp_tables_init(void);
+
+typedef struct{
+	analyzer_t an;
+	analyzer_work_t work;
+	test_tone_t tone[2];
+	uint16_t x[FRAMES][FFT_SIZE];
+	tone_t out[FRAMES][2];
+} channel_t;
+
+static channel_t ch[NA];
+static tone_t seq_out[NA][FRAMES][2];
+
+/**
+ * @brief       一个分析器从头分析全部帧
+ * @param       arg:	channel_t
+ * @retval      NULL
+ */
+static void *channel_run(void *arg)
+{
+	channel_t *c = arg;
+	uint32_t fr;
+
+	analyzer_init(&c->an, &c->work, NULL);
+	for(fr = 0; fr < FRAMES; fr++)
+	{
+		const uint16_t *x = FFT_Feed(&c->an, c->x[fr], fr == 0);
+		if(x != NULL)
+			process_signal(&c->an, x);
+		c->out[fr][0] = c->an.tones[0];
+		c->out[fr][1] = c->an.tones[1];
+	}
+	return NULL;
+}
+
+int main(void)
+{
+	pthread_t th[NA];
+	uint32_t i, k, fr, seed = 1;
+	uint32_t diff = 0, bad = 0;
+	double ef = 0, eA = 0, ephi = 0;
+
+	dsp_tables_init();
+	fft_plan_init();
+
+	// 各通道取不同的两音，两音相距数十个bin
+	for(i = 0; i < NA; i++)
+	{
+		channel_t *c = &ch[i];
+		c->tone[0] = (test_tone_t){ 800.0 + 1500.0 * test_urand(&seed), 0.3 + 0.5 * test_urand(&seed), 2 * M_PI * test_urand(&seed) };
+		c->tone[1] = (test_tone_t){ 3000.0 + 12000.0 * test_urand(&seed), 0.1 + 0.4 * test_urand(&seed), 2 * M_PI * test_urand(&seed) };
+		if(c->tone[1].A > c->tone[0].A)
+			c->tone[1].A = 0.5 * c->tone[0].A;		// 第一音为强音，与 tones[0] 对应
+		for(fr = 0; fr < FRAMES; fr++)
+			test_synth(c->x[fr], FFT_SIZE, (uint64_t)fr * FFT_SIZE, FS, c->tone, 2, 1.0);
+	}
+
+	// 串行参考
+	for(i = 0; i < NA; i++)
+	{
+		channel_run(&ch[i]);
+		for(fr = 0; fr < FRAMES; fr++)
+			for(k = 0; k < 2; k++)
+				seq_out[i][fr][k] = ch[i].out[fr][k];
+	}
+
+	// 并行：每个分析器一个线程，同时运行
+	for(i = 0; i < NA; i++)
+		pthread_create(&th[i], NULL, channel_run, &ch[i]);
+	for(i = 0; i < NA; i++)
+		pthread_join(th[i], NULL);
+
+	for(i = 0; i < NA; i++)
+	{
+		const channel_t *c = &ch[i];
+		uint64_t t0 = (uint64_t)(FRAMES - 1) * FFT_SIZE;
+
+		if(memcmp(seq_out[i], c->out, sizeof(c->out)) != 0)
+			diff++;
+		for(k = 0; k < 2; k++)
+		{
+			const tone_t *t = &c->out[FRAMES - 1][k];
+			double df = fabs(t->f - c->tone[k].f);
+			double dA = fabs(t->A - c->tone[k].A);
+			double dphi = fabs(test_wrap(t->phi - test_tone_phi(&c->tone[k], t0, FS)));
+
+			ef = fmax(ef, df);
+			eA = fmax(eA, dA);
+			ephi = fmax(ephi, dphi);
+			if(df > TOL_F || dA > TOL_A || dphi > TOL_PHI)
+			{
+				bad++;
+				printf("ch%u tone%u: f %.4f/%.4f  A %.5f/%.5f  phi %.4f/%.4f\n", i, k, t->f, c->tone[k].f,
+						t->A, c->tone[k].A, t->phi, test_tone_phi(&c->tone[k], t0, FS));
+			}
+		}
+	}
+	printf("analyzers %u  frames %u  mismatch vs sequential %u  max err f %.2e Hz  A %.2e V  phi %.2e rad  out of tol %u\n",
+			NA, FRAMES, diff, ef, eA, ephi, bad);
+	return (diff || bad) ? 1 : 0;
+}
@@ -0,0 +1,115 @@
+#include "arm_math.h"
+#include <stdlib.h>
+#include <math.h>
+
+/*
+ * 主机构建用的浮点FFT
+ * 代替预编译库中的 arm_cfft_f32 与 arm_rfft_fast_f32：双精度基 2 FFT，输入输出格式与缩放与 CMSIS 相同，
+ * 不读取实例中的旋转因子与位反转表（见 dsp_tables.c），只取其长度。输出总是自然顺序，bitReverseFlag 须为 1
+ */
+
+/**
+ * @brief       双精度原地复数FFT
+ * @param       z:		n 个复数，实虚交错
+ * @param		n:		长度，2 的幂
+ * @param		sign:	-1 为正变换，+1 为逆变换（不缩放）
+ * @retval      无
+ */
+static void fft_ref(double *z, uint32_t n, int sign)
+{
+	uint32_t i, j, k, len;
+
+	for(i = 1, j = 0; i < n; i++)
+	{
+		uint32_t bit = n >> 1;
+		for(; j & bit; bit >>= 1)
+			j ^= bit;
+		j |= bit;
+		if(i < j)
+		{
+			double tr = z[2 * i], ti = z[2 * i + 1];
+			z[2 * i] = z[2 * j];
+			z[2 * i + 1] = z[2 * j + 1];
+			z[2 * j] = tr;
+			z[2 * j + 1] = ti;
+		}
+	}
+	for(len = 2; len <= n; len <<= 1)
+	{
+		for(k = 0; k < len / 2; k++)
+		{
+			double wr = cos(2.0 * M_PI * k / len), wi = sign * sin(2.0 * M_PI * k / len);
+			for(i = k; i < n; i += len)
+			{
+				uint32_t m = i + len / 2;
+				double xr = z[2 * m] * wr - z[2 * m + 1] * wi;
+				double xi = z[2 * m] * wi + z[2 * m + 1] * wr;
+				z[2 * m] = z[2 * i] - xr;
+				z[2 * m + 1] = z[2 * i + 1] - xi;
+				z[2 * i] += xr;
+				z[2 * i + 1] += xi;
+			}
+		}
+	}
+}
+
+/**
+ * @brief       复数FFT，正变换不缩放，逆变换缩小 fftLen 倍
+ */
+void arm_cfft_f32(const arm_cfft_instance_f32 *S, float32_t *p1, uint8_t ifftFlag, uint8_t bitReverseFlag)
+{
+	uint32_t n = S->fftLen, i;
+	double *z = malloc(2 * n * sizeof(double));
+
+	(void)bitReverseFlag;
+	for(i = 0; i < 2 * n; i++)
+		z[i] = p1[i];
+	fft_ref(z, n, ifftFlag ? 1 : -1);
+	for(i = 0; i < 2 * n; i++)
+		p1[i] = (float32_t)(ifftFlag ? z[i] / n : z[i]);
+	free(z);
+}
+
+/**
+ * @brief       实数FFT，打包格式：[0] 为直流，[1] 为 n/2 处的实数值，其后第 k 个复数为 X[k]；逆变换缩小 n 倍
+ */
+void arm_rfft_fast_f32(const arm_rfft_fast_instance_f32 *S, float32_t *p, float32_t *pOut, uint8_t ifftFlag)
+{
+	uint32_t n = S->fftLenRFFT, k;
+	double *z = malloc(2 * n * sizeof(double));
+
+	if(!ifftFlag)
+	{
+		for(k = 0; k < n; k++)
+		{
+			z[2 * k] = p[k];
+			z[2 * k + 1] = 0.0;
+		}
+		fft_ref(z, n, -1);
+		pOut[0] = (float32_t)z[0];
+		pOut[1] = (float32_t)z[n];
+		for(k = 1; k < n / 2; k++)
+		{
+			pOut[2 * k] = (float32_t)z[2 * k];
+			pOut[2 * k + 1] = (float32_t)z[2 * k + 1];
+		}
+	}
+	else
+	{
+		z[0] = p[0];
+		z[1] = 0.0;
+		z[n] = p[1];
+		z[n + 1] = 0.0;
+		for(k = 1; k < n / 2; k++)
+		{
+			z[2 * k] = p[2 * k];
+			z[2 * k + 1] = p[2 * k + 1];
+			z[2 * (n - k)] = p[2 * k];
+			z[2 * (n - k) + 1] = -p[2 * k + 1];
+		}
+		fft_ref(z, n, 1);
+		for(k = 0; k < n; k++)
+			pOut[k] = (float32_t)(z[2 * k] / n);
+	}
+	free(z);
+}
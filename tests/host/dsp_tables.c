@@ -0,0 +1,93 @@
+#include <stdint.h>
+#include <math.h>
+
+/*
+ * 主机构建用的 CMSIS-DSP 常量表
+ * 工程只链接预编译的 arm_cortexM4lf_math.lib，源码树中没有 arm_common_tables.c；此处在启动时生成测试用到的表：
+ *   sinTable_f32                   sin(2*pi*i/512)，i = 0..512，供 arm_sin_f32 / arm_cos_f32 查表
+ *   twiddleCoef_N_q31              cos/sin(2*pi*i/N)，i < 3N/4，供 arm_cfft_q31 的基 4 蝶形与定点实数后处理
+ *   armBitRevIndexTable_fixed_N    q31 复数FFT的位反转交换对，以字节偏移存放（与 arm_bitreversal_32 的约定一致）
+ * 浮点变换由 dsp_fft.c 中的参考FFT代替，其旋转因子与位反转表只需占位。
+ * 不包含 arm_common_tables.h，以便以非 const 数组定义同名符号
+ */
+
+#define SIN_TABLE_SIZE      512					// 与 FAST_MATH_TABLE_SIZE 一致
+
+float sinTable_f32[SIN_TABLE_SIZE + 1];
+
+// q31 复数FFT的旋转因子与位反转表，N 为复数FFT长度
+#define Q31_TABLES(N)														\
+	int32_t twiddleCoef_##N##_q31[3 * (N) / 2];								\
+	uint16_t armBitRevIndexTable_fixed_##N[N];
+
+Q31_TABLES(128)
+Q31_TABLES(256)
+Q31_TABLES(512)
+Q31_TABLES(1024)
+Q31_TABLES(2048)
+Q31_TABLES(4096)
+
+// 浮点复数/实数FFT的表，参考FFT不读取，只为 fft_plan.c 中的实例提供地址
+#define F32_TABLES(N)														\
+	float twiddleCoef_##N[1];												\
+	uint16_t armBitRevIndexTable##N[1];
+
+F32_TABLES(128)
+F32_TABLES(256)
+F32_TABLES(512)
+F32_TABLES(1024)
+F32_TABLES(2048)
+F32_TABLES(4096)
+float twiddleCoef_rfft_256[1], twiddleCoef_rfft_512[1], twiddleCoef_rfft_1024[1],
+	twiddleCoef_rfft_2048[1], twiddleCoef_rfft_4096[1];
+
+/**
+ * @brief       生成 N 点 q31 复数FFT的旋转因子与位反转表
+ * @note		位反转表只列出 i < rev(i) 的交换对，长度 2 * 交换对数，与 ARMBITREVINDEXTABLE_FIXED_N_TABLE_LENGTH 相同
+ * @param       tw:		旋转因子，3N/2 个
+ * @param		br:		位反转表
+ * @param		n:		复数FFT长度
+ * @retval      无
+ */
+static void q31_tables_gen(int32_t *tw, uint16_t *br, uint32_t n)
+{
+	uint32_t i, j, r, bits = 0, len = 0;
+
+	for(i = 0; i < 3 * n / 4; i++)
+	{
+		double c = cos(2.0 * M_PI * i / n) * 2147483648.0, s = sin(2.0 * M_PI * i / n) * 2147483648.0;
+		tw[2 * i] = (int32_t)fmin(llround(c), 2147483647.0);
+		tw[2 * i + 1] = (int32_t)fmin(llround(s), 2147483647.0);
+	}
+	while((1U << bits) < n)
+		bits++;
+	for(i = 0; i < n; i++)
+	{
+		for(j = 0, r = 0; j < bits; j++)
+			r |= ((i >> j) & 1U) << (bits - 1 - j);
+		if(r > i)
+		{
+			br[len++] = (uint16_t)(8 * i);		// 每个 q31 复数 8 字节
+			br[len++] = (uint16_t)(8 * r);
+		}
+	}
+}
+
+/**
+ * @brief       生成全部表，须在使用 CMSIS-DSP 函数之前调用一次
+ * @param       无
+ * @retval      无
+ */
+void dsp_tables_init(void)
+{
+	unsigned i;
+
+	for(i = 0; i <= SIN_TABLE_SIZE; i++)
+		sinTable_f32[i] = (float)sin(2.0 * M_PI * i / SIN_TABLE_SIZE);
+	q31_tables_gen(twiddleCoef_128_q31, armBitRevIndexTable_fixed_128, 128);
+	q31_tables_gen(twiddleCoef_256_q31, armBitRevIndexTable_fixed_256, 256);
+	q31_tables_gen(twiddleCoef_512_q31, armBitRevIndexTable_fixed_512, 512);
+	q31_tables_gen(twiddleCoef_1024_q31, armBitRevIndexTable_fixed_1024, 1024);
+	q31_tables_gen(twiddleCoef_2048_q31, armBitRevIndexTable_fixed_2048, 2048);
+	q31_tables_gen(twiddleCoef_4096_q31, armBitRevIndexTable_fixed_4096, 4096);
+}
@@ -0,0 +1,70 @@
+/*
+ * 帧队列主机测试
+ * 生产者线程模拟DMA中断，按序推入 FQ_TEST_FRAMES 个描述符，队满时让出CPU后重试；
+ * 主线程作为消费者逐个取出，检查序号连续、描述符内容完整（三个字段由序号唯一确定）。
+ * 检查的是 fq_push/fq_pop 中屏障的发布顺序：若索引先于槽位内容可见，消费者会读到旧描述符。
+ * 构建与运行：make -C tests/host fq_test && tests/host/fq_test
+ */
+#include "frame_queue.h"
+#include <pthread.h>
+#include <sched.h>
+#include <stdio.h>
+
+#define FQ_TEST_FRAMES      200000              // 推入的帧数
+
+static frame_queue_t q;
+static uint16_t bufs[FQ_DEPTH][8];
+
+
+/**
+ * @brief       生产者线程
+ * @param       arg:	未使用
+ * @retval      NULL
+ */
+static void *producer(void *arg)
+{
+	uint32_t i;
+	frame_desc_t d;
+
+	(void)arg;
+	for(i = 0; i < FQ_TEST_FRAMES; ++i)
+	{
+		d.buf = bufs[i & (FQ_DEPTH - 1)];
+		d.seq = i;
+		d.tick = i * 3U;
+		while(!fq_push(&q, &d))
+			sched_yield();
+	}
+	return NULL;
+}
+
+int main(void)
+{
+	pthread_t t;
+	frame_desc_t d;
+	uint32_t expect = 0, bad = 0;
+
+	fq_init(&q);
+	if(pthread_create(&t, NULL, producer, NULL) != 0)
+	{
+		printf("pthread_create failed\n");
+		return 2;
+	}
+	while(expect < FQ_TEST_FRAMES)
+	{
+		if(!fq_pop(&q, &d))
+		{
+			sched_yield();
+			continue;
+		}
+		if(d.seq != expect || d.tick != expect * 3U || d.buf != bufs[expect & (FQ_DEPTH - 1)])
+			bad++;
+		expect++;
+	}
+	pthread_join(t, NULL);
+
+	// 队满重试也计入 drop，此处只作参考
+	printf("frames %u  bad %u  full retries %u  left %u\n",
+			(unsigned)expect, (unsigned)bad, (unsigned)q.drop, (unsigned)fq_count(&q));
+	return (bad == 0 && fq_count(&q) == 0) ? 0 : 1;
+}
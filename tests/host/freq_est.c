@@ -0,0 +1,118 @@
+#include "FFT.h"
+#include "test_signal.h"
+#include <stdlib.h>
+#include <math.h>
+
+/*
+ * 单帧插值DFT频率估计
+ *   1. 端到端：布莱克曼-哈里斯窗，PAIRS 组随机双音，每组只分析首帧（无前帧相位），
+ *      比较 FREQ_MODE_PHASE（幅值抛物线插值）与 FREQ_MODE_INTERP（插值DFT）的频率均方根误差
+ *   2. 偏差表：每种窗对 TRIALS 个随机偏移的单音做 FFT，由 interp_dft 查 window_table.c 中的偏差表，
+ *      检查估计偏移的最大误差，覆盖全部窗的表
+ */
+
+#define FS                  40000.0
+#define PAIRS               40					// 端到端的随机双音组数
+#define TRIALS              200					// 每种窗的单音次数
+#define TOL_GAIN            10.0				// 插值DFT的均方根误差须至少比抛物线插值小该倍数
+#define TOL_RMS_BIN         2e-4				// 插值DFT的均方根误差上限，单位 bin
+#define TOL_BIAS_BIN        5e-4				// 偏差表反查的最大误差，单位 bin
+
+void dsp_tables_init(void);
+
+static analyzer_work_t work;
+static analyzer_t an;
+static uint16_t x[FFT_SIZE];
+
+/**
+ * @brief       随机双音首帧的频率均方根误差
+ * @param       n:		FFT长度
+ * @param		mode:	频率估计方式
+ * @retval      两音合计的均方根误差，单位 Hz
+ */
+static double pair_rms(uint16_t n, uint8_t mode)
+{
+	uint32_t i, k, seed = 5;
+	double e = 0;
+
+	for(i = 0; i < PAIRS; i++)
+	{
+		test_tone_t tone[2];
+
+		tone[0] = (test_tone_t){ 1000.0 + 7000.0 * test_urand(&seed), 0.8, -0.3 };	// 离直流至少 6 个bin（N=256），避开直流与负频率镜像的主瓣
+		tone[1] = (test_tone_t){ tone[0].f + 1500.0 + 8000.0 * test_urand(&seed), 0.5, 1.0 };
+		test_synth(x, n, 0, FS, tone, 2, 1.0);
+		analyzer_init(&an, &work, NULL);
+		FFT_SetSize(&an, n);
+		FFT_SetFreqMode(&an, mode);
+		process_signal(&an, x);
+		for(k = 0; k < 2; k++)
+			e += (an.tones[k].f - tone[k].f) * (an.tones[k].f - tone[k].f);
+	}
+	return sqrt(e / (2 * PAIRS));
+}
+
+/**
+ * @brief       一种窗的偏差表反查误差
+ * @param       type:	窗类型
+ * @retval      估计偏移的最大误差，单位 bin
+ */
+static double bias_err(uint8_t type)
+{
+	const uint16_t n = FFT_SIZE;
+	uint32_t i, j, k, seed = 11;
+	double e = 0;
+
+	analyzer_init(&an, &work, NULL);
+	for(i = 0; i < TRIALS; i++)
+	{
+		test_tone_t tone = { (100.5 + 1500.0 * test_urand(&seed)) * FS / n, 0.8, 2 * M_PI * test_urand(&seed) };
+		const float32_t *X;
+		float32_t best = 0;
+
+		test_synth(x, n, 0, FS, &tone, 1, 0.0);
+		FFT_start(&an, x, type);
+		X = an.spec;
+		for(j = 2, k = 2; j < n / 2 - 2; j++)
+		{
+			float32_t m = X[2 * j] * X[2 * j] + X[2 * j + 1] * X[2 * j + 1];
+			if(m > best)
+			{
+				best = m;
+				k = j;
+			}
+		}
+		e = fmax(e, fabs(k + interp_dft(an.window, &X[2 * k]) - tone.f * n / FS));
+	}
+	return e;
+}
+
+int main(void)
+{
+	static const uint16_t sizes[] = { 256, 4096 };
+	static const char *names[] = { "Hann", "Hamming", "Blackman", "Blackman-Harris", "Kaiser", "Flat-top" };
+	uint32_t s, bad = 0;
+	uint8_t type;
+
+	dsp_tables_init();
+	fft_plan_init();
+	for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		uint16_t n = sizes[s];
+		double bin = FS / n;
+		double rp = pair_rms(n, FREQ_MODE_PHASE), ri = pair_rms(n, FREQ_MODE_INTERP);
+
+		printf("N=%4u first-frame rms error: parabolic %.4f Hz  interp-DFT %.4f Hz  (bin %.2f Hz)\n", n, rp, ri, bin);
+		if(ri * TOL_GAIN > rp || ri > TOL_RMS_BIN * bin)
+			bad++;
+	}
+	for(type = 1; type <= WINDOW_TYPE_NUM; type++)
+	{
+		double e = bias_err(type);
+		printf("%-16s bias table max error %.2e bin\n", names[type - 1], e);
+		if(e > TOL_BIAS_BIN)
+			bad++;
+	}
+	printf("out of tol %u\n", bad);
+	return bad ? 1 : 0;
+}
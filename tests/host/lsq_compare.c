@@ -0,0 +1,125 @@
+#include "lsq.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+
+/*
+ * 时域最小二乘两种正规矩阵算法的精度对比
+ * lsq.c 编译两次：LSQ_GRAM_CLOSED_FORM=1 为 lsq_solve（闭式 Gram），
+ * LSQ_GRAM_CLOSED_FORM=0 并将导出函数改名为 lsq_iter_* 为逐点累加版本（见 Makefile）。
+ * 对 256/1024/4096 点、若干典型频率组合各做 TRIALS 次随机试验（12 位量化加 ±0.5LSB 噪声），
+ * 输出两者相对真值的最大幅度、相位误差，以及两者之间的最大幅度差 |A_closed - A_iter|
+ */
+
+#define FS                  40000.0				// 采样率
+#define VREF                3.3					// ADC 满量程
+#define TRIALS              300					// 每种情况的试验次数
+#define MAX_N               4096
+
+uint8_t lsq_iter_solve(lsq_work_t *w, const float32_t *f, uint32_t K, float32_t fs, const uint16_t *x, uint32_t n,
+				float32_t lsb, float32_t bias, float32_t *I, float32_t *Q);
+void dsp_tables_init(void);
+
+static uint16_t buf[MAX_N];
+static lsq_work_t work;
+
+static const char *case_name[] = {"2 tones random", "2 tones 1.5-2.5 bins", "3 tones random", "1 tone + f2=0.001"};
+
+static double urand(void)
+{
+	return rand() / (double)RAND_MAX;
+}
+
+/**
+ * @brief       生成一组随机音
+ * @param       f, A, P: 输出频率、幅度、相位
+ * @param       K: 音数
+ * @param       n: 点数
+ * @param       spaced: 非 0 时要求频率间隔不小于 3 bin
+ * @retval      无
+ */
+static void random_tones(double *f, double *A, double *P, int K, uint32_t n, int spaced)
+{
+	double bin = FS / n;
+	int a, b, ok;
+	do{
+		for(a = 0; a < K; a++)
+		{
+			f[a] = 3 * bin + urand() * (FS / 2 - 6 * bin);
+			A[a] = 0.1 + urand() * 0.4;
+			P[a] = urand() * 2 * M_PI - M_PI;
+		}
+		ok = 1;
+		for(a = 0; a < K && spaced; a++)
+			for(b = a + 1; b < K; b++)
+				if(fabs(f[a] - f[b]) < 3 * bin)
+					ok = 0;
+	}while(!ok);
+}
+
+int main(void)
+{
+	static const uint32_t sizes[] = {4096, 1024, 256};
+	uint32_t si, t, n;
+	int cas, tr, k, K;
+
+	dsp_tables_init();
+	srand(1);
+	printf("%6s %-22s %10s %10s %14s %10s %10s\n", "N", "case", "Aerr clos", "Aerr iter", "|Aclos-Aiter|", "Perr clos", "Perr iter");
+	for(si = 0; si < sizeof(sizes) / sizeof(sizes[0]); si++)
+	{
+		n = sizes[si];
+		for(cas = 0; cas < 4; cas++)
+		{
+			double eAc = 0, eAi = 0, ePc = 0, ePi = 0, dA = 0;
+			K = (cas == 2) ? 3 : 2;
+			for(tr = 0; tr < TRIALS; tr++)
+			{
+				double f[3], A[3], P[3], mean = 0;
+				float32_t ff[3], Ic[3], Qc[3], Ii[3], Qi[3];
+
+				random_tones(f, A, P, K, n, cas != 1);
+				if(cas == 1)
+					f[1] = f[0] + (1.5 + urand()) * FS / n;		// 两音相距 1.5~2.5 bin
+				if(cas == 3)
+				{
+					f[1] = 0.001;								// process_signal 中“无第二音”的占位频率
+					A[1] = 0;
+				}
+				for(t = 0; t < n; t++)
+				{
+					double v = VREF / 2;
+					for(k = 0; k < K; k++)
+						v += A[k] * cos(2 * M_PI * f[k] * t / FS + P[k]);
+					v += (urand() - 0.5) * VREF / 4096;
+					buf[t] = (uint16_t)lrint(v / VREF * 4096);
+					mean += buf[t];
+				}
+				mean = mean / n * VREF / 4096;
+				for(k = 0; k < K; k++)
+					ff[k] = (float32_t)f[k];
+
+				lsq_solve(&work, ff, K, FS, buf, n, VREF / 4096, mean, Ic, Qc);
+				lsq_iter_solve(&work, ff, K, FS, buf, n, VREF / 4096, mean, Ii, Qi);
+				for(k = 0; k < K; k++)
+				{
+					double Ac, Ai, ec, ei;
+					if(cas == 3 && k == 1)
+						continue;
+					// I*cos + Q*sin = A*cos(wt - phi)，phi = atan2(Q, I) = -P
+					Ac = hypot(Ic[k], Qc[k]);
+					Ai = hypot(Ii[k], Qi[k]);
+					ec = fabs(remainder(atan2(Qc[k], Ic[k]) + P[k], 2 * M_PI));
+					ei = fabs(remainder(atan2(Qi[k], Ii[k]) + P[k], 2 * M_PI));
+					eAc = fmax(eAc, fabs(Ac - A[k]));
+					eAi = fmax(eAi, fabs(Ai - A[k]));
+					ePc = fmax(ePc, ec);
+					ePi = fmax(ePi, ei);
+					dA = fmax(dA, fabs(Ac - Ai));
+				}
+			}
+			printf("%6u %-22s %10.2e %10.2e %14.2e %10.2e %10.2e\n", n, case_name[cas], eAc, eAi, dA, ePc, ePi);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,79 @@
+#include "FFT.h"
+#include "test_signal.h"
+#include <stdlib.h>
+#include <math.h>
+
+/*
+ * 成对变换
+ * NCH 个通道逐点交错，经 process_channels 分析：通道 0、1 共用工作缓冲区成对变换，通道 2 单独分析。
+ * 通道 1 与通道 0 频率相同，各音相位超前 XPHI；检查
+ *   1. 各通道结果与各自独立逐帧 process_signal 的结果一致
+ *   2. 通道 1 的 xphi 还原出注入的相位差，未成对的通道 xphi 为 0
+ */
+
+#define FS                  40000.0
+#define NCH                 3
+#define FRAMES              3
+#define XPHI                1.2					// 通道 1 相对通道 0 的相位差，单位 rad
+#define TOL_F               1e-3				// 与逐帧结果的频率差上限，单位 Hz
+#define TOL_A               1e-4				// 与逐帧结果的幅度相对差上限
+#define TOL_PHI             1e-3				// 与逐帧结果的相位差及 xphi 误差上限，单位 rad
+
+void dsp_tables_init(void);
+
+static analyzer_work_t work, solo_work[NCH];
+static analyzer_t an[NCH], solo[NCH];
+static uint16_t frame[NCH][FFT_SIZE];
+static uint16_t scan[FFT_SIZE * NCH];
+
+int main(void)
+{
+	const test_tone_t tone[NCH][2] = {
+		{ { 1234.5, 0.8, 0.3 },        { 3210.7, 0.4, -1.0 } },
+		{ { 1234.5, 0.6, 0.3 + XPHI }, { 3210.7, 0.3, -1.0 + XPHI } },
+		{ { 2500.2, 0.5, 2.0 },        { 7000.9, 0.2, 0.5 } },
+	};
+	uint32_t c, i, k, fr, bad = 0;
+	double ef = 0, eA = 0, ephi = 0, ex = 0;
+
+	dsp_tables_init();
+	fft_plan_init();
+	for(c = 0; c < NCH; c++)
+	{
+		analyzer_init(&an[c], &work, NULL);				// 共用工作缓冲区，相邻通道可成对
+		analyzer_init(&solo[c], &solo_work[c], NULL);
+	}
+
+	for(fr = 0; fr < FRAMES; fr++)
+	{
+		for(c = 0; c < NCH; c++)
+		{
+			test_synth(frame[c], FFT_SIZE, (uint64_t)fr * FFT_SIZE, FS, tone[c], 2, 1.0);
+			for(i = 0; i < FFT_SIZE; i++)
+				scan[i * NCH + c] = frame[c][i];
+			process_signal(&solo[c], FFT_Feed(&solo[c], frame[c], fr == 0));
+		}
+		if(process_channels(an, NCH, scan, fr == 0) != (1U << NCH) - 1)
+			bad++;
+
+		for(c = 0; c < NCH; c++)
+		{
+			for(k = 0; k < 2; k++)
+			{
+				const tone_t *p = &an[c].tones[k], *s = &solo[c].tones[k];
+				ef = fmax(ef, fabs(p->f - s->f));
+				eA = fmax(eA, fabs(p->A - s->A) / s->A);
+				ephi = fmax(ephi, fabs(test_wrap(p->phi - s->phi)));
+			}
+		}
+		ex = fmax(ex, fabs(test_wrap(an[1].xphi - XPHI)));
+		if(an[0].xphi != 0.0f || an[2].xphi != 0.0f)
+			bad++;
+		printf("frame %u  xphi ch1 %.5f (injected %.5f)  ch2 %.1f\n", fr, an[1].xphi, XPHI, an[2].xphi);
+	}
+	if(ef > TOL_F || eA > TOL_A || ephi > TOL_PHI || ex > TOL_PHI)
+		bad++;
+	printf("paired vs per-frame: max df %.2e Hz  dA %.2e rel  dphi %.2e rad   xphi err %.2e rad  out of tol %u\n",
+			ef, eA, ephi, ex, bad);
+	return bad ? 1 : 0;
+}
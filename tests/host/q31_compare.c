@@ -0,0 +1,104 @@
+#include "FFT.h"
+#include "test_signal.h"
+#include <stdlib.h>
+#include <math.h>
+
+/*
+ * 定点流水线与浮点流水线的对比
+ * 同一组主机合成的测试向量分别经浮点（参考FFT）与块浮点 q31（CMSIS arm_cfft_q31 加 fft_q31_split）分析：
+ *   1. 频谱：q31 频谱按 qscale 换算后相对浮点频谱的最大误差，以浮点频谱最大模值归一；
+ *      直流主瓣内的 bin 不计，两条流水线去直流的取整不同，残余直流在此处有差别，峰值搜索也不使用这些 bin
+ *   2. 结果：强音 0.8V 加 -58dB 的弱音，连续三帧后两条流水线给出的频率、幅度、相位之差及相对注入值的误差
+ * 长度取 256 ~ 4096
+ */
+
+#define FS                  40000.0
+#define FRAMES              3
+#define SPEC_SKIP           8					// 频谱比较跳过的前几个数（直流附近 4 个复数bin）
+#define WEAK_DB             (-58.0)				// 弱音相对强音的电平
+#define TOL_SPEC            1e-5				// 频谱相对误差上限
+#define TOL_F               0.01				// 两条流水线频率之差上限，单位 Hz
+#define TOL_A               1e-3				// 两条流水线幅度相对差上限
+#define TOL_PHI             2e-3				// 两条流水线相位之差上限，单位 rad
+
+void dsp_tables_init(void);
+
+static analyzer_work_t work;
+static analyzer_t an;
+static uint16_t x[FRAMES][FFT_SIZE];
+static float32_t spec[FFT_SIZE];
+
+/**
+ * @brief       以指定流水线分析全部帧
+ * @param       n:		FFT长度
+ * @param		pipe:	FFT_PIPE_F32 或 FFT_PIPE_Q31
+ * @param		out:	最后一帧的结果
+ * @retval      无
+ */
+static void run(uint16_t n, uint8_t pipe, tone_t *out)
+{
+	uint32_t fr;
+
+	analyzer_init(&an, &work, NULL);
+	FFT_SetSize(&an, n);
+	FFT_SetPipeline(&an, pipe);
+	for(fr = 0; fr < FRAMES; fr++)
+		process_signal(&an, x[fr]);
+	out[0] = an.tones[0];
+	out[1] = an.tones[1];
+}
+
+int main(void)
+{
+	static const uint16_t sizes[] = { 256, 512, 1024, 2048, 4096 };
+	const test_tone_t tone[2] = {
+		{ 1234.5, 0.8, 0.3 },
+		{ 3210.7, 0.8 * 1.0e-3 * 1.2589254117941673, -1.0 },	// 0.8 * 10^(-58/20)
+	};
+	uint32_t s, i, k, fr, bad = 0;
+
+	dsp_tables_init();
+	fft_plan_init();
+	printf("%5s %10s | %9s %9s %9s | %9s %9s %9s\n", "N", "spec rel", "df1", "dA1 rel", "dphi1", "df2", "dA2 rel", "dphi2");
+	for(s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++)
+	{
+		uint16_t n = sizes[s];
+		double e = 0, m = 0, d[2][3];
+		tone_t tf[2], tq[2];
+
+		// 各帧相隔一个帧移，与采集流送入分析器的节奏相同
+		analyzer_init(&an, &work, NULL);
+		FFT_SetSize(&an, n);
+		for(fr = 0; fr < FRAMES; fr++)
+			test_synth(x[fr], n, (uint64_t)fr * FFT_GetHop(&an), FS, tone, 2, 1.0);
+
+		// 同一帧的两种频谱
+		FFT_start(&an, x[0], BLACKMAN_HARRIS);
+		memcpy(spec, work.buf.f, n * sizeof(float32_t));
+		FFT_StartQ31(&an, x[0], BLACKMAN_HARRIS);
+		for(i = SPEC_SKIP; i < n; i++)
+		{
+			e = fmax(e, fabs(work.buf.q[i] * an.qscale - spec[i]));
+			m = fmax(m, fabs(spec[i]));
+		}
+
+		run(n, FFT_PIPE_F32, tf);
+		run(n, FFT_PIPE_Q31, tq);
+		for(k = 0; k < 2; k++)
+		{
+			d[k][0] = fabs(tq[k].f - tf[k].f);
+			d[k][1] = fabs(tq[k].A - tf[k].A) / tf[k].A;
+			d[k][2] = fabs(test_wrap(tq[k].phi - tf[k].phi));
+			if(d[k][0] > TOL_F || d[k][1] > TOL_A || d[k][2] > TOL_PHI)
+				bad++;
+		}
+		if(e / m > TOL_SPEC)
+			bad++;
+		printf("%5u %10.2e | %9.2e %9.2e %9.2e | %9.2e %9.2e %9.2e\n", n, e / m,
+				d[0][0], d[0][1], d[0][2], d[1][0], d[1][1], d[1][2]);
+		printf("      q31 tones: %.4f Hz %.5f V | %.4f Hz %.6f V   injected %.4f Hz %.5f V | %.4f Hz %.6f V\n",
+				tq[0].f, tq[0].A, tq[1].f, tq[1].A, tone[0].f, tone[0].A, tone[1].f, tone[1].A);
+	}
+	printf("out of tol %u\n", bad);
+	return bad ? 1 : 0;
+}
@@ -0,0 +1,32 @@
+#ifndef __CMSIS_COMPILER_H
+#define __CMSIS_COMPILER_H
+
+/* 主机构建用的 cmsis_compiler.h 替身：CMSIS-DSP 头文件引用的编译器宏与饱和内建函数的可移植实现 */
+
+#include <stdint.h>
+
+#define __ASM               __asm
+#define __INLINE            inline
+#define __STATIC_INLINE     static inline
+#define __STATIC_FORCEINLINE    static inline __attribute__((always_inline))
+#define __ALIGNED(x)        __attribute__((aligned(x)))
+#define __WEAK              __attribute__((weak))
+#define __PACKED            __attribute__((packed))
+#define __RESTRICT          __restrict
+#define __USED              __attribute__((used))
+#define __NOP()
+#define __CLZ               __builtin_clz
+
+static inline int32_t __SSAT(int32_t v, uint32_t b)
+{
+	int32_t mx = (1 << (b - 1)) - 1, mn = -(1 << (b - 1));
+	return v > mx ? mx : (v < mn ? mn : v);
+}
+
+static inline uint32_t __USAT(int32_t v, uint32_t b)
+{
+	int32_t mx = (1 << b) - 1;
+	return v > mx ? (uint32_t)mx : (v < 0 ? 0U : (uint32_t)v);
+}
+
+#endif
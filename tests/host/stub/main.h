@@ -0,0 +1,12 @@
+#ifndef __MAIN_H
+#define __MAIN_H
+
+/* 主机构建用的 main.h 替身：只提供驱动源码在 PC 上编译所需的最小定义，不引入 HAL */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#define __IO                volatile
+
+#endif
@@ -0,0 +1,61 @@
+#include "test_signal.h"
+#include <math.h>
+
+/**
+ * @brief       线性同余随机数，各线程各用一个种子，结果与调用顺序无关
+ * @param       seed:	种子，原地更新
+ * @retval      [0, 1) 均匀分布
+ */
+double test_urand(uint32_t *seed)
+{
+	*seed = *seed * 1664525U + 1013904223U;
+	return (*seed >> 8) / 16777216.0;
+}
+
+/**
+ * @brief       相位折叠到 [-pi, pi)
+ * @param       phi:	相位，单位 rad
+ * @retval      折叠后的相位
+ */
+double test_wrap(double phi)
+{
+	return phi - 2.0 * M_PI * floor(phi / (2.0 * M_PI) + 0.5);
+}
+
+/**
+ * @brief       合成一帧量化样本
+ * @param       x:		输出，n 个码值
+ * @param		n:		点数
+ * @param		t0:		首个样本在整个流中的序号，连续帧依次递增 n
+ * @param		fs:		采样率，单位 Hz
+ * @param		tone:	各音
+ * @param		K:		音数
+ * @param		noise:	叠加的均匀噪声峰峰值，单位 LSB；为 0 时只有量化误差
+ * @retval      无
+ */
+void test_synth(uint16_t *x, uint32_t n, uint64_t t0, double fs, const test_tone_t *tone, uint32_t K, double noise)
+{
+	uint32_t i, k, seed = (uint32_t)t0 * 2654435761U + 1U;
+
+	for(i = 0; i < n; i++)
+	{
+		double v = TEST_VREF / 2;
+		for(k = 0; k < K; k++)
+			v += tone[k].A * cos(2.0 * M_PI * tone[k].f * (double)(t0 + i) / fs + tone[k].p);
+		v = v / TEST_LSB + noise * (test_urand(&seed) - 0.5);
+		x[i] = (uint16_t)lrint(fmin(fmax(v, 0.0), 4095.0));
+	}
+}
+
+/**
+ * @brief       分析器对某音应报告的相位
+ * @note		分析器的模型为 A*cos(w*t - phi)，t 从帧首起算，故 phi = -(2*pi*f*t0/fs + p)
+ * @param       tone:	合成用的音
+ * @param		t0:		帧首样本序号
+ * @param		fs:		采样率，单位 Hz
+ * @retval      相位，单位 rad，折叠到 [-pi, pi)
+ */
+double test_tone_phi(const test_tone_t *tone, uint64_t t0, double fs)
+{
+	return test_wrap(-(2.0 * M_PI * tone->f * (double)t0 / fs + tone->p));
+}
@@ -0,0 +1,26 @@
+#ifndef _TEST_SIGNAL_H
+#define _TEST_SIGNAL_H
+
+#include <stdint.h>
+
+/*
+ * 主机测试共用的信号合成
+ * 按 12 位 ADC（满量程 TEST_VREF，中点偏置）量化若干余弦音之和，可叠加 ±0.5LSB 均匀噪声
+ */
+
+#define TEST_VREF           3.3					// ADC 满量程，单位 V
+#define TEST_LSB            (TEST_VREF / 4096.0)	// 每个码值对应的电压
+
+// 合成用的音：A*cos(2*pi*f*t/fs + p)，t 为样本序号
+typedef struct{
+	double f;
+	double A;
+	double p;
+} test_tone_t;
+
+void test_synth(uint16_t *x, uint32_t n, uint64_t t0, double fs, const test_tone_t *tone, uint32_t K, double noise);
+double test_tone_phi(const test_tone_t *tone, uint64_t t0, double fs);
+double test_wrap(double phi);
+double test_urand(uint32_t *seed);
+
+#endif